@@ -6,15 +6,15 @@
 #include "../Local.hlsli"
 #include "../Util/PBR.hlsli"
 
-inline float3 Normal(in MyAttr attr) {
-    float2 uv = GetUV(attr);
-    float3 worldNormal = normalize(mul(GetNormal(attr), (float3x3)ObjectToWorld4x3()));
-    float4 tangent4 = GetTangent(attr);
+inline float3 Normal(in TriangleAttributes tri, in MaterialRecord material) {
+    float2 uv = tri.uv;
+    float3 worldNormal = normalize(mul(tri.normal, (float3x3)ObjectToWorld4x3()));
+    float4 tangent4 = tri.tangent;
     float3 tangent = normalize(mul(tangent4.xyz, (float3x3)ObjectToWorld4x3())) * tangent4.w;
 
     float3 binormal = normalize(cross(worldNormal, tangent));
 
-    float3 normal = SampleTexture(normalMap, samLinear, uv).rgb;
+    float3 normal = SampleMaterialTexture(material.normalIndex, uv).rgb;
 
     float3 N = normal.x * tangent.xyz + normal.y * binormal.xyz + normal.z * worldNormal.xyz;
 
@@ -23,13 +23,15 @@ inline float3 Normal(in MyAttr attr) {
 
 [shader("closesthit")] void ClosestHit_Normal(inout RayPayload payload, in MyAttr attr) {
     float3 hitPosition = hitWorldPosition();
-    float2 uv = GetUV(attr);
-    float3 N = normalize(Normal(attr));
+    TriangleAttributes tri = GetTriangleAttributes(attr);
+    float2 uv = tri.uv;
+    MaterialRecord material = GetMaterial();
+    float3 N = normalize(Normal(tri, material));
     float3 L = normalize(g_sceneCB.lightPosition.xyz);
     float3 V = normalize(hitPosition - g_sceneCB.cameraPosition.xyz);
 
-    float2 metallicRoughness = SampleTexture(metallicRoughnessMap, samLinear, uv).rg;
-    float3 albedoColor = SampleTexture(albedoTex, samLinear, uv).rgb;
+    float2 metallicRoughness = SampleMaterialTexture(material.metallicRoughnessIndex, uv).rg;
+    float3 albedoColor = SampleMaterialTexture(material.albedoIndex, uv).rgb;
 
     LightingInfo info;
     info.N = N;
@@ -45,7 +47,7 @@ inline float3 Normal(in MyAttr attr) {
     Ray shadowRay;
     shadowRay.origin = hitPosition;
     shadowRay.direction = L;
-    float factor = ShadowRayCast(shadowRay, payload.recursionCount) ? 0.1 : 1.0;
+    float factor = ShadowRayCast(shadowRay) ? 0.1 : 1.0;
 
     payload.color.rgb = color * factor;
     payload.color.a = 1.0;
@@ -10,21 +10,18 @@
     //p[^擾
     float3 hitPosition = hitWorldPosition();
     float3 currentRayDirection = WorldRayDirection();
-    float3 N = GetNormal(attr);
+    TriangleAttributes tri = GetTriangleAttributes(attr);
+    float3 N = tri.normal;
     float3 L = normalize(g_sceneCB.lightPosition.xyz);
-    float2 uv = GetUV(attr);
+    float2 uv = tri.uv;
     float3 V = normalize(hitPosition - g_sceneCB.cameraPosition.xyz);
-    float3 albedoColor = SampleTexture(albedoTex, samLinear, uv).rgb;
-    float2 metallicRoughness = SampleTexture(metallicRoughnessMap, samLinear, uv).rg;
+    MaterialRecord material = GetMaterial();
+    float3 albedoColor = SampleMaterialTexture(material.albedoIndex, uv).rgb;
+    float2 metallicRoughness = SampleMaterialTexture(material.metallicRoughnessIndex, uv).rg;
 
     //eɂĂ邩
     Ray shadowRay = { hitPosition, L };
-    float factor = ShadowRayCast(shadowRay, payload.recursionCount) ? 0.5 : 1.0;
-
-    //񎟃CLXg
-    Ray secondRay;
-    secondRay.origin = hitPosition;
-    secondRay.direction = reflect(currentRayDirection, N);
+    float factor = ShadowRayCast(shadowRay) ? 0.5 : 1.0;
 
     LightingInfo info;
     info.N = N;
@@ -36,15 +33,13 @@
     info.roughness = metallicRoughness.g;
 
     float3 color = Lighting(info);
-
-    //ːF̎擾
-    float3 reflectColor = RayCast(secondRay, payload.recursionCount).rgb;
-    color.rgb += reflectColor * 0.5;
-
     color.rgb *= factor;
-    color = saturate(color);
 
-    payload.color = float4(color, 1.0);
+    //˂̓CVF[_[Ŕ΂
+    payload.color = float4(saturate(color), 1.0);
+    payload.nextOrigin = hitPosition;
+    payload.nextDirection = reflect(currentRayDirection, N);
+    payload.reflectance = 0.5 * factor;
 }
 
 #endif //! SHADER_RAYTRACING_HITGROUP_CLOSESTHIT_CLOSESTHIT_PLANE_HLSL
@@ -5,19 +5,21 @@
 #include "../Util/Global.hlsli"
 #include "../Util/GlobalCompat.h"
 #include "../Util/Helper.hlsli"
+#include "../Util/TriangleCompat.h"
 #include "Local.hlsli"
 
-inline bool ShadowRayCast(in Ray ray, in uint currentRecursionNum) {
-    //őċA񐔂𒴂Ă牽Ȃ
-    if (currentRecursionNum >= MAX_RAY_RECURSION_DEPTH) { return false; }
-
+inline bool ShadowRayCast(in Ray ray) {
     ShadowPayload shadow = { true };
     RayDesc rayDesc;
     rayDesc.Origin = ray.origin;
     rayDesc.Direction = ray.direction;
     rayDesc.TMin = T_MIN;
     rayDesc.TMax = T_MAX;
-    TraceRay(g_scene, RAY_FLAG_SKIP_CLOSEST_HIT_SHADER, ~0, 0, 0, 1, rayDesc, shadow);
+    //ՕĂ邩΂悢̂ōŏ̏Փ˂ŒTł؂
+    TraceRay(g_scene,
+        RAY_FLAG_ACCEPT_FIRST_HIT_AND_END_SEARCH | RAY_FLAG_SKIP_CLOSEST_HIT_SHADER
+            | RAY_FLAG_FORCE_OPAQUE,
+        ~0, 0, 0, 1, rayDesc, shadow);
     return shadow.hit;
 }
 /**
@@ -34,50 +36,13 @@ inline uint3 GetIndices() {
 }
 
 /**
- * @brief Փ˓_̖@擾
- */
-inline float3 GetNormal(in MyAttr attr) {
-    uint3 indices = GetIndices();
-
-    float3 normals[3] = {
-        Vertices[indices[0]].normal,
-        Vertices[indices[1]].normal,
-        Vertices[indices[2]].normal,
-    };
-
-    return normals[0] + attr.barycentrics.x * (normals[1] - normals[0])
-        + attr.barycentrics.y * (normals[2] - normals[0]);
-}
-
-/**
- * @brief Փ˓_UVW擾
+ * @brief Փ˂Op`̒_擾
+ * @details CfbNXƒ_̓ǂݍ݂1񂾂ɂāAׂĂ̑܂Ƃ߂ĕԂ
  */
-inline float2 GetUV(in MyAttr attr) {
+inline TriangleAttributes GetTriangleAttributes(in MyAttr attr) {
     uint3 indices = GetIndices();
-
-    float2 uvs[3] = {
-        Vertices[indices[0]].uv,
-        Vertices[indices[1]].uv,
-        Vertices[indices[2]].uv,
-    };
-    return uvs[0] + attr.barycentrics.x * (uvs[1] - uvs[0])
-        + attr.barycentrics.y * (uvs[2] - uvs[0]);
-}
-
-/**
- * @brief Փ˓_̐ڐ擾
- */
-inline float4 GetTangent(in MyAttr attr) {
-    uint3 indices = GetIndices();
-
-    float4 tangents[3] = {
-        Vertices[indices[0]].tangent,
-        Vertices[indices[1]].tangent,
-        Vertices[indices[2]].tangent,
-    };
-
-    return tangents[0] + attr.barycentrics.x * (tangents[1] - tangents[0])
-        + attr.barycentrics.y * (tangents[2] - tangents[0]);
+    return InterpolateTriangle(
+        Vertices[indices.x], Vertices[indices.y], Vertices[indices.z], attr.barycentrics);
 }
 
 #endif //! SHADER_RAYTRACING_HITGROUP_HELPER_HLSLI
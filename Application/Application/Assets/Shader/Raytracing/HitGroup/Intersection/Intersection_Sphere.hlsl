@@ -0,0 +1,20 @@
+#ifndef SHADER_RAYTRACING_HITGROUP_INTERSECTION_INTERSECTION_SPHERE_HLSL
+#define SHADER_RAYTRACING_HITGROUP_INTERSECTION_INTERSECTION_SPHERE_HLSL
+
+#define HLSL
+#include "../../Util/Global.hlsli"
+#include "../../Util/SphereCompat.h"
+
+[shader("intersection")] void Intersection_Sphere() {
+    //AABB͒Pʋ͂ł̂ŁA[JԂ̃CŒPʋƌ肷
+    //[JԂ͐̕KĂȂ̂ŁA߂p[^͂̂܂܃[hԂłg
+    SphereHit hit
+        = IntersectUnitSphere(ObjectRayOrigin(), ObjectRayDirection(), RayTMin(), RayTCurrent());
+    if (hit.hit) {
+        SphereAttributes attr;
+        attr.normal = hit.normal;
+        ReportHit(hit.t, 0, attr);
+    }
+}
+
+#endif //! SHADER_RAYTRACING_HITGROUP_INTERSECTION_INTERSECTION_SPHERE_HLSL
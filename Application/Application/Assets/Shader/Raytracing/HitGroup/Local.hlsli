@@ -2,14 +2,24 @@
 #define SHADER_RAYTRACING_HITGROUP_LOCAL_HLSLI
 
 #define HLSL
+#include "../Util/Global.hlsli"
+#include "../Util/Helper.hlsli"
 #include "../Util/HitGroupCompat.h"
 
 ConstantBuffer<HitGroupConstant> l_sceneCB : register(b1);
 
-Texture2D albedoTex : register(t3);
-Texture2D normalMap : register(t4);
-Texture2D metallicRoughnessMap : register(t5);
-Texture2D emissiveMap : register(t6);
-Texture2D occulusionMap : register(t7);
+/**
+ * @brief ̃qbgO[ṽ}eA擾
+ */
+inline MaterialRecord GetMaterial() {
+    return g_materials[l_sceneCB.materialIndex];
+}
+/**
+ * @brief oChX̃e[ueNX`TvO
+ * @details EF[uł}eAقȂ̂ŔlȃCfbNXƂĈ
+ */
+inline float4 SampleMaterialTexture(in uint index, in float2 uv) {
+    return SampleTexture(g_textures[NonUniformResourceIndex(index)], samLinear, uv);
+}
 
 #endif //! SHADER_RAYTRACING_HITGROUP_LOCAL_HLSLI
@@ -6,13 +6,16 @@
 #include "Util/Helper.hlsli"
 
 [shader("raygeneration")] void RayGenShader() {
+    const uint2 pixel = GetPixelIndex();
+    //^C̒[͉ʊOɂȂ
+    if (any(pixel >= uint2(g_sceneCB.screenWidth, g_sceneCB.screenHeight))) { return; }
+
     //J̃C𐶐
-    Ray ray = GenerateCameraRay(
-        DispatchRaysIndex().xy, g_sceneCB.cameraPosition.xyz, g_sceneCB.projectionToWorld);
+    Ray ray = GenerateCameraRay(pixel, g_sceneCB.cameraPosition.xyz, g_sceneCB.projectionToWorld);
 
     //΂̐F擾
-    float4 color = RayCast(ray, 0);
-    g_renderTarget[DispatchRaysIndex().xy] = color;
+    float4 color = PathTrace(ray);
+    g_renderTarget[pixel] = color;
 }
 
 #endif //! SHADER_RAYTRACING_RAYGENSHADER_HLSL
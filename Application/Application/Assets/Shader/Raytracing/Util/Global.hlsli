@@ -8,6 +8,7 @@
 
 #define HLSL
 #include "GlobalCompat.h"
+#include "HitGroupCompat.h"
 
 //Top-Level-AS\
 RaytracingAccelerationStructure g_scene : register(t0);
@@ -15,6 +16,10 @@ RaytracingAccelerationStructure g_scene : register(t0);
 ByteAddressBuffer Indices : register(t1);
 //_z
 StructuredBuffer<Vertex> Vertices : register(t2);
+//}eAz
+StructuredBuffer<MaterialRecord> g_materials : register(t3);
+//oChX̃eNX`e[u
+Texture2D g_textures[] : register(t0, space1);
 
 //V[
 ConstantBuffer<SceneConstantBuffer> g_sceneCB : register(b0);
@@ -26,7 +26,9 @@
 //O[ö̃VF[_[\[XJnn_
 #define GLOBAL_SHADER_RESOURCE_VIEW_REGISTER_START 0
 //[J̈̃VF[_[\[XJnn_
-#define LOCAL_SHADER_RESOURCE_VIEW_REGISTER_START 3
+#define LOCAL_SHADER_RESOURCE_VIEW_REGISTER_START 4
+//oChX̃eNX`e[ũWX^[Xy[X
+#define BINDLESS_TEXTURE_REGISTER_SPACE 1
 //O[ö̃AI[_[hANZXJnn_
 #define GLOBAL_UNORDERED_ACCESS_VIEW_REGISTER_START 0
 //[J̈̃AI[_[hANZXJnn_
@@ -41,7 +43,10 @@
 #define LOCAL_SHADER_RESOURCE_VIEW_REGISTER_NUM 48 - LOCAL_SHADER_RESOURCE_VIEW_REGISTER_START
 #define LOCAL_UNORDERED_ACCESS_VIEW_REGISTER_NUM 16 - LOCAL_UNORDERED_ACCESS_VIEW_REGISTER_START
 
-static const UINT MAX_RAY_RECURSION_DEPTH = 3; //! őċA
+static const UINT MAX_RAY_RECURSION_DEPTH = 3; //! ő唽ˉ
+//! TraceRay̍őċA ˂̓CVF[_[̃[vŔ΂̂ŁAẽC̕ł悢
+static const UINT MAX_TRACE_RECURSION_DEPTH = 2;
+static const UINT RAY_DISPATCH_TILE_SIZE = 8; //! ^CPʂŃfBXpb`Ƃ̃^C̈ӂ̃sNZ
 
 /**
  * @brief V[Ŝ̏
@@ -54,14 +59,21 @@ struct SceneConstantBuffer {
     Color lightAmbient; //!< F
     float globalTime; //!< AvP[VJňoߎ
     float gammaRate;
+    UINT screenWidth; //!< o͐̕
+    UINT screenHeight; //!< o͐̍
+    UINT tiledDispatch; //!< ^CPʂŕבւăfBXpb`邩
 };
 
 /**
  * @brief C̃C̃yC[h
+ * @details ˂͍ċAAɔ΂CCVF[_[ɕԂ
  */
 struct RayPayload {
-    Color color; //!< F
-    UINT recursionCount; //!< ċA
+    Color color; //!< ̏Փ˓_œꂽF
+    UINT recursionCount; //!< ˉ
+    Vec3 nextOrigin; //!< ɔ΂C̎n_
+    Vec3 nextDirection; //!< ɔ΂C̕
+    float reflectance; //!< ̃C̐F̊^ 0Ȃ甽˂Ȃ
 };
 
 /**
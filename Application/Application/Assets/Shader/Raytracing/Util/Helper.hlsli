@@ -23,6 +23,35 @@ struct Ray {
     float3 direction; //!< 
 };
 
+/**
+ * @brief [g2Wɕϊ
+ */
+inline uint2 DecodeMorton2D(uint code) {
+    uint2 v = uint2(code, code >> 1) & 0x55555555;
+    v = (v | (v >> 1)) & 0x33333333;
+    v = (v | (v >> 2)) & 0x0f0f0f0f;
+    v = (v | (v >> 4)) & 0x00ff00ff;
+    v = (v | (v >> 8)) & 0x0000ffff;
+    return v;
+}
+
+/**
+ * @brief ̃XbhsNZ擾
+ * @details ^CPʂ̂Ƃ1ŃfBXpb`A^C[gɕׂ邱Ƃ
+ * EF[uɗאڂsNZ̃CW܂悤ɂ
+ */
+inline uint2 GetPixelIndex() {
+    if (!g_sceneCB.tiledDispatch) { return DispatchRaysIndex().xy; }
+
+    const uint tileArea = RAY_DISPATCH_TILE_SIZE * RAY_DISPATCH_TILE_SIZE;
+    const uint tilesX
+        = (g_sceneCB.screenWidth + RAY_DISPATCH_TILE_SIZE - 1) / RAY_DISPATCH_TILE_SIZE;
+    const uint index = DispatchRaysIndex().x;
+    const uint tile = index / tileArea;
+    return uint2(tile % tilesX, tile / tilesX) * RAY_DISPATCH_TILE_SIZE
+        + DecodeMorton2D(index % tileArea);
+}
+
 /**
  * @brief J̃C΂
  */
@@ -30,7 +59,7 @@ inline Ray GenerateCameraRay(in uint2 index, in float3 cameraPosition,
     in float4x4 projectionToWorld, float2 offset = float2(0.5, 0.5)) {
     //XN[WvZ
     float2 xy = index + offset;
-    float2 screenPos = xy / DispatchRaysDimensions().xy * 2.0 - 1.0;
+    float2 screenPos = xy / float2(g_sceneCB.screenWidth, g_sceneCB.screenHeight) * 2.0 - 1.0;
     screenPos.y = -screenPos.y;
 
     //[hWɖ߂
@@ -71,23 +100,44 @@ static inline uint3 LoadIndices(uint offsetBytes, ByteAddressBuffer Indices) {
 inline float3 hitWorldPosition() { return WorldRayOrigin() + WorldRayDirection() * RayTCurrent(); }
 
 /**
- * @brief C΂AIuWFNg̐F擾
+ * @brief C1΂AIuWFNg̐FƎɔ΂C擾
  */
-inline float4 RayCast(in Ray ray, in uint currentRecursionNum) {
-    //ċA񐔐
-    if (currentRecursionNum >= MAX_RAY_RECURSION_DEPTH) { return float4(0, 0, 0, 0); }
-
+inline RayPayload RayCast(in Ray ray, in uint currentRecursionNum) {
     RayDesc rayDesc;
     rayDesc.Origin = ray.origin;
     rayDesc.Direction = ray.direction;
     rayDesc.TMin = T_MIN;
     rayDesc.TMax = T_MAX;
 
-    RayPayload payload = { float4(0, 0, 0, 0), currentRecursionNum + 1 };
+    RayPayload payload;
+    payload.color = float4(0, 0, 0, 0);
+    payload.recursionCount = currentRecursionNum + 1;
+    payload.nextOrigin = float3(0, 0, 0);
+    payload.nextDirection = float3(0, 0, 0);
+    payload.reflectance = 0.0;
 
     TraceRay(g_scene, RAY_FLAG_CULL_BACK_FACING_TRIANGLES, ~0, 0, 1, 0, rayDesc, payload);
 
-    return payload.color;
+    return payload;
+}
+
+/**
+ * @brief ˂JԂĐF擾
+ * @details ˂ƂTraceRayċAA[vŎ̃C΂
+ */
+inline float4 PathTrace(in Ray ray) {
+    float3 color = float3(0, 0, 0);
+    float weight = 1.0;
+    for (uint depth = 0; depth < MAX_RAY_RECURSION_DEPTH; depth++) {
+        RayPayload payload = RayCast(ray, depth);
+        color += payload.color.rgb * weight;
+        if (payload.reflectance <= 0.0) { break; }
+
+        weight *= payload.reflectance;
+        ray.origin = payload.nextOrigin;
+        ray.direction = payload.nextDirection;
+    }
+    return float4(color, 1.0);
 }
 
 //eNX`̃TvO
@@ -9,10 +9,13 @@
 #ifdef HLSL
 #include "Typedef.hlsli"
 #else
-#include <DirectXMath.h>
-#include <Windows.h>
+#include "Math/Vector3.h"
+#include "Utility/Platform.h"
+//Vec3̕ʖWindowsłTypedef.hAeXgłTestPrelude.hŒ`
+#ifdef _WIN32
 #include "Typedef.h"
 #endif
+#endif
 
 /**
  * @struct HitGroupConstant
@@ -21,7 +24,27 @@
 struct HitGroupConstant {
     UINT vertexOffset; //!< _ItZbg
     UINT indexOffset; //!< CfbNXItZbg
+    UINT materialIndex; //!< }eAobt@̃CfbNX
+};
+
+/**
+ * @struct MaterialRecord
+ * @brief }eA
+ * @details eNX`̓oChX̃e[ũCfbNXŎ
+ */
+struct MaterialRecord {
+    UINT albedoIndex; //!< AxheNX`̃CfbNX
+    UINT normalIndex; //!< @}bṽCfbNX
+    UINT metallicRoughnessIndex; //!< ^bNEtlX}bṽCfbNX
+    UINT emissiveIndex; //!< G~bVu}bṽCfbNX
+    UINT occlusionIndex; //!< IN[W}bṽCfbNX
     Vec3 emissiveFactor; //!< G~bV̗vf
 };
 
+#ifndef HLSL
+//StructuredBuffer̃XgChƃVF[_[̔zuv
+static_assert(sizeof(HitGroupConstant) == sizeof(UINT) * 3, "HitGroupConstant size mismatch");
+static_assert(sizeof(MaterialRecord) == 32, "MaterialRecord size mismatch");
+#endif
+
 #endif // !SHADER_RAYTRACING_HITGROUP_HITGROUPCOMPAT_H
@@ -0,0 +1,109 @@
+/**
+ * @file SphereCompat.h
+ * @brief ̌ƒ_
+ * @details VF[_[Cppt@C̗ŃRpCł悤ɏ
+ * ̓[JԂŌ_𒆐SƂ锼a1̋ƂAʒuƑ傫̓CX^X̕ϊŌ߂
+ */
+
+#ifndef SHADER_RAYTRACING_UTIL_SPHERECOMPAT_H
+#define SHADER_RAYTRACING_UTIL_SPHERECOMPAT_H
+
+#ifdef HLSL
+#include "Typedef.hlsli"
+#include "TriangleCompat.h"
+#else
+#include <cmath>
+#include "TriangleCompat.h"
+namespace Framework::DX {
+using std::acos;
+using std::atan2;
+using std::sqrt;
+#endif
+
+/**
+ * @brief C^[ZNVVF[_[nՓˏ
+ */
+struct SphereAttributes {
+    float3 normal; //!< [JԂł̖@
+};
+
+/**
+ * @brief Ƃ̌̌
+ */
+struct SphereHit {
+    bool hit; //!< ͈͓œ
+    float t; //!< ʒũC̃p[^
+    float3 normal; //!< [JԂł̖@
+};
+
+/**
+ * @brief 3xNg̓
+ */
+inline float SphereDot(float3 a, float3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+/**
+ * @brief CƒPʋ̌
+ * @param origin [JԂł̃C̎n_
+ * @param direction [JԂł̃C̕ KĂȂĂ悢
+ * @param tMin Ƃp[^̍ŏl
+ * @param tMax Ƃp[^̍ől
+ * @details ʎ̓CŒSɍł߂_狁߁A猂CłȂ悤ɂ
+ * Ỏ͈͊OȂ牜̉ĝŁA̓猂C
+ */
+inline SphereHit IntersectUnitSphere(float3 origin, float3 direction, float tMin, float tMax) {
+    SphereHit result;
+    result.hit = false;
+    result.t = tMax;
+    result.normal = float3(0, 0, 0);
+
+    const float a = SphereDot(direction, direction);
+    const float b = -SphereDot(origin, direction);
+    const float3 closest = origin + direction * (b / a);
+    const float discriminant = 1.0f - SphereDot(closest, closest);
+    if (discriminant < 0.0f) return result;
+
+    //2̉̍炸ɍςނ悤ɁAЕЕƌW̊֌Wŋ߂
+    const float c = SphereDot(origin, origin) - 1.0f;
+    const float q = b + (b >= 0.0f ? 1.0f : -1.0f) * sqrt(a * discriminant);
+    //n_ʏŐڂɌq=0̏dɂȂA0/0ɂȂ̂ŉ𒼐ڎg
+    const float t0 = q != 0.0f ? c / q : b / a;
+    const float t1 = q / a;
+    const float tNear = t0 < t1 ? t0 : t1;
+    const float tFar = t0 < t1 ? t1 : t0;
+    const float t = tNear >= tMin ? tNear : tFar;
+    if (!(t >= tMin && t <= tMax)) return result;
+
+    result.hit = true;
+    result.t = t;
+    result.normal = origin + direction * t;
+    return result;
+}
+
+/**
+ * @brief Pʋ̓_̒_߂
+ * @param normal [JԂł̖@
+ * @details UV͌oxƈܓx̂܂܎gAڐ͌oxɂ
+ */
+inline TriangleAttributes GetSphereSurface(float3 normal) {
+    const float y = normal.y < -1.0f ? -1.0f : (normal.y > 1.0f ? 1.0f : normal.y);
+    const float horizontal = sqrt(normal.x * normal.x + normal.z * normal.z);
+
+    TriangleAttributes result;
+    result.position = normal;
+    result.normal = normal;
+    //1/2΂1/΂|01Ɏ߂
+    result.uv = float2(atan2(normal.z, normal.x) * 0.15915494f + 0.5f, acos(y) * 0.31830989f);
+    //ɂł͌ox̌܂Ȃ̂ŔCӂ̐Ȍɂ
+    result.tangent = horizontal > 1e-6f
+        ? float4(-normal.z / horizontal, 0.0f, normal.x / horizontal, 1.0f)
+        : float4(1.0f, 0.0f, 0.0f, 1.0f);
+    return result;
+}
+
+#ifndef HLSL
+} // namespace Framework::DX
+#endif
+
+#endif // !SHADER_RAYTRACING_UTIL_SPHERECOMPAT_H
@@ -0,0 +1,62 @@
+/**
+ * @file TriangleCompat.h
+ * @brief Op`̒_̕
+ * @details VF[_[Cppt@C̗ŃRpCł悤ɏ
+ */
+
+#ifndef SHADER_RAYTRACING_UTIL_TRIANGLECOMPAT_H
+#define SHADER_RAYTRACING_UTIL_TRIANGLECOMPAT_H
+
+#ifdef HLSL
+// clang-format off
+#include "Typedef.hlsli"
+#include "../../../../Source/DX/ModelCompat.h"
+// clang-format on
+#else
+#include "DX/ModelCompat.h"
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+namespace Framework::DX {
+//VF[_[Ƌʂ̃R[hŎgp^ OԂ̊Oɂ͌JȂ
+using float2 = Math::Vector2;
+using float3 = Math::Vector3;
+using float4 = Math::Vector4;
+#endif
+
+/**
+ * @brief ԂOp`̒_
+ */
+struct TriangleAttributes {
+    float3 position; //!< W
+    float3 normal; //!< @
+    float2 uv; //!< UVW
+    float4 tangent; //!< ڐ
+};
+
+/**
+ * @brief dSWŎOp`̒_܂Ƃ߂ĕԂ
+ * @param v0 1Ԗڂ̒_
+ * @param v1 2Ԗڂ̒_
+ * @param v2 3Ԗڂ̒_
+ * @param barycentrics 2Ԗڂ3Ԗڂ̒_̏d
+ */
+inline TriangleAttributes InterpolateTriangle(
+    Vertex v0, Vertex v1, Vertex v2, float2 barycentrics) {
+    const float w0 = 1.0f - barycentrics.x - barycentrics.y;
+    const float w1 = barycentrics.x;
+    const float w2 = barycentrics.y;
+
+    TriangleAttributes result;
+    result.position = v0.position * w0 + v1.position * w1 + v2.position * w2;
+    result.normal = v0.normal * w0 + v1.normal * w1 + v2.normal * w2;
+    result.uv = v0.uv * w0 + v1.uv * w1 + v2.uv * w2;
+    result.tangent = v0.tangent * w0 + v1.tangent * w1 + v2.tangent * w2;
+    return result;
+}
+
+#ifndef HLSL
+} // namespace Framework::DX
+#endif
+
+#endif // !SHADER_RAYTRACING_UTIL_TRIANGLECOMPAT_H
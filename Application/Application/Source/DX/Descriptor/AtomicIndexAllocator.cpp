@@ -0,0 +1,58 @@
+#include "AtomicIndexAllocator.h"
+
+namespace Framework::DX {
+    //RXgN^
+    AtomicIndexAllocator::AtomicIndexAllocator()
+        : mFreeHead(makeHead(0, INVALID_INDEX)), mBump(0), mAllocatedCount(0), mCapacity(0) {}
+    //fXgN^
+    AtomicIndexAllocator::~AtomicIndexAllocator() {}
+    //
+    void AtomicIndexAllocator::init(UINT capacity) {
+        MY_ASSERTION(capacity < INVALID_INDEX, "Ǘł鐔𒴂Ă܂");
+        mCapacity = capacity;
+        mNextFree = std::make_unique<std::atomic<UINT>[]>(capacity);
+        mFreeHead.store(makeHead(0, INVALID_INDEX));
+        mBump.store(0);
+        mAllocatedCount.store(0);
+    }
+    //m
+    UINT AtomicIndexAllocator::allocate() {
+        //ς݂̂̂΍ėp
+        UINT64 head = mFreeHead.load(std::memory_order_acquire);
+        while (static_cast<UINT>(head) != INVALID_INDEX) {
+            const UINT index = static_cast<UINT>(head);
+            //̃XbhɎoĂl͌ÂA^Oς̂Ŕr͎s
+            const UINT next = mNextFree[index].load(std::memory_order_relaxed);
+            if (mFreeHead.compare_exchange_weak(head, makeHead((head >> 32) + 1, next),
+                    std::memory_order_acq_rel,
+                    std::memory_order_acquire)) {
+                mAllocatedCount.fetch_add(1, std::memory_order_relaxed);
+                return index;
+            }
+        }
+
+        //gp̗̈悩؂o 𒴂ĉZȂ悤rŐi߂
+        UINT bump = mBump.load(std::memory_order_relaxed);
+        while (bump < mCapacity) {
+            if (mBump.compare_exchange_weak(bump, bump + 1,
+                    std::memory_order_relaxed,
+                    std::memory_order_relaxed)) {
+                mAllocatedCount.fetch_add(1, std::memory_order_relaxed);
+                return bump;
+            }
+        }
+        return INVALID_INDEX;
+    }
+    //
+    void AtomicIndexAllocator::free(UINT index) {
+        MY_ASSERTION(index < mBump.load(std::memory_order_relaxed),
+            "mۂĂȂCfbNXw肳܂");
+        UINT64 head = mFreeHead.load(std::memory_order_relaxed);
+        do {
+            mNextFree[index].store(
+                static_cast<UINT>(head), std::memory_order_relaxed);
+        } while (!mFreeHead.compare_exchange_weak(head, makeHead((head >> 32) + 1, index),
+            std::memory_order_release, std::memory_order_relaxed));
+        mAllocatedCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+} // namespace Framework::DX
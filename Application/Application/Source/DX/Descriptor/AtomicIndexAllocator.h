@@ -0,0 +1,78 @@
+/**
+ * @file AtomicIndexAllocator.h
+ * @brief XbhgCfbNX̃AP[^
+ * @details q[vɂ͈ˑACfbNXǗ
+ */
+
+#pragma once
+#include <atomic>
+
+namespace Framework::DX {
+    /**
+     * @class AtomicIndexAllocator
+     * @brief bNgȂCfbNX̃AP[^
+     * @details gp̗̈̓Ag~bNȉZŐ擪؂oAꂽCfbNX
+     * ^Ot̘AXgɂX^bNōėp
+     * ^O͓CfbNXEĊmۂꂽƂɐ擪̔rĐ̂h
+     */
+    class AtomicIndexAllocator {
+    public:
+        static constexpr UINT INVALID_INDEX = UINT_MAX; //!< mێs̃CfbNX
+    public:
+        /**
+         * @brief RXgN^
+         */
+        AtomicIndexAllocator();
+        /**
+         * @brief fXgN^
+         */
+        ~AtomicIndexAllocator();
+        AtomicIndexAllocator(const AtomicIndexAllocator&) = delete;
+        AtomicIndexAllocator& operator=(const AtomicIndexAllocator&) = delete;
+        /**
+         * @brief 
+         * @param capacity Ǘ鑍
+         * @details ̃XbhgĂȂԂŌĂԂ
+         */
+        void init(UINT capacity);
+        /**
+         * @brief CfbNXmۂ
+         * @return mۂCfbNX mۂłȂINVALID_INDEXԂ
+         */
+        UINT allocate();
+        /**
+         * @brief CfbNX
+         */
+        void free(UINT index);
+        /**
+         * @brief Ǘ鑍擾
+         */
+        UINT getCapacity() const {
+            return mCapacity;
+        }
+        /**
+         * @brief mے̐擾
+         * @details ̃XbhmہEĂŒ͖ڈɂȂȂ
+         */
+        UINT getAllocatedCount() const {
+            return mAllocatedCount.load(std::memory_order_relaxed);
+        }
+
+    private:
+        /**
+         * @brief X^bN̐擪
+         * @param tag XV
+         * @param index 擪̃CfbNX
+         */
+        static UINT64 makeHead(UINT64 tag, UINT index) {
+            return (tag << 32) | index;
+        }
+
+    private:
+        std::unique_ptr<std::atomic<UINT>[]> mNextFree; //!< ς݃Xg̎̃CfbNX
+        std::atomic<UINT64> mFreeHead; //!< ς݃Xg̐擪 32bit̓^O
+        std::atomic<UINT> mBump; //!< ܂xmۂĂȂ̈̐擪
+        std::atomic<UINT> mAllocatedCount; //!< mے̐
+        UINT mCapacity; //!< Ǘ鑍
+    };
+} // namespace Framework::DX
@@ -3,38 +3,79 @@
 
 namespace Framework::DX {
     //RXgN^
-    DescriptorAllocator::DescriptorAllocator() : mDevice(nullptr), mHeapNum(0) {}
+    DescriptorAllocator::DescriptorAllocator()
+        : mDevice(nullptr), mStackHeapCount(0), mHeapNum(0), mRangeNum(0) {}
     //fXgN^
     DescriptorAllocator::~DescriptorAllocator() {
         mDevice = nullptr;
-        mStackHeaps.clear();
+        for (auto&& heap : mStackHeaps) { heap.reset(); }
     }
     //
-    void DescriptorAllocator::init(
-        DeviceResource* device, D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorNum) {
+    void DescriptorAllocator::init(DeviceResource* device, D3D12_DESCRIPTOR_HEAP_TYPE type,
+        UINT descriptorNum, UINT rangeDescriptorNum) {
         mDevice = device;
         mHeapType = type;
         mHeapNum = descriptorNum;
+        mRangeNum = rangeDescriptorNum;
 
         //ŏɈǉ
         //ȂȂ炻̓sxǉ
-        addHeap();
+        addHeap(0);
     }
     //nh̊m
     DescriptorInfo DescriptorAllocator::allocate() {
         DescriptorInfo result;
         result.parent = this;
-        //AP[gł炻Ԃ
-        if (mStackHeaps.back().allocate(&result.cpuHandle, &result.gpuHandle)) return result;
-        //mۂłȂΐV쐬AP[g
-        addHeap();
-        mStackHeaps.back().allocate(&result.cpuHandle, &result.gpuHandle);
-        return result;
+        while (true) {
+            //ꂽ̈悪΂mۂ
+            const UINT heapCount = mStackHeapCount.load(std::memory_order_acquire);
+            for (UINT n = 0; n < heapCount; n++) {
+                if (mStackHeaps[n]->allocate(&result.cpuHandle, &result.gpuHandle)) return result;
+            }
+            //mۂłȂΐV쐬AP[g
+            addHeap(heapCount);
+        }
+    }
+    //Anh̊m
+    DescriptorInfo DescriptorAllocator::allocate(UINT count) {
+        //Vq[vłmۂłȂƖɃq[vǉĂ܂
+        MY_THROW_IF_FALSE_LOG(count <= mRangeNum, "AĊmۂł鐔𒴂Ă܂");
+        DescriptorInfo result;
+        result.parent = this;
+        result.count = count;
+        while (true) {
+            const UINT heapCount = mStackHeapCount.load(std::memory_order_acquire);
+            for (UINT n = 0; n < heapCount; n++) {
+                if (mStackHeaps[n]->allocate(&result.cpuHandle, &result.gpuHandle, count)) {
+                    return result;
+                }
+            }
+            addHeap(heapCount);
+        }
+    }
+    //nh̉
+    void DescriptorAllocator::deallocate(DescriptorInfo* info) {
+        MY_ASSERTION(info->parent == this, "̃AP[^ŊmۂfBXNv^ł͂܂");
+        const UINT heapCount = mStackHeapCount.load(std::memory_order_acquire);
+        for (UINT n = 0; n < heapCount; n++) {
+            if (!mStackHeaps[n]->contains(info->cpuHandle)) continue;
+            mStackHeaps[n]->free(info->cpuHandle, info->count);
+            *info = DescriptorInfo();
+            return;
+        }
+        MY_ASSERTION(false, "mۂq[v܂");
     }
     //q[v̒ǉ
-    void DescriptorAllocator::addHeap() {
-        LocalDescriptorHeap newHeap;
-        newHeap.init(mDevice->getDevice(), mHeapNum, mHeapType);
-        mStackHeaps.emplace_back(newHeap);
+    void DescriptorAllocator::addHeap(UINT knownHeapCount) {
+        std::lock_guard<std::mutex> lock(mAddHeapMutex);
+        const UINT heapCount = mStackHeapCount.load(std::memory_order_relaxed);
+        if (heapCount != knownHeapCount) return;
+        MY_THROW_IF_FALSE_LOG(heapCount < MAX_HEAP_NUM, "fBXNv^q[v̍ő吔𒴂܂");
+
+        std::unique_ptr<LocalDescriptorHeap> newHeap = std::make_unique<LocalDescriptorHeap>();
+        newHeap->init(mDevice->getDevice(), mHeapNum, mHeapType, mRangeNum);
+        mStackHeaps[heapCount] = std::move(newHeap);
+        //q[vIĂ琔J
+        mStackHeapCount.store(heapCount + 1, std::memory_order_release);
     }
 } // namespace Framework::DX
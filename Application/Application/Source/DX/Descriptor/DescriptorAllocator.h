@@ -4,7 +4,9 @@
  */
 
 #pragma once
+#include <mutex>
 #include "DX/Descriptor/DescriptorInfo.h"
+#include "DX/Descriptor/DescriptorThreadCache.h"
 #include "DX/Descriptor/LocalDescriptorHeap.h"
 
 namespace Framework::DX {
@@ -12,8 +14,13 @@ namespace Framework::DX {
     /**
      * @class DescriptorAllocator
      * @brief fBXNv^̊mۊǗ
+     * @details mۂƉ͕̃Xbh瓯ɌĂׂ
+     * q[v̒ǉ̓bN邪ApɂɋNȂ悤Ƀq[v̑傫߂邱
      */
     class DescriptorAllocator {
+    private:
+        static constexpr UINT MAX_HEAP_NUM = 32; //!< ǉłq[v̍ő吔
+
     public:
         /**
          * @brief RXgN^
@@ -25,23 +32,62 @@ namespace Framework::DX {
         ~DescriptorAllocator();
         /**
          * @brief 
+         * @param rangeDescriptorNum eq[v̂A͈͂̊mۂɎg
          */
-        void init(DeviceResource* device, D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorNum);
+        void init(DeviceResource* device, D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorNum,
+            UINT rangeDescriptorNum = 0);
         /**
          * @brief fBXNv^̊m
          */
         DescriptorInfo allocate();
+        /**
+         * @brief AfBXNv^̊m
+         * @param count AĊmۂ鐔 rangeDescriptorNumȉɂ邱
+         * @details bNĊmۂ̂ŁApɂɌĂԂ̂1mۂ邱
+         */
+        DescriptorInfo allocate(UINT count);
+        /**
+         * @brief fBXNv^̉
+         * @param info fBXNv^ AĊmۂ̂͂܂Ƃ߂ĉ ͖ȒlɂȂ
+         */
+        void deallocate(DescriptorInfo* info);
 
     private:
         /**
          * @brief q[v̒ǉ
+         * @param knownHeapCount ǉKvƔfƂ̃q[v̐
+         * @details ̃XbhɒǉĂ牽Ȃ
          */
-        void addHeap();
+        void addHeap(UINT knownHeapCount);
 
     private:
         DeviceResource* mDevice; //!< foCX
-        std::vector<LocalDescriptorHeap> mStackHeaps; //!< mۍς݂̃q[v
+        //mۍς݂̃q[v ǉꂽ͍̂폜Ȃ̂ŁAǂ񂾌̓bNɎQƂł
+        std::array<std::unique_ptr<LocalDescriptorHeap>, MAX_HEAP_NUM> mStackHeaps;
+        std::atomic<UINT> mStackHeapCount; //!< mۍς݂̃q[v̐
+        std::mutex mAddHeapMutex; //!< q[vǉ̃bN
         D3D12_DESCRIPTOR_HEAP_TYPE mHeapType; //!< q[v̎k
         UINT mHeapNum; //!< q[v̊mې
+        UINT mRangeNum; //!< q[v̂A͈͂̊mۂɎg
+    };
+
+    /**
+     * @brief r[̃fBXNv^LbV 1mۂ̂
+     */
+    template <>
+    struct DescriptorCacheTraits<DescriptorAllocator> {
+        using Item = DescriptorInfo;
+        static DescriptorInfo allocate(DescriptorAllocator* allocator) {
+            return allocator->allocate();
+        }
+        static void deallocate(DescriptorAllocator* allocator, DescriptorInfo* info) {
+            allocator->deallocate(info);
+        }
+        static bool isValid(const DescriptorInfo& info) {
+            return info.parent != nullptr && info.count == 1;
+        }
+        static DescriptorInfo invalid() {
+            return DescriptorInfo();
+        }
     };
 } // namespace Framework::DX
@@ -1,7 +1,31 @@
 #include "DescriptorHeapManager.h"
 #include "DX/DeviceResource.h"
 
+namespace {
+    //̃XbhŗLȍł̃XR[v
+    thread_local Framework::DX::DescriptorHeapManager::ThreadCacheScope* tCurrentScope = nullptr;
+} // namespace
+
 namespace Framework::DX {
+    //RXgN^
+    DescriptorHeapManager::ThreadCacheScope::ThreadCacheScope(DescriptorHeapManager* manager)
+        : mResourceCache(&manager->mCbvSrvUavAllocator),
+          mSamplerCache(&manager->mSamplerAllocator),
+          mPrevious(tCurrentScope) {
+        tCurrentScope = this;
+    }
+    //fXgN^
+    DescriptorHeapManager::ThreadCacheScope::~ThreadCacheScope() {
+        MY_ASSERTION(tCurrentScope == this, "XR[vXbhŔjĂ");
+        tCurrentScope = mPrevious;
+    }
+    //AP[^ɑΉLbVT
+    DescriptorThreadCache<DescriptorAllocator>* DescriptorHeapManager::ThreadCacheScope::find(
+        const DescriptorAllocator* allocator) {
+        if (mResourceCache.getAllocator() == allocator) return &mResourceCache;
+        if (mSamplerCache.getAllocator() == allocator) return &mSamplerCache;
+        return nullptr;
+    }
 
     DescriptorHeapManager::DescriptorHeapManager() {}
     DescriptorHeapManager::~DescriptorHeapManager() {}
@@ -9,15 +33,15 @@ namespace Framework::DX {
         mRaytracingDescriptor.init(device);
         mGlobalHeap.init(device->getDevice(),
             D3D12_DESCRIPTOR_HEAP_TYPE::D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
-            GLOBAL_RESOURCE_HEAP_SIZE);
+            GLOBAL_RESOURCE_HEAP_SIZE, D3D12_MAX_SHADER_VISIBLE_DESCRIPTOR_HEAP_SIZE_TIER_1);
         mCbvSrvUavAllocator.init(device,
             D3D12_DESCRIPTOR_HEAP_TYPE::D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
-            RESOURCE_VIEW_ALLOCATE_SIZE);
+            RESOURCE_VIEW_ALLOCATE_SIZE, RESOURCE_VIEW_RANGE_SIZE);
         mDefaultResourceInfo = mCbvSrvUavAllocator.allocate();
 
         mSamplerHeap.init(device->getDevice(),
             D3D12_DESCRIPTOR_HEAP_TYPE::D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER,
-            GLOBAL_SAMPLER_HEAP_SIZE);
+            GLOBAL_SAMPLER_HEAP_SIZE, D3D12_MAX_SHADER_VISIBLE_SAMPLER_HEAP_SIZE);
         mSamplerAllocator.init(device,
             D3D12_DESCRIPTOR_HEAP_TYPE::D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER,
             SAMPLER_VIEW_ALLOCATOR_SIZE);
@@ -30,8 +54,12 @@ namespace Framework::DX {
     }
     DescriptorInfo DescriptorHeapManager::allocate(DescriptorHeapType flag) {
         switch (flag) {
-        case DescriptorHeapType::CbvSrvUav: return mCbvSrvUavAllocator.allocate();
-        case DescriptorHeapType::Sampler: return mSamplerAllocator.allocate();
+        case DescriptorHeapType::CbvSrvUav:
+            if (auto* cache = findThreadCache(&mCbvSrvUavAllocator)) return cache->allocate();
+            return mCbvSrvUavAllocator.allocate();
+        case DescriptorHeapType::Sampler:
+            if (auto* cache = findThreadCache(&mSamplerAllocator)) return cache->allocate();
+            return mSamplerAllocator.allocate();
         case DescriptorHeapType::Rtv: return mRtvAllocator.allocate();
         case DescriptorHeapType::Dsv: return mDsvAllocator.allocate();
         case DescriptorHeapType::RaytracingGlobal: return mRaytracingDescriptor.allocateGlobal();
@@ -39,49 +67,136 @@ namespace Framework::DX {
         default: MY_ASSERTION(false, "Ή̃tOw肳܂B"); return DescriptorInfo();
         }
     }
-    void DescriptorHeapManager::beginFrame() {
-        mRaytracingDescriptor.mHeap.resetGlobal();
-        mGlobalHeap.reset();
-        mSamplerHeap.reset();
+    //AP[^擾
+    DescriptorAllocator* DescriptorHeapManager::getAllocator(DescriptorHeapType flag) {
+        switch (flag) {
+        case DescriptorHeapType::CbvSrvUav: return &mCbvSrvUavAllocator;
+        case DescriptorHeapType::Sampler: return &mSamplerAllocator;
+        case DescriptorHeapType::Rtv: return &mRtvAllocator;
+        case DescriptorHeapType::Dsv: return &mDsvAllocator;
+        default: MY_ASSERTION(false, "Ή̃tOw肳܂B"); return nullptr;
+        }
+    }
+    void DescriptorHeapManager::deallocate(DescriptorInfo* info) {
+        if (info->parent) {
+            //AĊmۂ̂̓LbVɒڕԂ
+            auto* cache = info->count == 1 ? findThreadCache(info->parent) : nullptr;
+            if (cache) {
+                cache->deallocate(info);
+            } else {
+                info->parent->deallocate(info);
+            }
+            //ꏊɕʂ̃fBXNv^ƃLbVƐHႤ̂Ŕj
+            clearTableCache();
+        } else if (info->cpuHandle.ptr != 0
+            && mRaytracingDescriptor.mHeap.containsLocal(info->cpuHandle)) {
+            //oChX̃e[uGPUgIĂ
+            mRaytracingDescriptor.mHeap.freeLocal(*info);
+            *info = DescriptorInfo();
+        }
+    }
+    //GPUgI͈͂
+    void DescriptorHeapManager::beginFrame(UINT64 completedFenceValue) {
+        mRaytracingDescriptor.mHeap.retire(completedFenceValue);
+        mGlobalHeap.beginFrame(completedFenceValue);
+        mSamplerHeap.beginFrame(completedFenceValue);
+        mRaytracingDescriptor.mTableCache.beginFrame();
+        mResourceTableCache.beginFrame();
+        mSamplerTableCache.beginFrame();
+    }
+    //̃t[Ŋmۂ͈͂ɃtFX̒lRÂ
+    void DescriptorHeapManager::endFrame(UINT64 fenceValue) {
+        mRaytracingDescriptor.mHeap.endFrame(fenceValue);
+        mGlobalHeap.endFrame(fenceValue);
+        mSamplerHeap.endFrame(fenceValue);
+    }
+    UINT DescriptorHeapManager::getBindlessIndex(const DescriptorInfo& info) const {
+        return mRaytracingDescriptor.mHeap.getLocalIndex(info);
+    }
+    D3D12_GPU_DESCRIPTOR_HANDLE DescriptorHeapManager::getBindlessTableStart() const {
+        return mRaytracingDescriptor.mHeap.getLocalStart();
+    }
+    DescriptorTableCache::Stats DescriptorHeapManager::getTableCacheStats() const {
+        DescriptorTableCache::Stats result;
+        for (const DescriptorTableCache* cache : { &mResourceTableCache, &mSamplerTableCache,
+                 &mRaytracingDescriptor.mTableCache }) {
+            const DescriptorTableCache::Stats& stats = cache->getLastFrameStats();
+            result.lookupCount += stats.lookupCount;
+            result.hitCount += stats.hitCount;
+            result.savedCopyCount += stats.savedCopyCount;
+            result.savedDescriptorCount += stats.savedDescriptorCount;
+        }
+        return result;
+    }
+    void DescriptorHeapManager::clearTableCache() {
+        //r[͑̃Xbh蒼邱Ƃ̂ŁAL^XbhŔj
+        mRaytracingDescriptor.mTableCache.invalidate();
+        mResourceTableCache.invalidate();
+        mSamplerTableCache.invalidate();
+    }
+    UINT DescriptorHeapManager::getCapacity(DescriptorHeapType type) const {
+        switch (type) {
+        case DescriptorHeapType::CbvSrvUav: return mGlobalHeap.getCapacity();
+        case DescriptorHeapType::Sampler: return mSamplerHeap.getCapacity();
+        case DescriptorHeapType::RaytracingGlobal:
+            return mRaytracingDescriptor.mHeap.getGlobalCapacity();
+        default: MY_ASSERTION(false, "Ή̃tOw肳܂B"); return 0;
+        }
+    }
+    UINT DescriptorHeapManager::getHighWaterMark(DescriptorHeapType type) const {
+        switch (type) {
+        case DescriptorHeapType::CbvSrvUav: return mGlobalHeap.getHighWaterMark();
+        case DescriptorHeapType::Sampler: return mSamplerHeap.getHighWaterMark();
+        case DescriptorHeapType::RaytracingGlobal:
+            return mRaytracingDescriptor.mHeap.getGlobalHighWaterMark();
+        default: MY_ASSERTION(false, "Ή̃tOw肳܂B"); return 0;
+        }
     }
     void DescriptorHeapManager::copyAndSetGraphicsDescriptorHeap(DescriptorHeapType type,
         DeviceResource* device, ID3D12GraphicsCommandList* commandList, const DescriptorSet& set) {
-        auto setDescriptorSetSingle = [&](const D3D12_CPU_DESCRIPTOR_HANDLE* start,
-                                          GlobalDescriptorHeap& heap, UINT num, UINT index) {
-            if (num == 0) return;
-            MY_THROW_IF_FALSE_LOG(
-                mGlobalHeap.canCopy(num), "mۂfBXNv^̑傫𒴂܂");
-            std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> tmpHandle(num);
-            for (UINT n = 0; n < num; n++) {
-                tmpHandle[n] = start[n].ptr == 0 ? mDefaultResourceInfo.cpuHandle : start[n];
+        //t[œтRs[ς݂Ȃ炻͈̔͂g
+        //Ȃ΃ZbgŜAĊmۂAxɃRs[
+        auto copyAndSet = [&](GlobalDescriptorHeap& heap, DescriptorTableCache& cache,
+                              const D3D12_CPU_DESCRIPTOR_HANDLE* staging, UINT total,
+                              UINT64 layout, std::initializer_list<std::pair<UINT, UINT>> tables) {
+            if (total == 0) return;
+            UINT offset = 0;
+            if (!cache.find(staging, total, layout, &offset)) {
+                //q[v̓t[̊Jnɂ蒼Ȃ̂ŁAZbgς݂̃q[v͂̂܂܎g
+                offset = heap.allocate(total);
+                CD3DX12_CPU_DESCRIPTOR_HANDLE dstHandle(
+                    heap.mDescriptorHeap->GetCPUDescriptorHandleForHeapStart(), offset,
+                    heap.mDescriptorHeapSize);
+                device->getDevice()->CopyDescriptors(
+                    1, &dstHandle, &total, total, staging, nullptr, heap.mType);
+                cache.insert(staging, total, layout, offset);
+            }
+            for (auto&& table : tables) {
+                //first:[gp[^̃CfbNX second:e[ȗ傫
+                if (table.second == 0) continue;
+                commandList->SetGraphicsRootDescriptorTable(table.first,
+                    CD3DX12_GPU_DESCRIPTOR_HANDLE(
+                        heap.mDescriptorHeap->GetGPUDescriptorHandleForHeapStart(), offset,
+                        heap.mDescriptorHeapSize));
+                offset += table.second;
             }
-            CD3DX12_CPU_DESCRIPTOR_HANDLE dstHandle(
-                heap.mDescriptorHeap->GetCPUDescriptorHandleForHeapStart(), heap.mAllocatedNum,
-                heap.mDescriptorHeapSize);
-
-            device->getDevice()->CopyDescriptors(
-                1, &dstHandle, &num, num, tmpHandle.data(), nullptr, heap.mType);
-
-            commandList->SetGraphicsRootDescriptorTable(index,
-                CD3DX12_GPU_DESCRIPTOR_HANDLE(
-                    heap.mDescriptorHeap->GetGPUDescriptorHandleForHeapStart(), heap.mAllocatedNum,
-                    heap.mDescriptorHeapSize));
-            heap.mAllocatedNum += num;
         };
 
         switch (type) {
-        case DescriptorHeapType::CbvSrvUav:
-            setDescriptorSetSingle(
-                set.getCbvHandle().handle.data(), mGlobalHeap, set.getCbvHandle().max, 0);
-            setDescriptorSetSingle(
-                set.getSrvHandle().handle.data(), mGlobalHeap, set.getSrvHandle().max, 1);
-            setDescriptorSetSingle(
-                set.getUavHandle().handle.data(), mGlobalHeap, set.getUavHandle().max, 2);
-            break;
-        case DescriptorHeapType::Sampler:
-            setDescriptorSetSingle(
-                set.getSamplerHandle().handle.data(), mSamplerHeap, set.getSamplerHandle().max, 3);
-            break;
+        case DescriptorHeapType::CbvSrvUav: {
+            DescriptorSet::CbvSrvUavStaging staging;
+            const UINT total = set.stageCbvSrvUavHandle(&staging, mDefaultResourceInfo.cpuHandle);
+            copyAndSet(mGlobalHeap, mResourceTableCache, staging.data(), total,
+                set.getCbvSrvUavLayout(),
+                { { 0, set.getCbvHandle().max }, { 1, set.getSrvHandle().max },
+                    { 2, set.getUavHandle().max } });
+        } break;
+        case DescriptorHeapType::Sampler: {
+            DescriptorSet::SamplerStaging staging;
+            const UINT total = set.stageSamplerHandle(&staging, mDefaultSamplerInfo.cpuHandle);
+            copyAndSet(mSamplerHeap, mSamplerTableCache, staging.data(), total, total,
+                { { 3, total } });
+        } break;
         default: MY_ASSERTION(false, "Ή̃tOw肳܂B");
         }
     }
@@ -95,6 +210,15 @@ namespace Framework::DX {
         }
     }
 
+    //̃XbhŗLȃXR[vAP[^̃LbVT
+    DescriptorThreadCache<DescriptorAllocator>* DescriptorHeapManager::findThreadCache(
+        const DescriptorAllocator* allocator) {
+        for (ThreadCacheScope* scope = tCurrentScope; scope; scope = scope->mPrevious) {
+            if (auto* cache = scope->find(allocator)) return cache;
+        }
+        return nullptr;
+    }
+
     ID3D12DescriptorHeap* DescriptorHeapManager::getHeapFromType(DescriptorHeapType type) {
         switch (type) {
         case DescriptorHeapType::CbvSrvUav: return mGlobalHeap.getHeap();
@@ -1,6 +1,8 @@
 #pragma once
+#include "DX/Descriptor/DescriptorAllocator.h"
 #include "DX/Descriptor/DescriptorHeapFlag.h"
 #include "DX/Descriptor/DescriptorSet.h"
+#include "DX/Descriptor/DescriptorTableCache.h"
 #include "DX/Descriptor/GlobalDescriptorHeap.h"
 #include "DX/Raytracing/RaytracingDescriptorHeapManager.h"
 
@@ -11,13 +13,46 @@ namespace Framework::DX {
      */
     class DescriptorHeapManager {
     private:
-        static constexpr UINT GLOBAL_RESOURCE_HEAP_SIZE = 100000;
-        static constexpr UINT GLOBAL_SAMPLER_HEAP_SIZE = 1000;
+        static constexpr UINT GLOBAL_RESOURCE_HEAP_SIZE = 4096;
+        static constexpr UINT GLOBAL_SAMPLER_HEAP_SIZE = 256;
         static constexpr UINT RESOURCE_VIEW_ALLOCATE_SIZE = 2000;
+        static constexpr UINT RESOURCE_VIEW_RANGE_SIZE = 256;
         static constexpr UINT SAMPLER_VIEW_ALLOCATOR_SIZE = 1000;
         static constexpr UINT RTV_ALLOCATOR_SIZE = 10;
         static constexpr UINT DSV_ALLOCATOR_SIZE = 5;
 
+    public:
+        /**
+         * @class ThreadCacheScope
+         * @brief ͂̃XbhłCbvSrvUavSampler̊mۂƉLbVoRɂ
+         * @details [J[XbhŃr[鏈̐擪ōAXbhŔj邱
+         * jƂɃLbVĂfBXNv^AP[^ɕԂ
+         */
+        class ThreadCacheScope {
+        public:
+            /**
+             * @brief RXgN^
+             */
+            explicit ThreadCacheScope(DescriptorHeapManager* manager);
+            /**
+             * @brief fXgN^
+             */
+            ~ThreadCacheScope();
+            ThreadCacheScope(const ThreadCacheScope&) = delete;
+            ThreadCacheScope& operator=(const ThreadCacheScope&) = delete;
+            /**
+             * @brief AP[^ɑΉLbVT
+             * @return ̃XR[vňȂAP[^ȂnullptrԂ
+             */
+            DescriptorThreadCache<DescriptorAllocator>* find(const DescriptorAllocator* allocator);
+
+        private:
+            friend class DescriptorHeapManager;
+            DescriptorThreadCache<DescriptorAllocator> mResourceCache; //!< CbvSrvUaṽLbV
+            DescriptorThreadCache<DescriptorAllocator> mSamplerCache; //!< Sampler̃LbV
+            ThreadCacheScope* mPrevious; //!< ÕXR[v
+        };
+
     public:
         /**
          * @brief RXgN^
@@ -35,12 +70,56 @@ namespace Framework::DX {
         /**
          * @brief q[ṽAP[g
          * @param type q[v̎
+         * @details ̃XbhThreadCacheScope΂̃LbVmۂ
          */
         DescriptorInfo allocate(DescriptorHeapType type);
+        /**
+         * @brief q[v̉
+         * @param info fBXNv^ mیȂAoChX̃e[ułȂ͉̂Ȃ
+         */
+        void deallocate(DescriptorInfo* info);
+        /**
+         * @brief VF[_[猩Ȃq[ṽAP[^擾
+         * @param type q[v̎ CbvSrvUavASamplerARtvADsv̂ꂩ
+         * @details AfBXNv^KvȂƂ͂ꂩ璼ڊmۂ
+         */
+        DescriptorAllocator* getAllocator(DescriptorHeapType type);
         /**
          * @brief t[Jns
+         * @param completedFenceValue GPUʉ߂tFX̒l
+         */
+        void beginFrame(UINT64 completedFenceValue);
+        /**
+         * @brief t[Is
+         * @param fenceValue ̃t[̃R}h̊ɃVOitFX̒l
+         */
+        void endFrame(UINT64 fenceValue);
+        /**
+         * @brief VF[_[猩q[v̑傫擾
          */
-        void beginFrame();
+        UINT getCapacity(DescriptorHeapType type) const;
+        /**
+         * @brief VF[_[猩q[v̎gp̐̍ől擾
+         */
+        UINT getHighWaterMark(DescriptorHeapType type) const;
+        /**
+         * @brief oChX̃eNX`e[uł̃CfbNX擾
+         * @param info RaytracingLocalŊmۂfBXNv^
+         */
+        UINT getBindlessIndex(const DescriptorInfo& info) const;
+        /**
+         * @brief oChX̃eNX`e[u̐擪擾
+         */
+        D3D12_GPU_DESCRIPTOR_HANDLE getBindlessTableStart() const;
+        /**
+         * @brief Õt[̃e[ũLbV̓v擾
+         */
+        DescriptorTableCache::Stats getTableCacheStats() const;
+        /**
+         * @brief Rs[ς݂̃e[ũLbVj
+         * @details t[ŃRs[̃fBXNv^ꍇɌĂ ̃XbhĂׂ
+         */
+        void clearTableCache();
         /**
          * @brief fBXNv^̃Rs[ARs[gVF[_[ɃZbg
          */
@@ -65,6 +144,12 @@ namespace Framework::DX {
          * @brief q[v̎ނfBXNv^q[v擾
          */
         ID3D12DescriptorHeap* getHeapFromType(DescriptorHeapType type);
+        /**
+         * @brief ̃XbhŗLȃXR[vAP[^̃LbVT
+         * @return XR[vȂnullptrԂ
+         */
+        static DescriptorThreadCache<DescriptorAllocator>* findThreadCache(
+            const DescriptorAllocator* allocator);
 
     private:
         GlobalDescriptorHeap mGlobalHeap;
@@ -75,6 +160,8 @@ namespace Framework::DX {
         DescriptorAllocator mDsvAllocator;
         DescriptorInfo mDefaultResourceInfo;
         DescriptorInfo mDefaultSamplerInfo;
+        DescriptorTableCache mResourceTableCache; //!< CbvSrvUavɃRs[ς݂̃e[u
+        DescriptorTableCache mSamplerTableCache; //!< SamplerɃRs[ς݂̃e[u
         RaytracingDescriptorHeapManager mRaytracingDescriptor;
     };
     template <class... Types>
@@ -4,11 +4,13 @@ namespace Framework::DX {
     class DescriptorAllocator;
     /**
      * @class DescriptorInfo
-     * @brief discription
+     * @brief mۂfBXNv^̏
+     * @details parentnullptr͉̂̂łȂ
      */
     struct DescriptorInfo {
-        DescriptorAllocator* parent;
-        D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle;
-        D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle;
+        DescriptorAllocator* parent = nullptr; //!< mۂAP[^
+        D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle = {}; //!< CPUnh
+        D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle = {}; //!< GPUnh
+        UINT count = 1; //!< AĊmۂ
     };
 } // namespace Framework::DX
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "DescriptorRangeAllocator.h"
+
+namespace Framework::DX {
+    //RXgN^
+    DescriptorRangeAllocator::DescriptorRangeAllocator() : mCapacity(0), mFreeCount(0) {}
+    //fXgN^
+    DescriptorRangeAllocator::~DescriptorRangeAllocator() {}
+    //
+    void DescriptorRangeAllocator::init(UINT capacity) {
+        mCapacity = capacity;
+        reset();
+    }
+    //m
+    UINT DescriptorRangeAllocator::allocate(UINT count) {
+        MY_ASSERTION(count > 0, "0̊mۂ͂ł܂");
+        //܂钆ōł󂫗̈T
+        SizeMap::iterator sizeIt = mFreeRangesBySize.lower_bound(count);
+        if (sizeIt == mFreeRangesBySize.end()) return INVALID_OFFSET;
+
+        const UINT offset = sizeIt->second;
+        const UINT rangeCount = sizeIt->first;
+        removeFreeRange(mFreeRangesByOffset.find(offset));
+        //]͋󂫗̈ɖ߂
+        if (rangeCount > count) { addFreeRange(offset + count, rangeCount - count); }
+        mFreeCount -= count;
+        return offset;
+    }
+    //
+    void DescriptorRangeAllocator::free(UINT offset, UINT count) {
+        MY_ASSERTION(offset + count <= mCapacity, "͈͊ÕItZbgw肳܂");
+        UINT newOffset = offset;
+        UINT newCount = count;
+
+        //̋󂫗̈ƌ
+        OffsetMap::iterator next = mFreeRangesByOffset.upper_bound(offset);
+        if (next != mFreeRangesByOffset.end()) {
+            MY_ASSERTION(offset + count <= next->first, "d܂");
+            if (offset + count == next->first) {
+                newCount += next->second.count;
+                OffsetMap::iterator merged = next++;
+                removeFreeRange(merged);
+            }
+        }
+        //Ő󂫗̈ƌ
+        if (next != mFreeRangesByOffset.begin()) {
+            OffsetMap::iterator prev = std::prev(next);
+            MY_ASSERTION(prev->first + prev->second.count <= offset, "d܂");
+            if (prev->first + prev->second.count == offset) {
+                newOffset = prev->first;
+                newCount += prev->second.count;
+                removeFreeRange(prev);
+            }
+        }
+        addFreeRange(newOffset, newCount);
+        mFreeCount += count;
+    }
+    //ׂĉ
+    void DescriptorRangeAllocator::reset() {
+        mFreeRangesByOffset.clear();
+        mFreeRangesBySize.clear();
+        mFreeCount = 0;
+        if (mCapacity == 0) return;
+        addFreeRange(0, mCapacity);
+        mFreeCount = mCapacity;
+    }
+    //󂫗̈̒ǉ
+    void DescriptorRangeAllocator::addFreeRange(UINT offset, UINT count) {
+        SizeMap::iterator sizeIt = mFreeRangesBySize.emplace(count, offset);
+        mFreeRangesByOffset.emplace(offset, FreeRange{ count, sizeIt });
+    }
+    //󂫗̈̍폜
+    void DescriptorRangeAllocator::removeFreeRange(OffsetMap::iterator it) {
+        mFreeRangesBySize.erase(it->second.sizeIt);
+        mFreeRangesByOffset.erase(it);
+    }
+} // namespace Framework::DX
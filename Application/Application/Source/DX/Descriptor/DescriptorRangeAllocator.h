@@ -0,0 +1,94 @@
+/**
+ * @file DescriptorRangeAllocator.h
+ * @brief fBXNv^͈̔͂̊mۊǗ
+ * @details q[vɂ͈ˑAItZbgƌǗ
+ */
+
+#pragma once
+#include <map>
+
+namespace Framework::DX {
+    /**
+     * @class DescriptorRangeAllocator
+     * @brief 󂫃XgɂA͈͂̃AP[^
+     * @details 󂫗̈ItZbgƑ傫̓ŊǗAł܂͈͂mۂ
+     * ͑Ő󂫗̈ƌ
+     */
+    class DescriptorRangeAllocator {
+    public:
+        static constexpr UINT INVALID_OFFSET = UINT_MAX; //!< mێs̃ItZbg
+    public:
+        /**
+         * @brief RXgN^
+         */
+        DescriptorRangeAllocator();
+        /**
+         * @brief fXgN^
+         */
+        ~DescriptorRangeAllocator();
+        /**
+         * @brief 
+         * @param capacity Ǘ鑍
+         */
+        void init(UINT capacity);
+        /**
+         * @brief A͈͂mۂ
+         * @param count mۂ鐔
+         * @return mۂ擪̃ItZbg mۂłȂINVALID_OFFSETԂ
+         */
+        UINT allocate(UINT count = 1);
+        /**
+         * @brief ͈͂
+         * @param offset mێɕԂꂽItZbg
+         * @param count mۂ
+         */
+        void free(UINT offset, UINT count = 1);
+        /**
+         * @brief ׂĉ
+         */
+        void reset();
+        /**
+         * @brief Ǘ鑍擾
+         */
+        UINT getCapacity() const {
+            return mCapacity;
+        }
+        /**
+         * @brief 󂢂Ă鑍擾
+         */
+        UINT getFreeCount() const {
+            return mFreeCount;
+        }
+        /**
+         * @brief xɊmۂłő吔擾
+         */
+        UINT getLargestFreeRange() const {
+            return mFreeRangesBySize.empty() ? 0 : mFreeRangesBySize.rbegin()->first;
+        }
+
+    private:
+        using SizeMap = std::multimap<UINT, UINT>;
+        /**
+         * @brief 󂫗̈
+         */
+        struct FreeRange {
+            UINT count; //!< 
+            SizeMap::iterator sizeIt; //!< 傫̊Ǘ
+        };
+        using OffsetMap = std::map<UINT, FreeRange>;
+        /**
+         * @brief 󂫗̈ǉ
+         */
+        void addFreeRange(UINT offset, UINT count);
+        /**
+         * @brief 󂫗̈폜
+         */
+        void removeFreeRange(OffsetMap::iterator it);
+
+    private:
+        OffsetMap mFreeRangesByOffset; //!< ItZbg̋󂫗̈
+        SizeMap mFreeRangesBySize; //!< 傫̋󂫗̈ l̓ItZbg
+        UINT mCapacity; //!< Ǘ鑍
+        UINT mFreeCount; //!< 󂢂Ă鑍
+    };
+} // namespace Framework::DX
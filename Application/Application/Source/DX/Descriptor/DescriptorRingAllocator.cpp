@@ -0,0 +1,66 @@
+#include "DescriptorRingAllocator.h"
+#include "Math/MathUtility.h"
+
+namespace Framework::DX {
+    //RXgN^
+    DescriptorRingAllocator::DescriptorRingAllocator()
+        : mCapacity(0),
+          mHead(0),
+          mUsedCount(0),
+          mCurrentFrameCount(0),
+          mLastFrameCount(0),
+          mHighWaterMark(0) {}
+    //fXgN^
+    DescriptorRingAllocator::~DescriptorRingAllocator() {}
+    //
+    void DescriptorRingAllocator::init(UINT capacity) {
+        mFrames.clear();
+        mCapacity = capacity;
+        mHead = 0;
+        mUsedCount = 0;
+        mCurrentFrameCount = 0;
+    }
+    //m
+    UINT DescriptorRingAllocator::allocate(UINT count) {
+        MY_ASSERTION(count > 0, "0̊mۂ͂ł܂");
+        if (mUsedCount + count > mCapacity) return INVALID_OFFSET;
+
+        UINT offset = mHead;
+        UINT consumed = count;
+        if (mUsedCount == 0) {
+            //Ȃ擪l߂
+            offset = 0;
+        } else {
+            //gp͈̔͂tailmHead̎O܂
+            const UINT tail = (mHead + mCapacity - mUsedCount) % mCapacity;
+            if (tail > mHead) {
+                if (mHead + count > tail) return INVALID_OFFSET;
+            } else if (mHead + count > mCapacity) {
+                //Ɏ܂ȂΖ̂ĂĐ擪mۂ
+                if (count > tail) return INVALID_OFFSET;
+                consumed += mCapacity - mHead;
+                offset = 0;
+            }
+        }
+
+        mHead = (offset + count) % mCapacity;
+        mUsedCount += consumed;
+        mCurrentFrameCount += consumed;
+        mHighWaterMark = Math::MathUtil::mymax(mHighWaterMark, mUsedCount);
+        return offset;
+    }
+    //t[I
+    void DescriptorRingAllocator::endFrame(UINT64 fenceValue) {
+        mLastFrameCount = mCurrentFrameCount;
+        if (mCurrentFrameCount == 0) return;
+        mFrames.push_back({ fenceValue, mCurrentFrameCount });
+        mCurrentFrameCount = 0;
+    }
+    //t[
+    void DescriptorRingAllocator::retire(UINT64 completedFenceValue) {
+        while (!mFrames.empty() && mFrames.front().fenceValue <= completedFenceValue) {
+            mUsedCount -= mFrames.front().count;
+            mFrames.pop_front();
+        }
+    }
+} // namespace Framework::DX
@@ -0,0 +1,101 @@
+/**
+ * @file DescriptorRingAllocator.h
+ * @brief t[ƂɎĝĂfBXNv^̃OAP[^
+ * @details q[vɂ͈ˑAItZbgƃtFX̒lǗ
+ */
+
+#pragma once
+#include <deque>
+
+namespace Framework::DX {
+    /**
+     * @class DescriptorRingAllocator
+     * @brief tFXŉǗ郊OAP[^
+     * @details mۂ͈͂̓t[Pʂł܂Ƃ߁Ãt[̃tFX̒lGPUʉ߂
+     * A͈͂Ɏ܂Ȃꍇ͖̂ĂĐ擪mۂ
+     */
+    class DescriptorRingAllocator {
+    public:
+        static constexpr UINT INVALID_OFFSET = UINT_MAX; //!< mێs̃ItZbg
+    public:
+        /**
+         * @brief RXgN^
+         */
+        DescriptorRingAllocator();
+        /**
+         * @brief fXgN^
+         */
+        ~DescriptorRingAllocator();
+        /**
+         * @brief 
+         * @param capacity Ǘ鑍
+         * @details gpׂ͈̔͂͂Ĕj gp̐̍ől͈p
+         */
+        void init(UINT capacity);
+        /**
+         * @brief A͈͂mۂ
+         * @param count mۂ鐔
+         * @return mۂ擪̃ItZbg mۂłȂINVALID_OFFSETԂ
+         */
+        UINT allocate(UINT count);
+        /**
+         * @brief t[I
+         * @param fenceValue ̃t[̃R}h̊ɃVOitFX̒l
+         */
+        void endFrame(UINT64 fenceValue);
+        /**
+         * @brief GPUt[͈̔͂
+         * @param completedFenceValue GPUʉ߂tFX̒l
+         */
+        void retire(UINT64 completedFenceValue);
+        /**
+         * @brief Ǘ鑍擾
+         */
+        UINT getCapacity() const {
+            return mCapacity;
+        }
+        /**
+         * @brief gp̐擾
+         */
+        UINT getUsedCount() const {
+            return mUsedCount;
+        }
+        /**
+         * @brief gp̐̍ől擾
+         */
+        UINT getHighWaterMark() const {
+            return mHighWaterMark;
+        }
+        /**
+         * @brief ŌɏIt[Ŋmۂ擾
+         * @details ̂Ă܂
+         */
+        UINT getLastFrameCount() const {
+            return mLastFrameCount;
+        }
+        /**
+         * @brief ҂̃t[擾
+         */
+        UINT getPendingFrameCount() const {
+            return static_cast<UINT>(mFrames.size());
+        }
+
+    private:
+        /**
+         * @brief ҂̃t[
+         */
+        struct Frame {
+            UINT64 fenceValue; //!< ɃVOitFX̒l
+            UINT count; //!< mۂ ̂Ă܂
+        };
+
+    private:
+        std::deque<Frame> mFrames; //!< ҂̃t[ Â
+        UINT mCapacity; //!< Ǘ鑍
+        UINT mHead; //!< Ɋmۂʒu
+        UINT mUsedCount; //!< gp̐
+        UINT mCurrentFrameCount; //!< ݂̃t[Ŋmۂ
+        UINT mLastFrameCount; //!< ŌɏIt[Ŋmۂ
+        UINT mHighWaterMark; //!< gp̐̍ől
+    };
+} // namespace Framework::DX
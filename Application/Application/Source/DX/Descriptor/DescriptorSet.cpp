@@ -18,4 +18,27 @@ namespace Framework::DX {
         mSamplerHandle.max = Math::MathUtil::mymax(mSamplerHandle.max, index + 1);
         mSamplerHandle.handle[index] = cpuHandle;
     }
+    //CBVESRVEUAVׂ
+    UINT DescriptorSet::stageCbvSrvUavHandle(
+        CbvSrvUavStaging* staging, const D3D12_CPU_DESCRIPTOR_HANDLE& defaultHandle) const {
+        UINT num = 0;
+        auto stage = [&](const D3D12_CPU_DESCRIPTOR_HANDLE* handles, UINT max) {
+            for (UINT n = 0; n < max; n++) {
+                (*staging)[num++] = handles[n].ptr == 0 ? defaultHandle : handles[n];
+            }
+        };
+        stage(mCbvHandle.handle.data(), mCbvHandle.max);
+        stage(mSrvHandle.handle.data(), mSrvHandle.max);
+        stage(mUavHandle.handle.data(), mUavHandle.max);
+        return num;
+    }
+    //Tv[ׂ
+    UINT DescriptorSet::stageSamplerHandle(
+        SamplerStaging* staging, const D3D12_CPU_DESCRIPTOR_HANDLE& defaultHandle) const {
+        for (UINT n = 0; n < mSamplerHandle.max; n++) {
+            const D3D12_CPU_DESCRIPTOR_HANDLE& handle = mSamplerHandle.handle[n];
+            (*staging)[n] = handle.ptr == 0 ? defaultHandle : handle;
+        }
+        return mSamplerHandle.max;
+    }
 } // namespace Framework::DX
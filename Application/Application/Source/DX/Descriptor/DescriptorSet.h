@@ -15,11 +15,17 @@ namespace Framework::DX {
      * @brief discription
      */
     class DescriptorSet {
-    private:
+    public:
         static constexpr UINT MAX_SRV_NUM = 48;
         static constexpr UINT MAX_CBV_NUM = 16;
         static constexpr UINT MAX_UAV_NUM = 16;
         static constexpr UINT MAX_SAMPLER_NUM = 16;
+        static constexpr UINT MAX_CBV_SRV_UAV_NUM
+            = MAX_CBV_NUM + MAX_SRV_NUM + MAX_UAV_NUM; //!< CBVESRVEUAV܂Ƃ߂ő吔
+        using CbvSrvUavStaging = std::array<D3D12_CPU_DESCRIPTOR_HANDLE, MAX_CBV_SRV_UAV_NUM>;
+        using SamplerStaging = std::array<D3D12_CPU_DESCRIPTOR_HANDLE, MAX_SAMPLER_NUM>;
+
+    private:
         using CBVHandle = Handle<MAX_CBV_NUM>;
         using SRVHandle = Handle<MAX_SRV_NUM>;
         using UAVHandle = Handle<MAX_UAV_NUM>;
@@ -50,6 +56,29 @@ namespace Framework::DX {
         const SamplerHandle& getSamplerHandle() const {
             return mSamplerHandle;
         }
+        /**
+         * @brief CBVESRVEUAṼnh̏ŘAĕׂ
+         * @param[out] staging א
+         * @param defaultHandle ZbgĂȂꏊɓnh
+         * @return ׂ
+         */
+        UINT stageCbvSrvUavHandle(
+            CbvSrvUavStaging* staging, const D3D12_CPU_DESCRIPTOR_HANDLE& defaultHandle) const;
+        /**
+         * @brief Tv[̃nhAĕׂ
+         * @param[out] staging א
+         * @param defaultHandle ZbgĂȂꏊɓnh
+         * @return ׂ
+         */
+        UINT stageSamplerHandle(
+            SamplerStaging* staging, const D3D12_CPU_DESCRIPTOR_HANDLE& defaultHandle) const;
+        /**
+         * @brief CBVESRVEUAṼe[u̕擾
+         */
+        UINT64 getCbvSrvUavLayout() const {
+            return static_cast<UINT64>(mCbvHandle.max) | static_cast<UINT64>(mSrvHandle.max) << 16
+                | static_cast<UINT64>(mUavHandle.max) << 32;
+        }
 
     private:
         CBVHandle mCbvHandle;
@@ -0,0 +1,64 @@
+#include "DescriptorTableCache.h"
+
+namespace Framework::DX {
+    //RXgN^
+    DescriptorTableCache::DescriptorTableCache() : mInvalidated(false) {}
+    //fXgN^
+    DescriptorTableCache::~DescriptorTableCache() {}
+    //t[Jn
+    void DescriptorTableCache::beginFrame() {
+        mLastFrameStats = mCurrentStats;
+        mCurrentStats = Stats();
+        clear();
+    }
+    //LbVj
+    void DescriptorTableCache::clear() {
+        //eʂ͎cĂÃt[ŊmۂȂ悤ɂ
+        mEntries.clear();
+        mHandles.clear();
+    }
+    //Rs[ς݂̈ʒuT
+    bool DescriptorTableCache::find(
+        const D3D12_CPU_DESCRIPTOR_HANDLE* handles, UINT num, UINT64 layout, UINT* offset) {
+        if (mInvalidated.exchange(false, std::memory_order_acq_rel)) clear();
+        mCurrentStats.lookupCount++;
+        auto it = mEntries.find(computeHash(handles, num, layout));
+        if (it == mEntries.end()) return false;
+
+        //nbVlՓ˂ĂȂтׂ
+        const Entry& entry = it->second;
+        if (entry.layout != layout || entry.num != num) return false;
+        for (UINT n = 0; n < num; n++) {
+            if (mHandles[entry.handleIndex + n] != handles[n].ptr) return false;
+        }
+
+        *offset = entry.offset;
+        mCurrentStats.hitCount++;
+        mCurrentStats.savedCopyCount++;
+        mCurrentStats.savedDescriptorCount += num;
+        return true;
+    }
+    //Rs[ʒuo^
+    void DescriptorTableCache::insert(
+        const D3D12_CPU_DESCRIPTOR_HANDLE* handles, UINT num, UINT64 layout, UINT offset) {
+        Entry entry;
+        entry.layout = layout;
+        entry.num = num;
+        entry.handleIndex = static_cast<UINT>(mHandles.size());
+        entry.offset = offset;
+        for (UINT n = 0; n < num; n++) { mHandles.emplace_back(handles[n].ptr); }
+        mEntries[computeHash(handles, num, layout)] = entry;
+    }
+    //nbVlvZ
+    UINT64 DescriptorTableCache::computeHash(
+        const D3D12_CPU_DESCRIPTOR_HANDLE* handles, UINT num, UINT64 layout) {
+        //nh̓AhXȂ̂ŁAoCgPʂł͂Ȃ8oCgPʂō
+        auto mix = [](UINT64 hash, UINT64 value) {
+            hash ^= value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+            return hash;
+        };
+        UINT64 hash = mix(layout, num);
+        for (UINT n = 0; n < num; n++) { hash = mix(hash, static_cast<UINT64>(handles[n].ptr)); }
+        return hash;
+    }
+} // namespace Framework::DX
@@ -0,0 +1,105 @@
+/**
+ * @file DescriptorTableCache.h
+ * @brief Rs[ς݃fBXNv^e[ũLbV
+ */
+
+#pragma once
+#include <atomic>
+#include <unordered_map>
+
+namespace Framework::DX {
+    /**
+     * @class DescriptorTableCache
+     * @brief t[œfBXNv^̕тRs[Ȃ߂̃LbV
+     * @details nh̕т̃nbVlAVF[_[猩q[vɃRs[ς݂̈ʒu
+     * Rs[ς݂͈̔͂̓t[I܂łLłȂ̂ŁAt[j
+     * t[ŃRs[̃fBXNv^ꍇinvalidateĂԂ
+     * invalidateȊO͋L^Xbĥ݌Ă
+     */
+    class DescriptorTableCache {
+    public:
+        /**
+         * @brief LbV̓v
+         */
+        struct Stats {
+            UINT lookupCount = 0; //!< 
+            UINT hitCount = 0; //!< qbg
+            UINT savedCopyCount = 0; //!< ȗCopyDescriptoršĂяo
+            UINT savedDescriptorCount = 0; //!< ȗfBXNv^̃Rs[
+        };
+
+    public:
+        /**
+         * @brief RXgN^
+         */
+        DescriptorTableCache();
+        /**
+         * @brief fXgN^
+         */
+        ~DescriptorTableCache();
+        /**
+         * @brief t[Jn
+         * @details LbVjAÕt[̓vm肷
+         */
+        void beginFrame();
+        /**
+         * @brief LbVj
+         */
+        void clear();
+        /**
+         * @brief ̌ɃLbVj
+         * @details ̃XbhĂׂ
+         */
+        void invalidate() {
+            mInvalidated.store(true, std::memory_order_release);
+        }
+        /**
+         * @brief Rs[ς݂̈ʒuT
+         * @param handles Rs[̃nh̕
+         * @param num nh̐
+         * @param layout e[u̕ тłႦΕʂ̂̂ƂĈ
+         * @param[out] offset Rs[ς݂̐擪̃ItZbg
+         * @return trueԂ
+         */
+        bool find(
+            const D3D12_CPU_DESCRIPTOR_HANDLE* handles, UINT num, UINT64 layout, UINT* offset);
+        /**
+         * @brief Rs[ʒuo^
+         * @param handles Rs[̃nh̕
+         * @param num nh̐
+         * @param layout e[u̕
+         * @param offset Rs[̐擪̃ItZbg
+         */
+        void insert(
+            const D3D12_CPU_DESCRIPTOR_HANDLE* handles, UINT num, UINT64 layout, UINT offset);
+        /**
+         * @brief Õt[̓v擾
+         */
+        const Stats& getLastFrameStats() const {
+            return mLastFrameStats;
+        }
+
+    private:
+        /**
+         * @brief LbV̗vf
+         */
+        struct Entry {
+            UINT64 layout; //!< e[u̕
+            UINT num; //!< nh̐
+            UINT handleIndex; //!< mHandles̒̊Jnʒu
+            UINT offset; //!< Rs[̐擪̃ItZbg
+        };
+        /**
+         * @brief nh̕т̃nbVlvZ
+         */
+        static UINT64 computeHash(
+            const D3D12_CPU_DESCRIPTOR_HANDLE* handles, UINT num, UINT64 layout);
+
+    private:
+        std::unordered_map<UINT64, Entry> mEntries; //!< nbVlRs[ς݂̈ʒu
+        std::vector<SIZE_T> mHandles; //!< Փ˔p̃nh̕
+        Stats mCurrentStats; //!< ݂̃t[̓v
+        Stats mLastFrameStats; //!< Õt[̓v
+        std::atomic<bool> mInvalidated; //!< LbVjKv邩
+    };
+} // namespace Framework::DX
@@ -0,0 +1,138 @@
+/**
+ * @file DescriptorThreadCache.h
+ * @brief XbhƂ̃fBXNv^̃LbV
+ */
+
+#pragma once
+#include <array>
+#include "DX/Descriptor/AtomicIndexAllocator.h"
+
+namespace Framework::DX {
+    /**
+     * @struct DescriptorCacheTraits
+     * @brief LbVmی̃AP[^@
+     * @details AP[^ƂɓꉻÂ̂`
+     * - Item mۂ
+     * - allocate(allocator) 1mۂ mۂłȂΖȒlԂ
+     * - deallocate(allocator, item) 1
+     * - isValid(item) LȒl
+     * - invalid() Ȓl
+     */
+    template <class Allocator>
+    struct DescriptorCacheTraits;
+
+    /**
+     * @brief CfbNX̃AP[^璼ڃLbV
+     */
+    template <>
+    struct DescriptorCacheTraits<AtomicIndexAllocator> {
+        using Item = UINT;
+        static UINT allocate(AtomicIndexAllocator* allocator) {
+            return allocator->allocate();
+        }
+        static void deallocate(AtomicIndexAllocator* allocator, UINT* index) {
+            allocator->free(*index);
+            *index = invalid();
+        }
+        static bool isValid(UINT index) {
+            return index != AtomicIndexAllocator::INVALID_INDEX;
+        }
+        static UINT invalid() {
+            return AtomicIndexAllocator::INVALID_INDEX;
+        }
+    };
+
+    /**
+     * @class DescriptorThreadCache
+     * @brief XbhƂɎfBXNv^̃LbV
+     * @tparam Allocator mی̃AP[^ DescriptorCacheTraitsꉻĂ邱
+     * @details ܂Ƃ߂ĊmۂĂAL̃AP[^ւ̃ANZX炷
+     * ̃NX̂̓XbhZ[tł͂Ȃ̂ŁA̃Xbĥݎg
+     */
+    template <class Allocator>
+    class DescriptorThreadCache {
+    private:
+        using Traits = DescriptorCacheTraits<Allocator>;
+
+    public:
+        using Item = typename Traits::Item;
+        static constexpr UINT CACHE_SIZE = 16; //!< LbVłő吔
+        static constexpr UINT BATCH_SIZE = CACHE_SIZE / 2; //!< ܂Ƃ߂ĊmہAԋp鐔
+    public:
+        /**
+         * @brief RXgN^
+         * @param allocator mی̃AP[^
+         */
+        explicit DescriptorThreadCache(Allocator* allocator)
+            : mAllocator(allocator), mCachedNum(0) {
+            MY_ASSERTION(mAllocator, "AP[^nullł");
+        }
+        /**
+         * @brief fXgN^
+         * @details LbVĂfBXNv^̓AP[^ɕԂ
+         */
+        ~DescriptorThreadCache() {
+            flush();
+        }
+        DescriptorThreadCache(const DescriptorThreadCache&) = delete;
+        DescriptorThreadCache& operator=(const DescriptorThreadCache&) = delete;
+        /**
+         * @brief fBXNv^̊m
+         * @return AP[^mۂłȂΖȒlԂ
+         */
+        Item allocate() {
+            //ɂȂ܂Ƃ߂ĕ[ ȂΕ[łg
+            if (mCachedNum == 0) {
+                while (mCachedNum < BATCH_SIZE) {
+                    const Item item = Traits::allocate(mAllocator);
+                    if (!Traits::isValid(item)) break;
+                    mCache[mCachedNum++] = item;
+                }
+                if (mCachedNum == 0) return Traits::invalid();
+            }
+            return mCache[--mCachedNum];
+        }
+        /**
+         * @brief fBXNv^̉
+         * @param item fBXNv^ ͖ȒlɂȂ
+         */
+        void deallocate(Item* item) {
+            MY_ASSERTION(Traits::isValid(*item), "ȃfBXNv^悤Ƃ܂");
+            //ςɂȂ甼Ԃ
+            if (mCachedNum == CACHE_SIZE) release(CACHE_SIZE - BATCH_SIZE);
+            mCache[mCachedNum++] = *item;
+            *item = Traits::invalid();
+        }
+        /**
+         * @brief LbVĂfBXNv^ׂăAP[^ɕԂ
+         */
+        void flush() {
+            release(0);
+        }
+        /**
+         * @brief LbVĂ鐔擾
+         */
+        UINT getCachedNum() const {
+            return mCachedNum;
+        }
+        /**
+         * @brief mی̃AP[^擾
+         */
+        Allocator* getAllocator() const {
+            return mAllocator;
+        }
+
+    private:
+        /**
+         * @brief LbVĂfBXNv^w萔܂ŃAP[^ɕԂ
+         */
+        void release(UINT remainNum) {
+            while (mCachedNum > remainNum) { Traits::deallocate(mAllocator, &mCache[--mCachedNum]); }
+        }
+
+    private:
+        Allocator* mAllocator; //!< mی̃AP[^
+        std::array<Item, CACHE_SIZE> mCache; //!< LbVĂfBXNv^
+        UINT mCachedNum; //!< LbVĂ鐔
+    };
+} // namespace Framework::DX
@@ -3,21 +3,75 @@
 #include "DX/Descriptor/DescriptorSet.h"
 #include "DX/Descriptor/LocalDescriptorHeap.h"
 #include "DX/DeviceResource.h"
+#include "Math/MathUtility.h"
 
 namespace Framework::DX {
 
-    void GlobalDescriptorHeap::init(
-        ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorHeapNum) {
+    void GlobalDescriptorHeap::init(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type,
+        UINT descriptorHeapNum, UINT maxDescriptorHeapNum) {
+        mDevice = device;
         mType = type;
+        mMaxDescriptorHeapNum = maxDescriptorHeapNum;
+        mDescriptorHeapSize = device->GetDescriptorHandleIncrementSize(mType);
+        createHeap(descriptorHeapNum);
+    }
+    //t[Jn
+    void GlobalDescriptorHeap::beginFrame(UINT64 completedFenceValue) {
+        mRing.retire(completedFenceValue);
+        mRetiredHeaps.erase(std::remove_if(mRetiredHeaps.begin(), mRetiredHeaps.end(),
+                                [&](const RetiredHeap& retired) {
+                                    return retired.fenceValue != 0
+                                        && retired.fenceValue <= completedFenceValue;
+                                }),
+            mRetiredHeaps.end());
 
+        //܂ZbgĂȂɍ蒼
+        const UINT newHeapNum = computeRequiredHeapNum();
+        if (newHeapNum == mRing.getCapacity()) return;
+        MY_DEBUG_LOG("fBXNv^q[vg܂ %u -> %u\n", mRing.getCapacity(), newHeapNum);
+        //Âq[vGPUgI܂ŕێ
+        mRetiredHeaps.push_back({ mDescriptorHeap, 0 });
+        createHeap(newHeapNum);
+        mGrowCount++;
+    }
+    //t[I
+    void GlobalDescriptorHeap::endFrame(UINT64 fenceValue) {
+        mRing.endFrame(fenceValue);
+        //̃t[ō蒼q[v͂̃t[̊܂Ŏg
+        for (auto&& retired : mRetiredHeaps) {
+            if (retired.fenceValue == 0) retired.fenceValue = fenceValue;
+        }
+    }
+    //m
+    UINT GlobalDescriptorHeap::allocate(UINT num) {
+        //Zbgς݂̃e[uɂȂ̂ŁAt[̓rł̓q[v蒼Ȃ
+        const UINT offset = mRing.allocate(num);
+        MY_THROW_IF_FALSE_LOG(offset != DescriptorRingAllocator::INVALID_OFFSET,
+            "1t[ŎgfBXNv^q[v̑傫𒴂܂ %u", mRing.getCapacity());
+        return offset;
+    }
+    //Kvȃq[v̑傫߂
+    UINT GlobalDescriptorHeap::computeRequiredHeapNum() const {
+        const UINT capacity = mRing.getCapacity();
+        const UINT64 required
+            = static_cast<UINT64>(mRing.getLastFrameCount()) * FRAME_HEADROOM;
+        if (required <= capacity) return capacity;
+
+        UINT64 newHeapNum = static_cast<UINT64>(capacity) * 2;
+        while (newHeapNum < required) { newHeapNum *= 2; }
+        return static_cast<UINT>(
+            Math::MathUtil::mymin(newHeapNum, static_cast<UINT64>(mMaxDescriptorHeapNum)));
+    }
+    //q[v쐬
+    void GlobalDescriptorHeap::createHeap(UINT descriptorHeapNum) {
         D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
         heapDesc.Type = mType;
         heapDesc.NumDescriptors = descriptorHeapNum;
         heapDesc.NodeMask = 0;
         heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAGS::D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-        MY_THROW_IF_FAILED(device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&mDescriptorHeap)));
-        mDescriptorHeapSize = device->GetDescriptorHandleIncrementSize(mType);
-
-        mLocalAreaIndex = descriptorHeapNum / 2;
+        Comptr<ID3D12DescriptorHeap> heap;
+        MY_THROW_IF_FAILED(mDevice->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&heap)));
+        mDescriptorHeap = heap;
+        mRing.init(descriptorHeapNum);
     }
 } // namespace Framework::DX
@@ -1,5 +1,6 @@
 #pragma once
 #include "DX/Descriptor/DescriptorInfo.h"
+#include "DX/Descriptor/DescriptorRingAllocator.h"
 
 namespace Framework::DX {
     class DescriptorSet;
@@ -7,6 +8,10 @@ namespace Framework::DX {
     /**
      * @class GlobalDescriptorHeap
      * @brief ɃpCvCɃZbgfBXNv^q[v
+     * @details t[ƂɃOŊmۂAGPUgI͈͂ėp
+     * Õt[̎gpʂɑ΂đȂȂ肻Ȃt[̊Jnɑ傫q[v蒼A
+     * Âq[vGPUgI܂ŕێ
+     * t[̓rł͍蒼Ȃ̂ŁAZbgς݂̃q[vƃe[u͖ɂȂȂ
      */
     class GlobalDescriptorHeap {
     public:
@@ -18,37 +23,89 @@ namespace Framework::DX {
          * @brief fXgN^
          */
         ~GlobalDescriptorHeap() {}
-
-        void init(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorHeapNum);
-        void reset() {
-            mAllocatedNum = 0;
-        }
+        /**
+         * @brief 
+         * @param device foCX
+         * @param type q[v̎
+         * @param descriptorHeapNum ŏ̃q[v̑傫
+         * @param maxDescriptorHeapNum głő̑傫
+         */
+        void init(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorHeapNum,
+            UINT maxDescriptorHeapNum);
+        /**
+         * @brief t[Jn
+         * @param completedFenceValue GPUʉ߂tFX̒l
+         * @details GPUgI͈͂ƃq[vAȂȂ肻Ȃq[v蒼
+         * 蒼ꍇ̓q[vZbgKv邪At[̊Jn͖ZbĝŖȂ
+         */
+        void beginFrame(UINT64 completedFenceValue);
+        /**
+         * @brief t[I
+         * @param fenceValue ̃t[̃R}h̊ɃVOitFX̒l
+         */
+        void endFrame(UINT64 fenceValue);
+        /**
+         * @brief A͈͂mۂ
+         * @param num mۂ鐔
+         * @return mۂ擪̃ItZbg
+         * @details 1t[Ŏgq[v̑傫𒴂O𓊂
+         */
+        UINT allocate(UINT num);
         ID3D12DescriptorHeap* getHeap() const {
             return mDescriptorHeap.Get();
         }
         UINT getHeapSize() const {
             return mDescriptorHeapSize;
         }
-        bool canCopy(UINT num) const {
-            return mAllocatedNum + num < mDescriptorHeap->GetDesc().NumDescriptors;
+        /**
+         * @brief ݂̃q[v̑傫擾
+         */
+        UINT getCapacity() const {
+            return mRing.getCapacity();
+        }
+        /**
+         * @brief gp̐̍ől擾
+         */
+        UINT getHighWaterMark() const {
+            return mRing.getHighWaterMark();
         }
-        DescriptorInfo allocate(ID3D12Device* device) {
-            DescriptorInfo info;
-            info.cpuHandle = CD3DX12_CPU_DESCRIPTOR_HANDLE(
-                mDescriptorHeap->GetCPUDescriptorHandleForHeapStart(), mLocalAreaIndex,
-                mDescriptorHeapSize);
-            info.gpuHandle = CD3DX12_GPU_DESCRIPTOR_HANDLE(
-                mDescriptorHeap->GetGPUDescriptorHandleForHeapStart(), mLocalAreaIndex,
-                mDescriptorHeapSize);
-            mLocalAreaIndex++;
-            return info;
+        /**
+         * @brief q[v蒼񐔂擾
+         */
+        UINT getGrowCount() const {
+            return mGrowCount;
         }
 
+    private:
+        /**
+         * @brief q[v쐬
+         */
+        void createHeap(UINT descriptorHeapNum);
+        /**
+         * @brief Õt[̎gpʂKvȃq[v̑傫߂
+         * @return ̑傫őȂ獡̑傫Ԃ
+         */
+        UINT computeRequiredHeapNum() const;
+
+    public:
         //private:
         Comptr<ID3D12DescriptorHeap> mDescriptorHeap;
         UINT mDescriptorHeapSize = 0;
-        UINT mAllocatedNum = 0;
-        UINT mLocalAreaIndex = 0;
         D3D12_DESCRIPTOR_HEAP_TYPE mType = {};
+
+    private:
+        /**
+         * @brief ҂̃q[v
+         */
+        struct RetiredHeap {
+            Comptr<ID3D12DescriptorHeap> heap; //!< q[v
+            UINT64 fenceValue; //!< gItFX̒l 0Ȃt[IĂȂ
+        };
+        static constexpr UINT FRAME_HEADROOM = 2; //!< Õt[̎gpʂ̉{mۂĂ
+        ID3D12Device* mDevice = nullptr;
+        DescriptorRingAllocator mRing; //!< t[Ƃ̊mۊǗ
+        std::vector<RetiredHeap> mRetiredHeaps; //!< ҂̃q[v
+        UINT mMaxDescriptorHeapNum = 0; //!< głő̑傫
+        UINT mGrowCount = 0; //!< q[v蒼
     };
 } // namespace Framework::DX
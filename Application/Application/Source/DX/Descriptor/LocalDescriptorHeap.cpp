@@ -2,8 +2,9 @@
 
 namespace Framework::DX {
 
-    void LocalDescriptorHeap::init(
-        ID3D12Device* device, UINT descriptorNum, D3D12_DESCRIPTOR_HEAP_TYPE type) {
+    void LocalDescriptorHeap::init(ID3D12Device* device, UINT descriptorNum,
+        D3D12_DESCRIPTOR_HEAP_TYPE type, UINT rangeDescriptorNum) {
+        MY_ASSERTION(rangeDescriptorNum <= descriptorNum, "q[v̑傫𒴂Ă܂");
         D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
         heapDesc.Type = type;
         heapDesc.NumDescriptors = descriptorNum;
@@ -12,17 +13,52 @@ namespace Framework::DX {
         MY_THROW_IF_FAILED(device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&mDescriptorHeap)));
         mDescriptorHeapSize = device->GetDescriptorHandleIncrementSize(type);
         mDescriptorHeapNum = descriptorNum;
+        mRangeStart = descriptorNum - rangeDescriptorNum;
+        mAllocator.init(mRangeStart);
+        mRangeAllocator.init(rangeDescriptorNum);
     }
     bool LocalDescriptorHeap::allocate(
         D3D12_CPU_DESCRIPTOR_HANDLE* cpuHandle, D3D12_GPU_DESCRIPTOR_HANDLE* gpuHandle) {
-        if (mCurrentAllocatedNum + 1 > mDescriptorHeapNum) return false;
+        const UINT offset = mAllocator.allocate();
+        if (offset == AtomicIndexAllocator::INVALID_INDEX) return false;
+        *cpuHandle = CD3DX12_CPU_DESCRIPTOR_HANDLE(
+            mDescriptorHeap->GetCPUDescriptorHandleForHeapStart(), offset, mDescriptorHeapSize);
+        *gpuHandle = CD3DX12_GPU_DESCRIPTOR_HANDLE(
+            mDescriptorHeap->GetGPUDescriptorHandleForHeapStart(), offset, mDescriptorHeapSize);
+        return true;
+    }
+    bool LocalDescriptorHeap::allocate(D3D12_CPU_DESCRIPTOR_HANDLE* cpuHandle,
+        D3D12_GPU_DESCRIPTOR_HANDLE* gpuHandle, UINT count) {
+        UINT offset;
+        {
+            std::lock_guard<std::mutex> lock(mRangeMutex);
+            offset = mRangeAllocator.allocate(count);
+        }
+        if (offset == DescriptorRangeAllocator::INVALID_OFFSET) return false;
         *cpuHandle
             = CD3DX12_CPU_DESCRIPTOR_HANDLE(mDescriptorHeap->GetCPUDescriptorHandleForHeapStart(),
-                mCurrentAllocatedNum, mDescriptorHeapSize);
+                mRangeStart + offset, mDescriptorHeapSize);
         *gpuHandle
             = CD3DX12_GPU_DESCRIPTOR_HANDLE(mDescriptorHeap->GetGPUDescriptorHandleForHeapStart(),
-                mCurrentAllocatedNum, mDescriptorHeapSize);
-        mCurrentAllocatedNum++;
+                mRangeStart + offset, mDescriptorHeapSize);
         return true;
     }
+    void LocalDescriptorHeap::free(const D3D12_CPU_DESCRIPTOR_HANDLE& cpuHandle, UINT count) {
+        MY_ASSERTION(contains(cpuHandle), "̃q[vŊmۂnhł͂܂");
+        const SIZE_T start = mDescriptorHeap->GetCPUDescriptorHandleForHeapStart().ptr;
+        const UINT offset = static_cast<UINT>((cpuHandle.ptr - start) / mDescriptorHeapSize);
+        //ʒułǂ̗̈悩mۂ̂f
+        if (offset < mRangeStart) {
+            MY_ASSERTION(count == 1, "1mۂ͈̈͂ŉ悤Ƃ܂");
+            mAllocator.free(offset);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mRangeMutex);
+        mRangeAllocator.free(offset - mRangeStart, count);
+    }
+    bool LocalDescriptorHeap::contains(const D3D12_CPU_DESCRIPTOR_HANDLE& cpuHandle) const {
+        const SIZE_T start = mDescriptorHeap->GetCPUDescriptorHandleForHeapStart().ptr;
+        return start <= cpuHandle.ptr
+            && cpuHandle.ptr < start + static_cast<SIZE_T>(mDescriptorHeapNum) * mDescriptorHeapSize;
+    }
 } // namespace Framework::DX
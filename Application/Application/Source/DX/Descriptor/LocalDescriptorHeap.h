@@ -1,9 +1,15 @@
 #pragma once
+#include <mutex>
+#include "DX/Descriptor/AtomicIndexAllocator.h"
+#include "DX/Descriptor/DescriptorRangeAllocator.h"
 
 namespace Framework::DX {
     /**
      * @class LocalDescriptorHeap
      * @brief [J̃fBXNv^q[v
+     * @details mۂƉ͕̃Xbh瓯ɌĂׂ
+     * q[v̐擪1mۂ̈ŁAbNg킸Ɋmۂ
+     * ͘A͈͂mۂ̈ŁAbNċ󂫃Xgmۂ
      */
     class LocalDescriptorHeap {
     public:
@@ -15,10 +21,14 @@ namespace Framework::DX {
          * @brief fXgN^
          */
         ~LocalDescriptorHeap() {}
+        LocalDescriptorHeap(const LocalDescriptorHeap&) = delete;
+        LocalDescriptorHeap& operator=(const LocalDescriptorHeap&) = delete;
         /**
          * @brief 
+         * @param rangeDescriptorNum A͈͂̊mۂɎg q[v̖Ɏ
          */
-        void init(ID3D12Device* device, UINT descriptorNum, D3D12_DESCRIPTOR_HEAP_TYPE type);
+        void init(ID3D12Device* device, UINT descriptorNum, D3D12_DESCRIPTOR_HEAP_TYPE type,
+            UINT rangeDescriptorNum = 0);
         /**
          * @brief AP[g
          * @param[out] cpuHandle mۂCPUnh
@@ -27,6 +37,33 @@ namespace Framework::DX {
          */
         bool allocate(
             D3D12_CPU_DESCRIPTOR_HANDLE* cpuHandle, D3D12_GPU_DESCRIPTOR_HANDLE* gpuHandle);
+        /**
+         * @brief A͈͂̃AP[g
+         * @param[out] cpuHandle mۂ擪CPUnh
+         * @param[out] gpuHandle mۂ擪GPUnh
+         * @param count AĊmۂ鐔
+         * @return AP[gɐtrueԂ
+         */
+        bool allocate(D3D12_CPU_DESCRIPTOR_HANDLE* cpuHandle,
+            D3D12_GPU_DESCRIPTOR_HANDLE* gpuHandle, UINT count);
+        /**
+         * @brief 
+         * @param cpuHandle mۂCPUnh
+         * @param count mۂ
+         */
+        void free(const D3D12_CPU_DESCRIPTOR_HANDLE& cpuHandle, UINT count = 1);
+        /**
+         * @brief ̃q[vmۂnh
+         */
+        bool contains(const D3D12_CPU_DESCRIPTOR_HANDLE& cpuHandle) const;
+        /**
+         * @brief 󂢂Ă鐔Ԃ
+         */
+        UINT getFreeNum() const {
+            std::lock_guard<std::mutex> lock(mRangeMutex);
+            return mAllocator.getCapacity() - mAllocator.getAllocatedCount()
+                + mRangeAllocator.getFreeCount();
+        }
         /**
          * @brief q[v̎擾
          */
@@ -48,7 +85,10 @@ namespace Framework::DX {
 
     private:
         Comptr<ID3D12DescriptorHeap> mDescriptorHeap;
-        UINT mCurrentAllocatedNum = 0;
+        AtomicIndexAllocator mAllocator; //!< 1mۂ̈̊mۊǗ
+        DescriptorRangeAllocator mRangeAllocator; //!< A͈͂mۂ̈̊mۊǗ
+        mutable std::mutex mRangeMutex; //!< A͈͂mۂ̈̃bN
+        UINT mRangeStart = 0; //!< A͈͂mۂ̈̐擪
         UINT mDescriptorHeapSize = 0;
         UINT mDescriptorHeapNum = 0;
     };
@@ -0,0 +1,85 @@
+#include "CommandListStateTracker.h"
+
+namespace {
+    //ǂݎp̏Ԃ͓ɐĂ悢
+    static constexpr UINT READ_ONLY_STATE_MASK
+        = static_cast<UINT>(D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_GENERIC_READ)
+        | static_cast<UINT>(D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_DEPTH_READ);
+} // namespace
+
+namespace Framework::DX {
+    //RXgN^
+    CommandListStateTracker::CommandListStateTracker()
+        : mCommandList(nullptr), mTracker(READ_ONLY_STATE_MASK) {}
+    //fXgN^
+    CommandListStateTracker::~CommandListStateTracker() {}
+    //
+    void CommandListStateTracker::init(ID3D12GraphicsCommandList* commandList) {
+        mCommandList = commandList;
+        mTracker.reset();
+    }
+    //Ԃڍs
+    void CommandListStateTracker::transition(
+        ID3D12Resource* resource, D3D12_RESOURCE_STATES nextState) {
+        mTracker.transition(resource, static_cast<UINT>(nextState));
+    }
+    //oAňڍsJn
+    void CommandListStateTracker::beginSplitTransition(
+        ID3D12Resource* resource, D3D12_RESOURCE_STATES nextState) {
+        mTracker.beginSplitTransition(resource, static_cast<UINT>(nextState));
+    }
+    //oÄڍs
+    void CommandListStateTracker::endSplitTransition(ID3D12Resource* resource) {
+        mTracker.endSplitTransition(resource);
+    }
+    //UAV̏݊҂
+    void CommandListStateTracker::uavBarrier(ID3D12Resource* resource) {
+        mTracker.uavBarrier(resource);
+    }
+    //߂oA𔭍s
+    void CommandListStateTracker::flush() {
+        mTracker.flush(this);
+    }
+    //oɏԂ˂킹
+    void CommandListStateTracker::resolve(
+        Utility::ResourceStateRegistry* registry, std::vector<D3D12_RESOURCE_BARRIER>* fixups) {
+        mFixups.clear();
+        mTracker.resolve(registry, &mFixups);
+        for (auto&& fixup : mFixups) { fixups->emplace_back(toD3D12Barrier(fixup)); }
+    }
+    //ǐՒ̏Ԃj
+    void CommandListStateTracker::reset() {
+        mTracker.reset();
+    }
+    //oAR}hXgɐς
+    void CommandListStateTracker::submitBarriers(
+        const Utility::ResourceBarrierDesc* barriers, UINT count) {
+        mBarriers.resize(count);
+        for (UINT i = 0; i < count; i++) { mBarriers[i] = toD3D12Barrier(barriers[i]); }
+        mCommandList->ResourceBarrier(count, mBarriers.data());
+    }
+    //D3D12̃oAɕϊ
+    D3D12_RESOURCE_BARRIER CommandListStateTracker::toD3D12Barrier(
+        const Utility::ResourceBarrierDesc& desc) {
+        ID3D12Resource* resource = static_cast<ID3D12Resource*>(const_cast<void*>(desc.resource));
+        if (desc.type == Utility::ResourceBarrierDesc::Type::UnorderedAccess) {
+            return CD3DX12_RESOURCE_BARRIER::UAV(resource);
+        }
+
+        D3D12_RESOURCE_BARRIER_FLAGS flags
+            = D3D12_RESOURCE_BARRIER_FLAGS::D3D12_RESOURCE_BARRIER_FLAG_NONE;
+        switch (desc.split) {
+        case Utility::ResourceBarrierDesc::Split::Begin:
+            flags = D3D12_RESOURCE_BARRIER_FLAGS::D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY;
+            break;
+        case Utility::ResourceBarrierDesc::Split::End:
+            flags = D3D12_RESOURCE_BARRIER_FLAGS::D3D12_RESOURCE_BARRIER_FLAG_END_ONLY;
+            break;
+        default: break;
+        }
+        return CD3DX12_RESOURCE_BARRIER::Transition(resource,
+            static_cast<D3D12_RESOURCE_STATES>(desc.before),
+            static_cast<D3D12_RESOURCE_STATES>(desc.after),
+            D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES, flags);
+    }
+} // namespace Framework::DX
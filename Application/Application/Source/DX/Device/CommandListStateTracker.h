@@ -0,0 +1,91 @@
+/**
+ * @file CommandListStateTracker.h
+ * @brief R}hXgPʂ̃\[XԂ̒ǐ
+ */
+
+#pragma once
+#include "Utility/Graphics/ResourceStateTracker.h"
+
+namespace Framework::DX {
+    /**
+     * @class CommandListStateTracker
+     * @brief R}hXgɐςރoA܂Ƃ߂Ĕs
+     * @details Ԃ̒ǐՂUtility::ResourceStateTrackerɔCAłD3D12̃oAւ̕ϊ̂ݍs
+     */
+    class CommandListStateTracker : public Utility::IResourceBarrierSink {
+    public:
+        /**
+         * @brief RXgN^
+         */
+        CommandListStateTracker();
+        /**
+         * @brief fXgN^
+         */
+        ~CommandListStateTracker();
+        /**
+         * @brief 
+         * @param commandList oAςރR}hXg
+         */
+        void init(ID3D12GraphicsCommandList* commandList);
+        /**
+         * @brief Ԃڍs
+         */
+        void transition(ID3D12Resource* resource, D3D12_RESOURCE_STATES nextState);
+        /**
+         * @brief oAŏԂ̈ڍsJn
+         */
+        void beginSplitTransition(ID3D12Resource* resource, D3D12_RESOURCE_STATES nextState);
+        /**
+         * @brief oÄڍs
+         */
+        void endSplitTransition(ID3D12Resource* resource);
+        /**
+         * @brief UAV̏݊҂
+         */
+        void uavBarrier(ID3D12Resource* resource);
+        /**
+         * @brief ߂oAxɔs
+         * @details \[XgR}hςޑOɌĂ
+         */
+        void flush();
+        /**
+         * @brief oɃXgȌԂƓ˂킹
+         * @param registry R}hXg܂
+         * @param fixups ̃XgOɎsׂoA̒ǉ
+         */
+        void resolve(
+            Utility::ResourceStateRegistry* registry, std::vector<D3D12_RESOURCE_BARRIER>* fixups);
+        /**
+         * @brief ǐՒ̏Ԃj
+         */
+        void reset();
+        /**
+         * @brief v擾
+         */
+        const Utility::ResourceStateTracker::Stats& getStats() const {
+            return mTracker.getStats();
+        }
+        /**
+         * @brief vZbg
+         */
+        void resetStats() {
+            mTracker.resetStats();
+        }
+        /**
+         * @brief oAR}hXgɐς
+         */
+        void submitBarriers(const Utility::ResourceBarrierDesc* barriers, UINT count) override;
+
+    private:
+        /**
+         * @brief D3D12̃oAɕϊ
+         */
+        static D3D12_RESOURCE_BARRIER toD3D12Barrier(const Utility::ResourceBarrierDesc& desc);
+
+    private:
+        ID3D12GraphicsCommandList* mCommandList; //!< oAςރR}hXg
+        Utility::ResourceStateTracker mTracker; //!< Ԃ̒ǐ
+        std::vector<D3D12_RESOURCE_BARRIER> mBarriers; //!< ϊp̍Ɨ̈
+        std::vector<Utility::ResourceBarrierDesc> mFixups; //!< ␳p̍Ɨ̈
+    };
+} // namespace Framework::DX
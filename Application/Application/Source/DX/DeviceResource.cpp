@@ -157,14 +157,27 @@ namespace Framework::DX {
             MY_THROW_IF_FAILED(mDevice->CreateCommandAllocator(
                 D3D12_COMMAND_LIST_TYPE::D3D12_COMMAND_LIST_TYPE_DIRECT,
                 IID_PPV_ARGS(&mCommandAllocators[n])));
+            MY_THROW_IF_FAILED(mDevice->CreateCommandAllocator(
+                D3D12_COMMAND_LIST_TYPE::D3D12_COMMAND_LIST_TYPE_DIRECT,
+                IID_PPV_ARGS(&mResolveAllocators[n])));
         }
 
         //R}hXg쐬
         MY_THROW_IF_FAILED(
             mDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE::D3D12_COMMAND_LIST_TYPE_DIRECT,
                 mCommandAllocators[0].Get(), nullptr, IID_PPV_ARGS(&mCommandList)));
+        mStateTracker.init(mCommandList.Get());
+
+        //Ԃ̕␳pR}hXg͕KvȂƂL^̂ŕĂ
+        MY_THROW_IF_FAILED(
+            mDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE::D3D12_COMMAND_LIST_TYPE_DIRECT,
+                mResolveAllocators[0].Get(), nullptr, IID_PPV_ARGS(&mResolveCommandList)));
+        MY_THROW_IF_FAILED(mResolveCommandList->Close());
 
         mHeapManager.init(this);
+        mMemoryAllocator.init(mDevice.Get());
+        mUploadManager.init(mDevice.Get(), &mMemoryAllocator);
+        mConstantBufferAllocator.init(&mMemoryAllocator);
 
         //tFX쐬
         MY_THROW_IF_FAILED(mDevice->CreateFence(mFenceValues[mBackBufferIndex],
@@ -302,13 +315,20 @@ namespace Framework::DX {
 
         for (UINT n = 0; n < BACK_BUFFER_COUNT; n++) {
             mCommandAllocators[n].Reset();
+            mResolveAllocators[n].Reset();
             //mRenderTargets[n].Reset();
         }
 
         //mDepthStencil.Reset();
         mCommandQueue.Reset();
         mCommandList.Reset();
+        mResolveCommandList.Reset();
+        mStateTracker.reset();
+        mResourceStates.clear();
         mFence.Reset();
+        mConstantBufferAllocator.reset();
+        mUploadManager.reset();
+        mMemoryAllocator.reset();
         //mRTVHeap->reset();
         //mDSVHeap->reset();
         mSwapChain.Reset();
@@ -348,23 +368,29 @@ namespace Framework::DX {
 
     //`揀
     void DeviceResource::prepare(D3D12_RESOURCE_STATES beforeState) {
-        mHeapManager.beginFrame();
+        const UINT64 completedFenceValue = mFence->GetCompletedValue();
+        mHeapManager.beginFrame(completedFenceValue);
+        mMemoryAllocator.beginFrame(completedFenceValue);
+        mConstantBufferAllocator.beginFrame(completedFenceValue);
+        mUploadManager.retire();
         MY_THROW_IF_FAILED(mCommandAllocators[mBackBufferIndex]->Reset());
+        MY_THROW_IF_FAILED(mResolveAllocators[mBackBufferIndex]->Reset());
         MY_THROW_IF_FAILED(
             mCommandList->Reset(mCommandAllocators[mBackBufferIndex].Get(), nullptr));
 
         //_[^[Qbg̃oA
         if (beforeState != D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RENDER_TARGET) {
             mRenderTargets[mBackBufferIndex].transition(
-                mCommandList.Get(), D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RENDER_TARGET);
+                &mStateTracker, D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RENDER_TARGET);
         }
+        mStateTracker.flush();
     }
 
     //`v[g
     void DeviceResource::present(D3D12_RESOURCE_STATES beforeState) {
         if (beforeState != D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_PRESENT) {
             mRenderTargets[mBackBufferIndex].transition(
-                mCommandList.Get(), D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_PRESENT);
+                &mStateTracker, D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_PRESENT);
         }
 
         executeCommandList();
@@ -391,8 +417,26 @@ namespace Framework::DX {
     }
     //R}hs
     void DeviceResource::executeCommandList() {
+        mStateTracker.flush();
         MY_THROW_IF_FAILED(mCommandList->Close());
-        ID3D12CommandList* lists[] = { mCommandList.Get() };
+        //]\[XgOɃRs[̊҂
+        mUploadManager.waitOnQueue(mCommandQueue.Get());
+
+        //XgōŏɎg\[X̏ԂÕXg̍ŏIԂƈႦΐɕ␳
+        mResolveBarriers.clear();
+        mStateTracker.resolve(&mResourceStates, &mResolveBarriers);
+        if (mResolveBarriers.empty()) {
+            ID3D12CommandList* lists[] = { mCommandList.Get() };
+            mCommandQueue->ExecuteCommandLists(_countof(lists), lists);
+            return;
+        }
+        //AP[^̓t[̐擪ł̂݃ZbĝŁAt[ŉxL^Ă悢
+        MY_THROW_IF_FAILED(
+            mResolveCommandList->Reset(mResolveAllocators[mBackBufferIndex].Get(), nullptr));
+        mResolveCommandList->ResourceBarrier(
+            static_cast<UINT>(mResolveBarriers.size()), mResolveBarriers.data());
+        MY_THROW_IF_FAILED(mResolveCommandList->Close());
+        ID3D12CommandList* lists[] = { mResolveCommandList.Get(), mCommandList.Get() };
         mCommandQueue->ExecuteCommandLists(_countof(lists), lists);
     }
     //GPȖҋ@
@@ -412,6 +456,9 @@ namespace Framework::DX {
         waitForGPU();
         const UINT64 currentFenceValue = mFenceValues[mBackBufferIndex];
         MY_THROW_IF_FAILED(mCommandQueue->Signal(mFence.Get(), currentFenceValue));
+        mHeapManager.endFrame(currentFenceValue);
+        mMemoryAllocator.endFrame(currentFenceValue);
+        mConstantBufferAllocator.endFrame(currentFenceValue);
         mBackBufferIndex = mSwapChain->GetCurrentBackBufferIndex();
 
         //܂őҋ@
@@ -3,6 +3,10 @@
 #include "DX/Descriptor/DescriptorHeapManager.h"
 #include "DX/DescriptorTable.h"
 #include "DX/Device/Adapter.h"
+#include "DX/Device/CommandListStateTracker.h"
+#include "DX/Resource/ConstantBufferAllocator.h"
+#include "DX/Resource/GpuMemoryAllocator.h"
+#include "DX/Resource/UploadManager.h"
 #include "DX/Shader/DepthStencil.h"
 #include "DX/Shader/RenderTarget.h"
 #include "Window/Window.h"
@@ -245,6 +249,36 @@ namespace Framework::DX {
         DescriptorHeapManager* getHeapManager() {
             return &mHeapManager;
         }
+        /**
+         * @brief GPŮ蓖Ă擾
+         */
+        GpuMemoryAllocator* getMemoryAllocator() {
+            return &mMemoryAllocator;
+        }
+        /**
+         * @brief GPUւ̃f[^]̊Ǘ擾
+         */
+        UploadManager* getUploadManager() {
+            return &mUploadManager;
+        }
+        /**
+         * @brief t[Ƃ̃RX^gobt@̊蓖Ă擾
+         */
+        ConstantBufferAllocator* getConstantBufferAllocator() {
+            return &mConstantBufferAllocator;
+        }
+        /**
+         * @brief R}hXg̃\[XԂ̒ǐՂ擾
+         */
+        CommandListStateTracker* getStateTracker() {
+            return &mStateTracker;
+        }
+        /**
+         * @brief R}hXg܂\[X̏Ԃ擾
+         */
+        Utility::ResourceStateRegistry* getResourceStates() {
+            return &mResourceStates;
+        }
 
     private:
         /**
@@ -262,6 +296,10 @@ namespace Framework::DX {
             mCommandAllocators; //!< R}hAP[^
         Comptr<IDXGIFactory4> mFactory; //!< t@Ng
         Comptr<IDXGISwapChain3> mSwapChain; //!< Xbv`FC
+        //obt@̓fXgN^ŏԂ̓o^̂ŁAɐ錾Ă
+        Utility::ResourceStateRegistry mResourceStates; //!< R}hXg܂\[X̏
+        //r[̓fXgN^ŃfBXNv^Ԃ̂ŁAɐ錾Ă
+        DescriptorHeapManager mHeapManager; //!< q[vǗ
         RenderTarget mRenderTargets[BACK_BUFFER_COUNT];
         DepthStencil mDepthStencil;
         //Comptr<ID3D12Resource> mRenderTargets[BACK_BUFFER_COUNT]; //!< _[^[Qbg
@@ -281,6 +319,13 @@ namespace Framework::DX {
         UINT mOptions; //!< foCX̃IvV
         Window::Window* mWindow; //!< EBhE
         IDeviceNotify* mDeviceNotify; //!< foCXCxg̒ʒm
-        DescriptorHeapManager mHeapManager; //!< q[vǗ
+        GpuMemoryAllocator mMemoryAllocator; //!< GPŮ蓖
+        UploadManager mUploadManager; //!< GPUւ̃f[^]
+        ConstantBufferAllocator mConstantBufferAllocator; //!< t[Ƃ̃RX^gobt@
+        CommandListStateTracker mStateTracker; //!< R}hXg̃\[XԂ̒ǐ
+        Comptr<ID3D12GraphicsCommandList> mResolveCommandList; //!< Ԃ̕␳pR}hXg
+        std::array<Comptr<ID3D12CommandAllocator>, BACK_BUFFER_COUNT>
+            mResolveAllocators; //!< Ԃ̕␳pR}hAP[^
+        std::vector<D3D12_RESOURCE_BARRIER> mResolveBarriers; //!< Ԃ̕␳poA
     };
 } // namespace Framework::DX
@@ -0,0 +1,121 @@
+#include "AccelerationStructureCache.h"
+
+namespace {
+    static constexpr UINT32 MAGIC = 0x53414C42; //!< t@C̎ʎq("BLAS")
+    //VACYꂽf[^ASƓACgŔzu
+    static constexpr UINT64 DATA_OFFSET = Framework::DX::AccelerationStructureCache::DATA_ALIGNMENT;
+#ifdef _WIN32
+    static_assert(DATA_OFFSET == D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT,
+        "AS̃ACgƈvĂ܂");
+#endif
+    static constexpr UINT64 FNV_OFFSET_BASIS = 14695981039346656037ull;
+    static constexpr UINT64 FNV_PRIME = 1099511628211ull;
+
+    /**
+     * @brief LbVt@C̃wb_[
+     */
+    struct FileHeader {
+        UINT32 magic;
+        UINT32 version;
+        UINT64 key;
+        UINT64 dataSize;
+        UINT64 dataHash;
+        Framework::DX::AccelerationStructureCache::Metadata metadata;
+    };
+    static_assert(sizeof(FileHeader) <= DATA_OFFSET, "wb_[f[^̈ɏdȂĂ܂");
+
+    /**
+     * @brief FNV-1aŃnbVlvZ
+     */
+    inline UINT64 fnv1a(const void* data, UINT64 size, UINT64 hash = FNV_OFFSET_BASIS) {
+        const BYTE* bytes = static_cast<const BYTE*>(data);
+        for (UINT64 i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+} // namespace
+
+namespace Framework::DX {
+    //RXgN^
+    AccelerationStructureCache::AccelerationStructureCache(const std::filesystem::path& directory)
+        : mDirectory(directory) {
+        std::error_code ec;
+        std::filesystem::create_directories(mDirectory, ec);
+    }
+    //fXgN^
+    AccelerationStructureCache::~AccelerationStructureCache() {}
+    //L[vZ
+    UINT64 AccelerationStructureCache::computeKey(const void* vertices, UINT64 vertexBytes,
+        const void* indices, UINT64 indexBytes, UINT buildFlags) {
+        UINT64 hash = fnv1a(&VERSION, sizeof(VERSION));
+        hash = fnv1a(&buildFlags, sizeof(buildFlags), hash);
+        hash = fnv1a(&vertexBytes, sizeof(vertexBytes), hash);
+        hash = fnv1a(vertices, vertexBytes, hash);
+        hash = fnv1a(&indexBytes, sizeof(indexBytes), hash);
+        hash = fnv1a(indices, indexBytes, hash);
+        return hash;
+    }
+    //ǂݍ
+    bool AccelerationStructureCache::load(const std::string& name, UINT64 key, Entry* entry) const {
+        if (!entry->file.open(getPath(name))) return false;
+
+        const UINT64 fileSize = entry->file.size();
+        if (fileSize < DATA_OFFSET) {
+            MY_DEBUG_LOG("AS cache %s: truncated\n", name.c_str());
+            entry->file.close();
+            return false;
+        }
+        const FileHeader* header = reinterpret_cast<const FileHeader*>(entry->file.data());
+        if (header->magic != MAGIC || header->version != VERSION || header->key != key) {
+            MY_DEBUG_LOG("AS cache %s: stale\n", name.c_str());
+            entry->file.close();
+            return false;
+        }
+        const BYTE* data = entry->file.data() + DATA_OFFSET;
+        if (header->dataSize != fileSize - DATA_OFFSET
+            || fnv1a(data, header->dataSize) != header->dataHash) {
+            MY_DEBUG_LOG("AS cache %s: corrupted\n", name.c_str());
+            entry->file.close();
+            return false;
+        }
+        entry->data = data;
+        entry->size = header->dataSize;
+        entry->metadata = header->metadata;
+        return true;
+    }
+    //ۑ
+    void AccelerationStructureCache::store(const std::string& name, UINT64 key,
+        const std::vector<BYTE>& data, const Metadata& metadata) const {
+        std::array<BYTE, DATA_OFFSET> headerBlock = {};
+        FileHeader* header = reinterpret_cast<FileHeader*>(headerBlock.data());
+        header->magic = MAGIC;
+        header->version = VERSION;
+        header->key = key;
+        header->dataSize = data.size();
+        header->dataHash = fnv1a(data.data(), data.size());
+        header->metadata = metadata;
+
+        //ݓr̃t@Cǂ܂Ȃ悤Ɉꎞt@CɏĂu
+        const std::filesystem::path path = getPath(name);
+        std::filesystem::path temp = path;
+        temp += ".tmp";
+        {
+            std::ofstream ofs(temp, std::ios::binary | std::ios::out | std::ios::trunc);
+            if (!ofs) {
+                MY_DEBUG_LOG("AS cache %s: failed to write\n", name.c_str());
+                return;
+            }
+            ofs.write(reinterpret_cast<const char*>(headerBlock.data()), headerBlock.size());
+            ofs.write(reinterpret_cast<const char*>(data.data()), data.size());
+        }
+        std::error_code ec;
+        std::filesystem::rename(temp, path, ec);
+        if (ec) { MY_DEBUG_LOG("AS cache %s: failed to write\n", name.c_str()); }
+    }
+    //pX擾
+    std::filesystem::path AccelerationStructureCache::getPath(const std::string& name) const {
+        return mDirectory / (name + ".blas");
+    }
+} // namespace Framework::DX
@@ -0,0 +1,89 @@
+/**
+ * @file AccelerationStructureCache.h
+ * @brief AS̃fBXNLbV
+ * @details VACYBLASWIg̃nbVL[Ƀt@C֕ۑ
+ */
+
+#pragma once
+#include <string>
+#include <vector>
+#include "Utility/IO/MappedFile.h"
+
+namespace Framework::DX {
+    /**
+     * @class AccelerationStructureCache
+     * @brief VACYAS̃t@CLbV
+     * @details t@C͌Œ蒷̃wb_[ƃACgꂽf[^ō\A}bv܂ܓǂ߂
+     * D3D12̌^ɂ͈ˑȂ̂ŁAt@Č؂͒P̂ŃeXgł
+     */
+    class AccelerationStructureCache {
+    public:
+        static constexpr UINT32 VERSION = 1; //!< t@C`̃o[W
+        static constexpr UINT64 DATA_ALIGNMENT = 256; //!< f[^̔zu AS̃ACgƓ
+        /**
+         * @brief ASƈꏏɕۑV[̏
+         */
+        struct Metadata {
+            UINT shaderKey; //!< VF[_[̎
+            UINT modelID; //!< qbgO[ṽCfbNX
+            UINT vertexOffset; //!< _obt@̃ItZbg
+            UINT indexOffset; //!< CfbNXobt@̃ItZbg
+        };
+        /**
+         * @brief ǂݍ񂾃LbV
+         */
+        struct Entry {
+            Utility::MappedFile file; //!< }bvt@C
+            const BYTE* data; //!< VACYꂽf[^̐擪
+            UINT64 size; //!< VACYꂽf[^̃oCgTCY
+            Metadata metadata; //!< V[̏
+        };
+
+    public:
+        /**
+         * @brief RXgN^
+         * @param directory LbVۑfBNg
+         */
+        AccelerationStructureCache(const std::filesystem::path& directory);
+        /**
+         * @brief fXgN^
+         */
+        ~AccelerationStructureCache();
+        /**
+         * @brief LbṼL[vZ
+         * @param vertices _f[^
+         * @param vertexBytes _f[^̃oCgTCY
+         * @param indices CfbNXf[^
+         * @param indexBytes CfbNXf[^̃oCgTCY
+         * @param buildFlags \ztO D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS̒l
+         */
+        static UINT64 computeKey(const void* vertices, UINT64 vertexBytes, const void* indices,
+            UINT64 indexBytes, UINT buildFlags);
+        /**
+         * @brief LbVǂݍ
+         * @param name LbV
+         * @param key LbṼL[
+         * @param[out] entry ǂݍ񂾃LbV
+         * @return ݂ȂAL[ႤAĂfalseԂ
+         */
+        bool load(const std::string& name, UINT64 key, Entry* entry) const;
+        /**
+         * @brief LbVۑ
+         * @param name LbV
+         * @param key LbṼL[
+         * @param data VACYꂽf[^
+         * @param metadata V[̏
+         */
+        void store(const std::string& name, UINT64 key, const std::vector<BYTE>& data,
+            const Metadata& metadata) const;
+
+    private:
+        /**
+         * @brief LbVt@C̃pX擾
+         */
+        std::filesystem::path getPath(const std::string& name) const;
+
+    private:
+        std::filesystem::path mDirectory; //!< LbVۑfBNg
+    };
+} // namespace Framework::DX
@@ -0,0 +1,60 @@
+#include "AccelerationStructureUpdatePolicy.h"
+#include <cmath>
+
+namespace Framework::DX {
+    //RXgN^
+    AccelerationStructureUpdatePolicy::AccelerationStructureUpdatePolicy(
+        float maxDegradation, UINT maxRefitCount)
+        : mMaxDegradation(maxDegradation),
+          mMaxRefitCount(maxRefitCount),
+          mRefitCount(0),
+          mDegradation(1.0f),
+          mLastMode(AccelerationStructureBuildMode::Build) {}
+    //fXgN^
+    AccelerationStructureUpdatePolicy::~AccelerationStructureUpdatePolicy() {}
+    //̍\z@߂
+    AccelerationStructureBuildMode AccelerationStructureUpdatePolicy::evaluate(
+        bool canRefit, float degradation) {
+        mDegradation = degradation;
+        //򉻂臒l𒴂AtBbg𑱂č\z
+        if (!canRefit || degradation > mMaxDegradation || mRefitCount >= mMaxRefitCount) {
+            mRefitCount = 0;
+            mDegradation = 1.0f;
+            mLastMode = AccelerationStructureBuildMode::Build;
+            return mLastMode;
+        }
+        mRefitCount++;
+        mLastMode = AccelerationStructureBuildMode::Refit;
+        return mLastMode;
+    }
+    //\ʐς߂
+    float AccelerationStructureUpdatePolicy::surfaceArea(const Utility::InstanceBounds& box) {
+        const Math::Vector3& e = box.extents;
+        //extents͔̑傫Ȃ̂Ŋeӂ2{ɂȂ
+        return 8.0f * (e.x * e.y + e.y * e.z + e.z * e.x);
+    }
+    //򉻗ς
+    float AccelerationStructureUpdatePolicy::estimateDegradation(
+        const Utility::InstanceBounds* built, const Utility::InstanceBounds* current,
+        size_t count) {
+        float builtArea = 0.0f;
+        float refitArea = 0.0f;
+        for (size_t i = 0; i < count; i++) {
+            //ЕЕ܂܂Ȃ΁Aa͒̕S̍Ɨ̘̔̕aɂȂ
+            auto mergeExtent = [](float c0, float e0, float c1, float e1) {
+                return Math::MathUtil::mymax(
+                    { (std::fabs(c1 - c0) + e0 + e1) * 0.5f, e0, e1 });
+            };
+            const Utility::InstanceBounds& b = built[i];
+            const Utility::InstanceBounds& c = current[i];
+            Utility::InstanceBounds merged;
+            merged.extents.x = mergeExtent(b.center.x, b.extents.x, c.center.x, c.extents.x);
+            merged.extents.y = mergeExtent(b.center.y, b.extents.y, c.center.y, c.extents.y);
+            merged.extents.z = mergeExtent(b.center.z, b.extents.z, c.center.z, c.extents.z);
+            builtArea += surfaceArea(built[i]);
+            refitArea += surfaceArea(merged);
+        }
+        if (builtArea <= 0.0f) return 1.0f;
+        return refitArea / builtArea;
+    }
+} // namespace Framework::DX
@@ -0,0 +1,101 @@
+/**
+ * @file AccelerationStructureUpdatePolicy.h
+ * @brief AS̍XVj
+ * @details tBbgɂi̗򉻂ǐՂAč\z^C~O߂
+ */
+
+#pragma once
+#include "Utility/Scene/InstanceStore.h"
+
+namespace Framework::DX {
+    /**
+     * @enum AccelerationStructureBuildMode
+     * @brief AS̍\z@
+     */
+    enum class AccelerationStructureBuildMode {
+        Build, //!< ꂩ\z
+        Refit, //!< ؍\ۂ܂܃oEfBO{bNX̂ݍXV
+    };
+
+    /**
+     * @class AccelerationStructureUpdatePolicy
+     * @brief tBbgƍč\z؂ւj
+     * @details 򉻗͍\zSAHRXgɑ΂郊tBbgSAHRXg̔䗦̌ς
+     * D3D12ɈˑȂ̂ŁAP̂ŃeXgł
+     */
+    class AccelerationStructureUpdatePolicy {
+    public:
+        static constexpr float DEFAULT_MAX_DEGRADATION = 1.5f; //!< č\z򉻗臒l
+        static constexpr UINT DEFAULT_MAX_REFIT_COUNT = 240; //!< AŃtBbgł
+    public:
+        /**
+         * @brief RXgN^
+         * @param maxDegradation č\z򉻗臒l
+         * @param maxRefitCount AŃtBbgł
+         */
+        AccelerationStructureUpdatePolicy(float maxDegradation = DEFAULT_MAX_DEGRADATION,
+            UINT maxRefitCount = DEFAULT_MAX_REFIT_COUNT);
+        /**
+         * @brief fXgN^
+         */
+        ~AccelerationStructureUpdatePolicy();
+        /**
+         * @brief ̍\z@߂
+         * @param canRefit tBbg\ȏԂ
+         * @param degradation ݂̗򉻗
+         */
+        AccelerationStructureBuildMode evaluate(bool canRefit, float degradation);
+        /**
+         * @brief č\z򉻗臒lݒ肷
+         */
+        void setMaxDegradation(float maxDegradation) {
+            mMaxDegradation = maxDegradation;
+        }
+        /**
+         * @brief AŃtBbgł񐔂ݒ肷
+         */
+        void setMaxRefitCount(UINT maxRefitCount) {
+            mMaxRefitCount = maxRefitCount;
+        }
+        /**
+         * @brief ŌɌ߂\z@擾
+         */
+        AccelerationStructureBuildMode getLastMode() const {
+            return mLastMode;
+        }
+        /**
+         * @brief Ōɕ]򉻗擾
+         */
+        float getDegradation() const {
+            return mDegradation;
+        }
+        /**
+         * @brief Ō̍\z̃tBbg񐔂擾
+         */
+        UINT getRefitCount() const {
+            return mRefitCount;
+        }
+
+    public:
+        /**
+         * @brief oEfBO{bNX̕\ʐς߂
+         */
+        static float surfaceArea(const Utility::InstanceBounds& box);
+        /**
+         * @brief \zƃtBbg̃oEfBO{bNX򉻗ς
+         * @param built \z̗vfƂ̃oEfBO{bNX
+         * @param current ݂̗vfƂ̃oEfBO{bNX
+         * @param count vf
+         * @details tBbgꂽm[h͍\zƌ݂̗͂ނ̂ŁA̘a̕\ʐςŋߎ
+         */
+        static float estimateDegradation(const Utility::InstanceBounds* built,
+            const Utility::InstanceBounds* current, size_t count);
+
+    private:
+        float mMaxDegradation; //!< č\z򉻗臒l
+        UINT mMaxRefitCount; //!< AŃtBbgł
+        UINT mRefitCount; //!< Ō̍\z̃tBbg
+        float mDegradation; //!< Ōɕ]򉻗
+        AccelerationStructureBuildMode mLastMode; //!< ŌɌ߂\z@
+    };
+} // namespace Framework::DX
@@ -1,4 +1,5 @@
 #include "BottomLevelAccelerationStructure.h"
+#include <cfloat>
 #include "DX/Util/Helper.h"
 
 namespace {
@@ -13,63 +14,287 @@ namespace {
 
 namespace Framework::DX {
     void BottomLevelAccelerationStructure::init(const DXRDevice& device,
-        const VertexBuffer& vertexBuffer, UINT vertexSize, const IndexBuffer& indexBuffer,
-        UINT indexSize) {
-        const UINT indexCount
-            = static_cast<UINT>(indexBuffer.getBuffer().getResource()->GetDesc().Width / indexSize);
-        const UINT vertexCount = static_cast<UINT>(
-            vertexBuffer.getBuffer().getResource()->GetDesc().Width / vertexSize);
-        D3D12_RAYTRACING_GEOMETRY_DESC geometryDesc = {};
-        geometryDesc.Type
+        const GeometryView& geometry, const DirectX::BoundingBox& localBounds,
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlags) {
+        setGeometry(geometry);
+        mBuildFlags = buildFlags;
+        mLocalBounds = localBounds;
+        mScratch.Reset();
+        mBuffer.Reset();
+        mCompacted = false;
+        build(device);
+    }
+
+    void BottomLevelAccelerationStructure::initProcedural(const DXRDevice& device,
+        const std::vector<D3D12_RAYTRACING_AABB>& aabbs,
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlags) {
+        MY_THROW_IF_FALSE(!aabbs.empty());
+        //ȂȂ̂ŁAAbv[hq[vɒu܂܍\z̓͂ɂ
+        const UINT64 size = aabbs.size() * sizeof(D3D12_RAYTRACING_AABB);
+        mAABBBuffer = createUploadBuffer(device.getMemoryAllocator(), size, L"ProceduralAABB");
+        writeToResource(mAABBBuffer.Get(), aabbs.data(), static_cast<size_t>(size));
+
+        mGeometryDesc = {};
+        mGeometryDesc.Type = D3D12_RAYTRACING_GEOMETRY_TYPE::
+            D3D12_RAYTRACING_GEOMETRY_TYPE_PROCEDURAL_PRIMITIVE_AABBS;
+        mGeometryDesc.AABBs.AABBCount = aabbs.size();
+        mGeometryDesc.AABBs.AABBs.StartAddress = mAABBBuffer->GetGPUVirtualAddress();
+        mGeometryDesc.AABBs.AABBs.StrideInBytes = sizeof(D3D12_RAYTRACING_AABB);
+        mGeometryDesc.Flags
+            = D3D12_RAYTRACING_GEOMETRY_FLAGS::D3D12_RAYTRACING_GEOMETRY_FLAG_OPAQUE;
+
+        //AABBׂĊ܂ރ{bNXoEfBO{bNXɂ
+        DirectX::XMVECTOR minimum = DirectX::XMVectorReplicate(FLT_MAX);
+        DirectX::XMVECTOR maximum = DirectX::XMVectorReplicate(-FLT_MAX);
+        for (auto&& aabb : aabbs) {
+            minimum = DirectX::XMVectorMin(
+                minimum, DirectX::XMVectorSet(aabb.MinX, aabb.MinY, aabb.MinZ, 0.0f));
+            maximum = DirectX::XMVectorMax(
+                maximum, DirectX::XMVectorSet(aabb.MaxX, aabb.MaxY, aabb.MaxZ, 0.0f));
+        }
+        DirectX::BoundingBox::CreateFromPoints(mLocalBounds, minimum, maximum);
+
+        mBuildFlags = buildFlags;
+        mScratch.Reset();
+        mBuffer.Reset();
+        mCompacted = false;
+        build(device);
+    }
+
+    bool BottomLevelAccelerationStructure::initFromSerialized(const DXRDevice& device,
+        const GeometryView& geometry, const DirectX::BoundingBox& localBounds,
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlags, const void* data,
+        UINT64 size) {
+        //wb_[mFÃhCo[œǂ߂f[^ׂ
+        using Header = D3D12_SERIALIZED_RAYTRACING_ACCELERATION_STRUCTURE_HEADER;
+        if (size < sizeof(Header)) return false;
+        const Header* header = static_cast<const Header*>(data);
+        if (header->SerializedSizeInBytesIncludingHeader != size
+            || header->NumBottomLevelAccelerationStructurePointersAfterHeader != 0) {
+            return false;
+        }
+        const D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS status
+            = device.getDXRDevice()->CheckDriverMatchingIdentifier(
+                D3D12_SERIALIZED_DATA_TYPE::
+                    D3D12_SERIALIZED_DATA_RAYTRACING_ACCELERATION_STRUCTURE,
+                &header->DriverMatchingIdentifier);
+        if (status
+            != D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS::
+                D3D12_DRIVER_MATCHING_IDENTIFIER_COMPATIBLE_WITH_DEVICE) {
+            return false;
+        }
+
+        setGeometry(geometry);
+        mBuildFlags = buildFlags;
+        mLocalBounds = localBounds;
+        mScratch.Reset();
+
+        //Abv[hq[vGENERIC_READȂ̂ł̂܂܃fVACYɂł
+        mDeserializeSource = createUploadBuffer(device.getMemoryAllocator(), size, L"DeserializeSource");
+        writeToResource(mDeserializeSource.Get(), data, static_cast<size_t>(size));
+        mBuffer = createUAVBuffer(device.getMemoryAllocator(), header->DeserializedSizeInBytes,
+            D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE,
+            L"BottomLevelAS");
+        mBufferSize = header->DeserializedSizeInBytes;
+        //TCYς邩Ȃ̂ōč\z̓obt@mۂ
+        mCompacted = true;
+
+        ID3D12GraphicsCommandList5* commandList = device.getDXRCommandList();
+        commandList->CopyRaytracingAccelerationStructure(mBuffer->GetGPUVirtualAddress(),
+            mDeserializeSource->GetGPUVirtualAddress(),
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE::
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE_DESERIALIZE);
+        commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::UAV(mBuffer.Get()));
+        return true;
+    }
+
+    void BottomLevelAccelerationStructure::setGeometry(const GeometryView& geometry) {
+        mGeometryDesc = {};
+        mGeometryDesc.Type
             = D3D12_RAYTRACING_GEOMETRY_TYPE::D3D12_RAYTRACING_GEOMETRY_TYPE_TRIANGLES;
-        geometryDesc.Triangles.IndexBuffer
-            = indexBuffer.getBuffer().getResource()->GetGPUVirtualAddress();
-        geometryDesc.Triangles.IndexCount = indexCount;
-        geometryDesc.Triangles.IndexFormat = toFormatFromIndexSize(indexSize);
-        geometryDesc.Triangles.Transform3x4 = 0;
-        geometryDesc.Triangles.VertexBuffer.StartAddress
-            = vertexBuffer.getBuffer().getResource()->GetGPUVirtualAddress();
-        geometryDesc.Triangles.VertexBuffer.StrideInBytes = vertexSize;
-        geometryDesc.Triangles.VertexCount = vertexCount;
-        geometryDesc.Triangles.VertexFormat = DXGI_FORMAT::DXGI_FORMAT_R32G32B32_FLOAT;
-        geometryDesc.Flags = D3D12_RAYTRACING_GEOMETRY_FLAGS::D3D12_RAYTRACING_GEOMETRY_FLAG_OPAQUE;
-
-        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlags
-            = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS::
-                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE;
+        mGeometryDesc.Triangles.IndexBuffer = geometry.indexAddress;
+        mGeometryDesc.Triangles.IndexCount = geometry.indexCount;
+        mGeometryDesc.Triangles.IndexFormat = toFormatFromIndexSize(geometry.indexSize);
+        mGeometryDesc.Triangles.Transform3x4 = 0;
+        mGeometryDesc.Triangles.VertexBuffer.StartAddress = geometry.vertexAddress;
+        mGeometryDesc.Triangles.VertexBuffer.StrideInBytes = geometry.vertexStride;
+        mGeometryDesc.Triangles.VertexCount = geometry.vertexCount;
+        mGeometryDesc.Triangles.VertexFormat = DXGI_FORMAT::DXGI_FORMAT_R32G32B32_FLOAT;
+        mGeometryDesc.Flags
+            = D3D12_RAYTRACING_GEOMETRY_FLAGS::D3D12_RAYTRACING_GEOMETRY_FLAG_OPAQUE;
+    }
 
+    void BottomLevelAccelerationStructure::build(const DXRDevice& device) {
         D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC
         bottomLevelBuildDesc = {};
         D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& bottomLevelInputs
             = bottomLevelBuildDesc.Inputs;
         bottomLevelInputs.DescsLayout = D3D12_ELEMENTS_LAYOUT::D3D12_ELEMENTS_LAYOUT_ARRAY;
-        bottomLevelInputs.Flags = buildFlags;
+        bottomLevelInputs.Flags = mBuildFlags;
         bottomLevelInputs.NumDescs = 1;
         bottomLevelInputs.Type = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE::
             D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL;
-        bottomLevelInputs.pGeometryDescs = &geometryDesc;
+        bottomLevelInputs.pGeometryDescs = &mGeometryDesc;
+
+        //kς݂̃obt@XNb`͍\zȂ̂Ŋmۂ
+        const bool needsAllocate = !mBuffer || mCompacted || !mScratch;
+        if (needsAllocate) {
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO
+            bottomLevelPreInfo = {};
+            device.getDXRDevice()->GetRaytracingAccelerationStructurePrebuildInfo(
+                &bottomLevelInputs, &bottomLevelPreInfo);
+            MY_THROW_IF_FALSE(bottomLevelPreInfo.ResultDataMaxSizeInBytes > 0);
 
-        //\zɕKvȏ擾
-        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO
-        bottomLevelPreInfo = {};
-        device.getDXRDevice()->GetRaytracingAccelerationStructurePrebuildInfo(
-            &bottomLevelInputs, &bottomLevelPreInfo);
-        MY_THROW_IF_FALSE(bottomLevelPreInfo.ResultDataMaxSizeInBytes > 0);
+            mScratch = createUAVBuffer(device.getMemoryAllocator(),
+                bottomLevelPreInfo.ScratchDataSizeInBytes,
+                D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_UNORDERED_ACCESS, L"ScratchResource");
 
-        mScratch = createUAVBuffer(device.getDXRDevice(), bottomLevelPreInfo.ScratchDataSizeInBytes,
-            D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_UNORDERED_ACCESS, L"ScratchResource");
+            D3D12_RESOURCE_STATES initResourceState
+                = D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE;
+            mBuffer = createUAVBuffer(device.getMemoryAllocator(),
+                bottomLevelPreInfo.ResultDataMaxSizeInBytes, initResourceState, L"BottomLevelAS");
+            mBufferSize = bottomLevelPreInfo.ResultDataMaxSizeInBytes;
+            mCompacted = false;
+        }
 
-        D3D12_RESOURCE_STATES initResourceState
-            = D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE;
-        mBuffer = createUAVBuffer(device.getDXRDevice(),
-            bottomLevelPreInfo.ResultDataMaxSizeInBytes, initResourceState, L"BottomLevelAS");
+        const bool allowCompaction
+            = hasBuildFlag(D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS::
+                    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_COMPACTION);
+        if (allowCompaction) { createPostbuildInfoBuffer(device); }
 
         bottomLevelBuildDesc.ScratchAccelerationStructureData = mScratch->GetGPUVirtualAddress();
         bottomLevelBuildDesc.DestAccelerationStructureData = mBuffer->GetGPUVirtualAddress();
 
-        device.getDXRCommandList()->BuildRaytracingAccelerationStructure(
-            &bottomLevelBuildDesc, 0, nullptr);
-        device.getDXRCommandList()->ResourceBarrier(
-            1, &CD3DX12_RESOURCE_BARRIER::UAV(mBuffer.Get()));
+        ID3D12GraphicsCommandList5* commandList = device.getDXRCommandList();
+        if (!allowCompaction) {
+            commandList->BuildRaytracingAccelerationStructure(&bottomLevelBuildDesc, 0, nullptr);
+            commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::UAV(mBuffer.Get()));
+            return;
+        }
+
+        //\zƓɈk̃TCY݁ACPUǂ߂悤ɃRs[Ă
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC postbuildDesc = {};
+        postbuildDesc.InfoType = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_TYPE::
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE;
+        postbuildDesc.DestBuffer = mPostbuildInfo->GetGPUVirtualAddress();
+        commandList->BuildRaytracingAccelerationStructure(&bottomLevelBuildDesc, 1, &postbuildDesc);
+        commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::UAV(mBuffer.Get()));
+        copyPostbuildInfoToReadback(commandList);
+    }
+
+    void BottomLevelAccelerationStructure::createPostbuildInfoBuffer(const DXRDevice& device) {
+        if (mPostbuildInfo) return;
+        //k̃TCYƃVACỸTCY̑傫قɍ킹
+        constexpr UINT64 size = sizeof(
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC);
+        mPostbuildInfo = createUAVBuffer(device.getMemoryAllocator(), size,
+            D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_UNORDERED_ACCESS, L"PostbuildInfo");
+        mPostbuildInfoReadback
+            = createReadbackBuffer(device.getMemoryAllocator(), size, L"PostbuildInfoReadback");
+    }
+
+    void BottomLevelAccelerationStructure::copyPostbuildInfoToReadback(
+        ID3D12GraphicsCommandList* commandList) {
+        commandList->ResourceBarrier(1,
+            &CD3DX12_RESOURCE_BARRIER::Transition(mPostbuildInfo.Get(),
+                D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+                D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COPY_SOURCE));
+        commandList->CopyResource(mPostbuildInfoReadback.Get(), mPostbuildInfo.Get());
+        commandList->ResourceBarrier(1,
+            &CD3DX12_RESOURCE_BARRIER::Transition(mPostbuildInfo.Get(),
+                D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COPY_SOURCE,
+                D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_UNORDERED_ACCESS));
+    }
+
+    void BottomLevelAccelerationStructure::compact(const DXRDevice& device) {
+        if (mCompacted) return;
+        MY_THROW_IF_FALSE_LOG(mPostbuildInfoReadback != nullptr,
+            "ALLOW_COMPACTIONō\zĂ܂");
+
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC* info;
+        MY_THROW_IF_FAILED(
+            mPostbuildInfoReadback->Map(0, nullptr, reinterpret_cast<void**>(&info)));
+        const UINT64 compactedSize = info->CompactedSizeInBytes;
+        CD3DX12_RANGE writeRange(0, 0);
+        mPostbuildInfoReadback->Unmap(0, &writeRange);
+        MY_THROW_IF_FALSE(compactedSize > 0);
+
+        Comptr<ID3D12Resource> compacted = createUAVBuffer(device.getMemoryAllocator(), compactedSize,
+            D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE,
+            L"CompactedBottomLevelAS");
+        ID3D12GraphicsCommandList5* commandList = device.getDXRCommandList();
+        commandList->CopyRaytracingAccelerationStructure(compacted->GetGPUVirtualAddress(),
+            mBuffer->GetGPUVirtualAddress(),
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE::
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE_COMPACT);
+        commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::UAV(compacted.Get()));
+
+        MY_DEBUG_LOG("BLAS compaction: %llu -> %llu bytes (%.1f bytes/triangle)\n", mBufferSize,
+            compactedSize,
+            static_cast<double>(compactedSize) / Math::MathUtil::mymax(getTriangleCount(), 1u));
+        mUncompactedBuffer = mBuffer;
+        mBuffer = compacted;
+        mBufferSize = compactedSize;
+        mCompacted = true;
+    }
+
+    void BottomLevelAccelerationStructure::requestSerializedSize(const DXRDevice& device) {
+        createPostbuildInfoBuffer(device);
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC postbuildDesc = {};
+        postbuildDesc.InfoType = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_TYPE::
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION;
+        postbuildDesc.DestBuffer = mPostbuildInfo->GetGPUVirtualAddress();
+        const D3D12_GPU_VIRTUAL_ADDRESS source = mBuffer->GetGPUVirtualAddress();
+        ID3D12GraphicsCommandList5* commandList = device.getDXRCommandList();
+        commandList->EmitRaytracingAccelerationStructurePostbuildInfo(&postbuildDesc, 1, &source);
+        copyPostbuildInfoToReadback(commandList);
+    }
+
+    void BottomLevelAccelerationStructure::serialize(const DXRDevice& device) {
+        MY_THROW_IF_FALSE(mPostbuildInfoReadback != nullptr);
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC* info;
+        MY_THROW_IF_FAILED(
+            mPostbuildInfoReadback->Map(0, nullptr, reinterpret_cast<void**>(&info)));
+        const UINT64 serializedSize = info->SerializedSizeInBytes;
+        CD3DX12_RANGE writeRange(0, 0);
+        mPostbuildInfoReadback->Unmap(0, &writeRange);
+        MY_THROW_IF_FALSE(serializedSize > 0);
+
+        mSerialized = createUAVBuffer(device.getMemoryAllocator(), serializedSize,
+            D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_UNORDERED_ACCESS, L"SerializedAS");
+        mSerializedReadback
+            = createReadbackBuffer(device.getMemoryAllocator(), serializedSize, L"SerializedASReadback");
+        ID3D12GraphicsCommandList5* commandList = device.getDXRCommandList();
+        commandList->CopyRaytracingAccelerationStructure(mSerialized->GetGPUVirtualAddress(),
+            mBuffer->GetGPUVirtualAddress(),
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE::
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE_SERIALIZE);
+        commandList->ResourceBarrier(1,
+            &CD3DX12_RESOURCE_BARRIER::Transition(mSerialized.Get(),
+                D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+                D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COPY_SOURCE));
+        commandList->CopyResource(mSerializedReadback.Get(), mSerialized.Get());
+    }
+
+    std::vector<BYTE> BottomLevelAccelerationStructure::getSerializedData() const {
+        MY_THROW_IF_FALSE(mSerializedReadback != nullptr);
+        const UINT64 size = mSerializedReadback->GetDesc().Width;
+        void* mapped;
+        MY_THROW_IF_FAILED(mSerializedReadback->Map(0, nullptr, &mapped));
+        std::vector<BYTE> result(static_cast<const BYTE*>(mapped),
+            static_cast<const BYTE*>(mapped) + size);
+        CD3DX12_RANGE writeRange(0, 0);
+        mSerializedReadback->Unmap(0, &writeRange);
+        return result;
+    }
+
+    void BottomLevelAccelerationStructure::releaseBuildResources() {
+        mUncompactedBuffer.Reset();
+        mPostbuildInfo.Reset();
+        mPostbuildInfoReadback.Reset();
+        mSerialized.Reset();
+        mSerializedReadback.Reset();
+        mDeserializeSource.Reset();
+        mScratch.Reset();
     }
 } // namespace Framework::DX
@@ -5,9 +5,10 @@
  */
 
 #pragma once
+#include <DirectXCollision.h>
+#include <vector>
 #include "DX/Raytracing/DXRDevice.h"
-#include "DX/Resource/IndexBuffer.h"
-#include "DX/Resource/VertexBuffer.h"
+#include "DX/Resource/GeometryArena.h"
 
 namespace Framework::DX {
     /**
@@ -19,7 +20,7 @@ namespace Framework::DX {
         /**
          * @brief RXgN^
          */
-        BottomLevelAccelerationStructure() {}
+        BottomLevelAccelerationStructure() : mBufferSize(0), mCompacted(false) {}
         /**
          * @brief fXgN^
          */
@@ -27,22 +28,139 @@ namespace Framework::DX {
         /**
          * @brief 
          * @param device DXRpfoCX
-         * @param vertexBuffer _obt@
-         * @param vertexSize _̃oCgTCY
-         * @param indexBuffer CfbNXobt@
-         * @param indexSize CfbNX̃oCgTCY
+         * @param geometry _ƃCfbNX͈̔
+         * @param localBounds [JԂł̃oEfBO{bNX
+         * @param buildFlags \ztO
+         * @details ALLOW_COMPACTIONw肷ƍ\zcompactňkł
          */
-        void init(const DXRDevice& device, const VertexBuffer& vertexBuffer, UINT vertexSize,
-            const IndexBuffer& indexBuffer, UINT indexSize);
+        void init(const DXRDevice& device, const GeometryView& geometry,
+            const DirectX::BoundingBox& localBounds,
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlags
+            = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS::
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE);
+        /**
+         * @brief AABBň͂񂾃vV[WȃWIgƂď
+         * @param device DXRpfoCX
+         * @param aabbs [JԂłAABB AABBƂɃC^[ZNVVF[_[Ă΂
+         * @param buildFlags \ztO
+         * @details AABB͂ASobt@ɏނ̂ŁAĂяoɔjĂ悢
+         */
+        void initProcedural(const DXRDevice& device,
+            const std::vector<D3D12_RAYTRACING_AABB>& aabbs,
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlags
+            = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS::
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE);
+        /**
+         * @brief VACYꂽf[^珉
+         * @param data VACYꂽf[^
+         * @param size f[^̃oCgTCY
+         * @return hCo[f[^ɑΉĂȂfalseԂ
+         * @details ̑̈initƓ
+         */
+        bool initFromSerialized(const DXRDevice& device, const GeometryView& geometry,
+            const DirectX::BoundingBox& localBounds,
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlags, const void* data,
+            UINT64 size);
+        /**
+         * @brief ASk
+         * @param device DXRpfoCX
+         * @details \zR}h̎sɌĂ
+         * kÕobt@̓Rs[ƂĎĝŁAreleaseBuildResources܂ŕێ
+         */
+        void compact(const DXRDevice& device);
+        /**
+         * @brief VACỸTCYǂݖ߂R}hς
+         * @details \z∳ǩɌĂсAsserializeĂ
+         */
+        void requestSerializedSize(const DXRDevice& device);
+        /**
+         * @brief VACYCPUǂ߂悤ɂR}hς
+         * @details sgetSerializedDataŎ擾ł
+         */
+        void serialize(const DXRDevice& device);
+        /**
+         * @brief VACYꂽf[^擾
+         */
+        std::vector<BYTE> getSerializedData() const;
+        /**
+         * @brief \zƈkɂ̂ݎgp\[X
+         * @details kR}h̎sɌĂ
+         */
+        void releaseBuildResources();
         /**
          * @brief obt@̎擾
          */
         ID3D12Resource* getBuffer() const {
             return mBuffer.Get();
         }
+        /**
+         * @brief AS̃oCgTCY擾
+         */
+        UINT64 getSize() const {
+            return mBufferSize;
+        }
+        /**
+         * @brief Op`̐擾
+         * @details vV[WȃWIg0Ԃ
+         */
+        UINT getTriangleCount() const {
+            return isProcedural() ? 0 : mGeometryDesc.Triangles.IndexCount / 3;
+        }
+        /**
+         * @brief vV[WȃWIg
+         */
+        bool isProcedural() const {
+            return mGeometryDesc.Type
+                == D3D12_RAYTRACING_GEOMETRY_TYPE::
+                    D3D12_RAYTRACING_GEOMETRY_TYPE_PROCEDURAL_PRIMITIVE_AABBS;
+        }
+        /**
+         * @brief [JԂł̃oEfBO{bNX擾
+         */
+        const DirectX::BoundingBox& getLocalBounds() const {
+            return mLocalBounds;
+        }
+
+    private:
+        /**
+         * @brief WIgfBXNݒ肷
+         */
+        void setGeometry(const GeometryView& geometry);
+        /**
+         * @brief ̃obt@KvȂ쐬
+         */
+        void createPostbuildInfoBuffer(const DXRDevice& device);
+        /**
+         * @brief ܂ꂽǂݖ߂p̃obt@ɃRs[
+         */
+        void copyPostbuildInfoToReadback(ID3D12GraphicsCommandList* commandList);
+        /**
+         * @brief ݂̓͂AS\z
+         * @param device DXRpfoCX
+         */
+        void build(const DXRDevice& device);
+
+        /**
+         * @brief \ztO܂ł邩
+         */
+        bool hasBuildFlag(D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS flag) const {
+            return (mBuildFlags & flag) != 0;
+        }
 
     private:
         Comptr<ID3D12Resource> mScratch;
         Comptr<ID3D12Resource> mBuffer;
+        Comptr<ID3D12Resource> mUncompactedBuffer; //!< kÕobt@
+        Comptr<ID3D12Resource> mPostbuildInfo; //!< ̏ݐ
+        Comptr<ID3D12Resource> mPostbuildInfoReadback; //!< ̓ǂݖ߂
+        Comptr<ID3D12Resource> mSerialized; //!< VACY
+        Comptr<ID3D12Resource> mSerializedReadback; //!< VACYf[^̓ǂݖ߂
+        Comptr<ID3D12Resource> mDeserializeSource; //!< fVACY
+        Comptr<ID3D12Resource> mAABBBuffer; //!< vV[WȃWIgAABB č\złg
+        UINT64 mBufferSize; //!< AS̃oCgTCY
+        bool mCompacted; //!< kς݂
+        D3D12_RAYTRACING_GEOMETRY_DESC mGeometryDesc; //!< WIgfBXN
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS mBuildFlags; //!< \ztO
+        DirectX::BoundingBox mLocalBounds; //!< [JԂł̃oEfBO{bNX
     };
 } // namespace Framework::DX
@@ -9,9 +9,12 @@ namespace Framework::DX {
     void DXRDevice::reset() {
         mDXRDevice.Reset();
         mDXRCommandList.Reset();
+        mMemoryAllocator = nullptr;
     }
     //foCX̐
-    void DXRDevice::create(ID3D12Device* device, ID3D12GraphicsCommandList* commandList) {
+    void DXRDevice::create(ID3D12Device* device, ID3D12GraphicsCommandList* commandList,
+        GpuMemoryAllocator* allocator) {
+        mMemoryAllocator = allocator;
         MY_THROW_IF_FAILED(device->QueryInterface(IID_PPV_ARGS(&mDXRDevice)));
         MY_THROW_IF_FAILED(commandList->QueryInterface(IID_PPV_ARGS(&mDXRCommandList)));
         mDXRDevice->SetName(L"DXRDevice");
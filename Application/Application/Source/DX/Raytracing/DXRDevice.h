@@ -5,6 +5,7 @@
 
 #pragma once
 #include "DX/DeviceResource.h"
+#include "DX/Resource/GpuMemoryAllocator.h"
 
 namespace Framework::DX {
     /**
@@ -28,7 +29,8 @@ namespace Framework::DX {
         /**
          * @brief foCX̐
          */
-        void create(ID3D12Device* device, ID3D12GraphicsCommandList* commandList);
+        void create(ID3D12Device* device, ID3D12GraphicsCommandList* commandList,
+            GpuMemoryAllocator* allocator);
         /**
          * @brief foCX̎擾
          */
@@ -41,9 +43,16 @@ namespace Framework::DX {
         ID3D12GraphicsCommandList5* getDXRCommandList() const {
             return mDXRCommandList.Get();
         }
+        /**
+         * @brief GPŮ蓖Ă擾
+         */
+        GpuMemoryAllocator* getMemoryAllocator() const {
+            return mMemoryAllocator;
+        }
 
     private:
         Comptr<ID3D12Device5> mDXRDevice; //!< DXRɑΉfoCX
         Comptr<ID3D12GraphicsCommandList5> mDXRCommandList; //!< DXRɑΉR}hXg
+        GpuMemoryAllocator* mMemoryAllocator = nullptr; //!< GPŮ蓖
     };
 } // namespace Framework::DX
@@ -20,18 +20,66 @@ namespace Framework::DX {
             D3D12_DESCRIPTOR_HEAP_TYPE::D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
         localDescriptorRate = Math::MathUtil::clamp(localDescriptorRate, 0.0f, 1.0f);
         mLocalHeapStartPosition = static_cast<UINT>(descriptorNum * (1.0f - localDescriptorRate));
+        mGlobalRing.init(mLocalHeapStartPosition);
+        mLocalAllocator.init(descriptorNum - mLocalHeapStartPosition);
     }
     DescriptorInfo RaytracingDescriptorHeap::allocateLocal() {
         DescriptorInfo info = {};
-        UINT position = mLocalAllocatedCount + mLocalHeapStartPosition;
+        const UINT index = mLocalAllocator.allocate();
+        MY_THROW_IF_FALSE_LOG(index != AtomicIndexAllocator::INVALID_INDEX,
+            "Cg[VOpfBXNv^̃[J̈𒴂܂");
+        UINT position = index + mLocalHeapStartPosition;
         info.cpuHandle = CD3DX12_CPU_DESCRIPTOR_HANDLE(
             mDescriptorHeap->GetCPUDescriptorHandleForHeapStart(), position, mDescriptorHeapSize);
         info.gpuHandle = CD3DX12_GPU_DESCRIPTOR_HANDLE(
             mDescriptorHeap->GetGPUDescriptorHandleForHeapStart(), position, mDescriptorHeapSize);
-        mLocalAllocatedCount++;
         return info;
     }
-    void RaytracingDescriptorHeap::resetGlobal() {
-        mGlobalAllocatedCount = 0;
+    void RaytracingDescriptorHeap::freeLocal(const DescriptorInfo& info) {
+        //͂܂Ȃ̂ŃbNōς܂
+        std::lock_guard<std::mutex> lock(mPendingFreeMutex);
+        mPendingFrees.push_back({ getLocalIndex(info), 0 });
+    }
+    bool RaytracingDescriptorHeap::containsLocal(
+        const D3D12_CPU_DESCRIPTOR_HANDLE& cpuHandle) const {
+        const SIZE_T start = mDescriptorHeap->GetCPUDescriptorHandleForHeapStart().ptr
+            + static_cast<SIZE_T>(mLocalHeapStartPosition) * mDescriptorHeapSize;
+        return start <= cpuHandle.ptr
+            && cpuHandle.ptr
+            < start + static_cast<SIZE_T>(mLocalAllocator.getCapacity()) * mDescriptorHeapSize;
+    }
+    UINT RaytracingDescriptorHeap::getLocalIndex(const DescriptorInfo& info) const {
+        MY_ASSERTION(containsLocal(info.cpuHandle), "[J̈̃fBXNv^ł͂܂");
+        const UINT64 offset = info.gpuHandle.ptr - getLocalStart().ptr;
+        return static_cast<UINT>(offset / mDescriptorHeapSize);
+    }
+    D3D12_GPU_DESCRIPTOR_HANDLE RaytracingDescriptorHeap::getLocalStart() const {
+        return CD3DX12_GPU_DESCRIPTOR_HANDLE(mDescriptorHeap->GetGPUDescriptorHandleForHeapStart(),
+            mLocalHeapStartPosition, mDescriptorHeapSize);
+    }
+    void RaytracingDescriptorHeap::retire(UINT64 completedFenceValue) {
+        mGlobalRing.retire(completedFenceValue);
+        std::lock_guard<std::mutex> lock(mPendingFreeMutex);
+        auto it = std::remove_if(
+            mPendingFrees.begin(), mPendingFrees.end(), [&](const PendingFree& pending) {
+                if (pending.fenceValue == 0 || pending.fenceValue > completedFenceValue)
+                    return false;
+                mLocalAllocator.free(pending.index);
+                return true;
+            });
+        mPendingFrees.erase(it, mPendingFrees.end());
+    }
+    void RaytracingDescriptorHeap::endFrame(UINT64 fenceValue) {
+        mGlobalRing.endFrame(fenceValue);
+        std::lock_guard<std::mutex> lock(mPendingFreeMutex);
+        for (auto&& pending : mPendingFrees) {
+            if (pending.fenceValue == 0) pending.fenceValue = fenceValue;
+        }
+    }
+    UINT RaytracingDescriptorHeap::allocateGlobal(UINT num) {
+        const UINT offset = mGlobalRing.allocate(num);
+        MY_THROW_IF_FALSE_LOG(offset != DescriptorRingAllocator::INVALID_OFFSET,
+            "Cg[VOpfBXNv^̃O[ö𒴂܂");
+        return offset;
     }
 } // namespace Framework::DX
@@ -1,5 +1,8 @@
 #pragma once
+#include <mutex>
+#include "DX/Descriptor/AtomicIndexAllocator.h"
 #include "DX/Descriptor/DescriptorInfo.h"
+#include "DX/Descriptor/DescriptorRingAllocator.h"
 
 namespace Framework::DX {
     class DeviceResource;
@@ -22,14 +25,75 @@ namespace Framework::DX {
          */
         void init(DeviceResource* device, D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorNum,
             float localDescriptorRate = 0.2f);
+        /**
+         * @brief [J̈悩mۂ
+         * @details [J̈̓oChX̃eNX`e[uƂĎĝŁA
+         * mۂʒu͉܂ŕςȂ ̃Xbh瓯ɌĂׂ
+         */
         DescriptorInfo allocateLocal();
-        void resetGlobal();
+        /**
+         * @brief [J̈̃fBXNv^
+         * @details GPUgI܂ōėpȂ悤At[̏Iɉ
+         */
+        void freeLocal(const DescriptorInfo& info);
+        /**
+         * @brief [J̈̃fBXNv^
+         */
+        bool containsLocal(const D3D12_CPU_DESCRIPTOR_HANDLE& cpuHandle) const;
+        /**
+         * @brief [J̈̐擪̃CfbNX擾
+         */
+        UINT getLocalIndex(const DescriptorInfo& info) const;
+        /**
+         * @brief [J̈̐擪GPUnh擾
+         */
+        D3D12_GPU_DESCRIPTOR_HANDLE getLocalStart() const;
+        /**
+         * @brief O[ö悩A͈͂mۂ
+         * @details [J̈̓VF[_[e[uɏĂ܂̂ŁAq[v͍蒼Ȃ
+         */
+        UINT allocateGlobal(UINT num);
+        /**
+         * @brief GPUgIO[öƃ[J̈
+         * @param completedFenceValue GPUʉ߂tFX̒l
+         */
+        void retire(UINT64 completedFenceValue);
+        /**
+         * @brief t[I
+         * @param fenceValue ̃t[̃R}h̊ɃVOitFX̒l
+         */
+        void endFrame(UINT64 fenceValue);
+        /**
+         * @brief O[ö̑傫擾
+         */
+        UINT getGlobalCapacity() const {
+            return mGlobalRing.getCapacity();
+        }
+        /**
+         * @brief O[ö̎gp̐̍ől擾
+         */
+        UINT getGlobalHighWaterMark() const {
+            return mGlobalRing.getHighWaterMark();
+        }
         //private:
         Comptr<ID3D12DescriptorHeap> mDescriptorHeap; //!< q[v
         UINT mDescriptorHeapSize = 0; //!< q[vTCY
-        UINT mGlobalAllocatedCount = 0;
+        DescriptorRingAllocator mGlobalRing; //!< O[ö̃t[Ƃ̊mۊǗ
         UINT mLocalHeapStartPosition = 0;
-        UINT mLocalAllocatedCount = 0;
+        AtomicIndexAllocator mLocalAllocator; //!< [J̈̊mۊǗ
+
+    private:
+        /**
+         * @brief ҂̃[J̈̃fBXNv^
+         */
+        struct PendingFree {
+            UINT index; //!< [J̈̐擪̃CfbNX
+            UINT64 fenceValue; //!< gItFX̒l 0Ȃt[IĂȂ
+        };
+        std::vector<PendingFree> mPendingFrees; //!< ҂̃fBXNv^
+        std::mutex mPendingFreeMutex; //!< ҂̃fBXNv^̃bN
+
+    public:
         D3D12_DESCRIPTOR_HEAP_TYPE mType = {};
     };
 } // namespace Framework::DX
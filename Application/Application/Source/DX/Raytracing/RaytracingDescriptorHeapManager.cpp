@@ -21,31 +21,33 @@ namespace Framework::DX {
     }
     void RaytracingDescriptorHeapManager::copyAndSetComputeDescriptorTable(DeviceResource* device,
         ID3D12GraphicsCommandList* commandList, const DescriptorSet& globalSet) {
-        auto setDescriptorSetSingle
-            = [&](const D3D12_CPU_DESCRIPTOR_HANDLE* start, UINT num, UINT index) {
-                  if (num == 0) return;
-                  std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> tmpHandle(num);
-                  for (UINT n = 0; n < num; n++) {
-                      tmpHandle[n] = start[n].ptr == 0 ? mDefaultGlobalView.cpuHandle : start[n];
-                  }
-                  CD3DX12_CPU_DESCRIPTOR_HANDLE dstHandle(
-                      mHeap.mDescriptorHeap->GetCPUDescriptorHandleForHeapStart(),
-                      mHeap.mGlobalAllocatedCount, mHeap.mDescriptorHeapSize);
+        //t[œтRs[ς݂Ȃ炻͈̔͂g
+        DescriptorSet::CbvSrvUavStaging staging;
+        const UINT total = globalSet.stageCbvSrvUavHandle(&staging, mDefaultGlobalView.cpuHandle);
+        if (total == 0) return;
+        const UINT64 layout = globalSet.getCbvSrvUavLayout();
+        UINT offset = 0;
+        if (!mTableCache.find(staging.data(), total, layout, &offset)) {
+            //ZbgŜAĊmۂAxɃRs[
+            offset = mHeap.allocateGlobal(total);
+            CD3DX12_CPU_DESCRIPTOR_HANDLE dstHandle(
+                mHeap.mDescriptorHeap->GetCPUDescriptorHandleForHeapStart(), offset,
+                mHeap.mDescriptorHeapSize);
+            device->getDevice()->CopyDescriptors(
+                1, &dstHandle, &total, total, staging.data(), nullptr, mHeap.mType);
+            mTableCache.insert(staging.data(), total, layout, offset);
+        }
 
-                  device->getDevice()->CopyDescriptors(
-                      1, &dstHandle, &num, num, tmpHandle.data(), nullptr, mHeap.mType);
-                  commandList->SetComputeRootDescriptorTable(index,
-                      CD3DX12_GPU_DESCRIPTOR_HANDLE(
-                          mHeap.mDescriptorHeap->GetGPUDescriptorHandleForHeapStart(),
-                          mHeap.mGlobalAllocatedCount, mHeap.mDescriptorHeapSize));
-                  mHeap.mGlobalAllocatedCount += num;
-              };
-
-        setDescriptorSetSingle(
-            globalSet.getCbvHandle().handle.data(), globalSet.getCbvHandle().max, 0);
-        setDescriptorSetSingle(
-            globalSet.getSrvHandle().handle.data(), globalSet.getSrvHandle().max, 1);
-        setDescriptorSetSingle(
-            globalSet.getUavHandle().handle.data(), globalSet.getUavHandle().max, 2);
+        auto setTable = [&](UINT num, UINT index) {
+            if (num == 0) return;
+            commandList->SetComputeRootDescriptorTable(index,
+                CD3DX12_GPU_DESCRIPTOR_HANDLE(
+                    mHeap.mDescriptorHeap->GetGPUDescriptorHandleForHeapStart(), offset,
+                    mHeap.mDescriptorHeapSize));
+            offset += num;
+        };
+        setTable(globalSet.getCbvHandle().max, 0);
+        setTable(globalSet.getSrvHandle().max, 1);
+        setTable(globalSet.getUavHandle().max, 2);
     }
 } // namespace Framework::DX
@@ -1,5 +1,6 @@
 #pragma once
 #include "DX/Descriptor/DescriptorAllocator.h"
+#include "DX/Descriptor/DescriptorTableCache.h"
 #include "DX/Descriptor/GlobalDescriptorHeap.h"
 #include "DX/Raytracing/RaytracingDescriptorHeap.h"
 
@@ -32,6 +33,7 @@ namespace Framework::DX {
         DeviceResource* mDeviceResource = nullptr;
         DescriptorAllocator mGlobalView; //!<O[opAP[^
         RaytracingDescriptorHeap mHeap; //!<Cg[VOpfBXNv^
+        DescriptorTableCache mTableCache; //!<O[öɃRs[ς݂̃e[u
 
         DescriptorInfo mDefaultGlobalView;
     };
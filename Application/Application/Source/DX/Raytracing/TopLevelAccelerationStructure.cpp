@@ -1,65 +1,134 @@
 #include "TopLevelAccelerationStructure.h"
 #include "DX/Util/Helper.h"
 
-using namespace DirectX;
-
-namespace {
-    inline Comptr<ID3D12Resource> createBuffer(
-        ID3D12Device* device, void* data, UINT size, const std::wstring& name) {
-        Comptr<ID3D12Resource> result = Framework::DX::createUploadBuffer(device, size, name);
-        Framework::DX::writeToResource(result.Get(), data, size);
-        return result;
-    }
-} // namespace
-
 namespace Framework::DX {
-    TopLevelAccelerationStructure::TopLevelAccelerationStructure() {}
+    TopLevelAccelerationStructure::TopLevelAccelerationStructure()
+        : mDesc{},
+          mBuildFlags(D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS::
+                  D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_NONE),
+          mMappedInstances(nullptr),
+          mInstanceCapacity(0),
+          mInstanceCount(0),
+          mUploadedInstanceCount(0),
+          mFrameIndex(0),
+          mNeedsPrebuild(true) {
+        mDirtyRanges.init(static_cast<UINT>(DeviceResource::BACK_BUFFER_COUNT));
+    }
 
     TopLevelAccelerationStructure::~TopLevelAccelerationStructure() {}
 
-    void TopLevelAccelerationStructure::add(const InstanceDesc& desc) {
-        MY_THROW_IF_FALSE(desc.blas);
-
-        D3D12_RAYTRACING_INSTANCE_DESC instanceDesc = {};
-        instanceDesc.InstanceID = desc.instanceID;
-        instanceDesc.InstanceMask = desc.mask;
-        instanceDesc.Flags = desc.flags;
-        instanceDesc.InstanceContributionToHitGroupIndex = desc.hitGroupIndex;
-        instanceDesc.AccelerationStructure = desc.blas->getBuffer()->GetGPUVirtualAddress();
-        XMStoreFloat3x4(reinterpret_cast<XMFLOAT3X4*>(instanceDesc.Transform), desc.transform);
-
-        mInstanceDescs.emplace_back(instanceDesc);
+    void TopLevelAccelerationStructure::writeInstances(const DXRDevice& device,
+        DeviceResource* deviceResource, const Utility::InstanceStore& instances,
+        const D3D12_GPU_VIRTUAL_ADDRESS* blasAddresses, const Utility::InstanceCuller* culler,
+        Utility::WorkerPool* workers) {
+        mInstanceCount = instances.getCount();
+        mDirtyRanges.resize(mInstanceCount);
+        if (mInstanceCount > mInstanceCapacity) {
+            //Ă蒼Ȃ悤ɔ{Xő₷
+            mInstanceCapacity = Math::MathUtil::mymax(
+                { mInstanceCount, mInstanceCapacity * 2, MIN_INSTANCE_CAPACITY });
+            mInstance = createUploadBuffer(device.getMemoryAllocator(),
+                static_cast<UINT64>(mInstanceCapacity) * DeviceResource::BACK_BUFFER_COUNT
+                    * sizeof(D3D12_RAYTRACING_INSTANCE_DESC),
+                L"InstanceDesc");
+            //Abv[hq[v̓}bv܂܂ł悢̂ŁA蒼܂ŕȂ
+            MY_THROW_IF_FAILED(
+                mInstance->Map(0, nullptr, reinterpret_cast<void**>(&mMappedInstances)));
+            mDirtyRanges.markAllDirty();
+            mNeedsPrebuild = true;
+        }
+        //ςCX^Xׂ͂Ă̎ʂŏ
+        mDirtyRanges.markDirty(instances.getDirtyBits());
+        //JǑʂς̂̓}XN CX^Xς͎gȂ
+        const UINT64* visibleBits = nullptr;
+        if (culler && culler->getVisibleBits().size() == (mInstanceCount + 63) / 64) {
+            mDirtyRanges.markDirty(culler->getChangedBits());
+            visibleBits = culler->getVisibleBits().data();
+        }
+        mFrameIndex = deviceResource->getCurrentFrameIndex();
+        mUploadedInstanceCount = mDirtyRanges.collect(mFrameIndex, &mUploadRanges);
+
+        //򉻂̌ςɎg[hԂł̃oEfBO{bNX
+        //ς͍͈̂̔͂ɕK܂܂̂ŁA΍ŐVɂȂ
+        mInstanceBounds.resize(mInstanceCount);
+
+        //͈͕͂āAXbhƂ̗ʂ낦
+        const UINT rangeCount = static_cast<UINT>(mUploadRanges.size());
+        for (UINT i = 0; i < rangeCount; i++) {
+            while (mUploadRanges[i].end - mUploadRanges[i].begin > INSTANCE_GRAIN_SIZE) {
+                const UINT begin = mUploadRanges[i].begin;
+                mUploadRanges[i].begin += INSTANCE_GRAIN_SIZE;
+                mUploadRanges.push_back({ begin, begin + INSTANCE_GRAIN_SIZE });
+            }
+        }
+        D3D12_RAYTRACING_INSTANCE_DESC* descs
+            = mMappedInstances + static_cast<size_t>(mFrameIndex) * mInstanceCapacity;
+        auto write = [&](UINT begin, UINT end) {
+            for (UINT i = begin; i < end; i++) {
+                const Utility::DirtyRange& range = mUploadRanges[i];
+                Utility::writeInstanceDescs(instances, blasAddresses, visibleBits, range.begin,
+                    range.end, descs, mInstanceBounds.data());
+            }
+        };
+        const UINT jobCount = static_cast<UINT>(mUploadRanges.size());
+        if (workers) {
+            workers->parallelFor(jobCount, 1, write);
+        } else {
+            write(0, jobCount);
+        }
     }
 
     void TopLevelAccelerationStructure::build(const DXRDevice& device,
         DeviceResource* deviceResource,
         D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlag) {
-        const UINT size
-            = static_cast<UINT>(mInstanceDescs.size() * sizeof(D3D12_RAYTRACING_INSTANCE_DESC));
-        //ÕfBXN̏ԂXVKvȂXV
-        if (!(mDesc.Inputs.NumDescs == mInstanceDescs.size() && mDesc.Inputs.Flags == buildFlag)) {
-            buildPrebuildInfo(device, buildFlag);
-            mInstance = createUploadBuffer(device.getDXRDevice(), size, L"InstanceDesc");
-            mDesc.Inputs.InstanceDescs = mInstance->GetGPUVirtualAddress();
+        MY_THROW_IF_FALSE(mInstance);
+        //mۂ\ztOςƂO񂩂蒼
+        const bool needsPrebuild = mNeedsPrebuild || mBuildFlags != buildFlag;
+        if (needsPrebuild) {
+            mBuildFlags = buildFlag;
+            buildPrebuildInfo(device, deviceResource, buildFlag);
+            mNeedsPrebuild = false;
+        }
+        mDesc.Inputs.NumDescs = mInstanceCount;
+        //񏑂񂾃t[̎ʂǂ
+        mDesc.Inputs.InstanceDescs = mInstance->GetGPUVirtualAddress()
+            + static_cast<UINT64>(mFrameIndex) * mInstanceCapacity
+                * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
+
+        //CX^XȂ烊tBbgł
+        const bool canRefit = !needsPrebuild && mBuiltBounds.size() == mInstanceBounds.size()
+            && (buildFlag
+                   & D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS::
+                       D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE)
+                != 0;
+        const float degradation = canRefit
+            ? AccelerationStructureUpdatePolicy::estimateDegradation(
+                  mBuiltBounds.data(), mInstanceBounds.data(), mInstanceBounds.size())
+            : 1.0f;
+        mDesc.Inputs.Flags = buildFlag;
+        if (mUpdatePolicy.evaluate(canRefit, degradation)
+            == AccelerationStructureBuildMode::Refit) {
+            mDesc.Inputs.Flags |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS::
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PERFORM_UPDATE;
+            mDesc.SourceAccelerationStructureData = mDesc.DestAccelerationStructureData;
+        } else {
+            mDesc.SourceAccelerationStructureData = 0;
+            mBuiltBounds = mInstanceBounds;
         }
-        writeToResource(mInstance.Get(), mInstanceDescs.data(), size);
         device.getDXRCommandList()->BuildRaytracingAccelerationStructure(&mDesc, 0, nullptr);
-        mSRV.initAsRaytracingAccelerationStructure(
-            deviceResource, mBuffer, DescriptorHeapType::RaytracingGlobal);
-    }
-
-    void TopLevelAccelerationStructure::clear() {
-        mInstanceDescs.clear();
+        device.getDXRCommandList()->ResourceBarrier(
+            1, &CD3DX12_RESOURCE_BARRIER::UAV(mBuffer.getResource()));
     }
 
-    void TopLevelAccelerationStructure::buildPrebuildInfo(
-        const DXRDevice& dxrDevice, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlag) {
+    void TopLevelAccelerationStructure::buildPrebuildInfo(const DXRDevice& dxrDevice,
+        DeviceResource* deviceResource,
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlag) {
         ID3D12Device5* device = dxrDevice.getDXRDevice();
 
         D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& topLevelInputs = mDesc.Inputs;
         topLevelInputs.DescsLayout = D3D12_ELEMENTS_LAYOUT::D3D12_ELEMENTS_LAYOUT_ARRAY;
         topLevelInputs.Flags = buildFlag;
-        topLevelInputs.NumDescs = static_cast<UINT>(mInstanceDescs.size());
+        topLevelInputs.NumDescs = mInstanceCapacity;
         topLevelInputs.pGeometryDescs = nullptr;
         topLevelInputs.Type = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE::
             D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL;
@@ -68,20 +137,27 @@ namespace Framework::DX {
         device->GetRaytracingAccelerationStructurePrebuildInfo(&topLevelInputs, &preInfo);
         MY_THROW_IF_FALSE(preInfo.ResultDataMaxSizeInBytes > 0);
 
-        mScratch = createUAVBuffer(device, preInfo.ScratchDataSizeInBytes,
+        //tBbgłXNb`ĝő傫قɍ킹
+        const UINT64 scratchSize = Math::MathUtil::mymax(
+            preInfo.ScratchDataSizeInBytes, preInfo.UpdateScratchDataSizeInBytes);
+        mScratch = createUAVBuffer(dxrDevice.getMemoryAllocator(), scratchSize,
             D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_UNORDERED_ACCESS, L"ScratchResource");
 
-        Comptr<ID3D12Resource> res = createUAVBuffer(device, preInfo.ResultDataMaxSizeInBytes,
+        Comptr<ID3D12Resource> res = createUAVBuffer(dxrDevice.getMemoryAllocator(),
+            preInfo.ResultDataMaxSizeInBytes,
             D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE,
             L"TopLevelAS");
-        mBuffer.init(
-            res, D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE);
+        mBuffer.init(deviceResource, res,
+            D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE);
 
         D3D12_RESOURCE_STATES initResourceState
             = D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE;
 
         mDesc.DestAccelerationStructureData = mBuffer.getResource()->GetGPUVirtualAddress();
         mDesc.ScratchAccelerationStructureData = mScratch->GetGPUVirtualAddress();
+        //TLASobt@蒼Ƃr[
+        mSRV.initAsRaytracingAccelerationStructure(
+            deviceResource, mBuffer, DescriptorHeapType::RaytracingGlobal);
     }
 
 } // namespace Framework::DX
@@ -6,9 +6,15 @@
 
 #pragma once
 #include <DirectXMath.h>
+#include "DX/Raytracing/AccelerationStructureUpdatePolicy.h"
 #include "DX/Raytracing/BottomLevelAccelerationStructure.h"
 #include "DX/Raytracing/DXRDevice.h"
 #include "DX/Resource/Buffer.h"
+#include "Utility/Memory/FrameDirtyRanges.h"
+#include "Utility/Scene/InstanceCuller.h"
+#include "Utility/Scene/InstanceDescWriter.h"
+#include "Utility/Scene/InstanceStore.h"
+#include "Utility/Thread/WorkerPool.h"
 
 namespace Framework::DX {
     /**
@@ -17,23 +23,8 @@ namespace Framework::DX {
      */
     class TopLevelAccelerationStructure {
     public:
-        /**
-         * @brief TLAS̃CX^XfBXN
-         */
-        struct InstanceDesc {
-            UINT instanceID; //!< ID
-            UINT mask; //!< }XN
-            UINT flags; //!< WIg̃tO
-            UINT hitGroupIndex; //!< qbgO[v̌vZɎgpCfbNX
-            BottomLevelAccelerationStructure* blas; //!< ΏۂƂȂWIg
-            DirectX::XMMATRIX transform; //!< WIg̃gXtH[
-            /**
-             * @brief RXgN^
-             */
-            InstanceDesc()
-                : instanceID(0), mask(0), flags(0), hitGroupIndex(0), blas(nullptr), transform() {}
-        };
-
+        static constexpr UINT INSTANCE_GRAIN_SIZE = 4096; //!< ɏނƂ̑̕傫
+        static constexpr UINT MIN_INSTANCE_CAPACITY = 64; //!< ŏɊmۂCX^X
     public:
         /**
          * @brief RXgN^
@@ -44,20 +35,28 @@ namespace Framework::DX {
          */
         ~TopLevelAccelerationStructure();
         /**
-         * @brief CX^XfBXNǉ
+         * @brief CX^XfBXN
+         * @param device foCX
+         * @param deviceResource foCX\[X
+         * @param instances CX^X̔z updateTransformsς݂clearDirtyOł邱
+         * @param blasAddresses WIg̔ԍňBLAS̃AhX
+         * @param culler JǑ nullptrȂ炷ׂĎc
+         * @param workers ďރXbh nullptrȂĂяoŏ
+         * @details iIɃ}bvAbv[hobt@݂̂̃t[̎ʂɁA
+         * ̎ʂ֍ŌɏłςCX^X
+         * JOꂽ̂͋l߂Ƀ}XN0ɂ̂ŁAт͕ς炸tBbgł
          */
-        void add(const InstanceDesc& desc);
+        void writeInstances(const DXRDevice& device, DeviceResource* deviceResource,
+            const Utility::InstanceStore& instances, const D3D12_GPU_VIRTUAL_ADDRESS* blasAddresses,
+            const Utility::InstanceCuller* culler, Utility::WorkerPool* workers);
         /**
          * @brief@TLAS\z
          * @param device foCX
          * @param buildFlag TLAS̍\ztO
+         * @details ALLOW_UPDATEw肷ƃCX^XςȂԂ͗򉻂ɉătBbg
          */
         void build(const DXRDevice& device, DeviceResource* deviceResource,
             D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlag);
-        /**
-         * @brief fBXNNA
-         */
-        void clear();
         /**
          * @brief obt@擾
          */
@@ -67,21 +66,62 @@ namespace Framework::DX {
         const ShaderResourceView& getView() const {
             return mSRV;
         }
+        /**
+         * @brief XVj擾
+         */
+        AccelerationStructureUpdatePolicy& getUpdatePolicy() {
+            return mUpdatePolicy;
+        }
+        const AccelerationStructureUpdatePolicy& getUpdatePolicy() const {
+            return mUpdatePolicy;
+        }
+        /**
+         * @brief Ōɏ񂾃CX^X擾
+         */
+        UINT getUploadedInstanceCount() const {
+            return mUploadedInstanceCount;
+        }
+        /**
+         * @brief Ōɏ񂾃oCg擾
+         */
+        UINT64 getUploadedBytes() const {
+            return static_cast<UINT64>(mUploadedInstanceCount)
+                * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
+        }
+        /**
+         * @brief Abv[hobt@ɓCX^X擾
+         */
+        UINT getInstanceCapacity() const {
+            return mInstanceCapacity;
+        }
 
     private:
         /**
          * @brief \zɕKvȎO\z
          * @param device foCX
+         * @param deviceResource foCX\[X
          * @param buildFlag TLAS̍\ztO
+         * @details mۂĂCX^XŌς̂ŁAĂ̐܂ł͍蒼Ȃ
          */
-        void buildPrebuildInfo(
-            const DXRDevice& device, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlag);
+        void buildPrebuildInfo(const DXRDevice& device, DeviceResource* deviceResource,
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS buildFlag);
 
     private:
         D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC mDesc; //!< fBXN
-        std::vector<D3D12_RAYTRACING_INSTANCE_DESC> mInstanceDescs; //!< V[fBXN
+        std::vector<Utility::InstanceBounds> mInstanceBounds; //!< CX^X̃[hԂł̃oEfBO{bNX
+        std::vector<Utility::InstanceBounds> mBuiltBounds; //!< Ōɍ\zƂ̃oEfBO{bNX
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS mBuildFlags; //!< \ztO
+        AccelerationStructureUpdatePolicy mUpdatePolicy; //!< XVj
         Comptr<ID3D12Resource> mScratch; //!< XNb`\[X
-        Comptr<ID3D12Resource> mInstance; //!< ꎞIȃ\[X
+        Comptr<ID3D12Resource> mInstance; //!< t[Ƃ̎ʂׂAbv[hobt@
+        D3D12_RAYTRACING_INSTANCE_DESC* mMappedInstances; //!< }bvCX^XfBXN
+        Utility::FrameDirtyRanges mDirtyRanges; //!< ʂƂ̏KvȔ͈
+        std::vector<Utility::DirtyRange> mUploadRanges; //!< 񏑂ޔ͈
+        UINT mInstanceCapacity; //!< ʂɓCX^X
+        UINT mInstanceCount; //!< 񂾃CX^X
+        UINT mUploadedInstanceCount; //!< Ōɏ񂾃CX^X
+        UINT mFrameIndex; //!< Ōɏ񂾎ʂ̔ԍ
+        bool mNeedsPrebuild; //!< mۂ̂ŎO񂩂蒼
         Buffer mBuffer;
         //Comptr<ID3D12Resource> mBuffer; //!< TLASobt@
         ShaderResourceView mSRV;
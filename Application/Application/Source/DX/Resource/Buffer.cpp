@@ -16,34 +16,84 @@ namespace {
 } // namespace
 
 namespace Framework::DX {
+    //fXgN^
+    Buffer::~Buffer() {
+        release();
+    }
+    //[uRXgN^
+    Buffer::Buffer(Buffer&& other) noexcept
+        : mStateRegistry(other.mStateRegistry),
+          mResource(std::move(other.mResource)),
+          mResourceType(other.mResourceType),
+          mCurrentState(other.mCurrentState),
+          mSize(other.mSize),
+          mStride(other.mStride) {
+        other.mStateRegistry = nullptr;
+    }
+    //[u
+    Buffer& Buffer::operator=(Buffer&& other) noexcept {
+        if (this == &other) return *this;
+        release();
+        mStateRegistry = other.mStateRegistry;
+        mResource = std::move(other.mResource);
+        mResourceType = other.mResourceType;
+        mCurrentState = other.mCurrentState;
+        mSize = other.mSize;
+        mStride = other.mStride;
+        other.mStateRegistry = nullptr;
+        return *this;
+    }
     /**
      * @brief 
      */
     void Buffer::init(
         DeviceResource* device, Usage usage, UINT64 size, UINT stride, const std::wstring& name) {
+        //ď͑Õ\[X̓o^
+        release();
         mCurrentState = D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_GENERIC_READ;
-        CD3DX12_HEAP_PROPERTIES props(D3D12_HEAP_TYPE::D3D12_HEAP_TYPE_UPLOAD);
         CD3DX12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Buffer(calcBufferSize(usage, size));
 
-        MY_THROW_IF_FAILED(device->getDevice()->CreateCommittedResource(&props,
-            D3D12_HEAP_FLAGS::D3D12_HEAP_FLAG_NONE, &desc, mCurrentState, nullptr,
-            IID_PPV_ARGS(&mResource)));
-        MY_THROW_IF_FAILED(mResource->SetName(name.c_str()));
+        mResource = device->getMemoryAllocator()->createResource(
+            D3D12_HEAP_TYPE::D3D12_HEAP_TYPE_UPLOAD, desc, mCurrentState, nullptr, name);
+        registerState(device);
+
+        mResourceType = usage;
+        mSize = desc.Width;
+        mStride = stride;
+    }
+    //̃obt@Ƃď
+    void Buffer::initAsDefault(DeviceResource* device, Usage usage, UINT64 size, UINT stride,
+        const std::wstring& name) {
+        release();
+        //obt@̓Rs[L[ňÖٓIɏԂڍŝŋʏԂō쐬
+        mCurrentState = D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COMMON;
+        CD3DX12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Buffer(calcBufferSize(usage, size));
+
+        mResource = device->getMemoryAllocator()->createResource(
+            D3D12_HEAP_TYPE::D3D12_HEAP_TYPE_DEFAULT, desc, mCurrentState, nullptr, name);
+        registerState(device);
 
         mResourceType = usage;
         mSize = desc.Width;
         mStride = stride;
     }
+    //Ȃobt@Ƃď
+    void Buffer::initAsStatic(DeviceResource* device, Usage usage, const void* data, UINT64 size,
+        UINT stride, const std::wstring& name) {
+        initAsDefault(device, usage, size, stride, name);
+        device->getUploadManager()->uploadBuffer(mResource.Get(), 0, data, size);
+    }
     //
     void Buffer::init(DeviceResource* device, const Desc::TextureDesc& texDesc,
         const D3D12_CLEAR_VALUE* clearValue) {
-        CD3DX12_HEAP_PROPERTIES props(D3D12_HEAP_TYPE::D3D12_HEAP_TYPE_DEFAULT);
+        release();
         CD3DX12_RESOURCE_DESC desc
             = CD3DX12_RESOURCE_DESC::Tex2D(texDesc.format, texDesc.width, texDesc.height);
 
         switch (texDesc.flags) {
         case Desc::TextureFlags::None:
-            mCurrentState = D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COPY_DEST;
+            //Rs[L[ŏ݁A͋ʏԂɖ߂̂ōŏ狤ʏԂɂĂ
+            mCurrentState = D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COMMON;
             break;
         case Desc::TextureFlags::RenderTarget:
             mCurrentState = D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RENDER_TARGET;
@@ -61,19 +111,21 @@ namespace Framework::DX {
         default: break;
         }
 
-        MY_THROW_IF_FAILED(device->getDevice()->CreateCommittedResource(&props,
-            D3D12_HEAP_FLAGS::D3D12_HEAP_FLAG_NONE, &desc, mCurrentState, clearValue,
-            IID_PPV_ARGS(&mResource)));
-        MY_THROW_IF_FAILED(mResource->SetName(texDesc.name.c_str()));
+        mResource = device->getMemoryAllocator()->createResource(
+            D3D12_HEAP_TYPE::D3D12_HEAP_TYPE_DEFAULT, desc, mCurrentState, clearValue, texDesc.name);
+        registerState(device);
 
         mResourceType = Usage::ShaderResource;
         mSize = texDesc.width * texDesc.height;
         mStride = 0;
     }
     //\[X珉
-    void Buffer::init(Comptr<ID3D12Resource> resource, D3D12_RESOURCE_STATES state) {
+    void Buffer::init(
+        DeviceResource* device, Comptr<ID3D12Resource> resource, D3D12_RESOURCE_STATES state) {
+        release();
         mResource = resource;
         mCurrentState = state;
+        registerState(device);
     }
 
     //̃}bv
@@ -93,11 +145,20 @@ namespace Framework::DX {
         unmap();
     }
     //\[X̏Ԃ̑J
-    void Buffer::transition(
-        ID3D12GraphicsCommandList* commandList, D3D12_RESOURCE_STATES nextState) {
-        if (mCurrentState == nextState) return;
-        commandList->ResourceBarrier(
-            1, &CD3DX12_RESOURCE_BARRIER::Transition(mResource.Get(), mCurrentState, nextState));
+    void Buffer::transition(CommandListStateTracker* tracker, D3D12_RESOURCE_STATES nextState) {
+        tracker->transition(mResource.Get(), nextState);
         mCurrentState = nextState;
     }
+    //Ԃ̓o^ɓo^
+    void Buffer::registerState(DeviceResource* device) {
+        mStateRegistry = device->getResourceStates();
+        mStateRegistry->registerResource(mResource.Get(), mCurrentState);
+    }
+    //o^ă\[X
+    void Buffer::release() {
+        //AhXɍꂽʂ̃\[XÂԂpȂ悤Aɓo^
+        if (mStateRegistry && mResource) mStateRegistry->unregisterResource(mResource.Get());
+        mStateRegistry = nullptr;
+        mResource.Reset();
+    }
 } // namespace Framework::DX
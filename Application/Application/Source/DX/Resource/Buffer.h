@@ -6,11 +6,17 @@
 #pragma once
 #include "Desc/TextureDesc.h"
 
+namespace Framework::Utility {
+    class ResourceStateRegistry;
+} // namespace Framework::Utility
+
 namespace Framework::DX {
     class DeviceResource;
+    class CommandListStateTracker;
     /**
      * @class Buffer
      * @brief obt@NX
+     * @details 쐬\[X͏Ԃ̓o^ɓo^Ajď̂Ƃɓo^
      */
     class Buffer {
     public:
@@ -33,18 +39,43 @@ namespace Framework::DX {
         /**
          * @brief fXgN^
          */
-        ~Buffer() {}
+        ~Buffer();
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+        /**
+         * @brief [uRXgN^
+         * @details \[XƓo^̏Lڂ
+         */
+        Buffer(Buffer&& other) noexcept;
+        /**
+         * @brief [u
+         * @details Ă郊\[X̓o^Ă珊Lڂ
+         */
+        Buffer& operator=(Buffer&& other) noexcept;
         /**
          * @brief ʏ̃obt@Ƃď
          */
         void init(DeviceResource* device, Usage usage, UINT64 size, UINT stride,
             const std::wstring& name);
+        /**
+         * @brief ̃obt@ƂDEFAULTq[vɏ
+         * @details ʏԂō쐬̂ŁARs[L[ŏ߂
+         */
+        void initAsDefault(DeviceResource* device, Usage usage, UINT64 size, UINT stride,
+            const std::wstring& name);
+        /**
+         * @brief Ȃobt@ƂDEFAULTq[vɏ
+         * @details f[^̓Rs[L[œ] ͋ʏԂɂȂ
+         */
+        void initAsStatic(DeviceResource* device, Usage usage, const void* data, UINT64 size,
+            UINT stride, const std::wstring& name);
         void init(DeviceResource* device, const Desc::TextureDesc& desc,
             const D3D12_CLEAR_VALUE* clearValue = nullptr);
         /**
          * @brief \[X珉
          */
-        void init(Comptr<ID3D12Resource> resource, D3D12_RESOURCE_STATES state);
+        void init(DeviceResource* device, Comptr<ID3D12Resource> resource,
+            D3D12_RESOURCE_STATES state);
         /**
          * @brief ̃}bv
          * @details ̏ݗ̈̐擪Ԃ
@@ -60,8 +91,9 @@ namespace Framework::DX {
         void writeResource(const void* data, UINT64 size);
         /**
          * @brief \[X̏Ԃڍs
+         * @details oA̓gbJ[ɗ߁A\[XgOɂ܂Ƃ߂Ĕs
          */
-        void transition(ID3D12GraphicsCommandList* commandList, D3D12_RESOURCE_STATES nextState);
+        void transition(CommandListStateTracker* tracker, D3D12_RESOURCE_STATES nextState);
         /**
          * @brief \[X擾
          */
@@ -75,7 +107,7 @@ namespace Framework::DX {
             return mResourceType;
         }
         /**
-         * @brief ݂̃\[X̏Ԃ擾
+         * @brief ŌɗvԂ擾
          */
         D3D12_RESOURCE_STATES getCurrentState() const {
             return mCurrentState;
@@ -94,6 +126,17 @@ namespace Framework::DX {
         }
 
     private:
+        /**
+         * @brief 쐬\[XԂ̓o^ɓo^
+         */
+        void registerState(DeviceResource* device);
+        /**
+         * @brief o^ă\[X
+         */
+        void release();
+
+    private:
+        Utility::ResourceStateRegistry* mStateRegistry = nullptr; //!< \[Xo^o^
         Comptr<ID3D12Resource> mResource;
         Usage mResourceType = Usage::ConstantBuffer;
         D3D12_RESOURCE_STATES mCurrentState = D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COMMON;
@@ -1,11 +1,12 @@
 #pragma once
-#include "DX/Resource/Buffer.h"
-#include "DX/Resource/ConstantBufferView.h"
+#include "DX/DeviceResource.h"
 
 namespace Framework::DX {
     /**
      * @class ConstantBuffer
      * @brief RX^gobt@ǗNX
+     * @details XV̂тɃt[̃OV͈͂؂ôŁA
+     * GPUQƒ̓e㏑Ȃ
      */
     template <class T>
     class ConstantBuffer {
@@ -14,27 +15,15 @@ namespace Framework::DX {
          * @brief RXgN^
          */
         ConstantBuffer() {}
-        /**
-         * @brief Rs[RXgN^
-         */
-        ConstantBuffer(const ConstantBuffer& other);
         /**
          * @brief fXgN^
          */
-        ~ConstantBuffer();
-        /**
-         * @brief Rs[
-         */
-        ConstantBuffer& operator=(const ConstantBuffer& other);
+        ~ConstantBuffer() {}
         /**
          * @brief 
-         */
-        void init(DeviceResource* device, const std::wstring& name);
-        /**
-         * @brief VF[_[\[Xr[쐬
          * @param device foCX
          */
-        void createCBV(DeviceResource* device, DescriptorHeapType flag);
+        void init(DeviceResource* device);
         /**
          * @brief Xe[WOeւ̃ANZXZq
          */
@@ -48,59 +37,42 @@ namespace Framework::DX {
             return mStaging;
         }
         /**
-         * @brief r[̎擾
+         * @brief Ōɓ]͈͂GPUAhX擾
+         * @details [gCBVƂĂ̂܂ܐݒł
          */
-        const ConstantBufferView& getView() const {
-            return mCBV;
+        D3D12_GPU_VIRTUAL_ADDRESS getGPUVirtualAddress() const {
+            return mAllocation.gpuAddress;
         }
         /**
-         * @brief Xe[WOeXV
+         * @brief Xe[WOe]
+         * @details t[œeςĂȂΑO͈̔͂g
          */
         void updateStaging();
 
     private:
-        T mStaging;
-        Buffer mBuffer;
-        ConstantBufferView mCBV;
-        void* mMapped = nullptr;
+        T mStaging = {}; //!< CPUŏe
+        T mUploaded = {}; //!< Ōɓ]e
+        ConstantBufferAllocator* mAllocator = nullptr; //!< ͈͂̐؂o
+        ConstantBufferAllocator::Allocation mAllocation; //!< Ōɓ]͈
+        UINT64 mUploadedFrame = UINT64_MAX; //!< Ōɓ]t[̒ʂԍ
     };
-    template <class T>
-    inline ConstantBuffer<T>::ConstantBuffer(const ConstantBuffer& other) {
-        *this = other;
-    }
-    template <class T>
-    inline ConstantBuffer<T>::~ConstantBuffer() {
-        if (mMapped) {
-            mBuffer.unmap();
-            mMapped = nullptr;
-        }
-    }
-    template <class T>
-    inline ConstantBuffer<T>& ConstantBuffer<T>::operator=(const ConstantBuffer& other) {
-        if (this == &other) return *this;
-        this->mCBV = other.mCBV;
-        this->mStaging = other.mStaging;
-        this->mBuffer = other.mBuffer;
-
-        //̃}bvgƉς݂ɃANZX̂
-        //Ń}bv
-        this->mMapped = this->mBuffer.map();
-        return *this;
-    }
     //
     template <class T>
-    inline void ConstantBuffer<T>::init(DeviceResource* device, const std::wstring& name) {
-        mBuffer.init(device, Buffer::Usage::ConstantBuffer, sizeof(T), 0, name);
-
-        mMapped = mBuffer.map();
-    }
-    template <class T>
-    inline void ConstantBuffer<T>::createCBV(DeviceResource* device, DescriptorHeapType flag) {
-        mCBV.init(device, mBuffer, flag);
+    inline void ConstantBuffer<T>::init(DeviceResource* device) {
+        mAllocator = device->getConstantBufferAllocator();
+        mAllocation = {};
+        mUploadedFrame = UINT64_MAX;
     }
     //Xe[WO̍XV
     template <class T>
     inline void ConstantBuffer<T>::updateStaging() {
-        memcpy(mMapped, &mStaging, sizeof(T));
+        MY_ASSERTION(mAllocator, "Ă܂");
+        //O͈͓̔͂t[̊ԂĂȂ
+        const UINT64 frame = mAllocator->getFrameSerial();
+        if (frame == mUploadedFrame && memcmp(&mStaging, &mUploaded, sizeof(T)) == 0) return;
+
+        mAllocation = mAllocator->upload(&mStaging, sizeof(T));
+        mUploaded = mStaging;
+        mUploadedFrame = frame;
     }
 } // namespace Framework::DX
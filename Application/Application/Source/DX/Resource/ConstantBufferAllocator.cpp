@@ -0,0 +1,60 @@
+#include "ConstantBufferAllocator.h"
+#include "DX/Util/Helper.h"
+#include "Math/MathUtility.h"
+
+namespace Framework::DX {
+    //RXgN^
+    ConstantBufferAllocator::ConstantBufferAllocator()
+        : mMapped(nullptr), mGpuAddress(0), mFrameSerial(0) {}
+    //fXgN^
+    ConstantBufferAllocator::~ConstantBufferAllocator() {
+        reset();
+    }
+    //
+    void ConstantBufferAllocator::init(GpuMemoryAllocator* allocator, UINT64 capacity) {
+        reset();
+        mBuffer = createUploadBuffer(allocator, capacity, L"ConstantBufferRing");
+        MY_THROW_IF_FAILED(mBuffer->Map(0, nullptr, reinterpret_cast<void**>(&mMapped)));
+        mGpuAddress = mBuffer->GetGPUVirtualAddress();
+        mRing.init(capacity);
+    }
+    //Oj
+    void ConstantBufferAllocator::reset() {
+        if (mBuffer && mMapped) mBuffer->Unmap(0, nullptr);
+        mMapped = nullptr;
+        mGpuAddress = 0;
+        mBuffer.Reset();
+        mRing.init(0);
+    }
+    //͈͂؂o
+    ConstantBufferAllocator::Allocation ConstantBufferAllocator::allocate(UINT size) {
+        const UINT alignedSize
+            = Math::MathUtil::alignPow2(size, D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+        const UINT64 offset
+            = mRing.allocate(alignedSize, D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+        MY_THROW_IF_FALSE_LOG(offset != Utility::RingAllocator::INVALID_OFFSET,
+            "RX^gobt@̃O𒴂܂");
+
+        Allocation result;
+        result.gpuAddress = mGpuAddress + offset;
+        result.cpuAddress = mMapped + offset;
+        result.size = alignedSize;
+        return result;
+    }
+    //f[^Ő؂o
+    ConstantBufferAllocator::Allocation ConstantBufferAllocator::upload(
+        const void* data, UINT size) {
+        Allocation result = allocate(size);
+        memcpy(result.cpuAddress, data, size);
+        return result;
+    }
+    //t[Jn
+    void ConstantBufferAllocator::beginFrame(UINT64 completedFenceValue) {
+        mRing.retire(completedFenceValue);
+    }
+    //t[I
+    void ConstantBufferAllocator::endFrame(UINT64 fenceValue) {
+        mRing.endBatch(fenceValue);
+        mFrameSerial++;
+    }
+} // namespace Framework::DX
@@ -0,0 +1,98 @@
+/**
+ * @file ConstantBufferAllocator.h
+ * @brief t[ƂɎĝĂRX^gobt@̊蓖
+ */
+
+#pragma once
+#include "DX/Resource/GpuMemoryAllocator.h"
+#include "Utility/Memory/RingAllocator.h"
+
+namespace Framework::DX {
+    /**
+     * @class ConstantBufferAllocator
+     * @brief Ƀ}bvAbv[hobt@256oCgPʂŐ؂o
+     * @details ؂o͈͂͂̃t[̃tFXGPUʉ߂܂ŏȂ
+     * [gCBVƂĂ̂܂ܓn̂ŁARX^gobt@Ƃ̃\[Xƃr[͕svɂȂ
+     * L^Xbĥ݌ĂԂ
+     */
+    class ConstantBufferAllocator {
+    public:
+        static constexpr UINT64 DEFAULT_CAPACITY = 2ull * 1024 * 1024; //!< Ȏ傫
+        /**
+         * @struct Allocation
+         * @brief ؂o͈
+         */
+        struct Allocation {
+            D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0; //!< GPU猩AhX
+            void* cpuAddress = nullptr; //!< ݐ
+            UINT size = 0; //!< ؂o傫
+        };
+
+    public:
+        /**
+         * @brief RXgN^
+         */
+        ConstantBufferAllocator();
+        /**
+         * @brief fXgN^
+         */
+        ~ConstantBufferAllocator();
+        ConstantBufferAllocator(const ConstantBufferAllocator&) = delete;
+        ConstantBufferAllocator& operator=(const ConstantBufferAllocator&) = delete;
+        /**
+         * @brief 
+         * @param allocator O̊mۂɎgAP[^
+         * @param capacity Ȏ傫
+         */
+        void init(GpuMemoryAllocator* allocator, UINT64 capacity = DEFAULT_CAPACITY);
+        /**
+         * @brief Oj
+         */
+        void reset();
+        /**
+         * @brief ͈͂؂o
+         * @param size Kvȑ傫 256oCgɐ؂グ
+         */
+        Allocation allocate(UINT size);
+        /**
+         * @brief f[^񂾔͈͂؂o
+         */
+        Allocation upload(const void* data, UINT size);
+        /**
+         * @brief t[Jns
+         * @param completedFenceValue GPUʉ߂tFX̒l
+         */
+        void beginFrame(UINT64 completedFenceValue);
+        /**
+         * @brief t[Is
+         * @param fenceValue ̃t[̃R}h̊ɃVOitFX̒l
+         */
+        void endFrame(UINT64 fenceValue);
+        /**
+         * @brief ݂̃t[̒ʂԍ擾
+         * @details t[Ő؂o͈͂g񂹂邩̔Ɏg
+         */
+        UINT64 getFrameSerial() const {
+            return mFrameSerial;
+        }
+        /**
+         * @brief Ȏ傫擾
+         */
+        UINT64 getCapacity() const {
+            return mRing.getCapacity();
+        }
+        /**
+         * @brief GPŮ҂܂߂gp̑傫擾
+         */
+        UINT64 getUsedSize() const {
+            return mRing.getUsedSize();
+        }
+
+    private:
+        Comptr<ID3D12Resource> mBuffer; //!< Õobt@
+        BYTE* mMapped; //!< obt@̐擪 Ƀ}bvĂ
+        D3D12_GPU_VIRTUAL_ADDRESS mGpuAddress; //!< obt@̐擪GPUAhX
+        Utility::RingAllocator mRing; //!< O̊蓖
+        UINT64 mFrameSerial; //!< ݂̃t[̒ʂԍ
+    };
+} // namespace Framework::DX
@@ -2,13 +2,43 @@
 #include "DX/DeviceResource.h"
 
 namespace Framework::DX {
+    //fXgN^
+    ConstantBufferView::~ConstantBufferView() {
+        release();
+    }
+    //[uRXgN^
+    ConstantBufferView::ConstantBufferView(ConstantBufferView&& other) noexcept
+        : mHeapManager(other.mHeapManager), mInfo(other.mInfo) {
+        other.mHeapManager = nullptr;
+        other.mInfo = DescriptorInfo();
+    }
+    //[u
+    ConstantBufferView& ConstantBufferView::operator=(ConstantBufferView&& other) noexcept {
+        if (this == &other) return *this;
+        release();
+        mHeapManager = other.mHeapManager;
+        mInfo = other.mInfo;
+        other.mHeapManager = nullptr;
+        other.mInfo = DescriptorInfo();
+        return *this;
+    }
     void ConstantBufferView::init(
         DeviceResource* device, const Buffer& buffer, DescriptorHeapType flag) {
-        mInfo = device->getHeapManager()->allocate(flag);
+        //ď͑Omۂ̂
+        release();
+        mHeapManager = device->getHeapManager();
+        mInfo = mHeapManager->allocate(flag);
 
         D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {};
         cbvDesc.BufferLocation = buffer.getResource()->GetGPUVirtualAddress();
         cbvDesc.SizeInBytes = static_cast<UINT>(buffer.getSize());
         device->getDevice()->CreateConstantBufferView(&cbvDesc, mInfo.cpuHandle);
     }
+    //mۂĂfBXNv^
+    void ConstantBufferView::release() {
+        if (!mHeapManager) return;
+        mHeapManager->deallocate(&mInfo);
+        mHeapManager = nullptr;
+        mInfo = DescriptorInfo();
+    }
 } // namespace Framework::DX
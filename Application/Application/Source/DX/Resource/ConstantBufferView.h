@@ -5,6 +5,7 @@
 
 namespace Framework::DX {
     class DeviceResource;
+    class DescriptorHeapManager;
     /**
      * @class ConstantBufferView
      * @brief discription
@@ -18,13 +19,32 @@ namespace Framework::DX {
         /**
          * @brief fXgN^
          */
-        ~ConstantBufferView() {}
+        ~ConstantBufferView();
+        ConstantBufferView(const ConstantBufferView&) = delete;
+        ConstantBufferView& operator=(const ConstantBufferView&) = delete;
+        /**
+         * @brief [uRXgN^
+         * @details fBXNv^̏Lڂ
+         */
+        ConstantBufferView(ConstantBufferView&& other) noexcept;
+        /**
+         * @brief [u
+         * @details ĂfBXNv^Ă珊Lڂ
+         */
+        ConstantBufferView& operator=(ConstantBufferView&& other) noexcept;
         void init(DeviceResource* device, const Buffer& buffer, DescriptorHeapType flag);
         const DescriptorInfo& getInfo() const {
             return mInfo;
         }
 
     private:
+        /**
+         * @brief mۂĂfBXNv^
+         */
+        void release();
+
+    private:
+        DescriptorHeapManager* mHeapManager = nullptr; //!< fBXNv^mۂq[vǗ
         DescriptorInfo mInfo;
     };
 } // namespace Framework::DX
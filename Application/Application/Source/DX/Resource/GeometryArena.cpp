@@ -0,0 +1,104 @@
+#include "GeometryArena.h"
+#include "DX/DeviceResource.h"
+#include "Math/MathUtility.h"
+
+namespace {
+    static constexpr UINT RAW_BUFFER_ELEMENT_SIZE = 4; //!< RAWobt@̗vf̃oCg
+} // namespace
+
+namespace Framework::DX {
+    //RXgN^
+    GeometryArena::GeometryArena()
+        : mVertexStride(0), mIndexSize(0), mResidency(GeometryResidency::GpuOnly) {}
+    //fXgN^
+    GeometryArena::~GeometryArena() {}
+    //
+    void GeometryArena::init(DeviceResource* device, UINT vertexStride, UINT vertexCapacity,
+        UINT indexSize, UINT indexCapacity, GeometryResidency residency,
+        const std::wstring& name) {
+        mVertexStride = vertexStride;
+        mIndexSize = indexSize;
+        mResidency = residency;
+        mLayout.init(vertexCapacity, indexCapacity);
+
+        //̃obt@͍Ȃ̂ōŒ1vf͊mۂ
+        const UINT vertexBytes
+            = Math::MathUtil::mymax(mLayout.getVertexCapacity(), 1u) * mVertexStride;
+        //CfbNX4oCgPʂœǂނ̂ŃTCY낦
+        const UINT indexBytes = Math::MathUtil::alignPow2(
+            Math::MathUtil::mymax(mLayout.getIndexCapacity(), 1u) * mIndexSize,
+            RAW_BUFFER_ELEMENT_SIZE);
+        mVertexBuffer.initAsDefault(
+            device, Buffer::Usage::VertexBuffer, vertexBytes, mVertexStride, name + L"Vertex");
+        mIndexBuffer.initAsDefault(
+            device, Buffer::Usage::IndexBuffer, indexBytes, mIndexSize, name + L"Index");
+
+        mCpuVertices.clear();
+        mCpuIndices.clear();
+        if (mResidency == GeometryResidency::KeepCpuCopy) {
+            mCpuVertices.resize(vertexBytes);
+            mCpuIndices.resize(indexBytes);
+        }
+    }
+    //bVǉ
+    UINT GeometryArena::addMesh(DeviceResource* device, const void* vertices, UINT vertexCount,
+        const void* indices, UINT indexCount) {
+        const UINT mesh = mLayout.allocate(vertexCount, indexCount);
+        MY_THROW_IF_FALSE_LOG(mesh != Utility::GeometryArenaLayout::INVALID_MESH,
+            "WIgA[i̗eʂ𒴂܂");
+
+        const Utility::GeometryRange& range = mLayout.getRange(mesh);
+        const UINT64 vertexOffset = static_cast<UINT64>(range.vertexOffset) * mVertexStride;
+        const UINT64 vertexBytes = static_cast<UINT64>(vertexCount) * mVertexStride;
+        const UINT64 indexOffset = static_cast<UINT64>(range.indexOffset) * mIndexSize;
+        const UINT64 indexBytes = static_cast<UINT64>(indexCount) * mIndexSize;
+        UploadManager* uploader = device->getUploadManager();
+        if (vertexBytes > 0) {
+            uploader->uploadBuffer(mVertexBuffer.getResource(), vertexOffset, vertices, vertexBytes);
+        }
+        if (indexBytes > 0) {
+            uploader->uploadBuffer(mIndexBuffer.getResource(), indexOffset, indices, indexBytes);
+        }
+
+        if (mResidency == GeometryResidency::KeepCpuCopy) {
+            if (vertexBytes > 0) memcpy(&mCpuVertices[vertexOffset], vertices, vertexBytes);
+            if (indexBytes > 0) memcpy(&mCpuIndices[indexOffset], indices, indexBytes);
+        }
+        return mesh;
+    }
+    //bV菜
+    void GeometryArena::removeMesh(UINT mesh) {
+        mLayout.free(mesh);
+    }
+    //r[쐬
+    void GeometryArena::createSRV(DeviceResource* device, DescriptorHeapType heapFlag) {
+        mVertexSRV.initAsBuffer(device, mVertexBuffer, heapFlag);
+        mIndexSRV.initAsRawBuffer(device, mIndexBuffer,
+            static_cast<UINT>(mIndexBuffer.getSize() / RAW_BUFFER_ELEMENT_SIZE), heapFlag);
+    }
+    //bṼWIg擾
+    GeometryView GeometryArena::getView(UINT mesh) const {
+        const Utility::GeometryRange& range = mLayout.getRange(mesh);
+        GeometryView view;
+        view.vertexAddress = mVertexBuffer.getResource()->GetGPUVirtualAddress()
+            + static_cast<UINT64>(range.vertexOffset) * mVertexStride;
+        view.vertexCount = range.vertexCount;
+        view.vertexStride = mVertexStride;
+        view.indexAddress = mIndexBuffer.getResource()->GetGPUVirtualAddress()
+            + static_cast<UINT64>(range.indexOffset) * mIndexSize;
+        view.indexCount = range.indexCount;
+        view.indexSize = mIndexSize;
+        return view;
+    }
+    //CPUɎc_擾
+    const void* GeometryArena::getCpuVertices(UINT mesh) const {
+        if (mCpuVertices.empty()) return nullptr;
+        return &mCpuVertices[static_cast<size_t>(mLayout.getRange(mesh).vertexOffset)
+            * mVertexStride];
+    }
+    //CPUɎcCfbNX擾
+    const void* GeometryArena::getCpuIndices(UINT mesh) const {
+        if (mCpuIndices.empty()) return nullptr;
+        return &mCpuIndices[static_cast<size_t>(mLayout.getRange(mesh).indexOffset) * mIndexSize];
+    }
+} // namespace Framework::DX
@@ -0,0 +1,144 @@
+/**
+ * @file GeometryArena.h
+ * @brief Sf̒_ƃCfbNX܂Ƃ߂Ďobt@
+ */
+
+#pragma once
+#include "DX/Resource/Buffer.h"
+#include "DX/Resource/ShaderResourceView.h"
+#include "Utility/Memory/GeometryArenaLayout.h"
+
+namespace Framework::DX {
+    /**
+     * @enum GeometryResidency
+     * @brief CPUɃWIgcǂ
+     */
+    enum class GeometryResidency {
+        GpuOnly, //!< ]GPUɂ̂ݒu
+        KeepCpuCopy, //!< CPUǂ߂悤Ɏʂc
+    };
+
+    /**
+     * @struct GeometryView
+     * @brief bṼWIgGPUAhXŕ\
+     */
+    struct GeometryView {
+        D3D12_GPU_VIRTUAL_ADDRESS vertexAddress = 0; //!< 擪̒_̃AhX
+        UINT vertexCount = 0; //!< _
+        UINT vertexStride = 0; //!< _̃oCgTCY
+        D3D12_GPU_VIRTUAL_ADDRESS indexAddress = 0; //!< 擪̃CfbNX̃AhX
+        UINT indexCount = 0; //!< CfbNX
+        UINT indexSize = 0; //!< CfbNX̃oCgTCY
+    };
+
+    /**
+     * @class GeometryArena
+     * @brief _obt@ƃCfbNXobt@AbVƂɐ؂o
+     * @details BLAS̓͂ƃVF[_[̎QƂ͓obt@ItZbgŎw
+     */
+    class GeometryArena {
+    public:
+        /**
+         * @brief RXgN^
+         */
+        GeometryArena();
+        /**
+         * @brief fXgN^
+         */
+        ~GeometryArena();
+        /**
+         * @brief 
+         * @param device foCX
+         * @param vertexStride _̃oCgTCY
+         * @param vertexCapacity i[钸_̍v
+         * @param indexSize CfbNX̃oCgTCY
+         * @param indexCapacity i[CfbNX̍v
+         * @param residency CPUɃWIgcǂ
+         * @param name obt@̖O
+         */
+        void init(DeviceResource* device, UINT vertexStride, UINT vertexCapacity, UINT indexSize,
+            UINT indexCapacity, GeometryResidency residency, const std::wstring& name);
+        /**
+         * @brief bVǉ
+         * @return bV̔ԍ
+         * @details f[^̓Rs[L[œ]
+         */
+        UINT addMesh(DeviceResource* device, const void* vertices, UINT vertexCount,
+            const void* indices, UINT indexCount);
+        /**
+         * @brief bVǉ
+         */
+        template <class V, class I>
+        UINT addMesh(
+            DeviceResource* device, const std::vector<V>& vertices, const std::vector<I>& indices);
+        /**
+         * @brief bV菜
+         * @details ͈͂͂ɍėp̂ŁAGPUQƂȂȂĂĂԂ
+         */
+        void removeMesh(UINT mesh);
+        /**
+         * @brief VF[_[QƂr[쐬
+         * @details _͍\obt@ACfbNXRAWobt@ƂĎQƂ
+         */
+        void createSRV(DeviceResource* device, DescriptorHeapType heapFlag);
+        /**
+         * @brief bV͈̔͂擾
+         */
+        const Utility::GeometryRange& getRange(UINT mesh) const {
+            return mLayout.getRange(mesh);
+        }
+        /**
+         * @brief bṼWIgGPUAhXŎ擾
+         */
+        GeometryView getView(UINT mesh) const;
+        /**
+         * @brief CPUɎc_擾
+         * @return ʂcĂȂnullptrԂ
+         */
+        const void* getCpuVertices(UINT mesh) const;
+        /**
+         * @brief CPUɎcCfbNX擾
+         * @return ʂcĂȂnullptrԂ
+         */
+        const void* getCpuIndices(UINT mesh) const;
+        /**
+         * @brief _obt@̃r[擾
+         */
+        const ShaderResourceView& getVertexView() const {
+            return mVertexSRV;
+        }
+        /**
+         * @brief CfbNXobt@̃r[擾
+         */
+        const ShaderResourceView& getIndexView() const {
+            return mIndexSRV;
+        }
+        /**
+         * @brief zu擾
+         */
+        const Utility::GeometryArenaLayout& getLayout() const {
+            return mLayout;
+        }
+
+    private:
+        Buffer mVertexBuffer; //!< _obt@
+        Buffer mIndexBuffer; //!< CfbNXobt@
+        ShaderResourceView mVertexSRV; //!< _obt@̃r[
+        ShaderResourceView mIndexSRV; //!< CfbNXobt@̃r[
+        Utility::GeometryArenaLayout mLayout; //!< bVƂ͈̔
+        UINT mVertexStride; //!< _̃oCgTCY
+        UINT mIndexSize; //!< CfbNX̃oCgTCY
+        GeometryResidency mResidency; //!< CPUɃWIgcǂ
+        std::vector<BYTE> mCpuVertices; //!< CPUɎc_
+        std::vector<BYTE> mCpuIndices; //!< CPUɎcCfbNX
+    };
+    //bVǉ
+    template <class V, class I>
+    inline UINT GeometryArena::addMesh(
+        DeviceResource* device, const std::vector<V>& vertices, const std::vector<I>& indices) {
+        MY_ASSERTION(sizeof(V) == mVertexStride && sizeof(I) == mIndexSize,
+            "A[iƗvf̑傫v܂");
+        return addMesh(device, vertices.data(), static_cast<UINT>(vertices.size()),
+            indices.data(), static_cast<UINT>(indices.size()));
+    }
+} // namespace Framework::DX
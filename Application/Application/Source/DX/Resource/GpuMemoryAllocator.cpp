@@ -0,0 +1,189 @@
+#include "GpuMemoryAllocator.h"
+
+namespace {
+    //zü̗\[XɎ邽߂GUID
+    // {6B7C0C5E-3F0B-4E8E-9A51-2D6C8F1B7A34}
+    static const GUID GPU_MEMORY_BLOCK_GUID
+        = { 0x6b7c0c5e, 0x3f0b, 0x4e8e, { 0x9a, 0x51, 0x2d, 0x6c, 0x8f, 0x1b, 0x7a, 0x34 } };
+
+    /**
+     * @class GpuMemoryBlock
+     * @brief \[Xzü
+     * @details \[X̃vCx[gf[^ƂĎA\[X̔jƓɉ\񂷂
+     */
+    class GpuMemoryBlock : public IUnknown {
+    public:
+        /**
+         * @brief RXgN^
+         */
+        GpuMemoryBlock(SharedPtr<Framework::DX::GpuMemoryPool> pool, UINT heapIndex,
+            const Framework::Utility::TlsfAllocator::Allocation& allocation)
+            : mRefCount(1), mPool(pool), mHeapIndex(heapIndex), mAllocation(allocation) {}
+        /**
+         * @brief fXgN^
+         */
+        virtual ~GpuMemoryBlock() {
+            mPool->free(mHeapIndex, mAllocation);
+        }
+        HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** object) override {
+            if (!object) return E_POINTER;
+            if (riid != __uuidof(IUnknown)) {
+                *object = nullptr;
+                return E_NOINTERFACE;
+            }
+            *object = this;
+            AddRef();
+            return S_OK;
+        }
+        ULONG STDMETHODCALLTYPE AddRef() override {
+            return mRefCount.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+        ULONG STDMETHODCALLTYPE Release() override {
+            const ULONG count = mRefCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+            if (count == 0) delete this;
+            return count;
+        }
+
+    private:
+        std::atomic<ULONG> mRefCount; //!< QƃJEg
+        SharedPtr<Framework::DX::GpuMemoryPool> mPool; //!< zũv[
+        UINT mHeapIndex; //!< zũq[v̔ԍ
+        Framework::Utility::TlsfAllocator::Allocation mAllocation; //!< zu͈
+    };
+
+    /**
+     * @brief \[Xɍq[ṽtO擾
+     * @details \[Xq[veBA1ł悤ɎނƂɃq[v𕪂
+     */
+    inline D3D12_HEAP_FLAGS getHeapFlags(const D3D12_RESOURCE_DESC& desc) {
+        if (desc.Dimension == D3D12_RESOURCE_DIMENSION::D3D12_RESOURCE_DIMENSION_BUFFER) {
+            return D3D12_HEAP_FLAGS::D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;
+        }
+        const D3D12_RESOURCE_FLAGS rtdsFlags
+            = D3D12_RESOURCE_FLAGS::D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET
+            | D3D12_RESOURCE_FLAGS::D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
+        if (desc.Flags & rtdsFlags) {
+            return D3D12_HEAP_FLAGS::D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+        }
+        return D3D12_HEAP_FLAGS::D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+    }
+} // namespace
+
+namespace Framework::DX {
+    //RXgN^
+    GpuMemoryAllocator::GpuMemoryAllocator()
+        : mDevice(nullptr), mHeapSize(DEFAULT_HEAP_SIZE), mCommittedCount(0) {}
+    //fXgN^
+    GpuMemoryAllocator::~GpuMemoryAllocator() {
+        reset();
+    }
+    //
+    void GpuMemoryAllocator::init(ID3D12Device* device, UINT64 heapSize) {
+        reset();
+        mDevice = device;
+        mHeapSize = heapSize;
+    }
+    //q[v
+    void GpuMemoryAllocator::reset() {
+        std::lock_guard<std::mutex> lock(mPoolMutex);
+        mPools.clear();
+        mDevice = nullptr;
+        mCommittedCount = 0;
+    }
+    //\[X쐬
+    Comptr<ID3D12Resource> GpuMemoryAllocator::createResource(D3D12_HEAP_TYPE heapType,
+        const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initState,
+        const D3D12_CLEAR_VALUE* clearValue, const std::wstring& name) {
+        Comptr<ID3D12Resource> resource;
+        D3D12_RESOURCE_DESC placedDesc = desc;
+        D3D12_RESOURCE_ALLOCATION_INFO info = {};
+        //eNX`4KBPʂŔzuł邩
+        const bool isTexture
+            = desc.Dimension != D3D12_RESOURCE_DIMENSION::D3D12_RESOURCE_DIMENSION_BUFFER;
+        if (isTexture && desc.Alignment == 0 && desc.SampleDesc.Count == 1
+            && getHeapFlags(desc) == D3D12_HEAP_FLAGS::D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES) {
+            placedDesc.Alignment = D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT;
+            info = mDevice->GetResourceAllocationInfo(0, 1, &placedDesc);
+            if (info.Alignment != D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT) {
+                placedDesc.Alignment = 0;
+            }
+        }
+        if (placedDesc.Alignment == 0) {
+            info = mDevice->GetResourceAllocationInfo(0, 1, &placedDesc);
+        }
+
+        //q[v̔𒴂͔̂zuƖʂ傫̂ŃR~bg\[Xɂ
+        if (info.SizeInBytes > mHeapSize / 2) {
+            CD3DX12_HEAP_PROPERTIES props(heapType);
+            MY_THROW_IF_FAILED(mDevice->CreateCommittedResource(&props,
+                D3D12_HEAP_FLAGS::D3D12_HEAP_FLAG_NONE, &desc, initState, clearValue,
+                IID_PPV_ARGS(&resource)));
+            MY_THROW_IF_FAILED(resource->SetName(name.c_str()));
+            mCommittedCount.fetch_add(1, std::memory_order_relaxed);
+            return resource;
+        }
+
+        SharedPtr<GpuMemoryPool> pool = findPool(heapType, getHeapFlags(desc), info.Alignment);
+        ID3D12Heap* heap = nullptr;
+        UINT heapIndex = 0;
+        Utility::TlsfAllocator::Allocation allocation;
+        pool->allocate(info.SizeInBytes, &heap, &heapIndex, &allocation);
+
+        const HRESULT hr = mDevice->CreatePlacedResource(heap, allocation.offset, &placedDesc,
+            initState, clearValue, IID_PPV_ARGS(&resource));
+        if (FAILED(hr)) {
+            pool->free(heapIndex, allocation);
+            MY_THROW_IF_FAILED(hr);
+        }
+        MY_THROW_IF_FAILED(resource->SetName(name.c_str()));
+
+        //\[XjꂽubNAzủ\񂳂
+        Comptr<GpuMemoryBlock> block;
+        block.Attach(new GpuMemoryBlock(pool, heapIndex, allocation));
+        MY_THROW_IF_FAILED(resource->SetPrivateDataInterface(GPU_MEMORY_BLOCK_GUID, block.Get()));
+        return resource;
+    }
+    //t[Jn
+    void GpuMemoryAllocator::beginFrame(UINT64 completedFenceValue) {
+        std::lock_guard<std::mutex> lock(mPoolMutex);
+        for (auto&& pool : mPools) { pool->retire(completedFenceValue); }
+    }
+    //t[I
+    void GpuMemoryAllocator::endFrame(UINT64 fenceValue) {
+        std::lock_guard<std::mutex> lock(mPoolMutex);
+        for (auto&& pool : mPools) { pool->endFrame(fenceValue); }
+    }
+    //̃q[vj
+    UINT GpuMemoryAllocator::releaseEmptyHeaps() {
+        std::lock_guard<std::mutex> lock(mPoolMutex);
+        UINT count = 0;
+        for (auto&& pool : mPools) { count += pool->releaseEmptyHeaps(); }
+        return count;
+    }
+    //gp󋵂擾
+    GpuMemoryAllocator::Stats GpuMemoryAllocator::getStats() const {
+        std::lock_guard<std::mutex> lock(mPoolMutex);
+        Stats stats;
+        for (auto&& pool : mPools) {
+            const GpuMemoryPool::Stats poolStats = pool->getStats();
+            stats.heapCount += poolStats.heapCount;
+            stats.reservedSize += poolStats.reservedSize;
+            stats.usedSize += poolStats.usedSize;
+            stats.allocationCount += poolStats.allocationCount;
+            stats.pendingFreeCount += poolStats.pendingFreeCount;
+        }
+        stats.committedCount = mCommittedCount.load(std::memory_order_relaxed);
+        return stats;
+    }
+    //v[擾
+    SharedPtr<GpuMemoryPool> GpuMemoryAllocator::findPool(
+        D3D12_HEAP_TYPE heapType, D3D12_HEAP_FLAGS heapFlags, UINT64 alignment) {
+        std::lock_guard<std::mutex> lock(mPoolMutex);
+        for (auto&& pool : mPools) {
+            if (pool->isMatch(heapType, heapFlags, alignment)) return pool;
+        }
+        mPools.emplace_back(
+            std::make_shared<GpuMemoryPool>(mDevice, heapType, heapFlags, alignment, mHeapSize));
+        return mPools.back();
+    }
+} // namespace Framework::DX
@@ -0,0 +1,104 @@
+/**
+ * @file GpuMemoryAllocator.h
+ * @brief GPŮ蓖
+ */
+
+#pragma once
+#include <atomic>
+#include <mutex>
+#include "DX/Resource/GpuMemoryPool.h"
+
+namespace Framework::DX {
+    /**
+     * @class GpuMemoryAllocator
+     * @brief 傫ȃq[vɃ\[Xzuč쐬
+     * @details \[XƂɃR~bg\[Xƃy[WPʂ̖ʂƃhCoׂ̕傫̂ŁA
+     * ނƂ̃q[vɂ܂Ƃ߂Ĕzu zủ̓\[X̔jɍ킹Ďōs
+     * ̃Xbh瓯ɌĂׂ
+     */
+    class GpuMemoryAllocator {
+    public:
+        static constexpr UINT64 DEFAULT_HEAP_SIZE = 64ull * 1024 * 1024; //!< ̃q[v̑傫
+        /**
+         * @struct Stats
+         * @brief gp
+         */
+        struct Stats {
+            UINT heapCount = 0; //!< q[v̐
+            UINT64 reservedSize = 0; //!< mۂq[v̍v̑傫
+            UINT64 usedSize = 0; //!< \[XzuĂ傫
+            UINT allocationCount = 0; //!< zuĂ郊\[X̐
+            UINT pendingFreeCount = 0; //!< GPUgÎ҂Ă鐔
+            UINT committedCount = 0; //!< 傫ăR~bg\[Xɂ
+        };
+
+    public:
+        /**
+         * @brief RXgN^
+         */
+        GpuMemoryAllocator();
+        /**
+         * @brief fXgN^
+         */
+        ~GpuMemoryAllocator();
+        GpuMemoryAllocator(const GpuMemoryAllocator&) = delete;
+        GpuMemoryAllocator& operator=(const GpuMemoryAllocator&) = delete;
+        /**
+         * @brief 
+         * @param device foCX
+         * @param heapSize ̃q[v̑傫 ̔傫\[X̓R~bg\[Xɂ
+         */
+        void init(ID3D12Device* device, UINT64 heapSize = DEFAULT_HEAP_SIZE);
+        /**
+         * @brief ׂẴq[v
+         * @details zuς݂̃\[XcĂ΁A炪j܂Ńq[v͎c
+         */
+        void reset();
+        /**
+         * @brief \[X쐬
+         * @param heapType q[v̎
+         * @param desc \[X̐ݒ
+         * @param initState 
+         * @param clearValue NAl svȂnullptr
+         * @param name \[X
+         */
+        Comptr<ID3D12Resource> createResource(D3D12_HEAP_TYPE heapType,
+            const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initState,
+            const D3D12_CLEAR_VALUE* clearValue, const std::wstring& name);
+        /**
+         * @brief t[Jns
+         * @param completedFenceValue GPUʉ߂tFX̒l
+         */
+        void beginFrame(UINT64 completedFenceValue);
+        /**
+         * @brief t[Is
+         * @param fenceValue ̃t[̃R}h̊ɃVOitFX̒l
+         */
+        void endFrame(UINT64 fenceValue);
+        /**
+         * @brief zuĂȂq[vj
+         * @details V[̐؂ւȂǂł܂Ƃ߂ĉɌĂ
+         * @return jq[v̐
+         */
+        UINT releaseEmptyHeaps();
+        /**
+         * @brief gp󋵂擾
+         */
+        Stats getStats() const;
+
+    private:
+        /**
+         * @brief zũv[擾 Ȃ΍쐬
+         */
+        SharedPtr<GpuMemoryPool> findPool(
+            D3D12_HEAP_TYPE heapType, D3D12_HEAP_FLAGS heapFlags, UINT64 alignment);
+
+    private:
+        ID3D12Device* mDevice; //!< foCX
+        UINT64 mHeapSize; //!< ̃q[v̑傫
+        //zu\[Xv[QƂ̂ŁA\[XɔjȂ悤L
+        std::vector<SharedPtr<GpuMemoryPool>> mPools;
+        mutable std::mutex mPoolMutex; //!< v[ǉ̃bN
+        std::atomic<UINT> mCommittedCount; //!< R~bg\[Xɂ
+    };
+} // namespace Framework::DX
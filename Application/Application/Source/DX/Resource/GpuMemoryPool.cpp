@@ -0,0 +1,105 @@
+#include "GpuMemoryPool.h"
+
+namespace Framework::DX {
+    //RXgN^
+    GpuMemoryPool::GpuMemoryPool(ID3D12Device* device, D3D12_HEAP_TYPE heapType,
+        D3D12_HEAP_FLAGS heapFlags, UINT64 alignment, UINT64 heapSize)
+        : mDevice(device),
+          mHeapType(heapType),
+          mHeapFlags(heapFlags),
+          mAlignment(alignment),
+          mHeapSize(heapSize) {}
+    //fXgN^
+    GpuMemoryPool::~GpuMemoryPool() {}
+    //̈蓖Ă
+    void GpuMemoryPool::allocate(UINT64 size, ID3D12Heap** heap, UINT* heapIndex,
+        Utility::TlsfAllocator::Allocation* allocation) {
+        //傫ACgɂ낦Ă΁A擪̂ŋ󂫃ubN܂Ȃ
+        size = (size + mAlignment - 1) & ~(mAlignment - 1);
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (UINT i = 0; i < mHeaps.size(); i++) {
+            if (!mHeaps[i]) continue;
+            *allocation = mHeaps[i]->allocator.allocate(size, mAlignment);
+            if (!allocation->isValid()) continue;
+            *heap = mHeaps[i]->heap.Get();
+            *heapIndex = i;
+            return;
+        }
+
+        //ǂ̃q[vɂȂΒǉ jꏊ΍ėp
+        UINT index = static_cast<UINT>(mHeaps.size());
+        for (UINT i = 0; i < mHeaps.size(); i++) {
+            if (mHeaps[i]) continue;
+            index = i;
+            break;
+        }
+        UniquePtr<Heap> newHeap = std::make_unique<Heap>();
+        //MSAA4MBAȊO64KBɂq[vKv
+        const UINT64 heapAlignment = Math::MathUtil::mymax<UINT64>(
+            mAlignment, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
+        CD3DX12_HEAP_DESC desc(mHeapSize, mHeapType, heapAlignment, mHeapFlags);
+        MY_THROW_IF_FAILED(mDevice->CreateHeap(&desc, IID_PPV_ARGS(&newHeap->heap)));
+        MY_THROW_IF_FAILED(newHeap->heap->SetName(L"GpuMemoryPool"));
+        newHeap->allocator.init(mHeapSize);
+        *allocation = newHeap->allocator.allocate(size, mAlignment);
+        MY_THROW_IF_FALSE_LOG(allocation->isValid(), "q[v傫\[X͔zuł܂");
+        *heap = newHeap->heap.Get();
+        *heapIndex = index;
+        if (index == mHeaps.size()) mHeaps.emplace_back(std::move(newHeap));
+        else mHeaps[index] = std::move(newHeap);
+    }
+    //\񂷂
+    void GpuMemoryPool::free(UINT heapIndex, const Utility::TlsfAllocator::Allocation& allocation) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mPendingFrees.push_back({ heapIndex, allocation, 0 });
+    }
+    //GPUgÏ
+    void GpuMemoryPool::retire(UINT64 completedFenceValue) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = std::remove_if(mPendingFrees.begin(), mPendingFrees.end(),
+            [&](const PendingFree& pending) {
+                if (pending.fenceValue == 0 || pending.fenceValue > completedFenceValue) {
+                    return false;
+                }
+                mHeaps[pending.heapIndex]->allocator.free(pending.allocation);
+                return true;
+            });
+        mPendingFrees.erase(it, mPendingFrees.end());
+    }
+    //҂̗̈ɃtFX̒lݒ肷
+    void GpuMemoryPool::endFrame(UINT64 fenceValue) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (auto&& pending : mPendingFrees) {
+            if (pending.fenceValue == 0) pending.fenceValue = fenceValue;
+        }
+    }
+    //̃q[vj
+    UINT GpuMemoryPool::releaseEmptyHeaps() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        UINT count = 0;
+        for (UINT i = 0; i < mHeaps.size(); i++) {
+            //҂̗̈͊mےƂĐĂ̂ŁAȂGPUgĂȂ
+            if (!mHeaps[i] || !mHeaps[i]->allocator.isEmpty()) continue;
+            mHeaps[i].reset();
+            count++;
+        }
+        return count;
+    }
+    //gp󋵂擾
+    GpuMemoryPool::Stats GpuMemoryPool::getStats() const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        Stats stats;
+        for (auto&& heap : mHeaps) {
+            if (!heap) continue;
+            const Utility::TlsfAllocator::Stats heapStats = heap->allocator.getStats();
+            stats.heapCount++;
+            stats.reservedSize += heapStats.capacity;
+            stats.usedSize += heapStats.usedSize;
+            stats.largestFreeSize
+                = Math::MathUtil::mymax(stats.largestFreeSize, heapStats.largestFreeSize);
+            stats.allocationCount += heapStats.allocationCount;
+        }
+        stats.pendingFreeCount = static_cast<UINT>(mPendingFrees.size());
+        return stats;
+    }
+} // namespace Framework::DX
@@ -0,0 +1,119 @@
+/**
+ * @file GpuMemoryPool.h
+ * @brief ނ̃\[Xzuq[v̏W܂
+ */
+
+#pragma once
+#include <mutex>
+#include "Utility/Memory/TlsfAllocator.h"
+
+namespace Framework::DX {
+    /**
+     * @class GpuMemoryPool
+     * @brief q[v̎ށAtOAACg\[Xzuq[v̏W܂
+     * @details q[v̗̈TLSFŊ蓖Ă GPUgIĂs
+     * ̃Xbh瓯ɌĂׂ
+     */
+    class GpuMemoryPool {
+    public:
+        /**
+         * @struct Stats
+         * @brief gp
+         */
+        struct Stats {
+            UINT heapCount = 0; //!< q[v̐
+            UINT64 reservedSize = 0; //!< mۂq[v̍v̑傫
+            UINT64 usedSize = 0; //!< \[XzuĂ傫
+            UINT64 largestFreeSize = 0; //!< xɔzułő̑傫
+            UINT allocationCount = 0; //!< zuĂ郊\[X̐
+            UINT pendingFreeCount = 0; //!< GPUgÎ҂Ă鐔
+        };
+
+    public:
+        /**
+         * @brief RXgN^
+         * @param device foCX
+         * @param heapType q[v̎
+         * @param heapFlags q[vɔzuł郊\[X̎
+         * @param alignment zuACg
+         * @param heapSize ̃q[v̑傫
+         */
+        GpuMemoryPool(ID3D12Device* device, D3D12_HEAP_TYPE heapType,
+            D3D12_HEAP_FLAGS heapFlags, UINT64 alignment, UINT64 heapSize);
+        /**
+         * @brief fXgN^
+         */
+        ~GpuMemoryPool();
+        GpuMemoryPool(const GpuMemoryPool&) = delete;
+        GpuMemoryPool& operator=(const GpuMemoryPool&) = delete;
+        /**
+         * @brief ނ̃v[
+         */
+        bool isMatch(D3D12_HEAP_TYPE heapType, D3D12_HEAP_FLAGS heapFlags, UINT64 alignment) const {
+            return mHeapType == heapType && mHeapFlags == heapFlags && mAlignment == alignment;
+        }
+        /**
+         * @brief ̈蓖Ă
+         * @param size zu郊\[X̑傫
+         * @param heap zũq[v
+         * @param heapIndex zũq[v̔ԍ
+         * @param allocation 蓖Ă͈
+         * @details 󂫂Ȃ΃q[vǉ
+         */
+        void allocate(UINT64 size, ID3D12Heap** heap, UINT* heapIndex,
+            Utility::TlsfAllocator::Allocation* allocation);
+        /**
+         * @brief ̈̉\񂷂
+         * @details endFrameœnꂽtFXʉ߂
+         */
+        void free(UINT heapIndex, const Utility::TlsfAllocator::Allocation& allocation);
+        /**
+         * @brief GPUgÏ
+         * @param completedFenceValue GPUʉ߂tFX̒l
+         */
+        void retire(UINT64 completedFenceValue);
+        /**
+         * @brief \񂳂ꂽ̈ɃtFX̒lݒ肷
+         * @param fenceValue ̃t[̃R}h̊ɃVOitFX̒l
+         */
+        void endFrame(UINT64 fenceValue);
+        /**
+         * @brief zuĂȂq[vj
+         * @return jq[v̐
+         */
+        UINT releaseEmptyHeaps();
+        /**
+         * @brief gp󋵂擾
+         */
+        Stats getStats() const;
+
+    private:
+        /**
+         * @struct Heap
+         * @brief q[vƊ蓖ď
+         */
+        struct Heap {
+            Comptr<ID3D12Heap> heap; //!< q[v
+            Utility::TlsfAllocator allocator; //!< q[v̊蓖
+        };
+        /**
+         * @struct PendingFree
+         * @brief ҂̗̈
+         */
+        struct PendingFree {
+            UINT heapIndex; //!< q[v̔ԍ
+            Utility::TlsfAllocator::Allocation allocation; //!< ͈
+            UINT64 fenceValue; //!< łtFX̒l 0Ȃ܂t[IĂȂ
+        };
+
+    private:
+        ID3D12Device* mDevice; //!< foCX
+        D3D12_HEAP_TYPE mHeapType; //!< q[v̎
+        D3D12_HEAP_FLAGS mHeapFlags; //!< q[ṽtO
+        UINT64 mAlignment; //!< zuACg
+        UINT64 mHeapSize; //!< ̃q[v̑傫
+        std::vector<UniquePtr<Heap>> mHeaps; //!< q[v jƂnullɂȂ
+        std::vector<PendingFree> mPendingFrees; //!< ҂̗̈
+        mutable std::mutex mMutex; //!< 蓖ĂƉ̃bN
+    };
+} // namespace Framework::DX
@@ -67,8 +67,8 @@ namespace Framework::DX {
         D3D_PRIMITIVE_TOPOLOGY topology, const std::wstring& name) {
         mIndexNum = static_cast<UINT>(indices.size());
         mTopology = topology;
-        mBuffer.init(device, Buffer::Usage::IndexBuffer, mIndexNum * sizeof(T), sizeof(T), name);
-        mBuffer.writeResource(indices.data(), mIndexNum * sizeof(T));
+        mBuffer.initAsStatic(device, Buffer::Usage::IndexBuffer, indices.data(),
+            mIndexNum * sizeof(T), sizeof(T), name);
         mView.init(mBuffer);
     }
 } // namespace Framework::DX
@@ -3,6 +3,26 @@
 #include "DX/DeviceResource.h"
 
 namespace Framework::DX {
+    //fXgN^
+    ShaderResourceView::~ShaderResourceView() {
+        release();
+    }
+    //[uRXgN^
+    ShaderResourceView::ShaderResourceView(ShaderResourceView&& other) noexcept
+        : mHeapManager(other.mHeapManager), mInfo(other.mInfo) {
+        other.mHeapManager = nullptr;
+        other.mInfo = DescriptorInfo();
+    }
+    //[u
+    ShaderResourceView& ShaderResourceView::operator=(ShaderResourceView&& other) noexcept {
+        if (this == &other) return *this;
+        release();
+        mHeapManager = other.mHeapManager;
+        mInfo = other.mInfo;
+        other.mHeapManager = nullptr;
+        other.mInfo = DescriptorInfo();
+        return *this;
+    }
     void ShaderResourceView::initAsTexture2D(DeviceResource* device, const Buffer& buffer,
         DXGI_FORMAT format, DescriptorHeapType heapFlag) {
         //VF[_[\[Xr[쐬
@@ -54,8 +74,18 @@ namespace Framework::DX {
     void ShaderResourceView::createShaderResourceView(DeviceResource* device,
         ID3D12Resource* resource, const D3D12_SHADER_RESOURCE_VIEW_DESC& desc,
         DescriptorHeapType heapFlag) {
-        mInfo = device->getHeapManager()->allocate(heapFlag);
+        //ď͑Omۂ̂
+        release();
+        mHeapManager = device->getHeapManager();
+        mInfo = mHeapManager->allocate(heapFlag);
 
         device->getDevice()->CreateShaderResourceView(resource, &desc, mInfo.cpuHandle);
     }
+    //mۂĂfBXNv^
+    void ShaderResourceView::release() {
+        if (!mHeapManager) return;
+        mHeapManager->deallocate(&mInfo);
+        mHeapManager = nullptr;
+        mInfo = DescriptorInfo();
+    }
 } // namespace Framework::DX
@@ -10,6 +10,7 @@
 
 namespace Framework::DX {
     class DeviceResource;
+    class DescriptorHeapManager;
     /**
      * @class ShaderResourceView
      * @brief VF[_[\[Xr[
@@ -23,7 +24,19 @@ namespace Framework::DX {
         /**
          * @brief fXgN^
          */
-        ~ShaderResourceView() {}
+        ~ShaderResourceView();
+        ShaderResourceView(const ShaderResourceView&) = delete;
+        ShaderResourceView& operator=(const ShaderResourceView&) = delete;
+        /**
+         * @brief [uRXgN^
+         * @details fBXNv^̏Lڂ
+         */
+        ShaderResourceView(ShaderResourceView&& other) noexcept;
+        /**
+         * @brief [u
+         * @details ĂfBXNv^Ă珊Lڂ
+         */
+        ShaderResourceView& operator=(ShaderResourceView&& other) noexcept;
         void initAsTexture2D(DeviceResource* device, const Buffer& buffer, DXGI_FORMAT format,
             DescriptorHeapType heapFlag);
         void initAsBuffer(
@@ -39,8 +52,13 @@ namespace Framework::DX {
     private:
         void createShaderResourceView(DeviceResource* device, ID3D12Resource* resource,
             const D3D12_SHADER_RESOURCE_VIEW_DESC& desc, DescriptorHeapType flag);
+        /**
+         * @brief mۂĂfBXNv^
+         */
+        void release();
 
     private:
+        DescriptorHeapManager* mHeapManager = nullptr; //!< fBXNv^mۂq[vǗ
         DescriptorInfo mInfo;
     };
 } // namespace Framework::DX
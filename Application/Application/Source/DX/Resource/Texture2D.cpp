@@ -1,4 +1,5 @@
 #include "Texture2D.h"
+#include "DX/DeviceResource.h"
 
 namespace {
     static constexpr UINT BYTES_PER_PIXEL = 4; // 1sNZ̃oCg
@@ -11,18 +12,16 @@ namespace Framework::DX {
         mTextureInfo = desc;
 
         mBuffer.init(device, desc);
-        mImmediateBuffer.init(device, Buffer::Usage::ShaderResource,
-            static_cast<UINT>(GetRequiredIntermediateSize(mBuffer.getResource(), 0, 1)), 0,
-            L"Immediate" + desc.name);
 
         D3D12_SUBRESOURCE_DATA subresource = {};
         subresource.pData = desc.pixels.data();
         subresource.RowPitch = desc.width * BYTES_PER_PIXEL;
         subresource.SlicePitch = subresource.RowPitch * desc.height;
-        UpdateSubresources(commandList, mBuffer.getResource(), mImmediateBuffer.getResource(), 0, 0,
-            1, &subresource);
+        //ԃobt@͋L̃Abv[ḧgARs[I΍ėp
+        device->getUploadManager()->uploadTexture(mBuffer.getResource(), 0, 1, &subresource);
 
-        mBuffer.transition(commandList, D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_GENERIC_READ);
+        mBuffer.transition(
+            device->getStateTracker(), D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_GENERIC_READ);
     }
     //VF[_[\[Xr[쐬
     void Texture2D::createSRV(DeviceResource* device, DescriptorHeapType heapFlag) {
@@ -50,7 +50,6 @@ namespace Framework::DX {
     private:
         Desc::TextureDesc mTextureInfo;
         Buffer mBuffer;
-        Buffer mImmediateBuffer;
         ShaderResourceView mView;
     };
 } // namespace Framework::DX
@@ -2,9 +2,32 @@
 #include "DX/DeviceResource.h"
 
 namespace Framework::DX {
+    //fXgN^
+    UnorderedAccessView::~UnorderedAccessView() {
+        release();
+    }
+    //[uRXgN^
+    UnorderedAccessView::UnorderedAccessView(UnorderedAccessView&& other) noexcept
+        : mHeapManager(other.mHeapManager), mInfo(other.mInfo) {
+        other.mHeapManager = nullptr;
+        other.mInfo = DescriptorInfo();
+    }
+    //[u
+    UnorderedAccessView& UnorderedAccessView::operator=(UnorderedAccessView&& other) noexcept {
+        if (this == &other) return *this;
+        release();
+        mHeapManager = other.mHeapManager;
+        mInfo = other.mInfo;
+        other.mHeapManager = nullptr;
+        other.mInfo = DescriptorInfo();
+        return *this;
+    }
     void UnorderedAccessView::initAsTexture2D(
         DeviceResource* device, const Buffer& buffer, DescriptorHeapType heapFlag) {
-        mInfo = device->getHeapManager()->allocate(heapFlag);
+        //ď͑Omۂ̂
+        release();
+        mHeapManager = device->getHeapManager();
+        mInfo = mHeapManager->allocate(heapFlag);
 
         D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
         uavDesc.ViewDimension = D3D12_UAV_DIMENSION::D3D12_UAV_DIMENSION_TEXTURE2D;
@@ -12,4 +35,11 @@ namespace Framework::DX {
         device->getDevice()->CreateUnorderedAccessView(
             buffer.getResource(), nullptr, &uavDesc, mInfo.cpuHandle);
     }
+    //mۂĂfBXNv^
+    void UnorderedAccessView::release() {
+        if (!mHeapManager) return;
+        mHeapManager->deallocate(&mInfo);
+        mHeapManager = nullptr;
+        mInfo = DescriptorInfo();
+    }
 } // namespace Framework::DX
@@ -10,6 +10,7 @@
 
 namespace Framework::DX {
     class DeviceResource;
+    class DescriptorHeapManager;
     /**
      * @class UnorderedAccessView
      * @brief discription
@@ -23,7 +24,19 @@ namespace Framework::DX {
         /**
          * @brief
          */
-        ~UnorderedAccessView() {}
+        ~UnorderedAccessView();
+        UnorderedAccessView(const UnorderedAccessView&) = delete;
+        UnorderedAccessView& operator=(const UnorderedAccessView&) = delete;
+        /**
+         * @brief [uRXgN^
+         * @details fBXNv^̏Lڂ
+         */
+        UnorderedAccessView(UnorderedAccessView&& other) noexcept;
+        /**
+         * @brief [u
+         * @details ĂfBXNv^Ă珊Lڂ
+         */
+        UnorderedAccessView& operator=(UnorderedAccessView&& other) noexcept;
         void initAsTexture2D(
             DeviceResource* device, const Buffer& buffer, DescriptorHeapType heapFlag);
         const DescriptorInfo& getInfo() const {
@@ -31,6 +44,13 @@ namespace Framework::DX {
         }
 
     private:
+        /**
+         * @brief mۂĂfBXNv^
+         */
+        void release();
+
+    private:
+        DescriptorHeapManager* mHeapManager = nullptr; //!< fBXNv^mۂq[vǗ
         DescriptorInfo mInfo;
     };
 } // namespace Framework::DX
@@ -0,0 +1,216 @@
+#include "UploadManager.h"
+#include "DX/Util/Helper.h"
+
+namespace {
+    static constexpr UINT64 BUFFER_ALIGNMENT = 16; //!< obt@̃Rs[̃ACg
+} // namespace
+
+namespace Framework::DX {
+    //RXgN^
+    UploadManager::UploadManager()
+        : mDevice(nullptr),
+          mAllocator(nullptr),
+          mNextFenceValue(1),
+          mLastQueueWaitValue(0),
+          mIsRecording(false),
+          mArenaMapped(nullptr) {}
+    //fXgN^
+    UploadManager::~UploadManager() {
+        reset();
+    }
+    //
+    void UploadManager::init(ID3D12Device* device, GpuMemoryAllocator* allocator, UINT64 arenaSize) {
+        reset();
+        mDevice = device;
+        mAllocator = allocator;
+
+        D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+        queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAGS::D3D12_COMMAND_QUEUE_FLAG_NONE;
+        queueDesc.Type = D3D12_COMMAND_LIST_TYPE::D3D12_COMMAND_LIST_TYPE_COPY;
+        MY_THROW_IF_FAILED(mDevice->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&mCopyQueue)));
+        MY_THROW_IF_FAILED(mCopyQueue->SetName(L"UploadCopyQueue"));
+        MY_THROW_IF_FAILED(mDevice->CreateFence(
+            0, D3D12_FENCE_FLAGS::D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&mFence)));
+        mFenceEvent.Attach(CreateEvent(nullptr, FALSE, FALSE, nullptr));
+        if (!mFenceEvent.IsValid()) { MY_THROW_IF_FAILED(E_FAIL); }
+        mNextFenceValue = 1;
+        mLastQueueWaitValue = 0;
+
+        //Abv[ḧ͍쐬Ƀ}bvAj܂ł̂܂܂ɂ
+        mArena = createUploadBuffer(mAllocator, arenaSize, L"UploadArena");
+        MY_THROW_IF_FAILED(mArena->Map(0, nullptr, reinterpret_cast<void**>(&mArenaMapped)));
+        mRing.init(arenaSize);
+        mStats = Stats();
+    }
+    //ׂĔj
+    void UploadManager::reset() {
+        if (mCopyQueue && mFence) {
+            waitForFence(submit());
+            retire();
+        }
+        if (mArena && mArenaMapped) mArena->Unmap(0, nullptr);
+        mArenaMapped = nullptr;
+        mArena.Reset();
+        mTemporaryBuffers.clear();
+        mPendingCommandAllocators.clear();
+        mCommandAllocator.Reset();
+        mCommandList.Reset();
+        mFence.Reset();
+        mCopyQueue.Reset();
+        mIsRecording = false;
+        mDevice = nullptr;
+        mAllocator = nullptr;
+    }
+    //obt@ɓ]
+    void UploadManager::uploadBuffer(
+        ID3D12Resource* dest, UINT64 destOffset, const void* data, UINT64 size) {
+        if (size == 0) return;
+        ID3D12Resource* source;
+        UINT64 sourceOffset;
+        BYTE* mapped = allocate(size, BUFFER_ALIGNMENT, &source, &sourceOffset);
+        memcpy(mapped, data, static_cast<size_t>(size));
+
+        beginRecording();
+        mCommandList->CopyBufferRegion(dest, destOffset, source, sourceOffset, size);
+        mStats.uploadedSize += size;
+    }
+    //eNX`ɓ]
+    void UploadManager::uploadTexture(ID3D12Resource* dest, UINT firstSubresource,
+        UINT subresourceNum, const D3D12_SUBRESOURCE_DATA* data) {
+        const D3D12_RESOURCE_DESC desc = dest->GetDesc();
+        std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts(subresourceNum);
+        std::vector<UINT> rowNums(subresourceNum);
+        std::vector<UINT64> rowSizes(subresourceNum);
+        UINT64 totalSize = 0;
+        mDevice->GetCopyableFootprints(&desc, firstSubresource, subresourceNum, 0, layouts.data(),
+            rowNums.data(), rowSizes.data(), &totalSize);
+
+        ID3D12Resource* source;
+        UINT64 sourceOffset;
+        BYTE* mapped = allocate(
+            totalSize, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, &source, &sourceOffset);
+
+        beginRecording();
+        for (UINT i = 0; i < subresourceNum; i++) {
+            //sƂ̃sb`Rs[ƈقȂ̂1slߒ
+            const D3D12_SUBRESOURCE_FOOTPRINT& footprint = layouts[i].Footprint;
+            BYTE* destSlice = mapped + layouts[i].Offset;
+            const BYTE* srcSlice = static_cast<const BYTE*>(data[i].pData);
+            for (UINT z = 0; z < footprint.Depth; z++) {
+                for (UINT y = 0; y < rowNums[i]; y++) {
+                    memcpy(destSlice + footprint.RowPitch * (rowNums[i] * z + y),
+                        srcSlice + data[i].SlicePitch * z + data[i].RowPitch * y,
+                        static_cast<size_t>(rowSizes[i]));
+                }
+            }
+
+            D3D12_PLACED_SUBRESOURCE_FOOTPRINT sourceFootprint = layouts[i];
+            sourceFootprint.Offset += sourceOffset;
+            CD3DX12_TEXTURE_COPY_LOCATION dst(dest, firstSubresource + i);
+            CD3DX12_TEXTURE_COPY_LOCATION src(source, sourceFootprint);
+            mCommandList->CopyTextureRegion(&dst, 0, 0, 0, &src, nullptr);
+        }
+        mStats.uploadedSize += totalSize;
+    }
+    //ς񂾃Rs[s
+    UINT64 UploadManager::submit() {
+        if (!mIsRecording) return mNextFenceValue - 1;
+
+        MY_THROW_IF_FAILED(mCommandList->Close());
+        ID3D12CommandList* lists[] = { mCommandList.Get() };
+        mCopyQueue->ExecuteCommandLists(_countof(lists), lists);
+        const UINT64 fenceValue = mNextFenceValue++;
+        MY_THROW_IF_FAILED(mCopyQueue->Signal(mFence.Get(), fenceValue));
+
+        mRing.endBatch(fenceValue);
+        mPendingCommandAllocators.push_back({ mCommandAllocator, fenceValue });
+        mCommandAllocator.Reset();
+        mIsRecording = false;
+        mStats.submitCount++;
+        return fenceValue;
+    }
+    //Rs[̊҂
+    void UploadManager::waitOnQueue(ID3D12CommandQueue* queue) {
+        const UINT64 fenceValue = submit();
+        //lx҂Ȃ悤ɂ
+        if (fenceValue <= mLastQueueWaitValue) return;
+        MY_THROW_IF_FAILED(queue->Wait(mFence.Get(), fenceValue));
+        mLastQueueWaitValue = fenceValue;
+    }
+    //̈
+    void UploadManager::retire() {
+        const UINT64 completedFenceValue = getCompletedFenceValue();
+        mRing.retire(completedFenceValue);
+        auto it = std::remove_if(mTemporaryBuffers.begin(), mTemporaryBuffers.end(),
+            [&](const PendingResource<ID3D12Resource>& pending) {
+                return pending.fenceValue <= completedFenceValue;
+            });
+        mTemporaryBuffers.erase(it, mTemporaryBuffers.end());
+    }
+    //gp󋵂擾
+    UploadManager::Stats UploadManager::getStats() const {
+        Stats stats = mStats;
+        stats.capacity = mRing.getCapacity();
+        stats.usedSize = mRing.getUsedSize();
+        stats.stallCount = mRing.getStallCount();
+        return stats;
+    }
+    //Abv[ḧmۂ
+    BYTE* UploadManager::allocate(
+        UINT64 size, UINT64 alignment, ID3D12Resource** resource, UINT64* offset) {
+        //̓]l܂点̂͐p̃obt@
+        if (mRing.isOversized(size)) {
+            Comptr<ID3D12Resource> buffer
+                = createUploadBuffer(mAllocator, size, L"UploadTemporary");
+            BYTE* mapped;
+            MY_THROW_IF_FAILED(buffer->Map(0, nullptr, reinterpret_cast<void**>(&mapped)));
+            //Abv[ḧƓARs[I܂ŎcĂ
+            mTemporaryBuffers.push_back({ buffer, mNextFenceValue });
+            *resource = buffer.Get();
+            *offset = 0;
+            mStats.overflowCount++;
+            return mapped;
+        }
+
+        const UINT64 ringOffset = mRing.allocate(size, alignment, this);
+        *resource = mArena.Get();
+        *offset = ringOffset;
+        return mArenaMapped + ringOffset;
+    }
+    //L^Jn
+    void UploadManager::beginRecording() {
+        if (mIsRecording) return;
+        //AP[^΍ėp
+        const UINT64 completedFenceValue = mFence->GetCompletedValue();
+        if (!mPendingCommandAllocators.empty()
+            && mPendingCommandAllocators.front().fenceValue <= completedFenceValue) {
+            mCommandAllocator = mPendingCommandAllocators.front().resource;
+            mPendingCommandAllocators.pop_front();
+            MY_THROW_IF_FAILED(mCommandAllocator->Reset());
+        } else {
+            MY_THROW_IF_FAILED(mDevice->CreateCommandAllocator(
+                D3D12_COMMAND_LIST_TYPE::D3D12_COMMAND_LIST_TYPE_COPY,
+                IID_PPV_ARGS(&mCommandAllocator)));
+        }
+
+        if (mCommandList) {
+            MY_THROW_IF_FAILED(mCommandList->Reset(mCommandAllocator.Get(), nullptr));
+        } else {
+            MY_THROW_IF_FAILED(
+                mDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE::D3D12_COMMAND_LIST_TYPE_COPY,
+                    mCommandAllocator.Get(), nullptr, IID_PPV_ARGS(&mCommandList)));
+            MY_THROW_IF_FAILED(mCommandList->SetName(L"UploadCommandList"));
+        }
+        mIsRecording = true;
+    }
+    //Rs[L[ʉ߂tFX̒l擾
+    UINT64 UploadManager::getCompletedFenceValue() const {
+        return mFence->GetCompletedValue();
+    }
+    //tFX҂
+    void UploadManager::waitForFence(UINT64 fenceValue) {
+        if (mFence->GetCompletedValue() >= fenceValue) return;
+        MY_THROW_IF_FAILED(mFence->SetEventOnCompletion(fenceValue, mFenceEvent.Get()));
+        WaitForSingleObjectEx(mFenceEvent.Get(), INFINITE, FALSE);
+    }
+} // namespace Framework::DX
@@ -0,0 +1,151 @@
+/**
+ * @file UploadManager.h
+ * @brief GPUւ̃f[^]̊Ǘ
+ */
+
+#pragma once
+#include <deque>
+#include "DX/Resource/GpuMemoryAllocator.h"
+#include "Utility/Memory/UploadRing.h"
+
+namespace Framework::DX {
+    /**
+     * @class UploadManager
+     * @brief L̃Abv[ḧoRDEFAULTq[ṽ\[XɃf[^]
+     * @details ]̓Rs[L[ɂ܂Ƃ߂Đς݁A`L[executeOɂ̊҂
+     * Abv[ḧ̓Rs[̊mFĂėp̂ŁA\[XƂ̒ԃobt@͎cȂ
+     * L^Xbĥ݌ĂԂ
+     * Abv[ḧ̊蓖ĂƋ󂫂邽߂̑ҋ@UploadRingɔCÃNX̓L[ƂĐU镑
+     */
+    class UploadManager : public Utility::IUploadQueue {
+    public:
+        static constexpr UINT64 DEFAULT_ARENA_SIZE = 32ull * 1024 * 1024; //!< Abv[ḧ̑傫
+        /**
+         * @struct Stats
+         * @brief gp
+         */
+        struct Stats {
+            UINT64 capacity = 0; //!< Abv[ḧ̑傫
+            UINT64 usedSize = 0; //!< Rs[̊҂̑傫
+            UINT64 uploadedSize = 0; //!< ܂łɓ]傫
+            UINT submitCount = 0; //!< Rs[L[ɐς񂾉
+            UINT overflowCount = 0; //!< ̈Ɏ܂炸ꎞobt@
+            UINT stallCount = 0; //!< ̈󂯂邽߂ɃRs[̊҂
+        };
+
+    public:
+        /**
+         * @brief RXgN^
+         */
+        UploadManager();
+        /**
+         * @brief fXgN^
+         */
+        ~UploadManager();
+        UploadManager(const UploadManager&) = delete;
+        UploadManager& operator=(const UploadManager&) = delete;
+        /**
+         * @brief 
+         * @param device foCX
+         * @param allocator Abv[ḧ̊mۂɎgAP[^
+         * @param arenaSize Abv[ḧ̑傫
+         */
+        void init(ID3D12Device* device, GpuMemoryAllocator* allocator,
+            UINT64 arenaSize = DEFAULT_ARENA_SIZE);
+        /**
+         * @brief Rs[̊҂Ă炷ׂĔj
+         */
+        void reset();
+        /**
+         * @brief obt@Ƀf[^]
+         * @param dest ] ʏԂł邱
+         * @param destOffset ]̃ItZbg
+         * @param data ]f[^
+         * @param size ]oCg
+         */
+        void uploadBuffer(ID3D12Resource* dest, UINT64 destOffset, const void* data, UINT64 size);
+        /**
+         * @brief eNX`Ƀf[^]
+         * @param dest ] ʏԂł邱
+         * @param firstSubresource ŏ̃Tu\[X
+         * @param subresourceNum Tu\[X̐
+         * @param data Tu\[XƂ̃f[^
+         */
+        void uploadTexture(ID3D12Resource* dest, UINT firstSubresource, UINT subresourceNum,
+            const D3D12_SUBRESOURCE_DATA* data);
+        /**
+         * @brief ς񂾃Rs[Rs[L[Ŏs
+         * @return ɃVOitFX̒l ς񂾂̂Ȃ΍ŌɎslԂ
+         */
+        UINT64 submit() override;
+        /**
+         * @brief ς񂾃Rs[sÅL[ɑ҂
+         * @param queue ]̃\[XgL[
+         */
+        void waitOnQueue(ID3D12CommandQueue* queue);
+        /**
+         * @brief Rs[̈
+         */
+        void retire();
+        /**
+         * @brief gp󋵂擾
+         */
+        Stats getStats() const;
+        /**
+         * @brief Rs[L[ʉ߂tFX̒l擾
+         */
+        UINT64 getCompletedFenceValue() const override;
+        /**
+         * @brief w肵tFX̒lʉ߂܂ő҂
+         */
+        void waitForFence(UINT64 fenceValue) override;
+
+    private:
+        /**
+         * @brief Abv[ḧmۂ
+         * @param size mۂoCg
+         * @param alignment 擪̃ACg
+         * @param resource mۂ\[X
+         * @param offset \[X̃ItZbg
+         * @return ݐ̃AhX
+         * @details ̈悪ȂΌÂRs[̊҂ 傫͈̂ꎞobt@
+         */
+        BYTE* allocate(
+            UINT64 size, UINT64 alignment, ID3D12Resource** resource, UINT64* offset);
+        /**
+         * @brief R}hXgL^łԂɂ
+         */
+        void beginRecording();
+
+    private:
+        /**
+         * @struct PendingResource
+         * @brief Rs[̊҂ĉ
+         */
+        template <class T>
+        struct PendingResource {
+            Comptr<T> resource; //!< \[X
+            UINT64 fenceValue; //!< łtFX̒l
+        };
+
+    private:
+        ID3D12Device* mDevice; //!< foCX
+        GpuMemoryAllocator* mAllocator; //!< Abv[ḧ̊mۂɎgAP[^
+        Comptr<ID3D12CommandQueue> mCopyQueue; //!< Rs[L[
+        Comptr<ID3D12GraphicsCommandList> mCommandList; //!< Rs[p̃R}hXg
+        Comptr<ID3D12CommandAllocator> mCommandAllocator; //!< L^̃R}hAP[^
+        //s̃R}hAP[^ ̂ėp
+        std::deque<PendingResource<ID3D12CommandAllocator>> mPendingCommandAllocators;
+        //̈Ɏ܂ȂƂ̈ꎞobt@
+        std::vector<PendingResource<ID3D12Resource>> mTemporaryBuffers;
+        Comptr<ID3D12Fence> mFence; //!< Rs[̊m点tFX
+        Microsoft::WRL::Wrappers::Event mFenceEvent; //!< tFXCxg
+        UINT64 mNextFenceValue; //!< ɎsƂ̃tFX̒l
+        UINT64 mLastQueueWaitValue; //!< Ōɕ`L[ɑ҂tFX̒l
+        bool mIsRecording; //!< R}hL^
+        Comptr<ID3D12Resource> mArena; //!< Abv[ḧ
+        BYTE* mArenaMapped; //!< Abv[ḧ̐擪 Ƀ}bvĂ
+        Utility::UploadRing mRing; //!< Abv[ḧ̊蓖
+        Stats mStats; //!< gp
+    };
+} // namespace Framework::DX
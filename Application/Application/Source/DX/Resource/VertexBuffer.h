@@ -50,9 +50,8 @@ namespace Framework::DX {
     inline void VertexBuffer::init(
         DeviceResource* device, const std::vector<T>& vertices, const std::wstring& name) {
         mVertexCount = static_cast<UINT>(vertices.size());
-        mBuffer.init(device, Buffer::Usage::VertexBuffer,
+        mBuffer.initAsStatic(device, Buffer::Usage::VertexBuffer, vertices.data(),
             static_cast<UINT>(mVertexCount * sizeof(T)), static_cast<UINT>(sizeof(T)), name);
-        mBuffer.writeResource(vertices.data(), static_cast<UINT>(mVertexCount * sizeof(T)));
         mView.init(mBuffer);
     }
 } // namespace Framework::DX
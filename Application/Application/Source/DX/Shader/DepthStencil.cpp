@@ -25,8 +25,8 @@ namespace Framework::DX {
         mDSV.init(device, mBuffer, format);
     }
     void DepthStencil::transition(
-        ID3D12GraphicsCommandList* commandList, D3D12_RESOURCE_STATES nextState) {
-        mBuffer.transition(commandList, nextState);
+        CommandListStateTracker* tracker, D3D12_RESOURCE_STATES nextState) {
+        mBuffer.transition(tracker, nextState);
     }
     void DepthStencil::clear(ID3D12GraphicsCommandList* commandList) {
         commandList->ClearDepthStencilView(mDSV.getInfo().cpuHandle,
@@ -25,7 +25,7 @@ namespace Framework::DX {
         /**
          * @brief ԂJڂ
          */
-        void transition(ID3D12GraphicsCommandList* commandList, D3D12_RESOURCE_STATES nextState);
+        void transition(CommandListStateTracker* tracker, D3D12_RESOURCE_STATES nextState);
         /**
          * @brief r[̃NA
          */
@@ -12,9 +12,11 @@ namespace Framework::DX {
             DepthStencilFormat::shaderResourceViewFormat(format), DescriptorHeapType::CbvSrvUav);
     }
     void DepthStencilTexture::transition(
-        ID3D12GraphicsCommandList* commandList, D3D12_RESOURCE_STATES nextState) {}
+        CommandListStateTracker* tracker, D3D12_RESOURCE_STATES nextState) {
+        mDepthStencil.transition(tracker, nextState);
+    }
     void DepthStencilTexture::transition(
-        ID3D12GraphicsCommandList* commandList, DepthStencilState nextMode) {
+        CommandListStateTracker* tracker, DepthStencilState nextMode) {
         D3D12_RESOURCE_STATES nextState = {};
         switch (nextMode) {
         case DepthStencilState::ShaderResource:
@@ -25,7 +27,7 @@ namespace Framework::DX {
             break;
         default: return;
         }
-        transition(commandList, nextState);
+        transition(tracker, nextState);
     }
     void DepthStencilTexture::clear(ID3D12GraphicsCommandList* commandList) {
         mDepthStencil.clear(commandList);
@@ -33,11 +33,11 @@ namespace Framework::DX {
         /**
          * @brief ԂJڂ
          */
-        void transition(ID3D12GraphicsCommandList* commandList, D3D12_RESOURCE_STATES nextState);
+        void transition(CommandListStateTracker* tracker, D3D12_RESOURCE_STATES nextState);
         /**
          * @brief ԂJڂ
          */
-        void transition(ID3D12GraphicsCommandList* commandList, DepthStencilState nextMode);
+        void transition(CommandListStateTracker* tracker, DepthStencilState nextMode);
         /**
          * @brief fvXEXeṼNA
          */
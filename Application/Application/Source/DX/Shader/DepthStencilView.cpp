@@ -2,9 +2,31 @@
 #include "DX/DeviceResource.h"
 
 namespace Framework::DX {
-
+    //fXgN^
+    DepthStencilView::~DepthStencilView() {
+        release();
+    }
+    //[uRXgN^
+    DepthStencilView::DepthStencilView(DepthStencilView&& other) noexcept
+        : mHeapManager(other.mHeapManager), mInfo(other.mInfo) {
+        other.mHeapManager = nullptr;
+        other.mInfo = DescriptorInfo();
+    }
+    //[u
+    DepthStencilView& DepthStencilView::operator=(DepthStencilView&& other) noexcept {
+        if (this == &other) return *this;
+        release();
+        mHeapManager = other.mHeapManager;
+        mInfo = other.mInfo;
+        other.mHeapManager = nullptr;
+        other.mInfo = DescriptorInfo();
+        return *this;
+    }
     void DepthStencilView::init(DeviceResource* device, const Buffer& buffer, DXGI_FORMAT format) {
-        mInfo = device->getHeapManager()->allocate(DescriptorHeapType::Dsv);
+        //ď͑Omۂ̂
+        release();
+        mHeapManager = device->getHeapManager();
+        mInfo = mHeapManager->allocate(DescriptorHeapType::Dsv);
 
         D3D12_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
         //DSV_DESC_FORMAT
@@ -15,4 +37,11 @@ namespace Framework::DX {
         device->getDevice()->CreateDepthStencilView(
             buffer.getResource(), &dsvDesc, mInfo.cpuHandle);
     }
+    //mۂĂfBXNv^
+    void DepthStencilView::release() {
+        if (!mHeapManager) return;
+        mHeapManager->deallocate(&mInfo);
+        mHeapManager = nullptr;
+        mInfo = DescriptorInfo();
+    }
 } // namespace Framework::DX
@@ -3,6 +3,8 @@
 #include "DX/Resource/Buffer.h"
 
 namespace Framework::DX {
+    class DeviceResource;
+    class DescriptorHeapManager;
     /**
      * @class DepthStencilView
      * @brief fvXEXeVr[
@@ -16,7 +18,19 @@ namespace Framework::DX {
         /**
          * @brief fXgN^
          */
-        ~DepthStencilView() {}
+        ~DepthStencilView();
+        DepthStencilView(const DepthStencilView&) = delete;
+        DepthStencilView& operator=(const DepthStencilView&) = delete;
+        /**
+         * @brief [uRXgN^
+         * @details fBXNv^̏Lڂ
+         */
+        DepthStencilView(DepthStencilView&& other) noexcept;
+        /**
+         * @brief [u
+         * @details ĂfBXNv^Ă珊Lڂ
+         */
+        DepthStencilView& operator=(DepthStencilView&& other) noexcept;
         /**
          * @brief 
          */
@@ -29,6 +43,13 @@ namespace Framework::DX {
         }
 
     private:
+        /**
+         * @brief mۂĂfBXNv^
+         */
+        void release();
+
+    private:
+        DescriptorHeapManager* mHeapManager = nullptr; //!< fBXNv^mۂq[vǗ
         DescriptorInfo mInfo;
     };
 } // namespace Framework::DX
\ No newline at end of file
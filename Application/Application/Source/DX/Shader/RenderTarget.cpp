@@ -16,8 +16,8 @@ namespace Framework::DX {
         mView.init(device, mBuffer);
     }
     void RenderTarget::transition(
-        ID3D12GraphicsCommandList* commandList, D3D12_RESOURCE_STATES nextState) {
-        mBuffer.transition(commandList, nextState);
+        CommandListStateTracker* tracker, D3D12_RESOURCE_STATES nextState) {
+        mBuffer.transition(tracker, nextState);
     }
     void RenderTarget::clear(ID3D12GraphicsCommandList* commandList, const Utility::Color4& color) {
         MY_ASSERTION(
@@ -27,7 +27,7 @@ namespace Framework::DX {
             mView.getInfo().cpuHandle, color.get().data(), 0, nullptr);
     }
     void RenderTarget::initAsResource(DeviceResource* device, Comptr<ID3D12Resource> resource) {
-        mBuffer.init(resource, D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COMMON);
+        mBuffer.init(device, resource, D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COMMON);
         mView.init(device, mBuffer);
     }
 } // namespace Framework::DX
@@ -10,11 +10,11 @@ namespace Framework::DX {
             device, mRenderTarget.getBuffer(), format, DescriptorHeapType::CbvSrvUav);
     }
     void RenderTargetTexture::transition(
-        ID3D12GraphicsCommandList* commandList, D3D12_RESOURCE_STATES nextState) {
-        mRenderTarget.transition(commandList, nextState);
+        CommandListStateTracker* tracker, D3D12_RESOURCE_STATES nextState) {
+        mRenderTarget.transition(tracker, nextState);
     }
     void RenderTargetTexture::transition(
-        ID3D12GraphicsCommandList* commandList, RenderTargetState nextMode) {
+        CommandListStateTracker* tracker, RenderTargetState nextMode) {
         D3D12_RESOURCE_STATES nextState = {};
         switch (nextMode) {
         case RenderTargetState::ShaderResource:
@@ -25,7 +25,7 @@ namespace Framework::DX {
             break;
         default: return;
         }
-        transition(commandList, nextState);
+        transition(tracker, nextState);
     }
     void RenderTargetTexture::clear(
         ID3D12GraphicsCommandList* commandList, const Utility::Color4& clearColor) {
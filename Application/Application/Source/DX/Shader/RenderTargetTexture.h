@@ -29,11 +29,11 @@ namespace Framework::DX {
         /**
          * @brief ԂJڂ
          */
-        void transition(ID3D12GraphicsCommandList* commandList, D3D12_RESOURCE_STATES nextState);
+        void transition(CommandListStateTracker* tracker, D3D12_RESOURCE_STATES nextState);
         /**
          * @brief [h؂ւ
          */
-        void transition(ID3D12GraphicsCommandList* commandList, RenderTargetState nextMode);
+        void transition(CommandListStateTracker* tracker, RenderTargetState nextMode);
         /**
          * @brief _[^[Qbg̃NA
          */
@@ -2,9 +2,31 @@
 #include "DX/DeviceResource.h"
 
 namespace Framework::DX {
-
+    //fXgN^
+    RenderTargetView::~RenderTargetView() {
+        release();
+    }
+    //[uRXgN^
+    RenderTargetView::RenderTargetView(RenderTargetView&& other) noexcept
+        : mHeapManager(other.mHeapManager), mInfo(other.mInfo) {
+        other.mHeapManager = nullptr;
+        other.mInfo = DescriptorInfo();
+    }
+    //[u
+    RenderTargetView& RenderTargetView::operator=(RenderTargetView&& other) noexcept {
+        if (this == &other) return *this;
+        release();
+        mHeapManager = other.mHeapManager;
+        mInfo = other.mInfo;
+        other.mHeapManager = nullptr;
+        other.mInfo = DescriptorInfo();
+        return *this;
+    }
     void RenderTargetView::init(DeviceResource* device, const Buffer& buffer) {
-        mInfo = device->getHeapManager()->allocate(DescriptorHeapType::Rtv);
+        //ď͑Omۂ̂
+        release();
+        mHeapManager = device->getHeapManager();
+        mInfo = mHeapManager->allocate(DescriptorHeapType::Rtv);
 
         D3D12_RENDER_TARGET_VIEW_DESC rtvDesc = {};
         rtvDesc.Format = buffer.getResource()->GetDesc().Format;
@@ -12,4 +34,11 @@ namespace Framework::DX {
         device->getDevice()->CreateRenderTargetView(
             buffer.getResource(), &rtvDesc, mInfo.cpuHandle);
     }
+    //mۂĂfBXNv^
+    void RenderTargetView::release() {
+        if (!mHeapManager) return;
+        mHeapManager->deallocate(&mInfo);
+        mHeapManager = nullptr;
+        mInfo = DescriptorInfo();
+    }
 } // namespace Framework::DX
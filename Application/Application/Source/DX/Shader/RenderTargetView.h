@@ -4,6 +4,7 @@
 
 namespace Framework::DX {
     class DeviceResource;
+    class DescriptorHeapManager;
     /**
      * @class RenderTargetView
      * @brief _[^[Qbgr[
@@ -17,7 +18,19 @@ namespace Framework::DX {
         /**
          * @brief fXgN^
          */
-        ~RenderTargetView() {}
+        ~RenderTargetView();
+        RenderTargetView(const RenderTargetView&) = delete;
+        RenderTargetView& operator=(const RenderTargetView&) = delete;
+        /**
+         * @brief [uRXgN^
+         * @details fBXNv^̏Lڂ
+         */
+        RenderTargetView(RenderTargetView&& other) noexcept;
+        /**
+         * @brief [u
+         * @details ĂfBXNv^Ă珊Lڂ
+         */
+        RenderTargetView& operator=(RenderTargetView&& other) noexcept;
         /**
          * @brief 
          */
@@ -30,6 +43,13 @@ namespace Framework::DX {
         }
 
     private:
+        /**
+         * @brief mۂĂfBXNv^
+         */
+        void release();
+
+    private:
+        DescriptorHeapManager* mHeapManager = nullptr; //!< fBXNv^mۂq[vǗ
         DescriptorInfo mInfo;
     };
 } // namespace Framework::DX
\ No newline at end of file
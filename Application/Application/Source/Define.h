@@ -3,9 +3,10 @@
 namespace GlobalRootSignature {
     namespace Slot {
         enum MyEnum {
-            Cbv,
+            Cbv, //!< V[̃RX^gobt@ [gCBVŒړn
             Srv,
             Uav,
+            BindlessTexture, //!< oChX̃eNX`e[u
 
             Count
         };
@@ -26,12 +27,7 @@ namespace LocalRootSignature {
     namespace HitGroup {
         namespace Constants {
             enum MyEnum {
-                AlbedoTex,
-                NormalMap,
-                MetallicRoughnessMap,
-                EmissiveMap,
-                OcclusionMap,
-
+                //eNX`̓oChX̃e[uQƂ
                 SceneConstants,
 
                 Count
@@ -1,6 +1,6 @@
-﻿/**
+/**
  * @file MathUtility.h
- * @brief 数学関係のユーティリティクラス
+ * @brief w֌W̃[eBeBNX
  */
 
 #pragma once
@@ -10,110 +10,110 @@
 namespace Framework::Math {
     /**
      * @class MathUtil
-     * @brief 数学関係のユーティリティクラス
+     * @brief w֌W̃[eBeBNX
      */
     class MathUtil {
     public:
-        static constexpr float PI = 3.1415926536f; //!< 円周率
-        static constexpr float PI2 = PI * 2; //!< 2π
-        static constexpr float EPSILON = 0.001f; //!< 誤差
+        static constexpr float PI = 3.1415926536f; //!< ~
+        static constexpr float PI2 = PI * 2; //!< 2
+        static constexpr float EPSILON = 0.001f; //!< 덷
     public:
         /**
-         * @brief サイン
+         * @brief TC
          */
-        static inline float sin(const Radians& rad) { return std::sinf(rad.getRad()); }
+        static inline float sin(const Radians& rad) { return std::sin(rad.getRad()); }
 
         /**
-         * @brief コサイン
+         * @brief RTC
          */
-        static inline float cos(const Radians& rad) { return std::cosf(rad.getRad()); }
+        static inline float cos(const Radians& rad) { return std::cos(rad.getRad()); }
 
         /**
-         * @brief タンジェント
+         * @brief ^WFg
          */
-        static inline float tan(const Radians& rad) { return std::tanf(rad.getRad()); }
+        static inline float tan(const Radians& rad) { return std::tan(rad.getRad()); }
 
         /**
-         * @brief アークタンジェント
-         * @return ラジアン角を返す
+         * @brief A[N^WFg
+         * @return WApԂ
          */
-        static inline Radians atan2(float y, float x) { return Radians(std::atan2f(y, x)); }
+        static inline Radians atan2(float y, float x) { return Radians(std::atan2(y, x)); }
         /**
-         * @brief アークサイン
-         * @return ラジアン角を返す
+         * @brief A[NTC
+         * @return WApԂ
          */
         static inline Radians asin(float x) { return Radians(std::asin(x)); }
         /**
-         * @brief アークコサイン
-         * @return ラジアン角を返す
+         * @brief A[NRTC
+         * @return WApԂ
          */
         static inline Radians acos(float x) { return Radians(std::acos(x)); }
 
         /**
-         * @brief ルート
+         * @brief [g
          */
-        static inline float sqrt(float a) { return std::sqrtf(a); }
+        static inline float sqrt(float a) { return std::sqrt(a); }
         /**
-         * @brief 累乗
-         * @param X 基数
-         * @param e 指数
+         * @brief ݏ
+         * @param X 
+         * @param e w
          */
-        static inline float pow(float X, float e) { return std::powf(X, e); }
+        static inline float pow(float X, float e) { return std::pow(X, e); }
         /**
-         * @brief 絶対値
+         * @brief Βl
          */
-        static inline float abs(float X) { return std::fabsf(X); }
+        static inline float abs(float X) { return std::fabs(X); }
         /**
-         * @brief 2の累乗にアラインメントする
-         * @param size 元のサイズ
-         * @param alignment アラインメントするサイズ
+         * @brief 2̗ݏɃACg
+         * @param size ̃TCY
+         * @param alignment ACgTCY
          */
         static inline UINT alignPow2(UINT size, UINT alignment) {
             return (size + (alignment - 1)) & ~(alignment - 1);
         }
         /**
-         * @brief クランプ処理
-         * @tparam t クランプする値
-         * @tparam min 下限値
-         * @tparam max 上限値
-         * @return クランプされた値
+         * @brief Nv
+         * @tparam t Nvl
+         * @tparam min l
+         * @tparam max l
+         * @return Nvꂽl
          */
         template <class T>
         static inline T clamp(const T& t, const T& minValue, const T& maxValue);
 
         /**
-         * @brief 補間
-         * @tparam a 開始値
-         * @tparam b 終了値
-         * @tparam t 補間値（０～１）
+         * @brief 
+         * @tparam a Jnl
+         * @tparam b Il
+         * @tparam t ԒliO`Pj
          */
         template <class T>
         static inline T lerp(const T& a, const T& b, float t);
 
         /**
-         * @brief 最大値の取得
+         * @brief ől̎擾
          */
         template <class T>
         static inline constexpr T mymax(const std::initializer_list<T>& param);
         /**
-         * @brief 最大値の取得
+         * @brief ől̎擾
          */
         template <class T>
         static inline constexpr T mymax(const T& t1, const T& t2);
 
         /**
-         * @brief 最小値の取得
+         * @brief ŏl̎擾
          */
         template <class T>
         static inline constexpr T mymin(const std::initializer_list<T>& param);
         /**
-         * @brief 最小値の取得
+         * @brief ŏl̎擾
          */
         template <class T>
         static inline constexpr T mymin(const T& t1, const T& t2);
     };
 
-    //クランプ処理
+    //Nv
     template <class T>
     T MathUtil::clamp(const T& t, const T& minValue, const T& maxValue) {
         T res(t);
@@ -124,32 +124,32 @@ namespace Framework::Math {
         return res;
     }
 
-    //補間
+    //
     template <class T>
     inline T MathUtil::lerp(const T& a, const T& b, float t) {
-        //0～1にクランプ
+        //0`1ɃNv
         t = clamp(t, 0.0f, 1.0f);
         return a * (1.0f - t) + b * t;
     }
 
-    //最大値の取得
+    //ől̎擾
     template <class T>
     inline constexpr T MathUtil::mymax(const std::initializer_list<T>& param) {
         return std::max(param);
     }
 
-    //最大値の取得
+    //ől̎擾
     template <class T>
     inline constexpr T MathUtil::mymax(const T& t1, const T& t2) {
         return std::max(t1, t2);
     }
 
-    //最小値の取得
+    //ŏl̎擾
     template <class T>
     inline constexpr T MathUtil::mymin(const std::initializer_list<T>& param) {
         return std::min(param);
     }
-    //最小値の取得
+    //ŏl̎擾
     template <class T>
     inline constexpr T MathUtil::mymin(const T& t1, const T& t2) {
         return std::min(t1, t2);
@@ -64,23 +64,26 @@ void Model::init(Framework::DX::DeviceResource* device, ID3D12GraphicsCommandLis
     GLBLoader loader(filepath);
     //CfbNXz񎟌z񂩂`ɕϊ
     std::vector<IndexList> indices = loader.getIndicesPerSubMeshes();
-    mIndices = toLinearList(indices);
+    mLods.resize(1);
+    ModelLod& lod = mLods[0];
+    lod.indices = toLinearList(indices);
 
     //_z`ɕϊ
     std::vector<PositionList> positions = loader.getPositionsPerSubMeshes();
     std::vector<NormalList> normals = loader.getNormalsPerSubMeshes();
     std::vector<UVList> uvs = loader.getUVsPerSubMeshes();
     std::vector<TangentList> tangents = loader.getTangentsPerSubMeshes();
-    mVertices = toLinearVertices(positions, normals, uvs, tangents);
-
-    mIndexBuffer.init(device, mIndices, D3D_PRIMITIVE_TOPOLOGY::D3D_PRIMITIVE_TOPOLOGY_UNDEFINED,
-        filepath.filename().wstring() + L"Index");
-    mVertexBuffer.init(device, mVertices, filepath.filename().wstring() + L"Vertex");
+    lod.vertices = toLinearVertices(positions, normals, uvs, tangents);
+    //_̈ʒuoEfBO{bNX߂
+    DirectX::BoundingBox::CreateFromPoints(mLocalBounds, lod.vertices.size(),
+        reinterpret_cast<const DirectX::XMFLOAT3*>(&lod.vertices[0].position),
+        sizeof(Framework::DX::Vertex));
 
     //}eAǂݍ
     std::vector<GlbMaterial> materials = loader.getMaterialDatas();
     //}eA΍ŏ̃}eAA݂Ȃ΃ftHg̃}eAgp
     GlbMaterial material = materials.empty() ? GlbMaterial{} : materials[0];
+    mEmissiveFactor = material.emissiveFactor;
     std::vector<TextureDesc> descs = loader.getImageDatas();
 
     //eNX`̓ǂݍݏ
@@ -104,3 +107,35 @@ void Model::init(Framework::DX::DeviceResource* device, ID3D12GraphicsCommandLis
         (material.occlusionMapID == -1 ? DEFAULT_OCCLUSIONMAP : descs[material.occlusionMapID]));
     mOcclusionMap.createSRV(device, DescriptorHeapType::RaytracingLocal);
 }
+//}eA쐬
+MaterialRecord Model::createMaterialRecord(DescriptorHeapManager* heapManager) const {
+    MaterialRecord record;
+    record.albedoIndex = heapManager->getBindlessIndex(mAlbedo.getView().getInfo());
+    record.normalIndex = heapManager->getBindlessIndex(mNormalMap.getView().getInfo());
+    record.metallicRoughnessIndex
+        = heapManager->getBindlessIndex(mMetallicRoughness.getView().getInfo());
+    record.emissiveIndex = heapManager->getBindlessIndex(mEmissiveMap.getView().getInfo());
+    record.occlusionIndex = heapManager->getBindlessIndex(mOcclusionMap.getView().getInfo());
+    record.emissiveFactor = mEmissiveFactor;
+    return record;
+}
+//ǂݍ񂾃bVȗđeiKǉ
+void Model::buildLods(const LodChainOptions& options) {
+    MY_ASSERTION(mLods.size() == 1, "ǂݍ񂾃bV̏ԂŌĂł");
+    std::vector<LodMesh> chain;
+    MeshSimplifier::buildLodChain(mLods[0].vertices, mLods[0].indices, options, &chain);
+    for (auto&& mesh : chain) {
+        ModelLod lod;
+        lod.vertices = std::move(mesh.vertices);
+        lod.indices = std::move(mesh.indices);
+        lod.geometricError = mesh.geometricError;
+        mLods.emplace_back(std::move(lod));
+    }
+}
+//ǂݍ񂾃WIg
+void Model::releaseGeometry() {
+    for (auto&& lod : mLods) {
+        std::vector<Framework::DX::Vertex>().swap(lod.vertices);
+        std::vector<Index>().swap(lod.indices);
+    }
+}
@@ -1,12 +1,26 @@
 #pragma once
+#include <DirectXCollision.h>
 #include "../Assets/Shader/Raytracing/Util/GlobalCompat.h"
+#include "../Assets/Shader/Raytracing/Util/HitGroupCompat.h"
 #include "DX/DeviceResource.h"
 #include "DX/ModelCompat.h"
-#include "DX/Resource/IndexBuffer.h"
 #include "DX/Resource/Texture2D.h"
-#include "DX/Resource/VertexBuffer.h"
+#include "Utility/Mesh/MeshSimplifier.h"
 #include "Typedef.h"
 
+/**
+ * @struct ModelLod
+ * @brief 1iK̏ڍדx̃bV
+ */
+struct ModelLod {
+    std::vector<Framework::DX::Vertex> vertices; //!< _ A[iւ̓]͋ɂȂ
+    std::vector<Index> indices; //!< CfbNX A[iւ̓]͋ɂȂ
+    float geometricError = 0.0f; //!< ǂݍ񂾃bV̍ő̂ [JԂł̋
+    UINT mesh = 0; //!< WIgA[ił̃bVԍ
+    UINT geometry = 0; //!< BLAS̔ԍ
+    UINT hitGroupIndex = 0; //!< qbgO[ṽR[h̔ԍ
+};
+
 /**
  * @class Model
  * @brief discription
@@ -23,19 +37,32 @@ public:
     ~Model() {}
     void init(Framework::DX::DeviceResource* device, ID3D12GraphicsCommandList* commandList,
         const std::filesystem::path& filepath, UINT id);
+    /**
+     * @brief }eA쐬
+     * @details eNX`̓oChX̃e[ũCfbNXɕϊ
+     */
+    MaterialRecord createMaterialRecord(Framework::DX::DescriptorHeapManager* heapManager) const;
+    /**
+     * @brief ǂݍ񂾃bVȗđeiKǉ
+     * @details WIgA[iɓ]OɌĂ GPUgȂ̂ŕʃXbhĂׂ
+     */
+    void buildLods(const Framework::Utility::LodChainOptions& options);
+    /**
+     * @brief ǂݍ񂾃WIg
+     * @details WIgA[iɓ]ɌĂ
+     */
+    void releaseGeometry();
 
     //private:
     UINT mShaderKey;
-    std::vector<Framework::DX::Vertex> mVertices;
-    std::vector<Index> mIndices;
-    UINT mVertexOffset;
-    UINT mIndexOffset;
-    Framework::DX::VertexBuffer mVertexBuffer;
-    Framework::DX::IndexBuffer mIndexBuffer;
+    std::vector<ModelLod> mLods; //!< ڍדxƂ̃bV 擪ǂݍ񂾃bVŌقǑe
+    UINT mLodGroup; //!< ڍדxIԂƂ̃O[v
     Framework::DX::Texture2D mAlbedo;
     Framework::DX::Texture2D mNormalMap;
     Framework::DX::Texture2D mMetallicRoughness;
     Framework::DX::Texture2D mEmissiveMap;
     Framework::DX::Texture2D mOcclusionMap;
     UINT mModelID;
+    Vec3 mEmissiveFactor; //!< G~bV̗vf
+    DirectX::BoundingBox mLocalBounds; //!< [JԂł̃oEfBO{bNX
 };
@@ -1,7 +1,10 @@
 #include "Scene.h"
 #include <DirectXMath.h>
+#include <chrono>
+#include <cmath>
 #include <numeric>
 #include "DX/Descriptor/DescriptorSet.h"
+#include "DX/Raytracing/AccelerationStructureCache.h"
 #include "DX/Raytracing/Shader/ShaderTable.h"
 #include "DX/Shader/PipelineState.h"
 #include "DX/Shader/Shader.h"
@@ -10,23 +13,25 @@
 #include "DX/Util/RasterizerDesc.h"
 #include "ImGui/ImGuiManager.h"
 #include "Math/Quaternion.h"
-#include "Model.h"
 #include "Utility/Debug.h"
 #include "Utility/IO/ByteReader.h"
 #include "Utility/IO/GLBLoader.h"
 #include "Utility/IO/TextureLoader.h"
 #include "Utility/Path.h"
+#include "Utility/Scene/SceneFile.h"
 #include "Utility/StringUtil.h"
 
 #include "CompiledShaders/ClosestHit_Normal.hlsl.h"
 #include "CompiledShaders/ClosestHit_Plane.hlsl.h"
 #include "CompiledShaders/ClosestHit_Sphere.hlsl.h"
+#include "CompiledShaders/Intersection_Sphere.hlsl.h"
 #include "CompiledShaders/Miss.hlsl.h"
 #include "CompiledShaders/RayGenShader.hlsl.h"
 #include "CompiledShaders/Shadow.hlsl.h"
 
 #include "Assets/Shader/Raytracing/Util/HitGroupCompat.h"
 #include "Assets/Shader/Raytracing/Util/MissCompat.h"
+#include "Assets/Shader/Raytracing/Util/SphereCompat.h"
 
 using namespace Framework::DX;
 using namespace Framework::Desc;
@@ -50,7 +55,6 @@ namespace {
 
             End
         };
-        constexpr UINT HITGROUP_NUM = ShaderKey::End - ShaderKey::HitGroup_UFO;
     } // namespace ShaderKey
 
     struct ExportShaderInfo {
@@ -70,18 +74,22 @@ namespace {
             _countof(g_pClosestHit_Plane) },
         { L"ClosestHit_Sphere", ShaderType::HitGroup, g_pClosestHit_Sphere,
             _countof(g_pClosestHit_Sphere) },
+        { L"Intersection_Sphere", ShaderType::HitGroup, g_pIntersection_Sphere,
+            _countof(g_pIntersection_Sphere) },
     };
 
     struct HitGroup {
         UINT shaderKey;
         std::wstring hitGroupName;
         std::wstring closestHitNames;
+        std::wstring intersectionName = L""; //!< w肷ƃvV[WȃWIgpɂȂ
     };
 
     static const std::vector<HitGroup> HIT_GROUP_LIST = {
         { ShaderKey::HitGroup_UFO, L"HitGroup_UFO", L"ClosestHit_Normal" },
         { ShaderKey::HitGroup_Floor, L"HitGroup_Floor", L"ClosestHit_Plane" },
-        { ShaderKey::HitGroup_Sphere, L"HitGroup_Sphere", L"ClosestHit_Sphere" },
+        { ShaderKey::HitGroup_Sphere, L"HitGroup_Sphere", L"ClosestHit_Sphere",
+            L"Intersection_Sphere" },
         { ShaderKey::HitGroup_House, L"HitGroup_House", L"ClosestHit_Normal" },
         { ShaderKey::HitGroup_Tree, L"HitGroup_Tree", L"ClosestHit_Normal" },
         { ShaderKey::HitGroup_Crate, L"HitGroup_Crate", L"ClosestHit_Normal" },
@@ -104,34 +112,23 @@ namespace {
         { L"HitGroup_Crate", ShaderKey::HitGroup_Crate, ShaderType::HitGroup },
     };
 
-    struct LoadModelInfo {
-        std::wstring name;
-        UINT shaderKey;
-    };
+    static const std::string SCENE_NAME = "default"; //!< ǂݍރV[t@C̖O
+    static const std::string SPIN_GROUP_NAME = "spin"; //!< t[]O[v̖O
+    static constexpr float SPIN_SPEED = 30.0f; //!< O[v񂷑 x/b
 
-    static const std::unordered_map<ModelType::Enum, LoadModelInfo> MODEL_NAMES = {
-        { ModelType::UFO, { L"UFO.glb", ShaderKey::HitGroup_UFO } },
-        { ModelType::Sphere, { L"sphere.glb", ShaderKey::HitGroup_Sphere } },
-        { ModelType::Floor, { L"floor.glb", ShaderKey::HitGroup_Floor } },
-        { ModelType::House, { L"house.glb", ShaderKey::HitGroup_House } },
-        { ModelType::Tree, { L"tree.glb", ShaderKey::HitGroup_Tree } },
-        { ModelType::Crate, { L"Crate.glb", ShaderKey::HitGroup_Crate } },
-    };
-
-    std::unordered_map<ModelType::Enum, Model> mLoadedModels;
+    //qbgO[vVF[_[̃L[T
+    UINT findShaderKey(const std::string& hitGroupName) {
+        for (auto&& hitGroup : HIT_GROUP_LIST) {
+            if (toString(hitGroup.hitGroupName) == hitGroupName) return hitGroup.shaderKey;
+        }
+        MY_THROW_IF_FALSE_LOG(false, "`̃qbgO[vł %s", hitGroupName.c_str());
+        return ShaderKey::End;
+    }
 
-    struct Object {
-        Model* model;
-        BottomLevelAccelerationStructure* blas;
-        Vec3 position;
-        Quaternion rotation;
-        Vec3 scale;
-    };
-    Object mFloor;
-    std::vector<Object> mSpheres;
-    Object mHouse;
-    std::vector<Object> mTree;
-    Object mCrate;
+    static constexpr UINT GPU_TIMER_RAYTRACING = 0; //!< Cg[VǑvɎg^C}[
+    static constexpr UINT LOD_LEVEL_COUNT = 4; //!< ǂݍ񂾃bV܂߂ڍדx̒iK
+    static constexpr float LOD_MAX_RELATIVE_ERROR
+        = 0.25f; //!< ȗŋe邸 oEfBO{bNX̑Ίpɑ΂銄
 
     RootSignature mDefaultRootSignature;
     PipelineState mGrayScalePipelineState;
@@ -145,6 +142,11 @@ Scene::Scene(Framework::DX::DeviceResource* device, Framework::Input::InputManag
     : mDeviceResource(device),
       mInputManager(inputManager),
       mDXRDevice(),
+      mSpinNode(SceneGraph::INVALID_NODE),
+      mSpinAngle(180.0f),
+      mCullDistance(1000.0f),
+      mRelevanceDistance(300.0f),
+      mLodPixelError(1.0f),
       mWidth(width),
       mHeight(height) {}
 Scene::~Scene() {}
@@ -153,11 +155,11 @@ void Scene::create() {
     createDeviceDependentResources();
     createWindowDependentResources();
     {
-        mSceneCB.init(mDeviceResource, L"SceneConstantBuffer");
-        mSceneCB.createCBV(mDeviceResource, DescriptorHeapType::RaytracingGlobal);
+        mSceneCB.init(mDeviceResource);
         mSceneCB->cameraPosition = Vec4(0, 50, -300, 1.0f);
         mSceneCB->lightPosition = Vec4(0, 100, -100, 0);
         mSceneCB->gammaRate = 1.0f;
+        mSceneCB->tiledDispatch = 1;
         mCameraRotation = Vec3::ZERO;
         mLightAmbient = Color4(0.1f, 0.1f, 0.1f, 1.0f);
     }
@@ -225,6 +227,56 @@ void Scene::update() {
 #pragma region IMGUI_REGION
     if (ImGui::Begin("Status")) {
         ImGui::Text("FPS:%0.3f", mTime.getFPS());
+        ImGui::Text("Raytracing:%0.3fms", mGpuTimer.getAverageTime(GPU_TIMER_RAYTRACING));
+        const AccelerationStructureUpdatePolicy& policy = mTLASBuffer->getUpdatePolicy();
+        ImGui::Text("TLAS:%s Refit:%u Degradation:%0.3f",
+            policy.getLastMode() == AccelerationStructureBuildMode::Refit ? "Refit" : "Build",
+            policy.getRefitCount(), policy.getDegradation());
+        ImGui::Text("TLAS Upload:%u/%u %.1fKB", mTLASBuffer->getUploadedInstanceCount(),
+            mTLASBuffer->getInstanceCapacity(), mTLASBuffer->getUploadedBytes() / 1024.0);
+        //VF[_[猩q[v̎gpʂ̍ől
+        DescriptorHeapManager* heapManager = mDeviceResource->getHeapManager();
+        for (DescriptorHeapType type : { DescriptorHeapType::CbvSrvUav, DescriptorHeapType::Sampler,
+                 DescriptorHeapType::RaytracingGlobal }) {
+            const char* name = type == DescriptorHeapType::CbvSrvUav
+                ? "CbvSrvUav"
+                : type == DescriptorHeapType::Sampler ? "Sampler" : "RaytracingGlobal";
+            ImGui::Text("%s:%u/%u", name, heapManager->getHighWaterMark(type),
+                heapManager->getCapacity(type));
+        }
+        const DescriptorTableCache::Stats cacheStats = heapManager->getTableCacheStats();
+        ImGui::Text("TableCache Hit:%u/%u SavedCopy:%u(%u)", cacheStats.hitCount,
+            cacheStats.lookupCount, cacheStats.savedCopyCount, cacheStats.savedDescriptorCount);
+        const GpuMemoryAllocator::Stats memoryStats
+            = mDeviceResource->getMemoryAllocator()->getStats();
+        ImGui::Text("GpuMemory %.1f/%.1fMB Heap:%u Alloc:%u Pending:%u Committed:%u",
+            memoryStats.usedSize / (1024.0 * 1024.0), memoryStats.reservedSize / (1024.0 * 1024.0),
+            memoryStats.heapCount, memoryStats.allocationCount, memoryStats.pendingFreeCount,
+            memoryStats.committedCount);
+        const UploadManager::Stats uploadStats = mDeviceResource->getUploadManager()->getStats();
+        ImGui::Text("Upload %.1f/%.1fMB Total:%.1fMB Submit:%u Overflow:%u",
+            uploadStats.usedSize / (1024.0 * 1024.0), uploadStats.capacity / (1024.0 * 1024.0),
+            uploadStats.uploadedSize / (1024.0 * 1024.0), uploadStats.submitCount,
+            uploadStats.overflowCount);
+        //Õt[̕\
+        CommandListStateTracker* stateTracker = mDeviceResource->getStateTracker();
+        const ResourceStateTracker::Stats& barrierStats = stateTracker->getStats();
+        ImGui::Text("Barrier %u/%u Redundant:%u Merged:%u Flush:%u Resolve:%u",
+            barrierStats.barrierCount, barrierStats.requestCount, barrierStats.redundantCount,
+            barrierStats.mergedCount, barrierStats.flushCount, barrierStats.resolveCount);
+        stateTracker->resetStats();
+        ConstantBufferAllocator* cbAllocator = mDeviceResource->getConstantBufferAllocator();
+        ImGui::Text("ConstantRing %.1f/%.1fKB", cbAllocator->getUsedSize() / 1024.0,
+            cbAllocator->getCapacity() / 1024.0);
+        ImGui::Text("Instance Active:%u/%u Node:%u Depth:%u", mCuller.getActiveCount(),
+            mInstances.getCount(), mSceneGraph.getNodeCount(), mSceneGraph.getDepth());
+        const std::array<UINT, LodSelector::MAX_LEVEL_COUNT>& lodCounts
+            = mLodSelector.getLevelCounts();
+        ImGui::Text("LOD %u/%u/%u/%u", lodCounts[0], lodCounts[1], lodCounts[2], lodCounts[3]);
+        const GeometryArenaLayout& geometryLayout = mGeometryArena.getLayout();
+        ImGui::Text("Geometry Mesh:%u Vertex:%u/%u Index:%u/%u", geometryLayout.getMeshCount(),
+            geometryLayout.getUsedVertexCount(), geometryLayout.getVertexCapacity(),
+            geometryLayout.getUsedIndexCount(), geometryLayout.getIndexCapacity());
         ImGui::End();
     }
 
@@ -269,6 +321,14 @@ void Scene::update() {
         ImGui::SetNextTreeNodeOpen(true, ImGuiCond_::ImGuiCond_Once);
         if (ImGui::TreeNode("Option")) {
             ImGui::DragFloat("Gamma(%)", &mSceneCB->gammaRate, 0.01f, 0.0f, 2.0f, "%.3f");
+            bool tiledDispatch = mSceneCB->tiledDispatch != 0;
+            if (ImGui::Checkbox("TiledDispatch", &tiledDispatch)) {
+                mSceneCB->tiledDispatch = tiledDispatch ? 1 : 0;
+                mGpuTimer.reset();
+            }
+            ImGui::DragFloat("CullDistance", &mCullDistance, 10.0f, 0.0f, 10000.0f);
+            ImGui::DragFloat("ShadowDistance", &mRelevanceDistance, 10.0f, 0.0f, 10000.0f);
+            ImGui::DragFloat("LodPixelError", &mLodPixelError, 0.1f, 0.0f, 64.0f);
             ImGui::TreePop();
         }
         ImGui::End();
@@ -282,50 +342,60 @@ void Scene::update() {
         mSceneCB->cameraPosition.x, mSceneCB->cameraPosition.y, mSceneCB->cameraPosition.z);
     Mat4 view = Mat4::createRotation(mCameraRotation) * Mat4::createTranslate(cameraPosition);
     view = view.inverse();
-    Mat4 proj = Mat4::createProjection(Deg(45.0f), aspect, 0.1f, 100.0f);
+    const Deg fovY(45.0f);
+    Mat4 proj = Mat4::createProjection(fovY, aspect, 0.1f, 100.0f);
     Mat4 vp = view * proj;
     mSceneCB->projectionToWorld = vp.inverse();
     mSceneCB->lightAmbient = mLightAmbient;
     mSceneCB->globalTime = static_cast<float>(mTime.getTime());
+    mSceneCB->screenWidth = mWidth;
+    mSceneCB->screenHeight = mHeight;
 #pragma endregion
-    static float rotHouse = 180.0f;
-    mHouse.rotation = Quaternion::fromEular(Vec3(0, rotHouse, 0));
+    if (mSpinNode != SceneGraph::INVALID_NODE) {
+        mSpinAngle = std::fmod(
+            mSpinAngle + SPIN_SPEED * static_cast<float>(mTime.getDeltaTime()), 360.0f);
+        mSceneGraph.setLocalRotation(mSpinNode, Quaternion::fromEular(Vec3(0, mSpinAngle, 0)));
+    }
+
+    //m[hƂ̎q̍s񂾂vZĂJO
+    mSceneGraph.update(&mInstances, &mWorkers);
+    mInstances.updateTransforms();
+    CullingParams culling = {};
+    InstanceCuller::extractFrustumPlanes(vp, &culling);
+    culling.viewPosition = cameraPosition;
+    culling.maxDistance = mCullDistance;
+    culling.relevanceDistance = mRelevanceDistance;
+    culling.relevanceMask = 0xff;
+    mCuller.cull(mInstances, culling);
+
+    //ĉڍדxI OĂԂ̃WIgTLASŎgȂ
+    LodParams lod;
+    lod.viewPosition = cameraPosition;
+    lod.projectionScale = LodSelector::computeProjectionScale(
+        Rad(fovY).getRad(), static_cast<float>(mHeight));
+    lod.maxPixelError = mLodPixelError;
+    mLodSelector.select(&mInstances, lod, &mCuller.getActiveInstances(), &mWorkers);
 }
 
 void Scene::render() {
     ID3D12Device* device = mDeviceResource->getDevice();
     ID3D12GraphicsCommandList5* dxrCommandList = mDXRDevice.getDXRCommandList();
 
-    mTLASBuffer->clear();
-    TopLevelAccelerationStructure::InstanceDesc instanceDesc = {};
-    instanceDesc.instanceID = 0;
-    instanceDesc.mask = 0xff;
-    instanceDesc.flags = D3D12_RAYTRACING_INSTANCE_FLAGS::D3D12_RAYTRACING_INSTANCE_FLAG_NONE;
-
-    auto createTransform = [](Object& obj) {
-        return XMMatrixScaling(obj.scale.x, obj.scale.y, obj.scale.z)
-            * XMMatrixRotationQuaternion(
-                { obj.rotation.x, obj.rotation.y, obj.rotation.z, obj.rotation.w })
-            * XMMatrixTranslation(obj.position.x, obj.position.y, obj.position.z);
-    };
-
-    auto addTLAS = [&](Object& obj) {
-        XMMATRIX transform = createTransform(obj);
-        instanceDesc.hitGroupIndex = obj.model->mModelID;
-        instanceDesc.blas = obj.blas;
-        instanceDesc.transform = transform;
-        mTLASBuffer->add(instanceDesc);
-    };
-
-    addTLAS(mFloor);
-    for (auto&& obj : mSpheres) { addTLAS(obj); }
-    addTLAS(mHouse);
-    for (auto&& obj : mTree) { addTLAS(obj); }
-    addTLAS(mCrate);
+    mBLASAddresses.resize(mBLASBuffers.size());
+    for (size_t i = 0; i < mBLASBuffers.size(); i++) {
+        mBLASAddresses[i] = mBLASBuffers[i]->getBuffer()->GetGPUVirtualAddress();
+    }
+    //CX^XfBXN͕ăAbv[hobt@ɒڏ
+    mTLASBuffer->writeInstances(
+        mDXRDevice, mDeviceResource, mInstances, mBLASAddresses.data(), &mCuller, &mWorkers);
+    mInstances.clearDirty();
 
+    //CX^ẌړԂ̓tBbgōς܂
     mTLASBuffer->build(mDXRDevice, mDeviceResource,
         D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS::
-            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE);
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE
+            | D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS::
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE);
 
     ID3D12GraphicsCommandList* commandList = mDeviceResource->getCommandList();
     UINT frameIndex = mDeviceResource->getCurrentFrameIndex();
@@ -336,38 +406,45 @@ void Scene::render() {
         commandList, DescriptorHeapType::RaytracingGlobal);
 
     DescriptorSet globalSet;
-    globalSet.setCbvHandle(0, mSceneCB.getView().getInfo().cpuHandle);
     globalSet.setSrvHandle(0, mTLASBuffer->getView().getInfo().cpuHandle);
-    globalSet.setSrvHandle(1, mResourceIndexBufferSRV.getInfo().cpuHandle);
-    globalSet.setSrvHandle(2, mResourceVertexBufferSRV.getInfo().cpuHandle);
+    globalSet.setSrvHandle(1, mGeometryArena.getIndexView().getInfo().cpuHandle);
+    globalSet.setSrvHandle(2, mGeometryArena.getVertexView().getInfo().cpuHandle);
+    globalSet.setSrvHandle(3, mMaterialBufferSRV.getInfo().cpuHandle);
     globalSet.setUavHandle(0, mRaytracingOutputUAV.getInfo().cpuHandle);
 
     mDeviceResource->getHeapManager()->copyAndSetComputeDescriptorHeap(
         DescriptorHeapType ::RaytracingGlobal, mDeviceResource, commandList, globalSet);
-    mDXRStateObject->doRaytracing(mWidth, mHeight);
-
-    D3D12_RESOURCE_BARRIER preCopyBarriers[2];
-    preCopyBarriers[0] = CD3DX12_RESOURCE_BARRIER::Transition(
-        mDeviceResource->getRenderTarget()->getBuffer().getResource(),
-        D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RENDER_TARGET,
-        D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COPY_DEST);
-    preCopyBarriers[1] = CD3DX12_RESOURCE_BARRIER::Transition(mRaytracingOutput.getResource(),
-        D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
-        D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COPY_SOURCE);
-    commandList->ResourceBarrier(_countof(preCopyBarriers), preCopyBarriers);
+    commandList->SetComputeRootConstantBufferView(
+        GlobalRootSignature::Slot::Cbv, mSceneCB.getGPUVirtualAddress());
+    commandList->SetComputeRootDescriptorTable(GlobalRootSignature::Slot::BindlessTexture,
+        mDeviceResource->getHeapManager()->getBindlessTableStart());
+    mGpuTimer.start(commandList, GPU_TIMER_RAYTRACING);
+    if (mSceneCB->tiledDispatch) {
+        //^CPʂɕבւ̂1ŃfBXpb`
+        const UINT tilesX = (mWidth + RAY_DISPATCH_TILE_SIZE - 1) / RAY_DISPATCH_TILE_SIZE;
+        const UINT tilesY = (mHeight + RAY_DISPATCH_TILE_SIZE - 1) / RAY_DISPATCH_TILE_SIZE;
+        mDXRStateObject->doRaytracing(
+            tilesX * tilesY * RAY_DISPATCH_TILE_SIZE * RAY_DISPATCH_TILE_SIZE, 1);
+    } else {
+        mDXRStateObject->doRaytracing(mWidth, mHeight);
+    }
+    mGpuTimer.stop(commandList, GPU_TIMER_RAYTRACING);
+
+    CommandListStateTracker* stateTracker = mDeviceResource->getStateTracker();
+    mDeviceResource->getRenderTarget()->transition(
+        stateTracker, D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COPY_DEST);
+    mRaytracingOutput.transition(
+        stateTracker, D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COPY_SOURCE);
+    stateTracker->flush();
 
     commandList->CopyResource(mDeviceResource->getRenderTarget()->getBuffer().getResource(),
         mRaytracingOutput.getResource());
 
-    D3D12_RESOURCE_BARRIER postCopyBarriers[2];
-    postCopyBarriers[0] = CD3DX12_RESOURCE_BARRIER::Transition(
-        mDeviceResource->getRenderTarget()->getBuffer().getResource(),
-        D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COPY_DEST,
-        D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RENDER_TARGET);
-    postCopyBarriers[1] = CD3DX12_RESOURCE_BARRIER::Transition(mRaytracingOutput.getResource(),
-        D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_COPY_SOURCE,
-        D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
-    commandList->ResourceBarrier(_countof(postCopyBarriers), postCopyBarriers);
+    //Őς񂾈ڍs̓O[XP[̕`Oɂ܂Ƃ߂Ĕs
+    mDeviceResource->getRenderTarget()->transition(
+        stateTracker, D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_RENDER_TARGET);
+    mRaytracingOutput.transition(
+        stateTracker, D3D12_RESOURCE_STATES::D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 
     commandList->RSSetViewports(1, &mDeviceResource->getScreenViewport());
     commandList->RSSetScissorRects(1, &mDeviceResource->getScissorRect());
@@ -384,9 +461,11 @@ void Scene::render() {
     mDeviceResource->getHeapManager()->copyAndSetGraphicsDescriptorHeap(
         DescriptorHeapType::Sampler, mDeviceResource, commandList, grayScaleSet);
 
+    stateTracker->flush();
     mQuadVertex.setCommandList(commandList);
     mQuadIndex.setCommandList(commandList);
     mQuadIndex.draw(commandList);
+    mGpuTimer.endFrame(commandList);
 }
 
 void Scene::onWindowSizeChanged(UINT width, UINT height) {
@@ -398,7 +477,8 @@ void Scene::onWindowSizeChanged(UINT width, UINT height) {
 }
 
 void Scene::createDeviceDependentResources() {
-    mDXRDevice.create(mDeviceResource->getDevice(), mDeviceResource->getCommandList());
+    mDXRDevice.create(mDeviceResource->getDevice(), mDeviceResource->getCommandList(),
+        mDeviceResource->getMemoryAllocator());
     {
         mGpuTimer.storeDevice(mDeviceResource->getDevice(), mDeviceResource->getCommandQueue(),
             mDeviceResource->getBackBufferCount());
@@ -406,23 +486,27 @@ void Scene::createDeviceDependentResources() {
     //O[o[gVOl`
     {
         CD3DX12_DESCRIPTOR_RANGE ranges[GlobalRootSignature::Slot::Count];
-        ranges[GlobalRootSignature::Slot::Cbv].Init(
-            D3D12_DESCRIPTOR_RANGE_TYPE::D3D12_DESCRIPTOR_RANGE_TYPE_CBV,
-            GLOBAL_CONSTANT_BUFFER_VIEW_RESGISTER_NUM, GLOBAL_CONSTANT_BUFFER_VIEW_RESGISTER_START);
         ranges[GlobalRootSignature::Slot::Srv].Init(
             D3D12_DESCRIPTOR_RANGE_TYPE::D3D12_DESCRIPTOR_RANGE_TYPE_SRV,
             GLOBAL_SHADER_RESOURCE_VIEW_REGISTER_NUM, GLOBAL_SHADER_RESOURCE_VIEW_REGISTER_START);
         ranges[GlobalRootSignature::Slot::Uav].Init(
             D3D12_DESCRIPTOR_RANGE_TYPE::D3D12_DESCRIPTOR_RANGE_TYPE_UAV,
             GLOBAL_UNORDERED_ACCESS_VIEW_REGISTER_NUM, GLOBAL_UNORDERED_ACCESS_VIEW_REGISTER_START);
+        //eNX`͏߂Ƀe[u̐擪QƂ
+        ranges[GlobalRootSignature::Slot::BindlessTexture].Init(
+            D3D12_DESCRIPTOR_RANGE_TYPE::D3D12_DESCRIPTOR_RANGE_TYPE_SRV, UINT_MAX, 0,
+            BINDLESS_TEXTURE_REGISTER_SPACE);
 
         std::vector<CD3DX12_ROOT_PARAMETER> rootParams(GlobalRootSignature::Slot::Count);
-        rootParams[GlobalRootSignature::Slot::Cbv].InitAsDescriptorTable(
-            1, &ranges[GlobalRootSignature::Slot::Cbv]);
+        //t[V͈͂ŵŃfBXNv^ɓn
+        rootParams[GlobalRootSignature::Slot::Cbv].InitAsConstantBufferView(
+            GLOBAL_CONSTANT_BUFFER_VIEW_RESGISTER_START);
         rootParams[GlobalRootSignature::Slot::Srv].InitAsDescriptorTable(
             1, &ranges[GlobalRootSignature::Slot::Srv]);
         rootParams[GlobalRootSignature::Slot::Uav].InitAsDescriptorTable(
             1, &ranges[GlobalRootSignature::Slot::Uav]);
+        rootParams[GlobalRootSignature::Slot::BindlessTexture].InitAsDescriptorTable(
+            1, &ranges[GlobalRootSignature::Slot::BindlessTexture]);
 
         std::vector<CD3DX12_STATIC_SAMPLER_DESC> sampler(1);
         sampler[0] = CD3DX12_STATIC_SAMPLER_DESC(
@@ -444,29 +528,13 @@ void Scene::createDeviceDependentResources() {
     }
     //qbgO[vVF[_[
     {
-        CD3DX12_DESCRIPTOR_RANGE range[5];
-        range[0].Init(D3D12_DESCRIPTOR_RANGE_TYPE::D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1,
-            LOCAL_SHADER_RESOURCE_VIEW_REGISTER_START + 0);
-        range[1].Init(D3D12_DESCRIPTOR_RANGE_TYPE::D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1,
-            LOCAL_SHADER_RESOURCE_VIEW_REGISTER_START + 1);
-        range[2].Init(D3D12_DESCRIPTOR_RANGE_TYPE::D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1,
-            LOCAL_SHADER_RESOURCE_VIEW_REGISTER_START + 2);
-        range[3].Init(D3D12_DESCRIPTOR_RANGE_TYPE::D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1,
-            LOCAL_SHADER_RESOURCE_VIEW_REGISTER_START + 3);
-        range[4].Init(D3D12_DESCRIPTOR_RANGE_TYPE::D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1,
-            LOCAL_SHADER_RESOURCE_VIEW_REGISTER_START + 4);
-
-        std::vector<CD3DX12_ROOT_PARAMETER> params(6);
-        UINT contSize
-            = Framework::Math::MathUtil::alignPow2(sizeof(HitGroupConstant), sizeof(UINT32));
-
-        params[0].InitAsDescriptorTable(1, &range[0]);
-        params[1].InitAsDescriptorTable(1, &range[1]);
-        params[2].InitAsDescriptorTable(1, &range[2]);
-        params[3].InitAsDescriptorTable(1, &range[3]);
-        params[4].InitAsDescriptorTable(1, &range[4]);
-
-        params[5].InitAsConstants(contSize, 1);
+        //eNX`̓}eAz񂩂oChX̃e[ûŁA萔
+        std::vector<CD3DX12_ROOT_PARAMETER> params(
+            LocalRootSignature::HitGroup::Constants::Count);
+        UINT contSize = static_cast<UINT>(sizeof(HitGroupConstant) / sizeof(UINT32));
+
+        params[LocalRootSignature::HitGroup::Constants::SceneConstants].InitAsConstants(
+            contSize, LOCAL_CONSTANT_BUFFER_VIEW_RESGISTER_START);
         RootSignatureDesc desc{ params, {}, RootSignature::Flags::Local };
         mHitGroupLocalRootSignature = std::make_unique<RootSignature>();
         mHitGroupLocalRootSignature->init(mDeviceResource, desc);
@@ -478,79 +546,236 @@ void Scene::createDeviceDependentResources() {
         ID3D12Device5* dxrDevice = mDXRDevice.getDXRDevice();
         ID3D12GraphicsCommandList5* dxrCommandList = mDXRDevice.getDXRCommandList();
 
-        std::vector<Framework::DX::Vertex> resourceVertices;
-        std::vector<Index> resourceIndices;
-
         auto path = Framework::Utility::ExePath::getInstance()->exe();
         path = path.remove_filename();
         auto modelPath = path / "Resources" / "Model";
         auto texPath = path / "Resources" / "Texture";
 
-        UINT vertexOffset = 0;
-        UINT indexOffset = 0;
-
-        auto loadModel = [&](const std::filesystem::path& filepath, UINT modelID) {
-            Model model;
-            model.init(mDeviceResource, commandList, filepath, modelID);
-            model.mVertexOffset = vertexOffset;
-            model.mIndexOffset = indexOffset;
-            vertexOffset += model.mVertices.size();
-            indexOffset += model.mIndices.size();
-            return model;
+        //eLXg`ҏWƂϊAi̓oCi`}bvēǂ
+        SceneFile sceneFile;
+        MY_THROW_IF_FALSE_LOG(
+            sceneFile.load(path / "Resources" / "Scene" / (SCENE_NAME + ".scene"),
+                path / "Cache" / (SCENE_NAME + ".sceneb")),
+            "V[t@Cǂݍ߂܂ %s", SCENE_NAME.c_str());
+        const SceneModelRecord* sceneModels = sceneFile.getModels();
+        auto isProceduralSphere = [&](UINT id) {
+            return (sceneModels[id].flags & SceneModelFlags::ProceduralSphere) != 0;
         };
 
-        UINT id = 0;
-        for (auto&& load : MODEL_NAMES) {
-            Model model = loadModel(modelPath / load.second.name, load.second.shaderKey);
-            resourceIndices.insert(
-                resourceIndices.end(), model.mIndices.begin(), model.mIndices.end());
-            resourceVertices.insert(
-                resourceVertices.end(), model.mVertices.begin(), model.mVertices.end());
-            model.mModelID = id++;
-            mBLASBuffers[load.first] = std::make_unique<BottomLevelAccelerationStructure>();
-            mBLASBuffers[load.first]->init(mDXRDevice, model.mVertexBuffer,
-                static_cast<UINT>(sizeof(Vertex)), model.mIndexBuffer,
-                static_cast<UINT>(sizeof(Index)));
-            mLoadedModels[load.first] = model;
+        //v̑傫ŃA[i邽߁AɂׂẴfǂݍ
+        mLoadedModels = std::vector<Model>(sceneFile.getModelCount());
+        std::vector<Model*> models;
+        for (UINT id = 0; id < sceneFile.getModelCount(); id++) {
+            Model& model = mLoadedModels[id];
+            model.init(mDeviceResource, commandList,
+                modelPath / sceneFile.getString(sceneModels[id].file),
+                findShaderKey(sceneFile.getString(sceneModels[id].hitGroup)));
+            model.mModelID = id;
+            if (isProceduralSphere(id)) {
+                //PʋCX^X̕ϊŒûŁAǂݍ񂾃bV͎gȂ
+                model.releaseGeometry();
+                model.mLocalBounds = BoundingBox(XMFLOAT3(0, 0, 0), XMFLOAT3(1, 1, 1));
+                continue;
+            }
+            models.emplace_back(&model);
         }
+        //ȗ̓fƂɓƗĂ̂ŁAfPʂŕɍs
+        mWorkers.parallelFor(static_cast<UINT>(models.size()), 1, [&](UINT begin, UINT end) {
+            for (UINT i = begin; i < end; i++) {
+                const XMFLOAT3& extents = models[i]->mLocalBounds.Extents;
+                LodChainOptions options;
+                options.maxLevelCount = LOD_LEVEL_COUNT;
+                options.maxError = 2.0f * LOD_MAX_RELATIVE_ERROR
+                    * std::sqrt(extents.x * extents.x + extents.y * extents.y
+                        + extents.z * extents.z);
+                models[i]->buildLods(options);
+            }
+        });
+
+        UINT vertexCount = 0;
+        UINT indexCount = 0;
+        for (auto&& model : models) {
+            for (auto&& lod : model->mLods) {
+                vertexCount += static_cast<UINT>(lod.vertices.size());
+                indexCount += static_cast<UINT>(lod.indices.size());
+            }
+        }
+        mGeometryArena.init(mDeviceResource, static_cast<UINT>(sizeof(Vertex)), vertexCount,
+            static_cast<UINT>(sizeof(Index)), indexCount, GeometryResidency::GpuOnly,
+            L"SceneGeometry");
+
+        //\zς݂BLAS̓LbVǂݍ݁AȂ΍\zČŕۑ
+        const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS blasBuildFlags
+            = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS::
+                  D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE
+            | D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS::
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_COMPACTION;
+        AccelerationStructureCache blasCache(path / "Cache");
+        struct BuiltBLAS {
+            std::string name;
+            UINT64 key;
+            AccelerationStructureCache::Metadata metadata;
+            BottomLevelAccelerationStructure* blas;
+        };
+        std::vector<BuiltBLAS> builtBLAS;
+        UINT cachedCount = 0;
+        const auto blasStartTime = std::chrono::high_resolution_clock::now();
+
+        //ڍדxƂBLASƃqbgO[ṽR[h蓖Ă
+        mBLASBuffers.clear();
+        mLodSelector.clear();
+        for (UINT id = 0; id < sceneFile.getModelCount(); id++) {
+            Model& model = mLoadedModels[id];
+            if (isProceduralSphere(id)) {
+                //Pʋ͂AABB1Ȃ̂ŁALbV∳kɂ̏ō\z
+                ModelLod& lod = model.mLods[0];
+                lod.geometry = static_cast<UINT>(mBLASBuffers.size());
+                lod.hitGroupIndex = lod.geometry;
+                mBLASBuffers.emplace_back(std::make_unique<BottomLevelAccelerationStructure>());
+                mBLASBuffers.back()->initProcedural(mDXRDevice,
+                    { D3D12_RAYTRACING_AABB{ -1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f } });
+                model.mLodGroup = InstanceCreateDesc::NO_LOD_GROUP;
+                continue;
+            }
+            const std::string modelName = sceneFile.getString(sceneModels[id].name);
+            std::vector<LodLevel> levels;
+            for (size_t level = 0; level < model.mLods.size(); level++) {
+                ModelLod& lod = model.mLods[level];
+                lod.mesh = mGeometryArena.addMesh(mDeviceResource, lod.vertices, lod.indices);
+                lod.geometry = static_cast<UINT>(mBLASBuffers.size());
+                lod.hitGroupIndex = lod.geometry;
+                levels.push_back({ lod.geometry, lod.hitGroupIndex, lod.geometricError });
+
+                const GeometryRange& range = mGeometryArena.getRange(lod.mesh);
+                const GeometryView geometry = mGeometryArena.getView(lod.mesh);
+                const std::string name
+                    = level == 0 ? modelName : modelName + "_lod" + std::to_string(level);
+                const UINT64 key = AccelerationStructureCache::computeKey(lod.vertices.data(),
+                    lod.vertices.size() * sizeof(Vertex), lod.indices.data(),
+                    lod.indices.size() * sizeof(Index), blasBuildFlags);
+                const AccelerationStructureCache::Metadata metadata = { model.mShaderKey,
+                    lod.hitGroupIndex, range.vertexOffset, range.indexOffset };
+
+                mBLASBuffers.emplace_back(std::make_unique<BottomLevelAccelerationStructure>());
+                BottomLevelAccelerationStructure* blas = mBLASBuffers.back().get();
+                AccelerationStructureCache::Entry entry;
+                //V[ł̔zuςĂqbgO[v̑Ή̂ŎgȂ
+                const bool cached = blasCache.load(name, key, &entry)
+                    && memcmp(&entry.metadata, &metadata, sizeof(metadata)) == 0
+                    && blas->initFromSerialized(mDXRDevice, geometry, model.mLocalBounds,
+                        blasBuildFlags, entry.data, entry.size);
+                if (cached) {
+                    cachedCount++;
+                } else {
+                    blas->init(mDXRDevice, geometry, model.mLocalBounds, blasBuildFlags);
+                    builtBLAS.emplace_back(BuiltBLAS{ name, key, metadata, blas });
+                }
+            }
+            model.mLodGroup
+                = mLodSelector.addGroup(levels.data(), static_cast<UINT>(levels.size()));
+            //GPUɓ]̂CPU̎ʂ͎Ȃ
+            model.releaseGeometry();
+        }
+        mGeometryArena.createSRV(mDeviceResource, DescriptorHeapType::RaytracingGlobal);
 
-        mResourcesIndexBuffer.init(mDeviceResource, resourceIndices,
-            D3D12_PRIMITIVE_TOPOLOGY::D3D_PRIMITIVE_TOPOLOGY_UNDEFINED, L"ResourceIndex");
-        mResourceIndexBufferSRV = mResourcesIndexBuffer.createSRV(
-            mDeviceResource, DescriptorHeapType::RaytracingGlobal);
-
-        mResourcesVertexBuffer.init(mDeviceResource, resourceVertices, L"ResourceVertex");
-        mResourceVertexBufferSRV.initAsBuffer(mDeviceResource, mResourcesVertexBuffer.getBuffer(),
-            DescriptorHeapType::RaytracingGlobal);
+        //}eA̓fID̏ɕׂ
+        std::vector<MaterialRecord> materials(mLoadedModels.size());
+        for (auto&& model : mLoadedModels) {
+            materials[model.mModelID]
+                = model.createMaterialRecord(mDeviceResource->getHeapManager());
+        }
+        const UINT materialBufferSize
+            = static_cast<UINT>(materials.size() * sizeof(MaterialRecord));
+        mMaterialBuffer.initAsStatic(mDeviceResource, Buffer::Usage::ShaderResource,
+            materials.data(), materialBufferSize, static_cast<UINT>(sizeof(MaterialRecord)),
+            L"MaterialBuffer");
+        mMaterialBufferSRV.initAsBuffer(
+            mDeviceResource, mMaterialBuffer, DescriptorHeapType::RaytracingGlobal);
 
         mTLASBuffer = std::make_unique<TopLevelAccelerationStructure>();
 
         mDeviceResource->executeCommandList();
         mDeviceResource->waitForGPU();
 
-        auto createModel = [&](ModelType::Enum type, const Vec3& position,
-                               const Quaternion& rotation, const Vec3& scale) {
-            Object model = {};
-            model.model = &mLoadedModels[type];
-            model.blas = mBLASBuffers[type].get();
-            model.position = position;
-            model.rotation = rotation;
-            model.scale = scale;
-            return model;
+        auto flushCommandList = [&]() {
+            mDeviceResource->executeCommandList();
+            mDeviceResource->waitForGPU();
+            MY_THROW_IF_FAILED(allocator->Reset());
+            MY_THROW_IF_FAILED(commandList->Reset(allocator, nullptr));
         };
 
-        mFloor
-            = createModel(ModelType::Floor, Vec3(0, 0, 0), Quaternion::IDENTITY, Vec3(500, 1, 500));
-        mHouse = createModel(
-            ModelType::House, Vec3(-20, 0, 0), Quaternion::IDENTITY, Vec3(30, 30, 30));
-        for (float z = -200; z <= 200; z += 80.0f) {
-            mTree.emplace_back(createModel(
-                ModelType::Tree, Vec3(-200, 0, z), Quaternion::IDENTITY, Vec3(1, 1, 1)));
-            mTree.emplace_back(
-                createModel(ModelType::Tree, Vec3(200, 0, z), Quaternion::IDENTITY, Vec3(1, 1, 1)));
+        //\zÎňk̃TCYǂ߂
+        MY_THROW_IF_FAILED(allocator->Reset());
+        MY_THROW_IF_FAILED(commandList->Reset(allocator, nullptr));
+        for (auto&& built : builtBLAS) {
+            built.blas->compact(mDXRDevice);
+            built.blas->requestSerializedSize(mDXRDevice);
+        }
+        if (!builtBLAS.empty()) {
+            flushCommandList();
+            for (auto&& built : builtBLAS) { built.blas->serialize(mDXRDevice); }
+        }
+        mDeviceResource->executeCommandList();
+        mDeviceResource->waitForGPU();
+        const double blasMilliseconds = std::chrono::duration<double, std::milli>(
+            std::chrono::high_resolution_clock::now() - blasStartTime)
+                                            .count();
+
+        for (auto&& built : builtBLAS) {
+            blasCache.store(
+                built.name, built.key, built.blas->getSerializedData(), built.metadata);
         }
-        mCrate
-            = createModel(ModelType::Crate, Vec3(0, 0, -100), Quaternion::IDENTITY, Vec3(1, 1, 1));
+        UINT64 blasBytes = 0;
+        UINT triangleCount = 0;
+        for (auto&& blas : mBLASBuffers) {
+            blas->releaseBuildResources();
+            blasBytes += blas->getSize();
+            triangleCount += blas->getTriangleCount();
+        }
+        MY_DEBUG_LOG("BLAS total: %llu bytes, %u triangles\n", blasBytes, triangleCount);
+        MY_DEBUG_LOG("BLAS setup: %u cached, %u built, %.3f ms (including model loading)\n",
+            cachedCount, static_cast<UINT>(builtBLAS.size()), blasMilliseconds);
+
+        //ŏ͍łׂbVŒuAt[̑IŐ؂ւ
+        const SceneInstanceRecord* sceneInstances = sceneFile.getInstances();
+        std::vector<InstanceCreateDesc> instances(sceneFile.getInstanceCount());
+        for (UINT i = 0; i < sceneFile.getInstanceCount(); i++) {
+            const Model& model = mLoadedModels[sceneInstances[i].model];
+            const BoundingBox& bounds = model.mLocalBounds;
+            InstanceCreateDesc& desc = instances[i];
+            SceneFile::decodeTransform(
+                sceneInstances[i].transform, &desc.position, &desc.rotation, &desc.scale);
+            desc.localBounds.center = Vec3(bounds.Center.x, bounds.Center.y, bounds.Center.z);
+            desc.localBounds.extents = Vec3(bounds.Extents.x, bounds.Extents.y, bounds.Extents.z);
+            desc.geometry = model.mLods[0].geometry;
+            desc.hitGroupIndex = model.mLods[0].hitGroupIndex;
+            desc.lodGroup = model.mLodGroup;
+        }
+        std::vector<InstanceHandle> handles(instances.size());
+        mInstances.clear();
+        mInstances.createBulk(
+            instances.data(), static_cast<UINT>(instances.size()), handles.data());
+
+        //O[v͐eKOɂ̂ŁA擪珇Ƀm[h
+        mSceneGraph.clear();
+        const SceneGroupRecord* sceneGroups = sceneFile.getGroups();
+        std::vector<UINT> groupNodes(sceneFile.getGroupCount());
+        auto parentNode = [&](UINT parent) {
+            return parent == SceneFile::NO_PARENT ? SceneGraph::INVALID_NODE : groupNodes[parent];
+        };
+        for (UINT i = 0; i < sceneFile.getGroupCount(); i++) {
+            Vec3 position, scale;
+            Quaternion rotation;
+            SceneFile::decodeTransform(sceneGroups[i].transform, &position, &rotation, &scale);
+            groupNodes[i] = mSceneGraph.createNode(
+                parentNode(sceneGroups[i].parent), position, rotation, scale);
+        }
+        for (size_t i = 0; i < instances.size(); i++) {
+            const InstanceCreateDesc& desc = instances[i];
+            mSceneGraph.createNode(parentNode(sceneInstances[i].parent), desc.position,
+                desc.rotation, desc.scale, handles[i]);
+        }
+        mSpinNode = parentNode(sceneFile.findGroup(SPIN_GROUP_NAME));
     }
 
     {
@@ -563,8 +788,11 @@ void Scene::createDeviceDependentResources() {
         }
 
         for (auto&& hitGroup : HIT_GROUP_LIST) {
-            mDXRStateObject->bindHitGroup({ hitGroup.hitGroupName,
-                D3D12_HIT_GROUP_TYPE::D3D12_HIT_GROUP_TYPE_TRIANGLES, hitGroup.closestHitNames });
+            const D3D12_HIT_GROUP_TYPE type = hitGroup.intersectionName.empty()
+                ? D3D12_HIT_GROUP_TYPE::D3D12_HIT_GROUP_TYPE_TRIANGLES
+                : D3D12_HIT_GROUP_TYPE::D3D12_HIT_GROUP_TYPE_PROCEDURAL_PRIMITIVE;
+            mDXRStateObject->bindHitGroup({ hitGroup.hitGroupName, type,
+                hitGroup.closestHitNames, L"", hitGroup.intersectionName });
         }
 
         for (auto&& table : SHADER_TABLE_INFO) {
@@ -584,8 +812,9 @@ void Scene::createDeviceDependentResources() {
         //̑VF[_[̐ݒ
         UINT payloadSize
             = Framework::Math::MathUtil::mymax<UINT>({ sizeof(RayPayload), sizeof(ShadowPayload) });
-        UINT attrSize = sizeof(float) * 2;
-        UINT maxRecursionDepth = MAX_RAY_RECURSION_DEPTH;
+        UINT attrSize = Framework::Math::MathUtil::mymax<UINT>(
+            { sizeof(float) * 2, sizeof(SphereAttributes) });
+        UINT maxRecursionDepth = MAX_TRACE_RECURSION_DEPTH;
         mDXRStateObject->setConfig(payloadSize, attrSize, maxRecursionDepth);
 
         mDXRStateObject->bindLocalRootSignature(*mMissLocalRootSignature, L"Miss");
@@ -611,32 +840,31 @@ void Scene::createDeviceDependentResources() {
         }
         {
             struct RootArgument {
-                D3D12_GPU_DESCRIPTOR_HANDLE albedo;
-                D3D12_GPU_DESCRIPTOR_HANDLE normal;
-                D3D12_GPU_DESCRIPTOR_HANDLE metallicRoughness;
-                D3D12_GPU_DESCRIPTOR_HANDLE emissive;
-                D3D12_GPU_DESCRIPTOR_HANDLE occlusion;
                 HitGroupConstant cb;
             };
 
-            mDXRStateObject->setShaderTableConfig(ShaderType::HitGroup, ShaderKey::HITGROUP_NUM,
-                sizeof(RootArgument), L"HitGroupShaderTable");
-
-            auto setRootArgument = [&](const Model& model) {
-                RootArgument arg;
-                arg.cb.indexOffset = model.mIndexOffset;
-                arg.cb.vertexOffset = model.mVertexOffset;
-                arg.albedo = model.mAlbedo.getView().getInfo().gpuHandle;
-                arg.normal = model.mNormalMap.getView().getInfo().gpuHandle;
-                arg.metallicRoughness = model.mMetallicRoughness.getView().getInfo().gpuHandle;
-                arg.emissive = model.mEmissiveMap.getView().getInfo().gpuHandle;
-                arg.occlusion = model.mOcclusionMap.getView().getInfo().gpuHandle;
-                return arg;
-            };
+            //ڍדxƂɎQƂ͈͂Ⴄ̂ŁACX^X̃qbgO[v̔ԍ̏ɕׂ
+            const UINT hitGroupCount = static_cast<UINT>(mBLASBuffers.size());
+            mDXRStateObject->setShaderTableConfig(
+                ShaderType::HitGroup, hitGroupCount, sizeof(RootArgument), L"HitGroupShaderTable");
 
+            std::vector<std::pair<UINT, RootArgument>> records(hitGroupCount);
             for (auto&& model : mLoadedModels) {
-                mDXRStateObject->appendShaderTable(
-                    model.second.mShaderKey, &setRootArgument(model.second));
+                for (auto&& lod : model.mLods) {
+                    RootArgument& arg = records[lod.hitGroupIndex].second;
+                    arg.cb = {};
+                    //vV[WȃWIg͒_QƂȂ
+                    if (!mBLASBuffers[lod.geometry]->isProcedural()) {
+                        const GeometryRange& range = mGeometryArena.getRange(lod.mesh);
+                        arg.cb.indexOffset = range.indexOffset;
+                        arg.cb.vertexOffset = range.vertexOffset;
+                    }
+                    arg.cb.materialIndex = model.mModelID;
+                    records[lod.hitGroupIndex].first = model.mShaderKey;
+                }
+            }
+            for (auto&& record : records) {
+                mDXRStateObject->appendShaderTable(record.first, &record.second);
             }
 
             mDXRStateObject->buildShaderTable();
@@ -7,6 +7,7 @@
 #include "DX/Raytracing/DXRPipelineStateObject.h"
 #include "DX/Raytracing/TopLevelAccelerationStructure.h"
 #include "DX/Resource/ConstantBuffer.h"
+#include "DX/Resource/GeometryArena.h"
 #include "DX/Resource/IndexBuffer.h"
 #include "DX/Resource/ShaderResourceView.h"
 #include "DX/Resource/Texture2D.h"
@@ -16,7 +17,13 @@
 #include "Define.h"
 #include "Device/ISystemEventNotify.h"
 #include "Input/InputManager.h"
+#include "Model.h"
 #include "Utility/GPUTimer.h"
+#include "Utility/Scene/InstanceCuller.h"
+#include "Utility/Scene/InstanceStore.h"
+#include "Utility/Scene/LodSelector.h"
+#include "Utility/Scene/SceneGraph.h"
+#include "Utility/Thread/WorkerPool.h"
 #include "Utility/Time.h"
 
 namespace DescriptorIndex {
@@ -27,19 +34,6 @@ namespace DescriptorIndex {
     };
 }
 
-namespace ModelType {
-    enum Enum {
-        UFO,
-        Floor,
-        Sphere,
-        House,
-        Tree,
-        Crate,
-
-        Count,
-    };
-}
-
 class Scene {
 public:
     Scene(Framework::DX::DeviceResource* device, Framework::Input::InputManager* inputManager,
@@ -61,25 +55,37 @@ private:
     Framework::DX::DeviceResource* mDeviceResource;
     Framework::Input::InputManager* mInputManager;
     Framework::DX::DXRDevice mDXRDevice;
-    std::unordered_map<ModelType::Enum,
-        std::unique_ptr<Framework::DX::BottomLevelAccelerationStructure>>
-        mBLASBuffers;
+    //! WIg̔ԍňBLAS f̏ڍדxƂɈ
+    std::vector<std::unique_ptr<Framework::DX::BottomLevelAccelerationStructure>> mBLASBuffers;
     std::unique_ptr<Framework::DX::TopLevelAccelerationStructure> mTLASBuffer;
     Framework::DX::ConstantBuffer<SceneConstantBuffer> mSceneCB;
+    Framework::Utility::WorkerPool mWorkers; //!< CPU̕񏈗ɎgXbh
 
 private:
     std::unique_ptr<Framework::DX::RootSignature> mGlobalRootSignature;
     std::unique_ptr<Framework::DX::RootSignature> mMissLocalRootSignature;
     std::unique_ptr<Framework::DX::RootSignature> mHitGroupLocalRootSignature;
-    Framework::DX::IndexBuffer mResourcesIndexBuffer;
-    Framework::DX::ShaderResourceView mResourceIndexBufferSRV;
-    Framework::DX::VertexBuffer mResourcesVertexBuffer;
-    Framework::DX::ShaderResourceView mResourceVertexBufferSRV;
+    Framework::DX::GeometryArena mGeometryArena; //!< Sf̒_ƃCfbNX
+    Framework::DX::Buffer mMaterialBuffer; //!< fIDň}eAz
+    Framework::DX::ShaderResourceView mMaterialBufferSRV;
     Framework::DX::Buffer mRaytracingOutput;
     Framework::DX::UnorderedAccessView mRaytracingOutputUAV;
 
     std::unique_ptr<Framework::DX::DXRPipelineStateObject> mDXRStateObject;
 
+private:
+    std::vector<Model> mLoadedModels; //!< V[t@CŒ`ɕׂf
+    Framework::Utility::InstanceStore mInstances; //!< V[ɔzuCX^X
+    Framework::Utility::SceneGraph mSceneGraph; //!< CX^X̐eq֌W
+    UINT mSpinNode; //!< t[]O[v
+    float mSpinAngle; //!< O[vY̊px x
+    Framework::Utility::InstanceCuller mCuller; //!< TLASɓCX^X߂
+    float mCullDistance; //!< ʓł艓̂͊O
+    float mRelevanceDistance; //!< e┽˂Ɏʂ̂ŉʊOłc
+    Framework::Utility::LodSelector mLodSelector; //!< CX^XƂɏڍדxI
+    float mLodPixelError; //!< ڍדxĂeʏł̌덷
+    std::vector<D3D12_GPU_VIRTUAL_ADDRESS> mBLASAddresses; //!< WIg̔ԍňBLAS̃AhX
+
 private:
     UINT mWidth;
     UINT mHeight;
@@ -0,0 +1,40 @@
+/**
+ * @file BitScan.h
+ * @brief Ărbg̈ʒu߂
+ * @details MSVCł͑gݍ݊֐AȊÕRpCł__builting
+ */
+
+#pragma once
+#include "Utility/Platform.h"
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Framework::Utility {
+    /**
+     * @brief Ăŉʃrbg̈ʒu߂
+     * @param value 0ȊO̒l
+     */
+    inline UINT findFirstSetBit(UINT64 value) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return static_cast<UINT>(index);
+#else
+        return static_cast<UINT>(__builtin_ctzll(value));
+#endif
+    }
+    /**
+     * @brief Ăŏʃrbg̈ʒu߂
+     * @param value 0ȊO̒l
+     */
+    inline UINT findLastSetBit(UINT64 value) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return static_cast<UINT>(index);
+#else
+        return static_cast<UINT>(63 - __builtin_clzll(value));
+#endif
+    }
+} // namespace Framework::Utility
@@ -0,0 +1,232 @@
+#include "ResourceStateTracker.h"
+
+namespace Framework::Utility {
+    //RXgN^
+    ResourceStateRegistry::ResourceStateRegistry() {}
+    //fXgN^
+    ResourceStateRegistry::~ResourceStateRegistry() {}
+    //\[Xo^
+    void ResourceStateRegistry::registerResource(const void* resource, UINT state) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStates[resource] = state;
+    }
+    //o^
+    void ResourceStateRegistry::unregisterResource(const void* resource) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStates.erase(resource);
+    }
+    //Ԃ擾
+    bool ResourceStateRegistry::tryGetState(const void* resource, UINT* state) const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = mStates.find(resource);
+        if (it == mStates.end()) return false;
+        *state = it->second;
+        return true;
+    }
+    //Ԃݒ肷
+    void ResourceStateRegistry::setState(const void* resource, UINT state) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStates[resource] = state;
+    }
+    //ׂĂ̓o^
+    void ResourceStateRegistry::clear() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStates.clear();
+    }
+    //o^擾
+    size_t ResourceStateRegistry::getCount() const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mStates.size();
+    }
+
+    //RXgN^
+    ResourceStateTracker::ResourceStateTracker(UINT readOnlyMask) : mReadOnlyMask(readOnlyMask) {}
+    //fXgN^
+    ResourceStateTracker::~ResourceStateTracker() {}
+    //Ԃڍs
+    void ResourceStateTracker::transition(const void* resource, UINT after) {
+        mStats.requestCount++;
+        auto it = mEntries.find(resource);
+        if (it == mEntries.end()) {
+            //ڍsȌԂ͒oɌ܂̂ŁAKvȏԂo
+            Entry entry;
+            entry.firstState = after;
+            entry.state = after;
+            mEntries.emplace(resource, entry);
+            return;
+        }
+
+        Entry& entry = it->second;
+        if (entry.splitOpen) {
+            const bool sameTarget = entry.splitState == after;
+            endSplitTransition(resource);
+            if (sameTarget) return;
+        }
+        if (entry.state == after) {
+            mStats.redundantCount++;
+            return;
+        }
+        if (isReadOnly(entry.state) && isReadOnly(after)) {
+            if ((entry.state & after) == after) {
+                mStats.redundantCount++;
+                return;
+            }
+            //܂oAςłȂ΁AŏɕKvȏԂL邾ōς
+            if (!entry.hasBarrier) {
+                entry.firstState |= after;
+                entry.state = entry.firstState;
+                mStats.mergedCount++;
+                return;
+            }
+            after |= entry.state;
+        }
+        pushTransition(&entry, resource, after);
+    }
+    //oAňڍsJn
+    void ResourceStateTracker::beginSplitTransition(const void* resource, UINT after) {
+        auto it = mEntries.find(resource);
+        if (it == mEntries.end()) {
+            transition(resource, after);
+            return;
+        }
+
+        mStats.requestCount++;
+        Entry& entry = it->second;
+        if (entry.splitOpen) endSplitTransition(resource);
+        if (entry.state == after) {
+            mStats.redundantCount++;
+            return;
+        }
+        ResourceBarrierDesc barrier;
+        barrier.split = ResourceBarrierDesc::Split::Begin;
+        barrier.resource = resource;
+        barrier.before = entry.state;
+        barrier.after = after;
+        mPending.emplace_back(barrier);
+        //JnƊ̊ԂɈڍs܂Ȃ悤Aȍ~̈ڍs͂܂Ƃ߂Ȃ
+        entry.pendingIndex = NO_PENDING;
+        entry.splitState = after;
+        entry.splitOpen = true;
+        entry.hasBarrier = true;
+    }
+    //oÄڍs
+    void ResourceStateTracker::endSplitTransition(const void* resource) {
+        auto it = mEntries.find(resource);
+        MY_ASSERTION(it != mEntries.end() && it->second.splitOpen,
+            "JnĂȂoA悤Ƃ܂");
+
+        Entry& entry = it->second;
+        ResourceBarrierDesc barrier;
+        barrier.split = ResourceBarrierDesc::Split::End;
+        barrier.resource = resource;
+        barrier.before = entry.state;
+        barrier.after = entry.splitState;
+        mPending.emplace_back(barrier);
+        entry.state = entry.splitState;
+        entry.pendingIndex = NO_PENDING;
+        entry.splitOpen = false;
+    }
+    //UAV̏݊҂
+    void ResourceStateTracker::uavBarrier(const void* resource) {
+        if (!mPending.empty()) {
+            const ResourceBarrierDesc& last = mPending.back();
+            if (last.type == ResourceBarrierDesc::Type::UnorderedAccess
+                && last.resource == resource) {
+                mStats.redundantCount++;
+                return;
+            }
+        }
+        ResourceBarrierDesc barrier;
+        barrier.type = ResourceBarrierDesc::Type::UnorderedAccess;
+        barrier.resource = resource;
+        mPending.emplace_back(barrier);
+
+        //UAVoA܂ňڍs܂Ƃ߂Əւ
+        auto it = mEntries.find(resource);
+        if (it != mEntries.end()) {
+            it->second.pendingIndex = NO_PENDING;
+            it->second.hasBarrier = true;
+        }
+    }
+    //߂oA𔭍s
+    void ResourceStateTracker::flush(IResourceBarrierSink* sink) {
+        if (mPending.empty()) return;
+
+        mSubmit.clear();
+        for (auto&& barrier : mPending) {
+            //܂Ƃ߂ʌ̏Ԃɖ߂͔̂sȂ
+            if (barrier.type == ResourceBarrierDesc::Type::Transition
+                && barrier.split == ResourceBarrierDesc::Split::None
+                && barrier.before == barrier.after) {
+                continue;
+            }
+            mSubmit.emplace_back(barrier);
+        }
+        for (auto&& barrier : mPending) {
+            auto it = mEntries.find(barrier.resource);
+            if (it != mEntries.end()) it->second.pendingIndex = NO_PENDING;
+        }
+        mPending.clear();
+        if (mSubmit.empty()) return;
+
+        sink->submitBarriers(mSubmit.data(), static_cast<UINT>(mSubmit.size()));
+        mStats.flushCount++;
+        mStats.barrierCount += static_cast<UINT>(mSubmit.size());
+    }
+    //oɏԂ˂킹
+    void ResourceStateTracker::resolve(
+        ResourceStateRegistry* registry, std::vector<ResourceBarrierDesc>* fixups) {
+        MY_ASSERTION(mPending.empty(), "sĂȂoAcĂ܂");
+        for (auto&& it : mEntries) {
+            const Entry& entry = it.second;
+            MY_ASSERTION(!entry.splitOpen, "ĂȂoAcĂ܂");
+
+            //o^ĂȂ\[X͍ŏɕKvȏԂɂ̂Ƃ݂Ȃ
+            UINT prevState;
+            if (registry->tryGetState(it.first, &prevState) && prevState != entry.firstState) {
+                ResourceBarrierDesc barrier;
+                barrier.resource = it.first;
+                barrier.before = prevState;
+                barrier.after = entry.firstState;
+                fixups->emplace_back(barrier);
+                mStats.resolveCount++;
+            }
+            registry->setState(it.first, entry.state);
+        }
+        mEntries.clear();
+    }
+    //ǐՒ̏Ԃj
+    void ResourceStateTracker::reset() {
+        mEntries.clear();
+        mPending.clear();
+    }
+    //̃Xgł̏Ԃ擾
+    bool ResourceStateTracker::tryGetState(const void* resource, UINT* state) const {
+        auto it = mEntries.find(resource);
+        if (it == mEntries.end()) return false;
+        *state = it->second.state;
+        return true;
+    }
+    //s̃oA擾
+    UINT ResourceStateTracker::getPendingCount() const {
+        return static_cast<UINT>(mPending.size());
+    }
+    //ڍsoA𗭂߂
+    void ResourceStateTracker::pushTransition(Entry* entry, const void* resource, UINT after) {
+        //s̈ڍs΂̈ڍs
+        if (entry->pendingIndex != NO_PENDING) {
+            mPending[entry->pendingIndex].after = after;
+            entry->state = after;
+            mStats.mergedCount++;
+            return;
+        }
+        ResourceBarrierDesc barrier;
+        barrier.resource = resource;
+        barrier.before = entry->state;
+        barrier.after = after;
+        entry->pendingIndex = static_cast<UINT>(mPending.size());
+        mPending.emplace_back(barrier);
+        entry->state = after;
+        entry->hasBarrier = true;
+    }
+} // namespace Framework::Utility
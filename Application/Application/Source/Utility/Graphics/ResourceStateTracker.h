@@ -0,0 +1,225 @@
+/**
+ * @file ResourceStateTracker.h
+ * @brief \[X̏Ԃ̒ǐՂƃoÂ܂Ƃߔs
+ * @details OtBbNXAPIɂ͈ˑA\[X̓|C^AԂ̓rbgtOƂĈ
+ */
+
+#pragma once
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Framework::Utility {
+    /**
+     * @struct ResourceBarrierDesc
+     * @brief APIɈˑȂoA̋Lq
+     */
+    struct ResourceBarrierDesc {
+        /**
+         * @enum Type
+         * @brief oA̎
+         */
+        enum class Type {
+            Transition, //!< Ԃ̈ڍs
+            UnorderedAccess, //!< UAV̏݊҂
+        };
+        /**
+         * @enum Split
+         * @brief oA̋敪
+         */
+        enum class Split {
+            None, //!< Ȃ
+            Begin, //!< ڍs̊Jn
+            End, //!< ڍs̊
+        };
+        Type type = Type::Transition; //!< oA̎
+        Split split = Split::None; //!< oA̋敪
+        const void* resource = nullptr; //!< Ώۂ̃\[X
+        UINT before = 0; //!< ڍsȌ
+        UINT after = 0; //!< ڍs̏
+    };
+
+    /**
+     * @class IResourceBarrierSink
+     * @brief ܂Ƃ߂oA̔s
+     */
+    class IResourceBarrierSink {
+    public:
+        /**
+         * @brief fXgN^
+         */
+        virtual ~IResourceBarrierSink() = default;
+        /**
+         * @brief oAxɔs
+         */
+        virtual void submitBarriers(const ResourceBarrierDesc* barriers, UINT count) = 0;
+    };
+
+    /**
+     * @class ResourceStateRegistry
+     * @brief R}hXg܂\[X̏
+     * @details L[ɒoɊeXg̍ŏIԂ XbhoĂ悢
+     */
+    class ResourceStateRegistry {
+    public:
+        /**
+         * @brief RXgN^
+         */
+        ResourceStateRegistry();
+        /**
+         * @brief fXgN^
+         */
+        ~ResourceStateRegistry();
+        /**
+         * @brief \[X쐬̏Ԃœo^
+         * @details AhXėpꂽꍇ͏㏑
+         */
+        void registerResource(const void* resource, UINT state);
+        /**
+         * @brief \[X̓o^
+         */
+        void unregisterResource(const void* resource);
+        /**
+         * @brief \[X̏Ԃ擾
+         * @return o^ĂȂfalseԂ
+         */
+        bool tryGetState(const void* resource, UINT* state) const;
+        /**
+         * @brief \[X̏Ԃݒ肷
+         */
+        void setState(const void* resource, UINT state);
+        /**
+         * @brief ׂĂ̓o^
+         */
+        void clear();
+        /**
+         * @brief o^擾
+         */
+        size_t getCount() const;
+
+    private:
+        mutable std::mutex mMutex; //!< Ԃ̔r
+        std::unordered_map<const void*, UINT> mStates; //!< \[XƂ̏
+    };
+
+    /**
+     * @class ResourceStateTracker
+     * @brief R}hXgPʂŃ\[X̏ԂǐՂAoA܂Ƃ߂Ĕs
+     * @details vꂽڍs͂ɂ͔sAflushł܂Ƃ߂Ĕs
+     * s̈ڍs͎̈ڍsƂ܂Ƃ߂̂ŁA\[XgR}h̑Oɂ͕Kflush邱
+     * XgōŏɎg\[X͈ڍsȌԂȂ̂ŁAKvȏԂoĂ
+     * oresolveœo^ς݂̏ԂƓ˂킹ĕ␳p̃oA
+     */
+    class ResourceStateTracker {
+    public:
+        /**
+         * @struct Stats
+         * @brief v
+         */
+        struct Stats {
+            UINT requestCount = 0; //!< ڍs̗v
+            UINT redundantCount = 0; //!< ɂ̏Ԃ̂ŏȂ
+            UINT mergedCount = 0; //!< s̃oAɂ܂Ƃ߂
+            UINT barrierCount = 0; //!< soA
+            UINT flushCount = 0; //!< sĂ񂾉
+            UINT resolveCount = 0; //!< oɕ␳oA
+        };
+
+    public:
+        /**
+         * @brief RXgN^
+         * @param readOnlyMask ǂݎp̏Ԃ̃rbg ɐĂ悢ԂƂĈ
+         */
+        explicit ResourceStateTracker(UINT readOnlyMask = 0);
+        /**
+         * @brief fXgN^
+         */
+        ~ResourceStateTracker();
+        /**
+         * @brief Ԃڍs
+         * @details ɂ̏ԂȂ牽Ȃ ǂݎpmȂԂ
+         */
+        void transition(const void* resource, UINT after);
+        /**
+         * @brief oAŏԂ̈ڍsJn
+         * @details ܂Ń\[X͎gȂ ڍsȌԂȂΒʏ̈ڍsɂ
+         */
+        void beginSplitTransition(const void* resource, UINT after);
+        /**
+         * @brief oÄڍs
+         */
+        void endSplitTransition(const void* resource);
+        /**
+         * @brief UAV̏݊҂
+         */
+        void uavBarrier(const void* resource);
+        /**
+         * @brief ߂oAxɔs
+         */
+        void flush(IResourceBarrierSink* sink);
+        /**
+         * @brief oɃXgȌԂƓ˂킹
+         * @param registry R}hXg܂ e\[X̍ŏIԂ
+         * @param fixups ̃XgOɎsׂoA̒ǉ
+         * @details Ăяo͒ǐՂĂԂj s̃oA▢̕oA͎cȂ
+         */
+        void resolve(ResourceStateRegistry* registry, std::vector<ResourceBarrierDesc>* fixups);
+        /**
+         * @brief ǐՒ̏Ԃj
+         */
+        void reset();
+        /**
+         * @brief ̃Xgł݂̌̏Ԃ擾
+         * @return ̃XgŎgĂȂfalseԂ
+         */
+        bool tryGetState(const void* resource, UINT* state) const;
+        /**
+         * @brief s̃oA擾
+         */
+        UINT getPendingCount() const;
+        /**
+         * @brief v擾
+         */
+        const Stats& getStats() const {
+            return mStats;
+        }
+        /**
+         * @brief vZbg
+         */
+        void resetStats() {
+            mStats = Stats();
+        }
+
+    private:
+        static constexpr UINT NO_PENDING = UINT_MAX; //!< s̃oAȂ
+        /**
+         * @struct Entry
+         * @brief \[XƂ̒ǐՏ
+         */
+        struct Entry {
+            UINT firstState = 0; //!< XgōŏɕKvƂ
+            UINT state = 0; //!< ߂oA𔭍s̏
+            UINT splitState = 0; //!< oÄڍs
+            UINT pendingIndex = NO_PENDING; //!< s̈ڍsoÄʒu
+            bool hasBarrier = false; //!< ̃XgŃoAς񂾂
+            bool splitOpen = false; //!< oA
+        };
+        /**
+         * @brief ǂݎp̏Ԃ
+         */
+        bool isReadOnly(UINT state) const {
+            return state != 0 && (state & ~mReadOnlyMask) == 0;
+        }
+        /**
+         * @brief ڍsoA𗭂߂
+         */
+        void pushTransition(Entry* entry, const void* resource, UINT after);
+
+    private:
+        UINT mReadOnlyMask; //!< ǂݎp̏Ԃ̃rbg
+        std::unordered_map<const void*, Entry> mEntries; //!< \[XƂ̒ǐՏ
+        std::vector<ResourceBarrierDesc> mPending; //!< s̃oA
+        std::vector<ResourceBarrierDesc> mSubmit; //!< sp̍Ɨ̈
+        Stats mStats; //!< v
+    };
+} // namespace Framework::Utility
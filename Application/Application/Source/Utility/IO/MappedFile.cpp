@@ -0,0 +1,88 @@
+#include "MappedFile.h"
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Framework::Utility {
+#ifdef _WIN32
+    //RXgN^
+    MappedFile::MappedFile()
+        : mFile(INVALID_HANDLE_VALUE), mMapping(nullptr), mData(nullptr), mSize(0) {}
+#else
+    //RXgN^
+    MappedFile::MappedFile() : mData(nullptr), mSize(0) {}
+#endif
+    //fXgN^
+    MappedFile::~MappedFile() {
+        close();
+    }
+#ifdef _WIN32
+    //t@CJ
+    bool MappedFile::open(const std::filesystem::path& path) {
+        close();
+        mFile = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (mFile == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER size;
+        //̃t@C̓}bvłȂ
+        if (!GetFileSizeEx(mFile, &size) || size.QuadPart == 0) {
+            close();
+            return false;
+        }
+        mMapping = CreateFileMappingW(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mMapping) {
+            close();
+            return false;
+        }
+        mData = static_cast<const BYTE*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+        if (!mData) {
+            close();
+            return false;
+        }
+        mSize = static_cast<UINT64>(size.QuadPart);
+        return true;
+    }
+    //t@C
+    void MappedFile::close() {
+        if (mData) { UnmapViewOfFile(mData); }
+        if (mMapping) { CloseHandle(mMapping); }
+        if (mFile != INVALID_HANDLE_VALUE) { CloseHandle(mFile); }
+        mFile = INVALID_HANDLE_VALUE;
+        mMapping = nullptr;
+        mData = nullptr;
+        mSize = 0;
+    }
+#else
+    //t@CJ
+    bool MappedFile::open(const std::filesystem::path& path) {
+        close();
+        const int file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0) return false;
+
+        //̃t@C̓}bvłȂ
+        struct stat status;
+        if (fstat(file, &status) != 0 || status.st_size == 0) {
+            ::close(file);
+            return false;
+        }
+        void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE,
+            file, 0);
+        //}bv̓t@CĂ悢
+        ::close(file);
+        if (data == MAP_FAILED) return false;
+        mData = static_cast<const BYTE*>(data);
+        mSize = static_cast<UINT64>(status.st_size);
+        return true;
+    }
+    //t@C
+    void MappedFile::close() {
+        if (mData) { munmap(const_cast<BYTE*>(mData), static_cast<size_t>(mSize)); }
+        mData = nullptr;
+        mSize = 0;
+    }
+#endif
+} // namespace Framework::Utility
@@ -0,0 +1,66 @@
+/**
+ * @file MappedFile.h
+ * @brief }bvgt@C
+ */
+
+#pragma once
+#include <filesystem>
+#include "Utility/Platform.h"
+
+namespace Framework::Utility {
+    /**
+     * @class MappedFile
+     * @brief t@CǂݍݐpŃɃ}bv
+     * @details Rs[Ƀt@C̓ê܂܎QƂł
+     * WindowsȊOłmmapŃ}bv
+     */
+    class MappedFile {
+    public:
+        /**
+         * @brief RXgN^
+         */
+        MappedFile();
+        /**
+         * @brief fXgN^
+         */
+        ~MappedFile();
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        /**
+         * @brief t@CJ
+         * @param path t@CpX
+         * @return JtrueԂ
+         */
+        bool open(const std::filesystem::path& path);
+        /**
+         * @brief t@C
+         */
+        void close();
+        /**
+         * @brief 擪AhX擾
+         */
+        const BYTE* data() const {
+            return mData;
+        }
+        /**
+         * @brief t@C̃oCgTCY擾
+         */
+        UINT64 size() const {
+            return mSize;
+        }
+        /**
+         * @brief JĂ邩
+         */
+        bool isOpen() const {
+            return mData != nullptr;
+        }
+
+    private:
+#ifdef _WIN32
+        HANDLE mFile; //!< t@Cnh
+        HANDLE mMapping; //!< }bsOnh
+#endif
+        const BYTE* mData; //!< 擪AhX
+        UINT64 mSize; //!< oCgTCY
+    };
+} // namespace Framework::Utility
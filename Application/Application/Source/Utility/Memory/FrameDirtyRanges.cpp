@@ -0,0 +1,97 @@
+#include "FrameDirtyRanges.h"
+#include <algorithm>
+#include "Utility/BitScan.h"
+
+namespace {
+    //rbg̃[h߂
+    inline size_t wordCount(size_t count) {
+        return (count + 63) / 64;
+    }
+    //ʂbit̃rbg}XN
+    inline UINT64 lowMask(UINT bit) {
+        return bit >= 64 ? ~0ull : (1ull << bit) - 1;
+    }
+} // namespace
+
+namespace Framework::Utility {
+    //RXgN^
+    FrameDirtyRanges::FrameDirtyRanges() : mCount(0), mMergeGap(DEFAULT_MERGE_GAP) {}
+    //fXgN^
+    FrameDirtyRanges::~FrameDirtyRanges() {}
+    //
+    void FrameDirtyRanges::init(UINT frameCount, UINT mergeGap) {
+        MY_ASSERTION(frameCount > 0, "ʂ̐0ł");
+        mFrameBits.assign(frameCount, std::vector<UINT64>());
+        mCount = 0;
+        mMergeGap = mergeGap;
+    }
+    //vfς
+    void FrameDirtyRanges::resize(UINT count) {
+        if (count == mCount) return;
+        const size_t words = wordCount(count);
+        for (auto&& bits : mFrameBits) {
+            if (count > mCount) {
+                bits.resize(words, ~0ull);
+                //ƂƓr܂ł[h̎cXVKvɂ
+                if (mCount & 63) bits[mCount >> 6] |= ~lowMask(mCount & 63);
+            } else {
+                bits.resize(words);
+            }
+            //̃[h͈̔͊O͗ĂȂł
+            if (count & 63) bits[words - 1] &= lowMask(count & 63);
+        }
+        mCount = count;
+    }
+    //ׂĂ̗vfXVKvɂ
+    void FrameDirtyRanges::markAllDirty() {
+        for (auto&& bits : mFrameBits) {
+            std::fill(bits.begin(), bits.end(), ~0ull);
+            if (mCount & 63) bits.back() &= lowMask(mCount & 63);
+        }
+    }
+    //vfXVKvɂ
+    void FrameDirtyRanges::markDirty(UINT index) {
+        MY_ASSERTION(index < mCount, "͈͊O̗vfł");
+        for (auto&& bits : mFrameBits) { bits[index >> 6] |= 1ull << (index & 63); }
+    }
+    //rbgŎꂽvfXVKvɂ
+    void FrameDirtyRanges::markDirty(const std::vector<UINT64>& source) {
+        for (auto&& bits : mFrameBits) {
+            const size_t words = Math::MathUtil::mymin(bits.size(), source.size());
+            for (size_t i = 0; i < words; i++) { bits[i] |= source[i]; }
+            if (words == bits.size() && (mCount & 63)) bits.back() &= lowMask(mCount & 63);
+        }
+    }
+    //ʂ̍XVKvȔ͈͂o
+    UINT FrameDirtyRanges::collect(UINT frame, std::vector<DirtyRange>* ranges) {
+        MY_ASSERTION(frame < mFrameBits.size(), "͈͊O̎ʂł");
+        ranges->clear();
+        UINT total = 0;
+        std::vector<UINT64>& bits = mFrameBits[frame];
+        for (size_t word = 0; word < bits.size(); word++) {
+            UINT64 value = bits[word];
+            if (value == 0) continue;
+            bits[word] = 0;
+            const UINT base = static_cast<UINT>(word * 64);
+            while (value != 0) {
+                //ĂrbgԂxɎo
+                const UINT first = findFirstSetBit(value);
+                const UINT64 clear = ~value & ~lowMask(first);
+                const UINT last = clear != 0 ? findFirstSetBit(clear) : 64;
+                value &= ~lowMask(last);
+
+                const UINT begin = base + first;
+                const UINT end = base + last;
+                total += end - begin;
+                //Ԃ΂܂Ƃ߂ĈxɃRs[
+                if (!ranges->empty() && begin - ranges->back().end <= mMergeGap) {
+                    total += begin - ranges->back().end;
+                    ranges->back().end = end;
+                } else {
+                    ranges->push_back({ begin, end });
+                }
+            }
+        }
+        return total;
+    }
+} // namespace Framework::Utility
@@ -0,0 +1,87 @@
+/**
+ * @file FrameDirtyRanges.h
+ * @brief t[Ƃ̃Rs[̍XV͈͂̊Ǘ
+ * @details t[̎ʂobt@ŁAʂƂɏKv͈̂͂߂
+ */
+
+#pragma once
+#include <vector>
+
+namespace Framework::Utility {
+    /**
+     * @struct DirtyRange
+     * @brief XVKvȗvf͈̔ [begin,end)
+     */
+    struct DirtyRange {
+        UINT begin; //!< 擪
+        UINT end; //!< I[
+    };
+
+    /**
+     * @class FrameDirtyRanges
+     * @brief t[Ƃ̎ʂ̍XV͈
+     * @details ύXׂ͂Ă̎ʂɋL^AʂɏނƂɂ̎ʂ̕oď
+     */
+    class FrameDirtyRanges {
+    public:
+        static constexpr UINT DEFAULT_MERGE_GAP = 16; //!< ͈̔͂ɂ܂Ƃ߂Ԋu
+    public:
+        /**
+         * @brief RXgN^
+         */
+        FrameDirtyRanges();
+        /**
+         * @brief fXgN^
+         */
+        ~FrameDirtyRanges();
+        /**
+         * @brief 
+         * @param frameCount ʂ̐
+         * @param mergeGap ύX̂Ȃvf̐ȉȂO͈̔͂܂Ƃ߂
+         */
+        void init(UINT frameCount, UINT mergeGap = DEFAULT_MERGE_GAP);
+        /**
+         * @brief vfς
+         * @details vfׂ͂Ă̎ʂōXVKvɂȂ
+         */
+        void resize(UINT count);
+        /**
+         * @brief ׂĂ̗vfXVKvɂ
+         */
+        void markAllDirty();
+        /**
+         * @brief vfXVKvɂ
+         */
+        void markDirty(UINT index);
+        /**
+         * @brief rbgŎꂽvfXVKvɂ
+         * @param bits 64vfƂ1[h̃rbg
+         */
+        void markDirty(const std::vector<UINT64>& bits);
+        /**
+         * @brief ʂ̍XVKvȔ͈͂o
+         * @param frame ʂ̔ԍ
+         * @param ranges ͈͂̏ݐ 擪珇ɕ
+         * @return ͈͂Ɋ܂܂vf
+         * @details o͈͂͂̎ʂł͍XVς݂ɂȂ
+         */
+        UINT collect(UINT frame, std::vector<DirtyRange>* ranges);
+        /**
+         * @brief vf擾
+         */
+        UINT getCount() const {
+            return mCount;
+        }
+        /**
+         * @brief ʂ̐擾
+         */
+        UINT getFrameCount() const {
+            return static_cast<UINT>(mFrameBits.size());
+        }
+
+    private:
+        std::vector<std::vector<UINT64>> mFrameBits; //!< ʂƂ̍XVKvȗvf
+        UINT mCount; //!< vf
+        UINT mMergeGap; //!< O͈̔͂܂Ƃ߂Ԋu
+    };
+} // namespace Framework::Utility
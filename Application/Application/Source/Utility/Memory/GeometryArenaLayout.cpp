@@ -0,0 +1,89 @@
+#include "GeometryArenaLayout.h"
+
+namespace {
+    //TLSF͑傫̋敪؂グĒT̂ŁA̕]T
+    inline UINT64 withSlack(UINT capacity, UINT alignment) {
+        if (capacity == 0) return 0;
+        return static_cast<UINT64>(capacity) + capacity / 16 + alignment;
+    }
+} // namespace
+
+namespace Framework::Utility {
+    //RXgN^
+    GeometryArenaLayout::GeometryArenaLayout() : mIndexAlignment(1), mMeshCount(0) {}
+    //fXgN^
+    GeometryArenaLayout::~GeometryArenaLayout() {}
+    //
+    void GeometryArenaLayout::init(UINT vertexCapacity, UINT indexCapacity, UINT indexAlignment) {
+        MY_ASSERTION(indexAlignment > 0 && (indexAlignment & (indexAlignment - 1)) == 0,
+            "ACg2̗ݏł͂܂");
+        //0̗͍̈Ȃ̂ŋ̂܂܎c
+        mVertices = TlsfAllocator();
+        mIndices = TlsfAllocator();
+        if (vertexCapacity > 0) mVertices.init(withSlack(vertexCapacity, 1));
+        if (indexCapacity > 0) mIndices.init(withSlack(indexCapacity, indexAlignment));
+        mIndexAlignment = indexAlignment;
+        mMeshes.clear();
+        mFreeMeshes.clear();
+        mMeshCount = 0;
+    }
+    //ׂĂ͈̔͂
+    void GeometryArenaLayout::reset() {
+        if (mVertices.getCapacity() > 0) mVertices.reset();
+        if (mIndices.getCapacity() > 0) mIndices.reset();
+        mMeshes.clear();
+        mFreeMeshes.clear();
+        mMeshCount = 0;
+    }
+    //bV͈̔͂mۂ
+    UINT GeometryArenaLayout::allocate(UINT vertexCount, UINT indexCount) {
+        Mesh mesh;
+        //CfbNXȂbV̂ŁA0͈̔͂͊mۂȂ
+        if (vertexCount > 0) {
+            mesh.vertexAllocation = mVertices.allocate(vertexCount, 1);
+            if (!mesh.vertexAllocation.isValid()) return INVALID_MESH;
+        }
+        if (indexCount > 0) {
+            mesh.indexAllocation = mIndices.allocate(indexCount, mIndexAlignment);
+            if (!mesh.indexAllocation.isValid()) {
+                if (mesh.vertexAllocation.isValid()) mVertices.free(mesh.vertexAllocation);
+                return INVALID_MESH;
+            }
+        }
+        mesh.range.vertexOffset = mesh.vertexAllocation.isValid()
+            ? static_cast<UINT>(mesh.vertexAllocation.offset)
+            : 0;
+        mesh.range.vertexCount = vertexCount;
+        mesh.range.indexOffset
+            = mesh.indexAllocation.isValid() ? static_cast<UINT>(mesh.indexAllocation.offset) : 0;
+        mesh.range.indexCount = indexCount;
+        mesh.used = true;
+
+        UINT index;
+        if (mFreeMeshes.empty()) {
+            index = static_cast<UINT>(mMeshes.size());
+            mMeshes.emplace_back(mesh);
+        } else {
+            index = mFreeMeshes.back();
+            mFreeMeshes.pop_back();
+            mMeshes[index] = mesh;
+        }
+        mMeshCount++;
+        return index;
+    }
+    //bV͈̔͂
+    void GeometryArenaLayout::free(UINT mesh) {
+        MY_ASSERTION(isValid(mesh), "ȃbV悤Ƃ܂");
+        Mesh& target = mMeshes[mesh];
+        if (target.vertexAllocation.isValid()) mVertices.free(target.vertexAllocation);
+        if (target.indexAllocation.isValid()) mIndices.free(target.indexAllocation);
+        target = Mesh();
+        mFreeMeshes.emplace_back(mesh);
+        mMeshCount--;
+    }
+    //bV͈̔͂擾
+    const GeometryRange& GeometryArenaLayout::getRange(UINT mesh) const {
+        MY_ASSERTION(isValid(mesh), "ȃbVł");
+        return mMeshes[mesh].range;
+    }
+} // namespace Framework::Utility
@@ -0,0 +1,124 @@
+/**
+ * @file GeometryArenaLayout.h
+ * @brief WIgA[i̔zuǗ
+ * @details obt@ɂ͈ˑA_ƃCfbNX͈̔͂vfPʂŊǗ
+ */
+
+#pragma once
+#include "Utility/Memory/TlsfAllocator.h"
+
+namespace Framework::Utility {
+    /**
+     * @struct GeometryRange
+     * @brief bVg_ƃCfbNX͈̔
+     */
+    struct GeometryRange {
+        UINT vertexOffset = 0; //!< 擪̒_̈ʒu
+        UINT vertexCount = 0; //!< _
+        UINT indexOffset = 0; //!< 擪̃CfbNẌʒu
+        UINT indexCount = 0; //!< CfbNX
+    };
+
+    /**
+     * @class GeometryArenaLayout
+     * @brief _ƃCfbNXL̗̈悩؂o
+     * @details CfbNX̓bVƂ̒_ԍ̂܂܊i[AQƑŒ_̈ʒu𑫂
+     */
+    class GeometryArenaLayout {
+    public:
+        static constexpr UINT INVALID_MESH = UINT_MAX; //!< ȃbV̔ԍ
+    public:
+        /**
+         * @brief RXgN^
+         */
+        GeometryArenaLayout();
+        /**
+         * @brief fXgN^
+         */
+        ~GeometryArenaLayout();
+        /**
+         * @brief 
+         * @param vertexCapacity i[ł钸_
+         * @param indexCapacity i[łCfbNX
+         * @param indexAlignment CfbNX̐擪낦vf 2̗ݏł邱
+         * @details w肵̍v܂ł͕Kmۂł悤Ał͏傫
+         */
+        void init(UINT vertexCapacity, UINT indexCapacity, UINT indexAlignment = 1);
+        /**
+         * @brief ׂĂ͈̔͂
+         * @details i[ł鐔͕ςȂ
+         */
+        void reset();
+        /**
+         * @brief bV͈̔͂mۂ
+         * @return bV̔ԍ ܂ȂINVALID_MESHԂ
+         */
+        UINT allocate(UINT vertexCount, UINT indexCount);
+        /**
+         * @brief bV͈̔͂
+         * @details ԍ͎̊mۂōėp
+         */
+        void free(UINT mesh);
+        /**
+         * @brief LȃbV
+         */
+        bool isValid(UINT mesh) const {
+            return mesh < mMeshes.size() && mMeshes[mesh].used;
+        }
+        /**
+         * @brief bV͈̔͂擾
+         */
+        const GeometryRange& getRange(UINT mesh) const;
+        /**
+         * @brief i[ł钸_擾
+         */
+        UINT getVertexCapacity() const {
+            return static_cast<UINT>(mVertices.getCapacity());
+        }
+        /**
+         * @brief i[łCfbNX擾
+         */
+        UINT getIndexCapacity() const {
+            return static_cast<UINT>(mIndices.getCapacity());
+        }
+        /**
+         * @brief gp̒_擾
+         */
+        UINT getUsedVertexCount() const {
+            return static_cast<UINT>(mVertices.getUsedSize());
+        }
+        /**
+         * @brief gp̃CfbNX擾
+         * @details ACgŋ󂢂܂
+         */
+        UINT getUsedIndexCount() const {
+            return static_cast<UINT>(mIndices.getUsedSize());
+        }
+        /**
+         * @brief LȃbV擾
+         */
+        UINT getMeshCount() const {
+            return mMeshCount;
+        }
+
+    private:
+        /**
+         * @struct Mesh
+         * @brief bVƂ̊mۏ
+         */
+        struct Mesh {
+            GeometryRange range; //!< ͈
+            TlsfAllocator::Allocation vertexAllocation; //!< _̊mۏ
+            TlsfAllocator::Allocation indexAllocation; //!< CfbNX̊mۏ
+            bool used = false; //!< gp
+        };
+
+    private:
+        TlsfAllocator mVertices; //!< _̊蓖
+        TlsfAllocator mIndices; //!< CfbNX̊蓖
+        UINT mIndexAlignment; //!< CfbNX̐擪낦vf
+        std::vector<Mesh> mMeshes; //!< bVƂ̊mۏ
+        std::vector<UINT> mFreeMeshes; //!< ėpł郁bV̔ԍ
+        UINT mMeshCount; //!< LȃbV
+    };
+} // namespace Framework::Utility
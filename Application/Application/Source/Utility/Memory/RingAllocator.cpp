@@ -0,0 +1,58 @@
+#include "RingAllocator.h"
+
+namespace Framework::Utility {
+    //RXgN^
+    RingAllocator::RingAllocator()
+        : mCapacity(0), mHead(0), mUsedSize(0), mCurrentBatchSize(0) {}
+    //fXgN^
+    RingAllocator::~RingAllocator() {}
+    //
+    void RingAllocator::init(UINT64 capacity) {
+        mBatches.clear();
+        mCapacity = capacity;
+        mHead = 0;
+        mUsedSize = 0;
+        mCurrentBatchSize = 0;
+    }
+    //m
+    UINT64 RingAllocator::allocate(UINT64 size, UINT64 alignment) {
+        MY_ASSERTION(size > 0, "0oCg̊mۂ͂ł܂");
+        MY_ASSERTION(alignment > 0 && (alignment & (alignment - 1)) == 0,
+            "ACg2̗ݏł͂܂");
+        if (mUsedSize + size > mCapacity) return INVALID_OFFSET;
+
+        //Ȃ擪l߂
+        if (mUsedSize == 0) mHead = 0;
+        UINT64 offset = (mHead + alignment - 1) & ~(alignment - 1);
+        UINT64 consumed = offset - mHead + size;
+        //gp͈̔͂tailmHead̎O܂
+        const UINT64 tail = (mHead + mCapacity - mUsedSize) % mCapacity;
+        if (mUsedSize != 0 && tail > mHead) {
+            if (offset + size > tail) return INVALID_OFFSET;
+        } else if (offset + size > mCapacity) {
+            //Ɏ܂ȂΖ̂ĂĐ擪mۂ
+            if (size > tail && mUsedSize != 0) return INVALID_OFFSET;
+            consumed = mCapacity - mHead + size;
+            offset = 0;
+        }
+        if (mUsedSize + consumed > mCapacity) return INVALID_OFFSET;
+
+        mHead = (offset + size) % mCapacity;
+        mUsedSize += consumed;
+        mCurrentBatchSize += consumed;
+        return offset;
+    }
+    //ob`
+    void RingAllocator::endBatch(UINT64 fenceValue) {
+        if (mCurrentBatchSize == 0) return;
+        mBatches.push_back({ fenceValue, mCurrentBatchSize });
+        mCurrentBatchSize = 0;
+    }
+    //ob`
+    void RingAllocator::retire(UINT64 completedFenceValue) {
+        while (!mBatches.empty() && mBatches.front().fenceValue <= completedFenceValue) {
+            mUsedSize -= mBatches.front().size;
+            mBatches.pop_front();
+        }
+    }
+} // namespace Framework::Utility
@@ -0,0 +1,93 @@
+/**
+ * @file RingAllocator.h
+ * @brief tFXŉǗoCgPʂ̃OAP[^
+ * @details obt@ɂ͈ˑAItZbgƃtFX̒lǗ
+ */
+
+#pragma once
+#include <deque>
+
+namespace Framework::Utility {
+    /**
+     * @class RingAllocator
+     * @brief tFXŉǗ郊OAP[^
+     * @details mۂ͈͂̓ob`Pʂł܂Ƃ߁Ãob`̃tFX̒lGPUʉ߂
+     * A͈͂Ɏ܂Ȃꍇ͖̂ĂĐ擪mۂ
+     */
+    class RingAllocator {
+    public:
+        static constexpr UINT64 INVALID_OFFSET = UINT64_MAX; //!< mێs̃ItZbg
+    public:
+        /**
+         * @brief RXgN^
+         */
+        RingAllocator();
+        /**
+         * @brief fXgN^
+         */
+        ~RingAllocator();
+        /**
+         * @brief 
+         * @param capacity ǗoCg
+         */
+        void init(UINT64 capacity);
+        /**
+         * @brief A͈͂mۂ
+         * @param size mۂoCg
+         * @param alignment 擪̃ACg 2̗ݏł邱
+         * @return mۂ擪̃ItZbg mۂłȂINVALID_OFFSETԂ
+         */
+        UINT64 allocate(UINT64 size, UINT64 alignment);
+        /**
+         * @brief ܂łɊmۂ͈͂̃ob`Ƃĕ
+         * @param fenceValue ob`̊ɃVOitFX̒l
+         */
+        void endBatch(UINT64 fenceValue);
+        /**
+         * @brief GPUob`͈̔͂
+         * @param completedFenceValue GPUʉ߂tFX̒l
+         */
+        void retire(UINT64 completedFenceValue);
+        /**
+         * @brief ǗoCg擾
+         */
+        UINT64 getCapacity() const {
+            return mCapacity;
+        }
+        /**
+         * @brief gp̃oCg擾
+         */
+        UINT64 getUsedSize() const {
+            return mUsedSize;
+        }
+        /**
+         * @brief ĂȂob`ŊmۂoCg擾
+         */
+        UINT64 getCurrentBatchSize() const {
+            return mCurrentBatchSize;
+        }
+        /**
+         * @brief ҂ňԌÂob`̃tFX̒l擾
+         * @return ҂Ȃ0Ԃ
+         */
+        UINT64 getOldestFenceValue() const {
+            return mBatches.empty() ? 0 : mBatches.front().fenceValue;
+        }
+
+    private:
+        /**
+         * @brief ҂̃ob`
+         */
+        struct Batch {
+            UINT64 fenceValue; //!< ɃVOitFX̒l
+            UINT64 size; //!< mۂoCg pfBOƖ̂Ă܂
+        };
+
+    private:
+        std::deque<Batch> mBatches; //!< ҂̃ob` Â
+        UINT64 mCapacity; //!< ǗoCg
+        UINT64 mHead; //!< Ɋmۂʒu
+        UINT64 mUsedSize; //!< gp̃oCg
+        UINT64 mCurrentBatchSize; //!< ĂȂob`ŊmۂoCg
+    };
+} // namespace Framework::Utility
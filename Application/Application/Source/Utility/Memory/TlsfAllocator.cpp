@@ -0,0 +1,251 @@
+#include "TlsfAllocator.h"
+#include "Math/MathUtility.h"
+#include "Utility/BitScan.h"
+
+namespace Framework::Utility {
+    //RXgN^
+    TlsfAllocator::TlsfAllocator()
+        : mFlBitmap(0), mCapacity(0), mUsedSize(0), mAllocationCount(0), mFreeBlockCount(0) {}
+    //fXgN^
+    TlsfAllocator::~TlsfAllocator() {}
+    //
+    void TlsfAllocator::init(UINT64 capacity) {
+        MY_ASSERTION(capacity > 0, "傫0ł");
+        mCapacity = capacity;
+        reset();
+    }
+    //ׂĉ
+    void TlsfAllocator::reset() {
+        mBlocks.clear();
+        mUnusedNodes.clear();
+        for (auto&& list : mFreeLists) { list.fill(INVALID_NODE); }
+        mFlBitmap = 0;
+        mSlBitmaps.fill(0);
+        mUsedSize = 0;
+        mAllocationCount = 0;
+        mFreeBlockCount = 0;
+
+        //Ŝ̋󂫃ubNɂ 擪̃ubN͏0ԂɂȂ
+        const UINT node = createNode();
+        mBlocks[node].offset = 0;
+        mBlocks[node].size = mCapacity;
+        insertFreeBlock(node);
+    }
+    //m
+    TlsfAllocator::Allocation TlsfAllocator::allocate(UINT64 size, UINT64 alignment) {
+        MY_ASSERTION(alignment > 0 && (alignment & (alignment - 1)) == 0,
+            "ACg2̗ݏł͂܂");
+        if (size == 0 || size > mCapacity) return Allocation();
+
+        //擪낦邽߂ɂ\镪傫ubNT
+        const UINT64 searchSize = size + alignment - 1;
+        UINT node = findFreeBlock(searchSize);
+        if (node == INVALID_NODE) {
+            //ACgĂubNȂ҂ł
+            node = findFreeBlock(size);
+            if (node == INVALID_NODE || (mBlocks[node].offset & (alignment - 1)) != 0) {
+                return Allocation();
+            }
+        }
+        removeFreeBlock(node);
+
+        //擪̂͋󂫃ubNƂĎc
+        const UINT64 offset = mBlocks[node].offset;
+        const UINT64 alignedOffset = (offset + alignment - 1) & ~(alignment - 1);
+        if (alignedOffset != offset) {
+            const UINT aligned = splitBlock(node, alignedOffset - offset);
+            insertFreeBlock(node);
+            node = aligned;
+        }
+        //]̕󂫃ubNƂĖ߂
+        if (mBlocks[node].size > size) {
+            const UINT remain = splitBlock(node, size);
+            insertFreeBlock(remain);
+        }
+
+        mUsedSize += size;
+        mAllocationCount++;
+
+        Allocation result;
+        result.offset = mBlocks[node].offset;
+        result.size = size;
+        result.node = node;
+        return result;
+    }
+    //
+    void TlsfAllocator::free(const Allocation& allocation) {
+        if (!allocation.isValid()) return;
+        UINT node = allocation.node;
+        MY_ASSERTION(node < mBlocks.size() && !mBlocks[node].isFree
+                && mBlocks[node].offset == allocation.offset,
+            "mۂĂȂ͈͂w肳܂");
+
+        mUsedSize -= mBlocks[node].size;
+        mAllocationCount--;
+
+        //Oオ󂢂ĂΌ
+        const UINT next = mBlocks[node].nextPhysical;
+        if (next != INVALID_NODE && mBlocks[next].isFree) {
+            removeFreeBlock(next);
+            mergeNext(node);
+        }
+        const UINT prev = mBlocks[node].prevPhysical;
+        if (prev != INVALID_NODE && mBlocks[prev].isFree) {
+            removeFreeBlock(prev);
+            mergeNext(prev);
+            node = prev;
+        }
+        insertFreeBlock(node);
+    }
+    //mے͈̔͂񋓂
+    void TlsfAllocator::forEachAllocation(
+        const std::function<void(const Allocation&)>& func) const {
+        if (mBlocks.empty()) return;
+        for (UINT node = 0; node != INVALID_NODE; node = mBlocks[node].nextPhysical) {
+            const Block& block = mBlocks[node];
+            if (block.isFree) continue;
+            Allocation allocation;
+            allocation.offset = block.offset;
+            allocation.size = block.size;
+            allocation.node = node;
+            func(allocation);
+        }
+    }
+    //gp󋵂擾
+    TlsfAllocator::Stats TlsfAllocator::getStats() const {
+        Stats stats;
+        stats.capacity = mCapacity;
+        stats.usedSize = mUsedSize;
+        stats.allocationCount = mAllocationCount;
+        stats.freeBlockCount = mFreeBlockCount;
+        if (mFlBitmap == 0) return stats;
+
+        //ő̃ubN͈ԏ̋󂫃Xgɂ
+        const UINT fl = findLastSetBit(mFlBitmap);
+        const UINT sl = findLastSetBit(mSlBitmaps[fl]);
+        for (UINT node = mFreeLists[fl][sl]; node != INVALID_NODE; node = mBlocks[node].nextFree) {
+            stats.largestFreeSize = Math::MathUtil::mymax(stats.largestFreeSize, mBlocks[node].size);
+        }
+        return stats;
+    }
+    //傫󂫃Xg̔ԍ߂
+    void TlsfAllocator::mapping(UINT64 size, UINT* fl, UINT* sl) {
+        //̂͑1x0ɂ܂Ƃ߁A2xɑ傫̂܂܎g
+        if (size < SL_INDEX_COUNT) {
+            *fl = 0;
+            *sl = static_cast<UINT>(size);
+            return;
+        }
+        const UINT msb = findLastSetBit(size);
+        *fl = msb - SL_INDEX_COUNT_LOG2 + 1;
+        *sl = static_cast<UINT>(size >> (msb - SL_INDEX_COUNT_LOG2)) ^ SL_INDEX_COUNT;
+    }
+    //vȏ̑傫̃ubN󂫃Xg̔ԍ߂
+    void TlsfAllocator::mappingSearch(UINT64 size, UINT* fl, UINT* sl) {
+        //̋؂܂Ő؂グĂ΁ÃXĝǂ̃ubNł
+        if (size >= SL_INDEX_COUNT) {
+            const UINT64 round = (1ull << (findLastSetBit(size) - SL_INDEX_COUNT_LOG2)) - 1;
+            if (size <= UINT64_MAX - round) size += round;
+        }
+        mapping(size, fl, sl);
+    }
+    //󂫃ubNT
+    UINT TlsfAllocator::findFreeBlock(UINT64 size) const {
+        UINT fl, sl;
+        mappingSearch(size, &fl, &sl);
+        if (fl >= FL_INDEX_COUNT) return INVALID_NODE;
+
+        //1xł傫2xT
+        UINT slMap = sl < SL_INDEX_COUNT ? mSlBitmaps[fl] & (~0u << sl) : 0;
+        if (slMap == 0) {
+            //Ȃ΂傫1xT
+            if (fl + 1 >= FL_INDEX_COUNT) return INVALID_NODE;
+            const UINT64 flMap = mFlBitmap & (~0ull << (fl + 1));
+            if (flMap == 0) return INVALID_NODE;
+            fl = findFirstSetBit(flMap);
+            slMap = mSlBitmaps[fl];
+        }
+        sl = findFirstSetBit(slMap);
+        return mFreeLists[fl][sl];
+    }
+    //󂫃Xgɒǉ
+    void TlsfAllocator::insertFreeBlock(UINT node) {
+        Block& block = mBlocks[node];
+        UINT fl, sl;
+        mapping(block.size, &fl, &sl);
+        const UINT head = mFreeLists[fl][sl];
+        block.isFree = true;
+        block.prevFree = INVALID_NODE;
+        block.nextFree = head;
+        if (head != INVALID_NODE) mBlocks[head].prevFree = node;
+        mFreeLists[fl][sl] = node;
+        mFlBitmap |= 1ull << fl;
+        mSlBitmaps[fl] |= 1u << sl;
+        mFreeBlockCount++;
+    }
+    //󂫃Xg菜
+    void TlsfAllocator::removeFreeBlock(UINT node) {
+        Block& block = mBlocks[node];
+        if (block.prevFree != INVALID_NODE) mBlocks[block.prevFree].nextFree = block.nextFree;
+        if (block.nextFree != INVALID_NODE) mBlocks[block.nextFree].prevFree = block.prevFree;
+
+        UINT fl, sl;
+        mapping(block.size, &fl, &sl);
+        if (mFreeLists[fl][sl] == node) {
+            mFreeLists[fl][sl] = block.nextFree;
+            //XgɂȂrbg𗎂Ƃ
+            if (block.nextFree == INVALID_NODE) {
+                mSlBitmaps[fl] &= ~(1u << sl);
+                if (mSlBitmaps[fl] == 0) mFlBitmap &= ~(1ull << fl);
+            }
+        }
+        block.isFree = false;
+        block.prevFree = INVALID_NODE;
+        block.nextFree = INVALID_NODE;
+        mFreeBlockCount--;
+    }
+    //ubN𕪊
+    UINT TlsfAllocator::splitBlock(UINT node, UINT64 size) {
+        //createNodeŔz񂪐Lт̂ŎQƂ͌Ŏ
+        const UINT remain = createNode();
+        Block& block = mBlocks[node];
+        Block& remainBlock = mBlocks[remain];
+        remainBlock.offset = block.offset + size;
+        remainBlock.size = block.size - size;
+        remainBlock.prevPhysical = node;
+        remainBlock.nextPhysical = block.nextPhysical;
+        if (block.nextPhysical != INVALID_NODE) mBlocks[block.nextPhysical].prevPhysical = remain;
+        block.nextPhysical = remain;
+        block.size = size;
+        return remain;
+    }
+    //̃ubN荞
+    void TlsfAllocator::mergeNext(UINT node) {
+        Block& block = mBlocks[node];
+        const UINT next = block.nextPhysical;
+        const Block& nextBlock = mBlocks[next];
+        block.size += nextBlock.size;
+        block.nextPhysical = nextBlock.nextPhysical;
+        if (nextBlock.nextPhysical != INVALID_NODE) {
+            mBlocks[nextBlock.nextPhysical].prevPhysical = node;
+        }
+        destroyNode(next);
+    }
+    //ubN쐬
+    UINT TlsfAllocator::createNode() {
+        UINT node;
+        if (mUnusedNodes.empty()) {
+            node = static_cast<UINT>(mBlocks.size());
+            mBlocks.emplace_back();
+        } else {
+            node = mUnusedNodes.back();
+            mUnusedNodes.pop_back();
+        }
+        mBlocks[node] = { 0, 0, INVALID_NODE, INVALID_NODE, INVALID_NODE, INVALID_NODE, false };
+        return node;
+    }
+    //ubNj
+    void TlsfAllocator::destroyNode(UINT node) {
+        mUnusedNodes.emplace_back(node);
+    }
+} // namespace Framework::Utility
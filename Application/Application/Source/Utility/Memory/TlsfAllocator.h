@@ -0,0 +1,190 @@
+/**
+ * @file TlsfAllocator.h
+ * @brief TLSFɂ̈̊蓖
+ */
+
+#pragma once
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "Utility/Platform.h"
+
+namespace Framework::Utility {
+    /**
+     * @class TlsfAllocator
+     * @brief Two-Level Segregated FitŔ͈͂蓖Ă
+     * @details ͎̂̂A[0, capacity)̃ItZbgǗ
+     * mہAƂɋ󂫃ubN̐ɂ炸萔ԂŏI
+     */
+    class TlsfAllocator {
+    public:
+        static constexpr UINT64 INVALID_OFFSET = UINT64_MAX; //!< mۂɎsƂ̃ItZbg
+        static constexpr UINT INVALID_NODE = UINT_MAX; //!< ȃubN̔ԍ
+        /**
+         * @struct Allocation
+         * @brief mۂ͈
+         */
+        struct Allocation {
+            UINT64 offset = INVALID_OFFSET; //!< 擪̃ItZbg
+            UINT64 size = 0; //!< mۂTCY
+            UINT node = INVALID_NODE; //!< ǗĂubN̔ԍ
+            /**
+             * @brief LȔ͈͂
+             */
+            bool isValid() const {
+                return node != INVALID_NODE;
+            }
+        };
+        /**
+         * @struct Stats
+         * @brief gp
+         */
+        struct Stats {
+            UINT64 capacity = 0; //!< ǗĂ傫
+            UINT64 usedSize = 0; //!< gp̑傫
+            UINT64 largestFreeSize = 0; //!< xɊmۂłő̑傫
+            UINT allocationCount = 0; //!< mے̐
+            UINT freeBlockCount = 0; //!< 󂫃ubN̐
+            /**
+             * @brief fЉ̓x擾
+             * @details 󂫗̈̂ő̃ubNɓȂ 0ȂfЉĂȂ
+             */
+            float getFragmentation() const {
+                const UINT64 freeSize = capacity - usedSize;
+                if (freeSize == 0) return 0.0f;
+                return 1.0f - static_cast<float>(largestFreeSize) / static_cast<float>(freeSize);
+            }
+        };
+
+    private:
+        static constexpr UINT SL_INDEX_COUNT_LOG2 = 4; //!< 2x̑̕ΐ
+        static constexpr UINT SL_INDEX_COUNT = 1 << SL_INDEX_COUNT_LOG2; //!< 2x̕
+        static constexpr UINT FL_INDEX_COUNT = 64 - SL_INDEX_COUNT_LOG2 + 1; //!< 1x̐
+        /**
+         * @struct Block
+         * @brief Ä
+         * @details IȕтƋ󂫃Xg2̑oXgłȂ
+         */
+        struct Block {
+            UINT64 offset; //!< 擪̃ItZbg
+            UINT64 size; //!< 傫
+            UINT prevPhysical; //!< ÕubN
+            UINT nextPhysical; //!< ̃ubN
+            UINT prevFree; //!< 󂫃Xg̑ÕubN
+            UINT nextFree; //!< 󂫃Xg̎̃ubN
+            bool isFree; //!< 󂢂Ă邩
+        };
+
+    public:
+        /**
+         * @brief RXgN^
+         */
+        TlsfAllocator();
+        /**
+         * @brief fXgN^
+         */
+        ~TlsfAllocator();
+        /**
+         * @brief 
+         * @param capacity Ǘ傫
+         */
+        void init(UINT64 capacity);
+        /**
+         * @brief ׂĉԂɖ߂
+         */
+        void reset();
+        /**
+         * @brief ͈͂mۂ
+         * @param size mۂ傫
+         * @param alignment ItZbg̃ACg 2̗ݏł邱
+         * @return mۂłȂΖȔ͈͂Ԃ
+         */
+        Allocation allocate(UINT64 size, UINT64 alignment);
+        /**
+         * @brief ͈͂
+         * @details אڂ󂫃ubNƂ͌
+         */
+        void free(const Allocation& allocation);
+        /**
+         * @brief mے͈̔͂擪珇ɗ񋓂
+         * @details ftOňړT̂Ɏg
+         */
+        void forEachAllocation(const std::function<void(const Allocation&)>& func) const;
+        /**
+         * @brief gp󋵂擾
+         */
+        Stats getStats() const;
+        /**
+         * @brief ǗĂ傫擾
+         */
+        UINT64 getCapacity() const {
+            return mCapacity;
+        }
+        /**
+         * @brief gp̑傫擾
+         */
+        UINT64 getUsedSize() const {
+            return mUsedSize;
+        }
+        /**
+         * @brief mۂĂȂ
+         */
+        bool isEmpty() const {
+            return mAllocationCount == 0;
+        }
+
+    private:
+        /**
+         * @brief 傫󂫃Xg̔ԍ߂
+         */
+        static void mapping(UINT64 size, UINT* fl, UINT* sl);
+        /**
+         * @brief v傫ȏ̃ubN󂫃Xg̔ԍ߂
+         */
+        static void mappingSearch(UINT64 size, UINT* fl, UINT* sl);
+        /**
+         * @brief 󂫃Xgv𖞂ubNT
+         */
+        UINT findFreeBlock(UINT64 size) const;
+        /**
+         * @brief 󂫃Xgɒǉ
+         */
+        void insertFreeBlock(UINT node);
+        /**
+         * @brief 󂫃Xg菜
+         */
+        void removeFreeBlock(UINT node);
+        /**
+         * @brief ubN2ɕ
+         * @param node ubN
+         * @param size Ȏ傫
+         * @return 㔼̃ubN
+         */
+        UINT splitBlock(UINT node, UINT64 size);
+        /**
+         * @brief ̃ubN荞
+         */
+        void mergeNext(UINT node);
+        /**
+         * @brief ubN쐬
+         */
+        UINT createNode();
+        /**
+         * @brief ubNj
+         */
+        void destroyNode(UINT node);
+
+    private:
+        std::vector<Block> mBlocks; //!< ubN̋L^
+        std::vector<UINT> mUnusedNodes; //!< ėpłubN̔ԍ
+        std::array<std::array<UINT, SL_INDEX_COUNT>, FL_INDEX_COUNT> mFreeLists; //!< 󂫃Xg̐擪
+        UINT64 mFlBitmap; //!< 󂫃Xĝ1x
+        std::array<UINT, FL_INDEX_COUNT> mSlBitmaps; //!< 1xƂ̋󂫃Xĝ2x
+        UINT64 mCapacity; //!< ǗĂ傫
+        UINT64 mUsedSize; //!< gp̑傫
+        UINT mAllocationCount; //!< mے̐
+        UINT mFreeBlockCount; //!< 󂫃ubN̐
+    };
+} // namespace Framework::Utility
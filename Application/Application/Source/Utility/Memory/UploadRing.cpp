@@ -0,0 +1,40 @@
+#include "UploadRing.h"
+
+namespace Framework::Utility {
+    //RXgN^
+    UploadRing::UploadRing() : mStallCount(0) {}
+    //fXgN^
+    UploadRing::~UploadRing() {}
+    //
+    void UploadRing::init(UINT64 capacity) {
+        mRing.init(capacity);
+        mStallCount = 0;
+    }
+    //̈mۂ
+    UINT64 UploadRing::allocate(UINT64 size, UINT64 alignment, IUploadQueue* queue) {
+        MY_ASSERTION(!isOversized(size), "Oɓ傫ł͂܂");
+        UINT64 offset = mRing.allocate(size, alignment);
+        if (offset == INVALID_OFFSET) {
+            //҂OɁAłɊĂob`
+            mRing.retire(queue->getCompletedFenceValue());
+            offset = mRing.allocate(size, alignment);
+        }
+        while (offset == INVALID_OFFSET) {
+            if (mRing.getOldestFenceValue() != 0) {
+                //ÂRs[Î҂ė̈󂯂
+                queue->waitForFence(mRing.getOldestFenceValue());
+                mRing.retire(queue->getCompletedFenceValue());
+                mStallCount++;
+            } else {
+                //҂̂Ȃ΋L^̃Rs[sĉł悤ɂ
+                MY_THROW_IF_FALSE_LOG(
+                    mRing.getCurrentBatchSize() > 0, "Abv[ḧmۂł܂");
+                queue->submit();
+                MY_THROW_IF_FALSE_LOG(
+                    mRing.getCurrentBatchSize() == 0, "sob`Ă܂");
+            }
+            offset = mRing.allocate(size, alignment);
+        }
+        return offset;
+    }
+} // namespace Framework::Utility
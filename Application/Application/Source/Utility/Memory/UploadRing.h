@@ -0,0 +1,110 @@
+/**
+ * @file UploadRing.h
+ * @brief Abv[ḧ̊蓖ĂƁA󂫂邽߂̑ҋ@
+ * @details L[ƃtFX̓C^[tFCXzɎĝŁAGPUȂĂm߂
+ */
+
+#pragma once
+#include "Utility/Memory/RingAllocator.h"
+
+namespace Framework::Utility {
+    /**
+     * @class IUploadQueue
+     * @brief Abv[ḧɋ󂫂邽߂̃L[
+     */
+    class IUploadQueue {
+    public:
+        /**
+         * @brief fXgN^
+         */
+        virtual ~IUploadQueue() = default;
+        /**
+         * @brief GPUʉ߂tFX̒l擾
+         */
+        virtual UINT64 getCompletedFenceValue() const = 0;
+        /**
+         * @brief w肵tFX̒lʉ߂܂ő҂
+         */
+        virtual void waitForFence(UINT64 fenceValue) = 0;
+        /**
+         * @brief ς񂾃Rs[s
+         * @return ɃVOitFX̒l
+         * @details UploadRing::endBatchŃob`邱
+         */
+        virtual UINT64 submit() = 0;
+    };
+
+    /**
+     * @class UploadRing
+     * @brief Abv[ḧ̃O
+     * @details ̈悪ȂΌÂRs[̊҂A҂̂Ȃ΋L^̃Rs[s
+     */
+    class UploadRing {
+    public:
+        static constexpr UINT64 INVALID_OFFSET = RingAllocator::INVALID_OFFSET; //!< mێs̃ItZbg
+    public:
+        /**
+         * @brief RXgN^
+         */
+        UploadRing();
+        /**
+         * @brief fXgN^
+         */
+        ~UploadRing();
+        /**
+         * @brief 
+         * @param capacity ǗoCg
+         */
+        void init(UINT64 capacity);
+        /**
+         * @brief Oɓꂸɐp̃obt@ׂ傫
+         * @details ̈̔𒴂̂͑̓]l܂点
+         */
+        bool isOversized(UINT64 size) const {
+            return size > mRing.getCapacity() / 2;
+        }
+        /**
+         * @brief ̈mۂ
+         * @param size mۂoCg isOversizedłȂ
+         * @param alignment 擪̃ACg
+         * @param queue 󂫂邽߂̃L[
+         * @return mۂ擪̃ItZbg
+         */
+        UINT64 allocate(UINT64 size, UINT64 alignment, IUploadQueue* queue);
+        /**
+         * @brief ܂łɊmۂ͈͂̃ob`Ƃĕ
+         * @param fenceValue ob`̊ɃVOitFX̒l
+         */
+        void endBatch(UINT64 fenceValue) {
+            mRing.endBatch(fenceValue);
+        }
+        /**
+         * @brief Rs[ob`͈̔͂
+         */
+        void retire(UINT64 completedFenceValue) {
+            mRing.retire(completedFenceValue);
+        }
+        /**
+         * @brief ǗoCg擾
+         */
+        UINT64 getCapacity() const {
+            return mRing.getCapacity();
+        }
+        /**
+         * @brief Rs[̊҂̃oCg擾
+         */
+        UINT64 getUsedSize() const {
+            return mRing.getUsedSize();
+        }
+        /**
+         * @brief 󂫂邽߂Ɋ҂񐔂擾
+         */
+        UINT getStallCount() const {
+            return mStallCount;
+        }
+
+    private:
+        RingAllocator mRing; //!< ̈̊蓖
+        UINT mStallCount; //!< ҂
+    };
+} // namespace Framework::Utility
@@ -0,0 +1,718 @@
+#include "MeshSimplifier.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace Framework::DX;
+using namespace Framework::Utility;
+
+namespace {
+    static constexpr float BORDER_WEIGHT = 10.0f; //!< Eƌpڂۂʂ̏d
+    static constexpr UINT INVALID = UINT_MAX;
+    static constexpr float MAX_GRID_RESOLUTION = 256.0f; //!< 𑪂Obh1̍ő啪
+
+    /**
+     * @brief vZp̍W
+     */
+    struct Point {
+        float x, y, z;
+    };
+    inline Point toPoint(const Vec3& v) {
+        return { v.x, v.y, v.z };
+    }
+    inline Point operator+(const Point& a, const Point& b) {
+        return { a.x + b.x, a.y + b.y, a.z + b.z };
+    }
+    inline Point operator-(const Point& a, const Point& b) {
+        return { a.x - b.x, a.y - b.y, a.z - b.z };
+    }
+    inline Point operator*(const Point& a, float s) {
+        return { a.x * s, a.y * s, a.z * s };
+    }
+    inline float dot(const Point& a, const Point& b) {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+    inline Point cross(const Point& a, const Point& b) {
+        return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+    }
+    inline float length(const Point& a) {
+        return std::sqrt(dot(a, a));
+    }
+
+    /**
+     * @brief ʂ܂ł̋̓a\񎟌`
+     */
+    struct Quadric {
+        double a2 = 0, ab = 0, ac = 0, ad = 0, b2 = 0, bc = 0, bd = 0, c2 = 0, cd = 0, d2 = 0;
+        double weight = 0; //!< ʂ̏d݂̍v 덷𕽋ς̋ɂ̂Ɏg
+        //ax+by+cz+d=0dݕtŉ
+        void addPlane(const Point& n, float d, float w) {
+            a2 += w * n.x * n.x;
+            ab += w * n.x * n.y;
+            ac += w * n.x * n.z;
+            ad += w * n.x * d;
+            b2 += w * n.y * n.y;
+            bc += w * n.y * n.z;
+            bd += w * n.y * d;
+            c2 += w * n.z * n.z;
+            cd += w * n.z * d;
+            d2 += w * static_cast<double>(d) * d;
+        }
+        void add(const Quadric& q) {
+            a2 += q.a2;
+            ab += q.ab;
+            ac += q.ac;
+            ad += q.ad;
+            b2 += q.b2;
+            bc += q.bc;
+            bd += q.bd;
+            c2 += q.c2;
+            cd += q.cd;
+            d2 += q.d2;
+            weight += q.weight;
+        }
+        double evaluate(const Point& p) const {
+            const double x = p.x, y = p.y, z = p.z;
+            return a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x + b2 * y * y
+                + 2 * bc * y * z + 2 * bd * y + c2 * z * z + 2 * cd * z + d2;
+        }
+    };
+
+    inline UINT64 edgeKey(UINT a, UINT b) {
+        return a < b ? (static_cast<UINT64>(a) << 32) | b : (static_cast<UINT64>(b) << 32) | a;
+    }
+
+    /**
+     * @brief ǩ
+     */
+    struct Collapse {
+        float cost; //!< 덷̓
+        UINT from; //!< _
+        UINT to; //!< 񂹂̒_
+        UINT fromVersion; //!< ς񂾂Ƃfrom̔
+        UINT toVersion; //!< ς񂾂Ƃto̔
+        bool operator>(const Collapse& other) const {
+            return cost > other.cost;
+        }
+    };
+
+    /**
+     * @class Simplifier
+     * @brief 1񕪂̊ȗ̍Ɨ̈
+     * @details _͍Ŵ1ɂ܂Ƃ߂ĈA܂Ƃ߂_k񂷂
+     * ̒_(EFbW)͎Op`̊pɎcAk̂ƂɊ񂹂̃EFbW֕tւ
+     */
+    class Simplifier {
+    public:
+        Simplifier(const std::vector<Vertex>& vertices, const std::vector<Index>& indices)
+            : mVertices(vertices) {
+            weld();
+            buildTriangles(indices);
+            classify();
+            buildQuadrics();
+        }
+
+        float run(const SimplifyOptions& options, std::vector<Index>* result) {
+            const double maxCost = options.maxError >= FLT_MAX
+                ? DBL_MAX
+                : static_cast<double>(options.maxError) * options.maxError;
+            for (UINT t = 0; t < mTriangleCount; t++) {
+                if (!mTriangleAlive[t]) continue;
+                for (UINT k = 0; k < 3; k++) {
+                    const UINT a = weldOf(t, k), b = weldOf(t, (k + 1) % 3);
+                    //Op`ƏdĐςނAÂ͔łŎ̂Ă
+                    if (a < b) pushEdge(a, b);
+                }
+            }
+            float error = 0.0f;
+            while (mAliveTriangles * 3 > options.targetIndexCount && !mHeap.empty()) {
+                const Collapse collapse = mHeap.top();
+                mHeap.pop();
+                if (mPositionDead[collapse.from] || mPositionDead[collapse.to]
+                    || mVersions[collapse.from] != collapse.fromVersion
+                    || mVersions[collapse.to] != collapse.toVersion) {
+                    continue;
+                }
+                if (collapse.cost > maxCost) break;
+                if (!tryCollapse(collapse.from, collapse.to)) continue;
+                error = Framework::Math::MathUtil::mymax(error, std::sqrt(collapse.cost));
+            }
+
+            result->clear();
+            result->reserve(mAliveTriangles * 3);
+            for (UINT t = 0; t < mTriangleCount; t++) {
+                if (!mTriangleAlive[t]) continue;
+                for (UINT k = 0; k < 3; k++) {
+                    result->push_back(static_cast<Index>(mCorners[t * 3 + k]));
+                }
+            }
+            return error;
+        }
+
+    private:
+        UINT weldOf(UINT triangle, UINT corner) const {
+            return mWeldOf[mCorners[triangle * 3 + corner]];
+        }
+        //W_܂Ƃ߂
+        void weld() {
+            struct Key {
+                UINT x, y, z;
+                bool operator==(const Key& o) const {
+                    return x == o.x && y == o.y && z == o.z;
+                }
+            };
+            struct KeyHash {
+                size_t operator()(const Key& k) const {
+                    return (k.x * 73856093u) ^ (k.y * 19349663u) ^ (k.z * 83492791u);
+                }
+            };
+            auto bits = [](float f) {
+                f += 0.0f; //-0+0ɂ낦
+                UINT u;
+                memcpy(&u, &f, sizeof(u));
+                return u;
+            };
+            std::unordered_map<Key, UINT, KeyHash> table;
+            table.reserve(mVertices.size());
+            mWeldOf.resize(mVertices.size());
+            //܂œ_͓EFbWƂĈȂƁȀdpڂɌ
+            struct VertexHash {
+                size_t operator()(const Vertex& v) const {
+                    UINT words[sizeof(Vertex) / sizeof(UINT)];
+                    memcpy(words, &v, sizeof(Vertex));
+                    size_t hash = 0;
+                    for (UINT w : words) hash = hash * 31 + w;
+                    return hash;
+                }
+            };
+            struct VertexEqual {
+                bool operator()(const Vertex& a, const Vertex& b) const {
+                    return memcmp(&a, &b, sizeof(Vertex)) == 0;
+                }
+            };
+            std::unordered_map<Vertex, UINT, VertexHash, VertexEqual> wedges;
+            wedges.reserve(mVertices.size());
+            mCanonical.resize(mVertices.size());
+            for (size_t v = 0; v < mVertices.size(); v++) {
+                mCanonical[v] = wedges.emplace(mVertices[v], static_cast<UINT>(v)).first->second;
+                const Vec3& p = mVertices[v].position;
+                const Key key = { bits(p.x), bits(p.y), bits(p.z) };
+                auto it = table.find(key);
+                if (it == table.end()) {
+                    it = table.emplace(key, static_cast<UINT>(mPositions.size())).first;
+                    mPositions.push_back(toPoint(p));
+                }
+                mWeldOf[v] = it->second;
+            }
+            const size_t count = mPositions.size();
+            mPositionTriangles.resize(count);
+            mPositionDead.assign(count, false);
+            mVersions.assign(count, 0);
+            mBorder.assign(count, false);
+            mLocked.assign(count, false);
+            mQuadrics.resize(count);
+        }
+        //܂Ƃ߂WŒׂĂOp`ĎOp`
+        void buildTriangles(const std::vector<Index>& indices) {
+            mTriangleCount = static_cast<UINT>(indices.size() / 3);
+            mCorners.resize(mTriangleCount * 3);
+            for (size_t i = 0; i < mCorners.size(); i++) mCorners[i] = mCanonical[indices[i]];
+            mTriangleAlive.assign(mTriangleCount, true);
+            mAliveTriangles = 0;
+            for (UINT t = 0; t < mTriangleCount; t++) {
+                const UINT a = weldOf(t, 0), b = weldOf(t, 1), c = weldOf(t, 2);
+                if (a == b || b == c || c == a) {
+                    mTriangleAlive[t] = false;
+                    continue;
+                }
+                mAliveTriangles++;
+                mPositionTriangles[a].push_back(t);
+                mPositionTriangles[b].push_back(t);
+                mPositionTriangles[c].push_back(t);
+            }
+        }
+        //Eƌpڂ̕ӂ𒲂ׂ
+        void classify() {
+            //ӂƂɍŏ̎Op`ƎgꂽL^
+            struct EdgeInfo {
+                UINT count = 0;
+                UINT wedgeFrom = INVALID; //!< ŏ̎Op`ł̎n_̃EFbW
+                UINT wedgeTo = INVALID; //!< ŏ̎Op`ł̏I_̃EFbW
+                bool seam = false;
+            };
+            std::unordered_map<UINT64, EdgeInfo> edges;
+            edges.reserve(mAliveTriangles * 2);
+            for (UINT t = 0; t < mTriangleCount; t++) {
+                if (!mTriangleAlive[t]) continue;
+                for (UINT k = 0; k < 3; k++) {
+                    const UINT wa = mCorners[t * 3 + k], wb = mCorners[t * 3 + (k + 1) % 3];
+                    EdgeInfo& info = edges[edgeKey(mWeldOf[wa], mWeldOf[wb])];
+                    if (info.count == 0) {
+                        info.wedgeFrom = wa;
+                        info.wedgeTo = wb;
+                    } else if (info.wedgeFrom != wb || info.wedgeTo != wa) {
+                        //Op`Œ[̃EFbWႦΑ̌p
+                        info.seam = true;
+                    }
+                    info.count++;
+                }
+            }
+            std::vector<UINT> borderEdgeCounts(mPositions.size(), 0);
+            for (auto&& edge : edges) {
+                const UINT a = static_cast<UINT>(edge.first >> 32);
+                const UINT b = static_cast<UINT>(edge.first & 0xffffffff);
+                if (edge.second.count == 1) {
+                    mBorderEdges.insert(edge.first);
+                    borderEdgeCounts[a]++;
+                    borderEdgeCounts[b]++;
+                    mBorder[a] = mBorder[b] = true;
+                } else if (edge.second.count > 2) {
+                    //l̂łȂӂ͓Ȃ
+                    mLocked[a] = mLocked[b] = true;
+                }
+                if (edge.second.count == 1 || edge.second.seam) mConstrainedEdges.push_back(edge.first);
+            }
+            //E钸_͓ƌ`
+            for (size_t p = 0; p < mPositions.size(); p++) {
+                if (borderEdgeCounts[p] > 2) mLocked[p] = true;
+            }
+        }
+        //ʂƍSӂ񎟌`
+        void buildQuadrics() {
+            std::unordered_map<UINT64, Point> edgeNormals;
+            for (UINT t = 0; t < mTriangleCount; t++) {
+                if (!mTriangleAlive[t]) continue;
+                const UINT a = weldOf(t, 0), b = weldOf(t, 1), c = weldOf(t, 2);
+                const Point& p0 = mPositions[a];
+                Point n = cross(mPositions[b] - p0, mPositions[c] - p0);
+                const float length = std::sqrt(dot(n, n));
+                if (length <= 0.0f) continue;
+                const float area = length * 0.5f;
+                n = n * (1.0f / length);
+                const float d = -dot(n, p0);
+                for (UINT v : { a, b, c }) {
+                    mQuadrics[v].addPlane(n, d, area);
+                    mQuadrics[v].weight += area;
+                }
+                for (UINT k = 0; k < 3; k++) {
+                    edgeNormals[edgeKey(weldOf(t, k), weldOf(t, (k + 1) % 3))] = n;
+                }
+            }
+            //Eƌpڂ͕ӂ܂ݖʂɐȕʂœȂ悤ɂ
+            for (UINT64 key : mConstrainedEdges) {
+                const UINT a = static_cast<UINT>(key >> 32);
+                const UINT b = static_cast<UINT>(key & 0xffffffff);
+                const Point edge = mPositions[b] - mPositions[a];
+                const float lengthSq = dot(edge, edge);
+                Point n = cross(edge, edgeNormals[key]);
+                const float length = std::sqrt(dot(n, n));
+                if (length <= 0.0f) continue;
+                n = n * (1.0f / length);
+                const float d = -dot(n, mPositions[a]);
+                mQuadrics[a].addPlane(n, d, lengthSq * BORDER_WEIGHT);
+                mQuadrics[b].addPlane(n, d, lengthSq * BORDER_WEIGHT);
+            }
+        }
+        bool isBorderEdge(UINT a, UINT b) const {
+            return mBorderEdges.find(edgeKey(a, b)) != mBorderEdges.end();
+        }
+        //ǩƂĂ蓾邩
+        bool canCollapse(UINT from, UINT to) const {
+            if (mLocked[from]) return false;
+            //E̒_͋EɉĂ̂ݓ
+            return !mBorder[from] || isBorderEdge(from, to);
+        }
+        float evaluate(UINT from, UINT to) const {
+            Quadric q = mQuadrics[from];
+            q.add(mQuadrics[to]);
+            const double cost = q.weight > 0 ? q.evaluate(mPositions[to]) / q.weight : 0.0;
+            return static_cast<float>(Framework::Math::MathUtil::mymax(cost, 0.0));
+        }
+        void pushEdge(UINT a, UINT b) {
+            if (canCollapse(a, b)) {
+                mHeap.push({ evaluate(a, b), a, b, mVersions[a], mVersions[b] });
+            }
+            if (canCollapse(b, a)) {
+                mHeap.push({ evaluate(b, a), b, a, mVersions[b], mVersions[a] });
+            }
+        }
+        //Op`̒̎w肵W̊pT
+        UINT findCorner(UINT t, UINT position) const {
+            for (UINT k = 0; k < 3; k++) {
+                if (weldOf(t, k) == position) return k;
+            }
+            return INVALID;
+        }
+        //אڂWW߂
+        void gatherNeighbors(UINT position, std::vector<UINT>* neighbors) const {
+            neighbors->clear();
+            for (UINT t : mPositionTriangles[position]) {
+                if (!mTriangleAlive[t]) continue;
+                for (UINT k = 0; k < 3; k++) {
+                    const UINT p = weldOf(t, k);
+                    if (p != position) neighbors->push_back(p);
+                }
+            }
+            std::sort(neighbors->begin(), neighbors->end());
+            neighbors->erase(std::unique(neighbors->begin(), neighbors->end()), neighbors->end());
+        }
+        //kł΍s
+        bool tryCollapse(UINT from, UINT to) {
+            //ӂLOp`A_̃EFbWǂ̃EFbWɕtւ邩߂
+            mWedgeMap.clear();
+            UINT sharedTriangles = 0;
+            for (UINT t : mPositionTriangles[from]) {
+                if (!mTriangleAlive[t]) continue;
+                const UINT kt = findCorner(t, to);
+                const UINT wa = mCorners[t * 3 + findCorner(t, from)];
+                if (kt == INVALID) {
+                    if (std::find_if(mWedgeMap.begin(), mWedgeMap.end(),
+                            [&](auto&& m) { return m.first == wa; })
+                        == mWedgeMap.end()) {
+                        mWedgeMap.push_back({ wa, INVALID });
+                    }
+                    continue;
+                }
+                sharedTriangles++;
+                const UINT wb = mCorners[t * 3 + kt];
+                auto it = std::find_if(
+                    mWedgeMap.begin(), mWedgeMap.end(), [&](auto&& m) { return m.first == wa; });
+                if (it == mWedgeMap.end()) {
+                    mWedgeMap.push_back({ wa, wb });
+                } else if (it->second == INVALID) {
+                    it->second = wb;
+                } else if (it->second != wb) {
+                    //pڂ܂̂ő܂Ȃ
+                    return false;
+                }
+            }
+            //ӂɐڂĂȂEFbWΌpڂO
+            for (auto&& m : mWedgeMap) {
+                if (m.second == INVALID) return false;
+            }
+            if (sharedTriangles == 0) return false;
+
+            //[ɋʂאڒ_ӂLOp`̐葽ƁAkŖʂdȂ
+            gatherNeighbors(from, &mNeighborsA);
+            gatherNeighbors(to, &mNeighborsB);
+            UINT common = 0;
+            for (size_t i = 0, j = 0; i < mNeighborsA.size() && j < mNeighborsB.size();) {
+                if (mNeighborsA[i] < mNeighborsB[j]) {
+                    i++;
+                } else if (mNeighborsA[i] > mNeighborsB[j]) {
+                    j++;
+                } else {
+                    common++;
+                    i++;
+                    j++;
+                }
+            }
+            if (common != sharedTriangles) return false;
+
+            //cOp`ԂȂm߂
+            const Point& target = mPositions[to];
+            for (UINT t : mPositionTriangles[from]) {
+                if (!mTriangleAlive[t] || findCorner(t, to) != INVALID) continue;
+                const UINT k = findCorner(t, from);
+                const Point& p1 = mPositions[weldOf(t, (k + 1) % 3)];
+                const Point& p2 = mPositions[weldOf(t, (k + 2) % 3)];
+                const Point& p0 = mPositions[from];
+                const Point before = cross(p1 - p0, p2 - p0);
+                const Point after = cross(p1 - target, p2 - target);
+                if (dot(before, after) <= 0.0f) return false;
+            }
+
+            //k񂷂
+            for (UINT t : mPositionTriangles[from]) {
+                if (!mTriangleAlive[t]) continue;
+                if (findCorner(t, to) != INVALID) {
+                    mTriangleAlive[t] = false;
+                    mAliveTriangles--;
+                    continue;
+                }
+                const UINT k = findCorner(t, from);
+                UINT& corner = mCorners[t * 3 + k];
+                corner = std::find_if(mWedgeMap.begin(), mWedgeMap.end(), [&](auto&& m) {
+                    return m.first == corner;
+                })->second;
+                mPositionTriangles[to].push_back(t);
+            }
+            //Op`l߂
+            std::vector<UINT>& toTriangles = mPositionTriangles[to];
+            toTriangles.erase(std::remove_if(toTriangles.begin(), toTriangles.end(),
+                                  [&](UINT t) { return !mTriangleAlive[t]; }),
+                toTriangles.end());
+            std::vector<UINT>().swap(mPositionTriangles[from]);
+            if (mBorder[from]) {
+                //_̎c̋E̕ӂ͊񂹂̋E̕ӂɂȂ
+                for (UINT n : mNeighborsA) {
+                    if (n != to && isBorderEdge(from, n)) mBorderEdges.insert(edgeKey(to, n));
+                }
+            }
+            mQuadrics[to].add(mQuadrics[from]);
+            mPositionDead[from] = true;
+            mVersions[to]++;
+
+            gatherNeighbors(to, &mNeighborsB);
+            for (UINT n : mNeighborsB) pushEdge(to, n);
+            return true;
+        }
+
+    private:
+        const std::vector<Vertex>& mVertices;
+        std::vector<UINT> mCanonical; //!< ܂œ_̂\̒_
+        std::vector<UINT> mWeldOf; //!< EFbW܂Ƃ߂Wւ̑Ή
+        std::vector<Point> mPositions; //!< ܂Ƃ߂W
+        std::vector<std::vector<UINT>> mPositionTriangles; //!< WƂ̎Op`
+        std::vector<bool> mPositionDead; //!< kŏW
+        std::vector<UINT> mVersions; //!< kŕς邽тɐi߂
+        std::vector<bool> mBorder; //!< E̍W
+        std::vector<bool> mLocked; //!< ȂW
+        std::vector<Quadric> mQuadrics; //!< WƂ̓񎟌`
+        std::unordered_set<UINT64> mBorderEdges; //!< E̕
+        std::vector<UINT64> mConstrainedEdges; //!< Epڂ̕
+        std::vector<UINT> mCorners; //!< Op`̊p̃EFbW
+        std::vector<bool> mTriangleAlive; //!< cĂOp`
+        UINT mTriangleCount = 0; //!< Op`
+        UINT mAliveTriangles = 0; //!< cĂOp`
+        std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> mHeap;
+        std::vector<std::pair<UINT, UINT>> mWedgeMap; //!< EFbW̕tւ
+        std::vector<UINT> mNeighborsA; //!< Ɨp̗אڒ_
+        std::vector<UINT> mNeighborsB; //!< Ɨp̗אڒ_
+    };
+
+    //_ƎOp`̍ŒZ̓߂
+    float pointTriangleDistanceSq(const Point& p, const Point& a, const Point& b, const Point& c) {
+        const Point ab = b - a, ac = c - a, ap = p - a;
+        const float d1 = dot(ab, ap), d2 = dot(ac, ap);
+        auto distanceSq = [&](const Point& q) {
+            const Point d = p - q;
+            return dot(d, d);
+        };
+        if (d1 <= 0.0f && d2 <= 0.0f) return distanceSq(a);
+        const Point bp = p - b;
+        const float d3 = dot(ab, bp), d4 = dot(ac, bp);
+        if (d3 >= 0.0f && d4 <= d3) return distanceSq(b);
+        const float vc = d1 * d4 - d3 * d2;
+        if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) return distanceSq(a + ab * (d1 / (d1 - d3)));
+        const Point cp = p - c;
+        const float d5 = dot(ab, cp), d6 = dot(ac, cp);
+        if (d6 >= 0.0f && d5 <= d6) return distanceSq(c);
+        const float vb = d5 * d2 - d1 * d6;
+        if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) return distanceSq(a + ac * (d2 / (d2 - d6)));
+        const float va = d3 * d6 - d5 * d4;
+        if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+            return distanceSq(b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))));
+        }
+        const float denom = 1.0f / (va + vb + vc);
+        return distanceSq(a + ab * (vb * denom) + ac * (vc * denom));
+    }
+
+    /**
+     * @class TriangleGrid
+     * @brief ł߂Op`T߂̈lObh
+     */
+    class TriangleGrid {
+    public:
+        TriangleGrid(const std::vector<Vertex>& vertices, const std::vector<Index>& indices)
+            : mVertices(vertices), mIndices(indices) {
+            const UINT triangleCount = static_cast<UINT>(indices.size() / 3);
+            mMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+            Point max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+            for (Index i : indices) {
+                const Point p = toPoint(vertices[i].position);
+                mMin = { std::fmin(mMin.x, p.x), std::fmin(mMin.y, p.y), std::fmin(mMin.z, p.z) };
+                max = { std::fmax(max.x, p.x), std::fmax(max.y, p.y), std::fmax(max.z, p.z) };
+            }
+            //ʂ͕ʓIɍL̂ŁAOp`̕ϓIȑ傫Z̑傫߂
+            double area = 0.0;
+            for (UINT t = 0; t < triangleCount; t++) {
+                const Point p0 = toPoint(vertices[indices[t * 3]].position);
+                area += length(cross(toPoint(vertices[indices[t * 3 + 1]].position) - p0,
+                    toPoint(vertices[indices[t * 3 + 2]].position) - p0)) * 0.5;
+            }
+            const Point size = max - mMin;
+            const float longest = Framework::Math::MathUtil::mymax({ size.x, size.y, size.z, 1e-6f });
+            mCellSize = Framework::Math::MathUtil::mymax(
+                2.0f * static_cast<float>(std::sqrt(area / Framework::Math::MathUtil::mymax(triangleCount, 1u))),
+                longest / MAX_GRID_RESOLUTION);
+            //̃Z΂ɂȂȂ悤ɃZOp`̐{܂łɗ}
+            const size_t maxCellCount = static_cast<size_t>(triangleCount) * 4 + 64;
+            while (true) {
+                for (int axis = 0; axis < 3; axis++) {
+                    const float extent = axis == 0 ? size.x : axis == 1 ? size.y : size.z;
+                    mDims[axis] = Framework::Math::MathUtil::mymax(
+                        1, static_cast<int>(std::ceil(extent / mCellSize)));
+                }
+                if (static_cast<size_t>(mDims[0]) * mDims[1] * mDims[2] <= maxCellCount) break;
+                mCellSize *= 1.25f;
+            }
+            mCells.resize(static_cast<size_t>(mDims[0]) * mDims[1] * mDims[2]);
+            for (UINT t = 0; t < triangleCount; t++) {
+                int lo[3] = { INT_MAX, INT_MAX, INT_MAX }, hi[3] = { INT_MIN, INT_MIN, INT_MIN };
+                for (UINT k = 0; k < 3; k++) {
+                    int cell[3];
+                    toCell(toPoint(vertices[indices[t * 3 + k]].position), cell);
+                    for (int axis = 0; axis < 3; axis++) {
+                        lo[axis] = std::min(lo[axis], cell[axis]);
+                        hi[axis] = std::max(hi[axis], cell[axis]);
+                    }
+                }
+                for (int z = lo[2]; z <= hi[2]; z++) {
+                    for (int y = lo[1]; y <= hi[1]; y++) {
+                        for (int x = lo[0]; x <= hi[0]; x++) mCells[cellIndex(x, y, z)].push_back(t);
+                    }
+                }
+            }
+            mStamps.assign(triangleCount, 0);
+        }
+        //ł߂Op`܂ł̋̓߂
+        float nearestDistanceSq(const Point& p) {
+            mQuery++;
+            int center[3];
+            toCell(p, center);
+            const int maxRing = Framework::Math::MathUtil::mymax({ mDims[0], mDims[1], mDims[2] });
+            float best = FLT_MAX;
+            for (int ring = 0; ring <= maxRing; ring++) {
+                for (int z = center[2] - ring; z <= center[2] + ring; z++) {
+                    if (z < 0 || z >= mDims[2]) continue;
+                    for (int y = center[1] - ring; y <= center[1] + ring; y++) {
+                        if (y < 0 || y >= mDims[1]) continue;
+                        for (int x = center[0] - ring; x <= center[0] + ring; x++) {
+                            if (x < 0 || x >= mDims[0]) continue;
+                            //O̗ւŒׂZ͔΂
+                            if (std::abs(x - center[0]) != ring && std::abs(y - center[1]) != ring
+                                && std::abs(z - center[2]) != ring) {
+                                continue;
+                            }
+                            for (UINT t : mCells[cellIndex(x, y, z)]) {
+                                if (mStamps[t] == mQuery) continue;
+                                mStamps[t] = mQuery;
+                                best = std::fmin(best,
+                                    pointTriangleDistanceSq(p,
+                                        toPoint(mVertices[mIndices[t * 3]].position),
+                                        toPoint(mVertices[mIndices[t * 3 + 1]].position),
+                                        toPoint(mVertices[mIndices[t * 3 + 2]].position)));
+                            }
+                        }
+                    }
+                }
+                //O̗ւ̃Z͂̋߂ɂ͂Ȃ
+                const float reach = ring * mCellSize;
+                if (best <= reach * reach) break;
+            }
+            return best;
+        }
+
+    private:
+        void toCell(const Point& p, int* cell) const {
+            const float v[3] = { p.x - mMin.x, p.y - mMin.y, p.z - mMin.z };
+            for (int axis = 0; axis < 3; axis++) {
+                const int c = static_cast<int>(std::floor(v[axis] / mCellSize));
+                cell[axis] = std::clamp(c, 0, mDims[axis] - 1);
+            }
+        }
+        size_t cellIndex(int x, int y, int z) const {
+            return (static_cast<size_t>(z) * mDims[1] + y) * mDims[0] + x;
+        }
+
+    private:
+        const std::vector<Vertex>& mVertices;
+        const std::vector<Index>& mIndices;
+        Point mMin; //!< Obh̍ŏ̊p
+        float mCellSize; //!< Z̈
+        int mDims[3]; //!< ẽZ
+        std::vector<std::vector<UINT>> mCells; //!< ZƂ̎Op`
+        std::vector<UINT> mStamps; //!< 1̌ŒׂOp`̈
+        UINT mQuery = 0; //!< ̔ԍ
+    };
+
+    //Е̃bV̒_ƏdSAЕ̖ʂ܂ł̍ő̋߂
+    float oneSidedDistance(const std::vector<Vertex>& verticesA, const std::vector<Index>& indicesA,
+        const std::vector<Vertex>& verticesB, const std::vector<Index>& indicesB) {
+        if (indicesA.empty() || indicesB.empty()) return 0.0f;
+        TriangleGrid grid(verticesB, indicesB);
+        float result = 0.0f;
+        std::vector<bool> visited(verticesA.size(), false);
+        for (size_t i = 0; i < indicesA.size(); i += 3) {
+            Point centroid = { 0, 0, 0 };
+            for (size_t k = 0; k < 3; k++) {
+                const Index v = indicesA[i + k];
+                const Point p = toPoint(verticesA[v].position);
+                centroid = centroid + p;
+                if (visited[v]) continue;
+                visited[v] = true;
+                result = std::fmax(result, grid.nearestDistanceSq(p));
+            }
+            result = std::fmax(result, grid.nearestDistanceSq(centroid * (1.0f / 3.0f)));
+        }
+        return std::sqrt(result);
+    }
+} // namespace
+
+namespace Framework::Utility {
+    //Op`炷
+    float MeshSimplifier::simplify(const std::vector<Vertex>& vertices,
+        const std::vector<Index>& indices, const SimplifyOptions& options,
+        std::vector<Index>* result) {
+        Simplifier simplifier(vertices, indices);
+        return simplifier.run(options, result);
+    }
+    //gĂ钸_l߂
+    void MeshSimplifier::compactVertices(const std::vector<Vertex>& vertices,
+        const std::vector<Index>& indices, std::vector<Vertex>* resultVertices,
+        std::vector<Index>* resultIndices) {
+        std::vector<UINT> remap(vertices.size(), INVALID);
+        resultVertices->clear();
+        resultIndices->resize(indices.size());
+        for (size_t i = 0; i < indices.size(); i++) {
+            UINT& target = remap[indices[i]];
+            if (target == INVALID) {
+                target = static_cast<UINT>(resultVertices->size());
+                resultVertices->push_back(vertices[indices[i]]);
+            }
+            (*resultIndices)[i] = static_cast<Index>(target);
+        }
+    }
+    //2̃bṼnEXht߂
+    float MeshSimplifier::computeHausdorffDistance(const std::vector<Vertex>& verticesA,
+        const std::vector<Index>& indicesA, const std::vector<Vertex>& verticesB,
+        const std::vector<Index>& indicesB) {
+        return std::fmax(oneSidedDistance(verticesA, indicesA, verticesB, indicesB),
+            oneSidedDistance(verticesB, indicesB, verticesA, indicesA));
+    }
+    //ڍדxƂ̃bV
+    void MeshSimplifier::buildLodChain(const std::vector<Vertex>& vertices,
+        const std::vector<Index>& indices, const LodChainOptions& options,
+        std::vector<LodMesh>* lods) {
+        lods->clear();
+        std::vector<Index> current = indices;
+        std::vector<Index> next;
+        float error = 0.0f;
+        for (UINT level = 1; level < options.maxLevelCount; level++) {
+            SimplifyOptions simplifyOptions;
+            simplifyOptions.targetIndexCount
+                = static_cast<UINT>(current.size() / 3 * options.reduction) * 3;
+            simplifyOptions.maxError = options.maxError;
+            simplify(vertices, current, simplifyOptions, &next);
+            //pڂ⋫EŎ~܂ČȂ΂ȏ͍Ȃ
+            if (next.empty() || next.size() > current.size() * MIN_LEVEL_REDUCTION) break;
+
+            LodMesh lod;
+            compactVertices(vertices, next, &lod.vertices, &lod.indices);
+            //񎟌덷͕ϓIȂȂ̂ŁAۂ̂ŋeʂm߂
+            const float distance
+                = computeHausdorffDistance(vertices, indices, lod.vertices, lod.indices);
+            if (distance > options.maxError) break;
+            //Iԑ͌덷ł邱ƂOɂ
+            error = std::fmax(error, distance);
+            lod.geometricError = error;
+            lods->push_back(std::move(lod));
+            current.swap(next);
+        }
+    }
+} // namespace Framework::Utility
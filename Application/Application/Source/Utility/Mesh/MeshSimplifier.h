@@ -0,0 +1,90 @@
+/**
+ * @file MeshSimplifier.h
+ * @brief bV̊ȗ
+ * @details 񎟌덷gӂ̏kŎOp`炵AڍדxƂ̃bV
+ */
+
+#pragma once
+#include <cfloat>
+#include <vector>
+#include "DX/ModelCompat.h"
+
+namespace Framework::Utility {
+    /**
+     * @struct SimplifyOptions
+     * @brief ȗ̏
+     * @details ǂ炩̏ɒB~߂
+     */
+    struct SimplifyOptions {
+        UINT targetIndexCount = 0; //!< ڕW̃CfbNX
+        float maxError = FLT_MAX; //!< e덷 [JԂł̋
+    };
+
+    /**
+     * @struct LodChainOptions
+     * @brief ڍדxƂ̃bV
+     */
+    struct LodChainOptions {
+        UINT maxLevelCount = 4; //!< ̃bV܂߂őiK
+        float reduction = 0.5f; //!< 1iKƂɎcOp`̊
+        float maxError = FLT_MAX; //!< e덷 [JԂł̋
+    };
+
+    /**
+     * @struct LodMesh
+     * @brief ȗbV
+     */
+    struct LodMesh {
+        std::vector<DX::Vertex> vertices; //!< gĂ钸_l߂_
+        std::vector<Index> indices; //!< CfbNX
+        float geometricError; //!< ̃bVƂ̃nEXht
+    };
+
+    /**
+     * @class MeshSimplifier
+     * @brief bV̊ȗ
+     * @details _͓Aӂ̕Е̒_ЕɊ񂹂k񂾂ŝŁA
+     * c_̖@EUVEڐ͂̂܂܎g
+     * WőႤ_̌pڂ͌pڂɉĂ̂ݏk񂵁AE̒_͋EɉĂ̂ݏk񂷂
+     */
+    class MeshSimplifier {
+    public:
+        static constexpr float MIN_LEVEL_REDUCTION = 0.9f; //!< ȏ㌸ȂΎ̒iKȂ
+    public:
+        /**
+         * @brief Op`炷
+         * @param vertices _
+         * @param indices CfbNX
+         * @param options ȗ̏
+         * @param result ȗCfbNX̏ݐ _verticeŝ܂܎QƂ
+         * @return 񎟌덷猩ς덷
+         */
+        static float simplify(const std::vector<DX::Vertex>& vertices,
+            const std::vector<Index>& indices, const SimplifyOptions& options,
+            std::vector<Index>* result);
+        /**
+         * @brief gĂ钸_l߂
+         */
+        static void compactVertices(const std::vector<DX::Vertex>& vertices,
+            const std::vector<Index>& indices, std::vector<DX::Vertex>* resultVertices,
+            std::vector<Index>* resultIndices);
+        /**
+         * @brief 2̃bṼnEXht߂
+         * @details _ƎOp`̏dS̖ʂ܂ł̍ŒZ̍őloŋ߂
+         */
+        static float computeHausdorffDistance(const std::vector<DX::Vertex>& verticesA,
+            const std::vector<Index>& indicesA, const std::vector<DX::Vertex>& verticesB,
+            const std::vector<Index>& indicesB);
+        /**
+         * @brief ڍדxƂ̃bV
+         * @param vertices ̒_
+         * @param indices ̃CfbNX
+         * @param options 
+         * @param lods ̃bVeiK̏ݐ ׂɕсA덷͏ɂȂ
+         * @details O̒iKȗĎ̒iKA덷͌̃bVƔׂ
+         */
+        static void buildLodChain(const std::vector<DX::Vertex>& vertices,
+            const std::vector<Index>& indices, const LodChainOptions& options,
+            std::vector<LodMesh>* lods);
+    };
+} // namespace Framework::Utility
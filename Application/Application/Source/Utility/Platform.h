@@ -0,0 +1,26 @@
+/**
+ * @file Platform.h
+ * @brief Ɉˑ{IȌ^
+ * @details WindowsłWindows SDǨ^̂܂܎gAȊO̊ł͓Ǒ^`
+ * D3D12ɈˑȂR[h͂̃wb_[Ō^낤̂ŁALinuxłrhł
+ */
+
+#pragma once
+#include <climits>
+#include <cstdint>
+
+#ifdef _WIN32
+#include <wtypes.h>
+#else
+using BYTE = std::uint8_t;
+using INT = int;
+using INT8 = std::int8_t;
+using INT16 = std::int16_t;
+using INT32 = std::int32_t;
+using INT64 = std::int64_t;
+using UINT = unsigned int;
+using UINT8 = std::uint8_t;
+using UINT16 = std::uint16_t;
+using UINT32 = std::uint32_t;
+using UINT64 = std::uint64_t;
+#endif
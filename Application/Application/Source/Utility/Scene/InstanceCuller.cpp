@@ -0,0 +1,186 @@
+#include "InstanceCuller.h"
+#include <cfloat>
+#include <cmath>
+#include <emmintrin.h>
+#include "Utility/BitScan.h"
+
+using namespace Framework::Math;
+using namespace Framework::Utility;
+
+namespace {
+    //4]uēǂނ̂ŁASƑ傫ԂȂłKv
+    static_assert(sizeof(InstanceBounds) == sizeof(float) * 6, "InstanceBounds must be packed");
+
+    /**
+     * @brief ɎgOČvZ
+     */
+    struct PreparedParams {
+        UINT planeCount; //!< ʂ̐
+        float planes[CullingParams::MAX_PLANE_COUNT][4]; //!< 
+        float absNormals[CullingParams::MAX_PLANE_COUNT][3]; //!< ʂ̖@̐Βl
+        float viewPosition[3]; //!< _
+        float maxDistance; //!< ő勗
+        float relevanceDistance; //!< ̊Ołc
+        UINT relevanceMask; //!< ̊Ołc}XN
+    };
+
+    PreparedParams prepare(const CullingParams& params) {
+        PreparedParams result;
+        result.planeCount = Framework::Math::MathUtil::mymin(
+            params.planeCount, CullingParams::MAX_PLANE_COUNT);
+        for (UINT p = 0; p < result.planeCount; p++) {
+            const Vector4& plane = params.planes[p];
+            result.planes[p][0] = plane.x;
+            result.planes[p][1] = plane.y;
+            result.planes[p][2] = plane.z;
+            result.planes[p][3] = plane.w;
+            result.absNormals[p][0] = std::abs(plane.x);
+            result.absNormals[p][1] = std::abs(plane.y);
+            result.absNormals[p][2] = std::abs(plane.z);
+        }
+        result.viewPosition[0] = params.viewPosition.x;
+        result.viewPosition[1] = params.viewPosition.y;
+        result.viewPosition[2] = params.viewPosition.z;
+        result.maxDistance = params.maxDistance > 0.0f ? params.maxDistance : FLT_MAX;
+        result.relevanceDistance = params.relevanceDistance;
+        result.relevanceMask = params.relevanceMask;
+        return result;
+    }
+
+    //1肷
+    bool testInstance(const PreparedParams& params, const InstanceBounds& bounds, UINT mask) {
+        const Vector3& c = bounds.center;
+        const Vector3& e = bounds.extents;
+        bool inside = true;
+        for (UINT p = 0; p < params.planeCount; p++) {
+            const float* plane = params.planes[p];
+            const float* absNormal = params.absNormals[p];
+            //łɊ_łOɂ΃{bNXŜO
+            const float distance = plane[0] * c.x + plane[1] * c.y + plane[2] * c.z + plane[3];
+            const float radius = absNormal[0] * e.x + absNormal[1] * e.y + absNormal[2] * e.z;
+            if (distance + radius < 0.0f) inside = false;
+        }
+        const float dx = c.x - params.viewPosition[0];
+        const float dy = c.y - params.viewPosition[1];
+        const float dz = c.z - params.viewPosition[2];
+        //{bNX͂ދ̕\ʂ܂ł̋Ŕ肷
+        const float distance = std::sqrt(dx * dx + dy * dy + dz * dz)
+            - std::sqrt(e.x * e.x + e.y * e.y + e.z * e.z);
+        if (inside && distance <= params.maxDistance) return true;
+        return (mask & params.relevanceMask) != 0 && distance <= params.relevanceDistance;
+    }
+
+    //4܂Ƃ߂Ĕ肵Aĉ̃rbgԂ
+    int testInstances4(const PreparedParams& params, const InstanceBounds* bounds, const UINT* masks) {
+        //(cx,cy,cz,ex)(cz,ex,ey,ez)ǂœ]uƊe4
+        __m128 cx = _mm_loadu_ps(&bounds[0].center.x);
+        __m128 cy = _mm_loadu_ps(&bounds[1].center.x);
+        __m128 cz = _mm_loadu_ps(&bounds[2].center.x);
+        __m128 unused0 = _mm_loadu_ps(&bounds[3].center.x);
+        _MM_TRANSPOSE4_PS(cx, cy, cz, unused0);
+        __m128 unused1 = _mm_loadu_ps(&bounds[0].center.z);
+        __m128 ex = _mm_loadu_ps(&bounds[1].center.z);
+        __m128 ey = _mm_loadu_ps(&bounds[2].center.z);
+        __m128 ez = _mm_loadu_ps(&bounds[3].center.z);
+        _MM_TRANSPOSE4_PS(unused1, ex, ey, ez);
+
+        const __m128 zero = _mm_setzero_ps();
+        __m128 outside = zero;
+        for (UINT p = 0; p < params.planeCount; p++) {
+            const float* plane = params.planes[p];
+            const float* absNormal = params.absNormals[p];
+            __m128 distance = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(cx, _mm_set1_ps(plane[0])),
+                    _mm_mul_ps(cy, _mm_set1_ps(plane[1]))),
+                _mm_add_ps(_mm_mul_ps(cz, _mm_set1_ps(plane[2])), _mm_set1_ps(plane[3])));
+            __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, _mm_set1_ps(absNormal[0])),
+                                           _mm_mul_ps(ey, _mm_set1_ps(absNormal[1]))),
+                _mm_mul_ps(ez, _mm_set1_ps(absNormal[2])));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), zero));
+        }
+        const __m128 dx = _mm_sub_ps(cx, _mm_set1_ps(params.viewPosition[0]));
+        const __m128 dy = _mm_sub_ps(cy, _mm_set1_ps(params.viewPosition[1]));
+        const __m128 dz = _mm_sub_ps(cz, _mm_set1_ps(params.viewPosition[2]));
+        const __m128 centerDistance = _mm_sqrt_ps(
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+        const __m128 sphereRadius = _mm_sqrt_ps(
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey)), _mm_mul_ps(ez, ez)));
+        const __m128 distance = _mm_sub_ps(centerDistance, sphereRadius);
+
+        const __m128 inView = _mm_andnot_ps(
+            outside, _mm_cmple_ps(distance, _mm_set1_ps(params.maxDistance)));
+        //}XNdȂȂ͎̂̊Oł͎cȂ
+        const __m128i maskBits = _mm_and_si128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks)),
+            _mm_set1_epi32(static_cast<int>(params.relevanceMask)));
+        const __m128 irrelevant = _mm_castsi128_ps(_mm_cmpeq_epi32(maskBits, _mm_setzero_si128()));
+        const __m128 relevant = _mm_andnot_ps(
+            irrelevant, _mm_cmple_ps(distance, _mm_set1_ps(params.relevanceDistance)));
+        return _mm_movemask_ps(_mm_or_ps(inView, relevant));
+    }
+} // namespace
+
+namespace Framework::Utility {
+    //RXgN^
+    InstanceCuller::InstanceCuller() {}
+    //fXgN^
+    InstanceCuller::~InstanceCuller() {}
+    //r[vWFNVs񂩂王̕ʂo
+    void InstanceCuller::extractFrustumPlanes(const Matrix4x4& viewProj, CullingParams* params) {
+        //sxNgɊ|sȂ̂ŗ񂩂畽ʂ
+        auto column = [&](int c) {
+            return Vector4(viewProj.m[0][c], viewProj.m[1][c], viewProj.m[2][c], viewProj.m[3][c]);
+        };
+        const Vector4 x = column(0);
+        const Vector4 y = column(1);
+        const Vector4 z = column(2);
+        const Vector4 w = column(3);
+        params->planes[0] = w + x; //
+        params->planes[1] = w - x; //E
+        params->planes[2] = w + y; //
+        params->planes[3] = w - y; //
+        params->planes[4] = z; //
+        params->planeCount = 5;
+    }
+    //JO
+    void InstanceCuller::cull(const InstanceStore& instances, const CullingParams& params) {
+        const UINT count = instances.getCount();
+        const PreparedParams prepared = prepare(params);
+        const InstanceBounds* bounds = instances.getWorldBounds();
+        const UINT* masks = instances.getMasks();
+
+        const size_t words = (count + 63) / 64;
+        mActive.resize(count);
+        mNextVisibleBits.assign(words, 0ull);
+        UINT* active = mActive.data();
+        UINT activeCount = 0;
+        UINT i = 0;
+        for (; i + 4 <= count; i += 4) {
+            int bits = testInstances4(prepared, bounds + i, masks + i);
+            if (bits == 0) continue;
+            //4PʂȂ̂Ń[h܂Ȃ
+            mNextVisibleBits[i >> 6] |= static_cast<UINT64>(bits) << (i & 63);
+            while (bits != 0) {
+                const UINT bit = findFirstSetBit(static_cast<UINT64>(bits));
+                bits &= bits - 1;
+                active[activeCount++] = i + bit;
+            }
+        }
+        for (; i < count; i++) {
+            if (!testInstance(prepared, bounds[i], masks[i])) continue;
+            mNextVisibleBits[i >> 6] |= 1ull << (i & 63);
+            active[activeCount++] = i;
+        }
+        mActive.resize(activeCount);
+
+        //ǑʂƔׂĕς̂L^
+        mVisibleBits.resize(words, 0ull);
+        mChangedBits.resize(words);
+        for (size_t w = 0; w < words; w++) {
+            mChangedBits[w] = mVisibleBits[w] ^ mNextVisibleBits[w];
+        }
+        //̌Âʂׂ͔Ȃ
+        if (count & 63) mChangedBits[words - 1] &= (1ull << (count & 63)) - 1;
+        mVisibleBits.swap(mNextVisibleBits);
+    }
+} // namespace Framework::Utility
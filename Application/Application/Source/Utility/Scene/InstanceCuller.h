@@ -0,0 +1,98 @@
+/**
+ * @file InstanceCuller.h
+ * @brief CX^X̃JO
+ * @details [hԂ̃oEfBO{bNXƋŔ肵ATLASɓCX^X߂
+ */
+
+#pragma once
+#include <array>
+#include <vector>
+#include "Math/Matrix4x4.h"
+#include "Math/Vector4.h"
+#include "Utility/Scene/InstanceStore.h"
+
+namespace Framework::Utility {
+    /**
+     * @struct CullingParams
+     * @brief JȌ
+     * @details Cg[VOł͉ʊÔ̂e┽˂Ɏʂ̂ŁA
+     * ߂ɂw肵}XÑCX^X͎̊Ołc
+     */
+    struct CullingParams {
+        static constexpr UINT MAX_PLANE_COUNT = 6; //!< ʂ̍ő吔
+        std::array<Math::Vector4, MAX_PLANE_COUNT> planes; //!< ɂȂ镽 (a,b,c,d)
+        UINT planeCount = 0; //!< gʂ̐ 0Ȃ王Ŕ肵Ȃ
+        Math::Vector3 viewPosition; //!< _̍W
+        float maxDistance = 0.0f; //!< ̒ł艓̂͊O 0ȉȂ琧Ȃ
+        float relevanceDistance = 0.0f; //!< ̊Oł̋ȓȂc
+        UINT relevanceMask = 0; //!< ̊OłcCX^X̃}XN
+    };
+
+    /**
+     * @class InstanceCuller
+     * @brief CX^X̃JO
+     * @details 4܂Ƃ߂SIMDŔ肷
+     */
+    class InstanceCuller {
+    public:
+        /**
+         * @brief RXgN^
+         */
+        InstanceCuller();
+        /**
+         * @brief fXgN^
+         */
+        ~InstanceCuller();
+        /**
+         * @brief r[vWFNVs񂩂王̕ʂo
+         * @param viewProj sxNgɊ|r[vWFNVs
+         * @param params ʂ̏ݐ
+         * @details C͉܂ŔԂ̂ŉʂ͎g킸A̔maxDistanceōs
+         */
+        static void extractFrustumPlanes(const Math::Matrix4x4& viewProj, CullingParams* params);
+        /**
+         * @brief JO
+         * @param instances CX^X̔z updateTransformsς݂ł邱
+         * @param params JȌ
+         */
+        void cull(const InstanceStore& instances, const CullingParams& params);
+        /**
+         * @brief cCX^X̔z̈ʒu擾
+         * @details ʒȕɕ
+         */
+        const std::vector<UINT>& getActiveInstances() const {
+            return mActive;
+        }
+        /**
+         * @brief cCX^X擾
+         */
+        UINT getActiveCount() const {
+            return static_cast<UINT>(mActive.size());
+        }
+        /**
+         * @brief CX^Xc
+         */
+        bool isVisible(UINT dense) const {
+            return (mVisibleBits[dense >> 6] & (1ull << (dense & 63))) != 0;
+        }
+        /**
+         * @brief cCX^X̃rbg擾
+         * @details 64vfƂ1[h
+         */
+        const std::vector<UINT64>& getVisibleBits() const {
+            return mVisibleBits;
+        }
+        /**
+         * @brief ÕJO猋ʂςCX^X̃rbg擾
+         */
+        const std::vector<UINT64>& getChangedBits() const {
+            return mChangedBits;
+        }
+
+    private:
+        std::vector<UINT> mActive; //!< cCX^X
+        std::vector<UINT64> mVisibleBits; //!< cCX^X̃rbg
+        std::vector<UINT64> mNextVisibleBits; //!< 蒆̃rbg
+        std::vector<UINT64> mChangedBits; //!< ʂςCX^X̃rbg
+    };
+} // namespace Framework::Utility
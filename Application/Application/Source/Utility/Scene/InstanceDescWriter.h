@@ -0,0 +1,48 @@
+/**
+ * @file InstanceDescWriter.h
+ * @brief CX^X̔z񂩂TLAS̃CX^XfBXN
+ * @details ݐ̌^̓ev[gɂāAOtBbNXAPIɈˑȂ悤ɂ
+ */
+
+#pragma once
+#include <cstring>
+#include "Utility/Scene/InstanceStore.h"
+
+namespace Framework::Utility {
+    /**
+     * @brief ͈͓̃CX^XfBXN
+     * @tparam Desc D3D12_RAYTRACING_INSTANCE_DESCƓo[^
+     * @param instances CX^X̔z
+     * @param blasAddresses WIg̔ԍňBLAS̃AhX
+     * @param visibleBits cCX^X̃rbg nullptrȂ炷ׂĎc
+     * @param begin ޔ͈͂̐擪
+     * @param end ޔ͈͂̏I[
+     * @param descs CX^XfBXN̏ݐ
+     * @param bounds [hԂł̃oEfBO{bNX̏ݐ
+     * @details ݐ͔͈͂ƂɏdȂȂ̂ŁAʁX̃XbhĂׂ
+     */
+    template <class Desc>
+    inline void writeInstanceDescs(const InstanceStore& instances, const UINT64* blasAddresses,
+        const UINT64* visibleBits, UINT begin, UINT end, Desc* descs, InstanceBounds* bounds) {
+        const InstanceTransform* transforms = instances.getTransforms();
+        const InstanceBounds* worldBounds = instances.getWorldBounds();
+        const UINT* geometries = instances.getGeometries();
+        const UINT* hitGroupIndices = instances.getHitGroupIndices();
+        const UINT* masks = instances.getMasks();
+        const UINT* flags = instances.getFlags();
+        for (UINT i = begin; i < end; i++) {
+            //ݐ̓Abv[hq[vȂ̂ŁAǂݕԂɈxɏ
+            Desc desc;
+            std::memcpy(desc.Transform, transforms[i].m, sizeof(desc.Transform));
+            desc.InstanceID = 0;
+            //}XN0̃CX^Xɂ͂ǂ̃CȂ
+            const bool visible = !visibleBits || (visibleBits[i >> 6] & (1ull << (i & 63))) != 0;
+            desc.InstanceMask = visible ? masks[i] : 0;
+            desc.InstanceContributionToHitGroupIndex = hitGroupIndices[i];
+            desc.Flags = flags[i];
+            desc.AccelerationStructure = blasAddresses[geometries[i]];
+            descs[i] = desc;
+            bounds[i] = worldBounds[i];
+        }
+    }
+} // namespace Framework::Utility
@@ -0,0 +1,337 @@
+#include "InstanceStore.h"
+#include <algorithm>
+#include <cmath>
+#include "Utility/BitScan.h"
+
+using namespace Framework::Math;
+
+namespace {
+    //rbg̃[h߂
+    inline size_t wordCount(size_t count) {
+        return (count + 63) / 64;
+    }
+} // namespace
+
+namespace Framework::Utility {
+    //gE]Esړ̏ōs߂
+    void composeTransform(const Vector3& position, const Quaternion& rotation,
+        const Vector3& scale, InstanceTransform* result) {
+        const float xx = rotation.x * rotation.x, yy = rotation.y * rotation.y,
+                    zz = rotation.z * rotation.z;
+        const float xy = rotation.x * rotation.y, xz = rotation.x * rotation.z,
+                    yz = rotation.y * rotation.z;
+        const float wx = rotation.w * rotation.x, wy = rotation.w * rotation.y,
+                    wz = rotation.w * rotation.z;
+        //xNgɊ|`Ȃ̂ŁAg͗񂲂ƂɊ|
+        float(*m)[4] = result->m;
+        m[0][0] = (1.0f - 2.0f * (yy + zz)) * scale.x;
+        m[0][1] = 2.0f * (xy - wz) * scale.y;
+        m[0][2] = 2.0f * (xz + wy) * scale.z;
+        m[0][3] = position.x;
+        m[1][0] = 2.0f * (xy + wz) * scale.x;
+        m[1][1] = (1.0f - 2.0f * (xx + zz)) * scale.y;
+        m[1][2] = 2.0f * (yz - wx) * scale.z;
+        m[1][3] = position.y;
+        m[2][0] = 2.0f * (xz - wy) * scale.x;
+        m[2][1] = 2.0f * (yz + wx) * scale.y;
+        m[2][2] = (1.0f - 2.0f * (xx + yy)) * scale.z;
+        m[2][3] = position.z;
+    }
+    //oEfBO{bNXϊ
+    //ȇ傫͍s̗vf̐Βlŏd݂ÂaɂȂ
+    void transformBounds(
+        const InstanceBounds& local, const InstanceTransform& transform, InstanceBounds* result) {
+        const float(*m)[4] = transform.m;
+        const Vector3& c = local.center;
+        const Vector3& e = local.extents;
+        result->center = Vector3(m[0][0] * c.x + m[0][1] * c.y + m[0][2] * c.z + m[0][3],
+            m[1][0] * c.x + m[1][1] * c.y + m[1][2] * c.z + m[1][3],
+            m[2][0] * c.x + m[2][1] * c.y + m[2][2] * c.z + m[2][3]);
+        result->extents = Vector3(
+            std::abs(m[0][0]) * e.x + std::abs(m[0][1]) * e.y + std::abs(m[0][2]) * e.z,
+            std::abs(m[1][0]) * e.x + std::abs(m[1][1]) * e.y + std::abs(m[1][2]) * e.z,
+            std::abs(m[2][0]) * e.x + std::abs(m[2][1]) * e.y + std::abs(m[2][2]) * e.z);
+    }
+    //s
+    void multiplyTransform(
+        const InstanceTransform& parent, const InstanceTransform& local, InstanceTransform* result) {
+        const float(*p)[4] = parent.m;
+        const float(*l)[4] = local.m;
+        //ݐ悪Ɠł悢悤Ɉx߂
+        InstanceTransform r;
+        for (int row = 0; row < 3; row++) {
+            for (int col = 0; col < 4; col++) {
+                r.m[row][col]
+                    = p[row][0] * l[0][col] + p[row][1] * l[1][col] + p[row][2] * l[2][col];
+            }
+            r.m[row][3] += p[row][3];
+        }
+        *result = r;
+    }
+    //RXgN^
+    InstanceStore::InstanceStore() {}
+    //fXgN^
+    InstanceStore::~InstanceStore() {}
+    //w肵܂ōĊmۂɊi[ł悤ɂ
+    void InstanceStore::reserve(UINT count) {
+        mSlots.reserve(count);
+        mHandles.reserve(count);
+        mPositions.reserve(count);
+        mRotations.reserve(count);
+        mScales.reserve(count);
+        mTransforms.reserve(count);
+        mLocalBounds.reserve(count);
+        mWorldBounds.reserve(count);
+        mGeometries.reserve(count);
+        mHitGroupIndices.reserve(count);
+        mLodGroups.reserve(count);
+        mMasks.reserve(count);
+        mFlags.reserve(count);
+        mTransformDirtyBits.reserve(wordCount(count));
+        mDirtyBits.reserve(wordCount(count));
+    }
+    //ׂẴCX^X폜
+    void InstanceStore::clear() {
+        //g͎cĐi߁AÂnh𖳌ɂ
+        for (auto&& handle : mHandles) {
+            Slot& slot = mSlots[handle.index];
+            slot.dense = InstanceHandle::INVALID_INDEX;
+            slot.generation++;
+            mFreeSlots.emplace_back(handle.index);
+        }
+        mHandles.clear();
+        mPositions.clear();
+        mRotations.clear();
+        mScales.clear();
+        mTransforms.clear();
+        mLocalBounds.clear();
+        mWorldBounds.clear();
+        mGeometries.clear();
+        mHitGroupIndices.clear();
+        mLodGroups.clear();
+        mMasks.clear();
+        mFlags.clear();
+        mTransformDirtyBits.clear();
+        mDirtyBits.clear();
+    }
+    //CX^X𐶐
+    InstanceHandle InstanceStore::create(const InstanceCreateDesc& desc) {
+        return pushBack(desc);
+    }
+    //CX^X܂Ƃ߂Đ
+    void InstanceStore::createBulk(
+        const InstanceCreateDesc* descs, UINT count, InstanceHandle* handles) {
+        reserve(getCount() + count);
+        for (UINT i = 0; i < count; i++) {
+            const InstanceHandle handle = pushBack(descs[i]);
+            if (handles) handles[i] = handle;
+        }
+    }
+    //CX^X폜
+    void InstanceStore::destroy(const InstanceHandle& handle) {
+        removeAt(getDenseIndex(handle));
+    }
+    //CX^X܂Ƃ߂č폜
+    void InstanceStore::destroyBulk(const InstanceHandle* handles, UINT count) {
+        std::vector<UINT> denseIndices;
+        denseIndices.reserve(count);
+        for (UINT i = 0; i < count; i++) {
+            if (!isValid(handles[i])) continue;
+            denseIndices.emplace_back(mSlots[handles[i].index].dense);
+        }
+        //납΁AړĂvf폜ΏۂɂȂ邱Ƃ͂Ȃ
+        std::sort(denseIndices.begin(), denseIndices.end(), std::greater<UINT>());
+        denseIndices.erase(
+            std::unique(denseIndices.begin(), denseIndices.end()), denseIndices.end());
+        for (auto&& dense : denseIndices) { removeAt(dense); }
+    }
+    //z̈ʒu擾
+    UINT InstanceStore::getDenseIndex(const InstanceHandle& handle) const {
+        MY_ASSERTION(isValid(handle), "ȃCX^X̃nhł");
+        return mSlots[handle.index].dense;
+    }
+    //z̈ʒunh擾
+    InstanceHandle InstanceStore::getHandle(UINT dense) const {
+        MY_ASSERTION(dense < getCount(), "͈͊ÕCX^Xł");
+        return mHandles[dense];
+    }
+    //Wݒ肷
+    void InstanceStore::setPosition(const InstanceHandle& handle, const Vector3& position) {
+        const UINT dense = getDenseIndex(handle);
+        mPositions[dense] = position;
+        markTransformDirty(dense);
+    }
+    //]ݒ肷
+    void InstanceStore::setRotation(const InstanceHandle& handle, const Quaternion& rotation) {
+        const UINT dense = getDenseIndex(handle);
+        mRotations[dense] = rotation;
+        markTransformDirty(dense);
+    }
+    //gݒ肷
+    void InstanceStore::setScale(const InstanceHandle& handle, const Vector3& scale) {
+        const UINT dense = getDenseIndex(handle);
+        mScales[dense] = scale;
+        markTransformDirty(dense);
+    }
+    //WE]Eg܂Ƃ߂Đݒ肷
+    void InstanceStore::setTransform(const InstanceHandle& handle, const Vector3& position,
+        const Quaternion& rotation, const Vector3& scale) {
+        const UINT dense = getDenseIndex(handle);
+        mPositions[dense] = position;
+        mRotations[dense] = rotation;
+        mScales[dense] = scale;
+        markTransformDirty(dense);
+    }
+    //[hϊs𒼐ڐݒ肷
+    void InstanceStore::setWorldTransform(
+        const InstanceHandle& handle, const InstanceTransform& transform) {
+        const UINT dense = getDenseIndex(handle);
+        mTransforms[dense] = transform;
+        transformBounds(mLocalBounds[dense], transform, &mWorldBounds[dense]);
+        //WE]Eg傩vZȂ悤ɂ
+        mTransformDirtyBits[dense >> 6] &= ~(1ull << (dense & 63));
+        markDirty(dense);
+    }
+    //[JԂł̃oEfBO{bNXݒ肷
+    void InstanceStore::setLocalBounds(const InstanceHandle& handle, const InstanceBounds& bounds) {
+        const UINT dense = getDenseIndex(handle);
+        mLocalBounds[dense] = bounds;
+        //s͕ςȂ̂ŁA[hԂ̃oEfBO{bNXXV
+        transformBounds(bounds, mTransforms[dense], &mWorldBounds[dense]);
+        markDirty(dense);
+    }
+    //C̃}XNݒ肷
+    void InstanceStore::setMask(const InstanceHandle& handle, UINT mask) {
+        const UINT dense = getDenseIndex(handle);
+        mMasks[dense] = mask;
+        markDirty(dense);
+    }
+    //qbgO[v̌vZɎgpCfbNXݒ肷
+    void InstanceStore::setHitGroupIndex(const InstanceHandle& handle, UINT hitGroupIndex) {
+        const UINT dense = getDenseIndex(handle);
+        mHitGroupIndices[dense] = hitGroupIndex;
+        markDirty(dense);
+    }
+    //QƂWIg؂ւ
+    void InstanceStore::setGeometry(
+        const InstanceHandle& handle, UINT geometry, UINT hitGroupIndex) {
+        const UINT dense = getDenseIndex(handle);
+        mGeometries[dense] = geometry;
+        mHitGroupIndices[dense] = hitGroupIndex;
+        markDirty(dense);
+    }
+    //ϊςCX^X̍sXV
+    UINT InstanceStore::updateTransforms() {
+        UINT updated = 0;
+        for (size_t word = 0; word < mTransformDirtyBits.size(); word++) {
+            UINT64 bits = mTransformDirtyBits[word];
+            if (bits == 0) continue;
+            //ϊς͔̂z̒gς
+            mDirtyBits[word] |= bits;
+            mTransformDirtyBits[word] = 0;
+            while (bits != 0) {
+                const UINT bit = findFirstSetBit(bits);
+                bits &= bits - 1;
+                const size_t i = word * 64 + bit;
+                composeTransform(mPositions[i], mRotations[i], mScales[i], &mTransforms[i]);
+                transformBounds(mLocalBounds[i], mTransforms[i], &mWorldBounds[i]);
+                updated++;
+            }
+        }
+        return updated;
+    }
+    //z̒gςL^
+    void InstanceStore::clearDirty() {
+        std::fill(mDirtyBits.begin(), mDirtyBits.end(), 0ull);
+    }
+    //z̖ɗvfǉ
+    InstanceHandle InstanceStore::pushBack(const InstanceCreateDesc& desc) {
+        const UINT dense = getCount();
+        InstanceHandle handle;
+        if (mFreeSlots.empty()) {
+            handle.index = static_cast<UINT>(mSlots.size());
+            mSlots.emplace_back();
+        } else {
+            handle.index = mFreeSlots.back();
+            mFreeSlots.pop_back();
+        }
+        Slot& slot = mSlots[handle.index];
+        slot.dense = dense;
+        handle.generation = slot.generation;
+
+        mHandles.emplace_back(handle);
+        mPositions.emplace_back(desc.position);
+        mRotations.emplace_back(desc.rotation);
+        mScales.emplace_back(desc.scale);
+        mTransforms.emplace_back();
+        mLocalBounds.emplace_back(desc.localBounds);
+        mWorldBounds.emplace_back();
+        mGeometries.emplace_back(desc.geometry);
+        mHitGroupIndices.emplace_back(desc.hitGroupIndex);
+        mLodGroups.emplace_back(desc.lodGroup);
+        mMasks.emplace_back(desc.mask);
+        mFlags.emplace_back(desc.flags);
+        resizeBits();
+        markTransformDirty(dense);
+        markDirty(dense);
+        return handle;
+    }
+    //z̗vf𖖔Ɠւč폜
+    void InstanceStore::removeAt(UINT dense) {
+        const UINT last = getCount() - 1;
+        const UINT64 lastMask = 1ull << (last & 63);
+        const InstanceHandle removed = mHandles[dense];
+        if (dense != last) {
+            const InstanceHandle moved = mHandles[last];
+            mHandles[dense] = moved;
+            mPositions[dense] = mPositions[last];
+            mRotations[dense] = mRotations[last];
+            mScales[dense] = mScales[last];
+            mTransforms[dense] = mTransforms[last];
+            mLocalBounds[dense] = mLocalBounds[last];
+            mWorldBounds[dense] = mWorldBounds[last];
+            mGeometries[dense] = mGeometries[last];
+            mHitGroupIndices[dense] = mHitGroupIndices[last];
+            mLodGroups[dense] = mLodGroups[last];
+            mMasks[dense] = mMasks[last];
+            mFlags[dense] = mFlags[last];
+            mSlots[moved.index].dense = dense;
+            //f̕ϊ͈pAʒuς̂Œg͕ς̂Ƃ
+            const UINT64 bit = 1ull << (dense & 63);
+            if (mTransformDirtyBits[last >> 6] & lastMask) {
+                mTransformDirtyBits[dense >> 6] |= bit;
+            } else {
+                mTransformDirtyBits[dense >> 6] &= ~bit;
+            }
+            markDirty(dense);
+        }
+        mTransformDirtyBits[last >> 6] &= ~lastMask;
+        mDirtyBits[last >> 6] &= ~lastMask;
+
+        mHandles.pop_back();
+        mPositions.pop_back();
+        mRotations.pop_back();
+        mScales.pop_back();
+        mTransforms.pop_back();
+        mLocalBounds.pop_back();
+        mWorldBounds.pop_back();
+        mGeometries.pop_back();
+        mHitGroupIndices.pop_back();
+        mLodGroups.pop_back();
+        mMasks.pop_back();
+        mFlags.pop_back();
+        resizeBits();
+
+        Slot& slot = mSlots[removed.index];
+        slot.dense = InstanceHandle::INVALID_INDEX;
+        slot.generation++;
+        mFreeSlots.emplace_back(removed.index);
+    }
+    //vfɍ킹ă_[eB̃rbg̒ς
+    void InstanceStore::resizeBits() {
+        const size_t words = wordCount(getCount());
+        if (mDirtyBits.size() == words) return;
+        mTransformDirtyBits.resize(words, 0ull);
+        mDirtyBits.resize(words, 0ull);
+    }
+} // namespace Framework::Utility
@@ -0,0 +1,305 @@
+/**
+ * @file InstanceStore.h
+ * @brief V[ɔzuCX^X̊Ǘ
+ * @details vfƂɔz𕪂ĖɕׁA폜ĂςȂnhŎQƂ
+ */
+
+#pragma once
+#include <vector>
+#include "Math/Quaternion.h"
+#include "Math/Vector3.h"
+
+namespace Framework::Utility {
+    /**
+     * @struct InstanceHandle
+     * @brief CX^X̃nh
+     * @details 폜ꂽgėpĂオႤ̂ŌÂnh͖ɂȂ
+     */
+    struct InstanceHandle {
+        static constexpr UINT INVALID_INDEX = UINT_MAX; //!< Șg̔ԍ
+        UINT index = INVALID_INDEX; //!< g̔ԍ
+        UINT generation = 0; //!< 
+    };
+
+    /**
+     * @struct InstanceTransform
+     * @brief [hϊs
+     * @details 3s4̍sD4ڂsړ TLAS̃CX^XfBXNƓ
+     */
+    struct InstanceTransform {
+        float m[3][4]; //!< vf
+    };
+
+    /**
+     * @struct InstanceBounds
+     * @brief ɉoEfBO{bNX
+     */
+    struct InstanceBounds {
+        Math::Vector3 center; //!< S
+        Math::Vector3 extents; //!< e̔̑傫
+    };
+
+    /**
+     * @brief gE]Esړ̏ōs߂
+     */
+    void composeTransform(const Math::Vector3& position, const Math::Quaternion& rotation,
+        const Math::Vector3& scale, InstanceTransform* result);
+    /**
+     * @brief s
+     * @param parent ォ|e̍s
+     * @param local Ɋ|q̍s
+     * @param result ݐ Ɠł悢
+     */
+    void multiplyTransform(
+        const InstanceTransform& parent, const InstanceTransform& local, InstanceTransform* result);
+    /**
+     * @brief oEfBO{bNXϊ
+     */
+    void transformBounds(
+        const InstanceBounds& local, const InstanceTransform& transform, InstanceBounds* result);
+
+    /**
+     * @struct InstanceCreateDesc
+     * @brief CX^X̐
+     */
+    struct InstanceCreateDesc {
+        static constexpr UINT NO_LOD_GROUP = UINT_MAX; //!< ڍדx؂ւȂ
+        Math::Vector3 position; //!< W
+        Math::Quaternion rotation = Math::Quaternion::IDENTITY; //!< ]
+        Math::Vector3 scale = Math::Vector3(1.0f); //!< g
+        InstanceBounds localBounds; //!< [JԂł̃oEfBO{bNX
+        UINT geometry = 0; //!< QƂWIg̔ԍ
+        UINT hitGroupIndex = 0; //!< qbgO[v̌vZɎgpCfbNX
+        UINT mask = 0xff; //!< C̃}XN
+        UINT flags = 0; //!< CX^X̃tO
+        UINT lodGroup = NO_LOD_GROUP; //!< ڍדxIԂƂ̃O[v
+    };
+
+    /**
+     * @class InstanceStore
+     * @brief CX^XvfƂ̔zŎ
+     * @details 폜͖Ɠւ̂ŁAz̏Ԃ͐Ƃ͌Ȃ
+     * ϊ̕ύX͕ϊ_[eBɋL^updateTransformsł܂Ƃ߂čsɔf
+     * z̒gςvf̓_[eBɋL^A]clearDirtyŏ
+     */
+    class InstanceStore {
+    public:
+        /**
+         * @brief RXgN^
+         */
+        InstanceStore();
+        /**
+         * @brief fXgN^
+         */
+        ~InstanceStore();
+        /**
+         * @brief w肵܂ōĊmۂɊi[ł悤ɂ
+         */
+        void reserve(UINT count);
+        /**
+         * @brief ׂẴCX^X폜
+         * @details sς݂̃nhׂ͂ĖɂȂ
+         */
+        void clear();
+        /**
+         * @brief CX^X𐶐
+         */
+        InstanceHandle create(const InstanceCreateDesc& desc);
+        /**
+         * @brief CX^X܂Ƃ߂Đ
+         * @param descs ̔z
+         * @param count 鐔
+         * @param handles nh̏ݐ nullptrȂ珑܂Ȃ
+         */
+        void createBulk(const InstanceCreateDesc* descs, UINT count, InstanceHandle* handles);
+        /**
+         * @brief CX^X폜
+         */
+        void destroy(const InstanceHandle& handle);
+        /**
+         * @brief CX^X܂Ƃ߂č폜
+         * @details ȃnhƏdnh͖
+         */
+        void destroyBulk(const InstanceHandle* handles, UINT count);
+        /**
+         * @brief Lȃnh
+         */
+        bool isValid(const InstanceHandle& handle) const {
+            return handle.index < mSlots.size()
+                && mSlots[handle.index].generation == handle.generation
+                && mSlots[handle.index].dense != InstanceHandle::INVALID_INDEX;
+        }
+        /**
+         * @brief z̈ʒu擾
+         */
+        UINT getDenseIndex(const InstanceHandle& handle) const;
+        /**
+         * @brief z̈ʒunh擾
+         */
+        InstanceHandle getHandle(UINT dense) const;
+        /**
+         * @brief Wݒ肷
+         */
+        void setPosition(const InstanceHandle& handle, const Math::Vector3& position);
+        /**
+         * @brief ]ݒ肷
+         */
+        void setRotation(const InstanceHandle& handle, const Math::Quaternion& rotation);
+        /**
+         * @brief gݒ肷
+         */
+        void setScale(const InstanceHandle& handle, const Math::Vector3& scale);
+        /**
+         * @brief WE]Eg܂Ƃ߂Đݒ肷
+         */
+        void setTransform(const InstanceHandle& handle, const Math::Vector3& position,
+            const Math::Quaternion& rotation, const Math::Vector3& scale);
+        /**
+         * @brief [hϊs𒼐ڐݒ肷
+         * @details V[OtȂǂŊOs߂ƂɎg WE]Eg͎gȂ
+         */
+        void setWorldTransform(const InstanceHandle& handle, const InstanceTransform& transform);
+        /**
+         * @brief [JԂł̃oEfBO{bNXݒ肷
+         */
+        void setLocalBounds(const InstanceHandle& handle, const InstanceBounds& bounds);
+        /**
+         * @brief C̃}XNݒ肷
+         */
+        void setMask(const InstanceHandle& handle, UINT mask);
+        /**
+         * @brief qbgO[v̌vZɎgpCfbNXݒ肷
+         */
+        void setHitGroupIndex(const InstanceHandle& handle, UINT hitGroupIndex);
+        /**
+         * @brief QƂWIg؂ւ
+         * @details ڍדxƂɃqbgO[ṽR[ĥŁACfbNX킹Đݒ肷
+         */
+        void setGeometry(const InstanceHandle& handle, UINT geometry, UINT hitGroupIndex);
+        /**
+         * @brief ϊςCX^X̍sƃ[hԂ̃oEfBO{bNXXV
+         * @return XV
+         */
+        UINT updateTransforms();
+        /**
+         * @brief CX^X擾
+         */
+        UINT getCount() const {
+            return static_cast<UINT>(mHandles.size());
+        }
+        /**
+         * @brief [hϊs̔z擾
+         * @details updateTransformsĂԂ܂ł͕ύXfȂ
+         */
+        const InstanceTransform* getTransforms() const {
+            return mTransforms.data();
+        }
+        /**
+         * @brief [hԂł̃oEfBO{bNX̔z擾
+         */
+        const InstanceBounds* getWorldBounds() const {
+            return mWorldBounds.data();
+        }
+        /**
+         * @brief WIg̔ԍ̔z擾
+         */
+        const UINT* getGeometries() const {
+            return mGeometries.data();
+        }
+        /**
+         * @brief qbgO[v̌vZɎgpCfbNX̔z擾
+         */
+        const UINT* getHitGroupIndices() const {
+            return mHitGroupIndices.data();
+        }
+        /**
+         * @brief ڍדx̃O[v̔z擾
+         */
+        const UINT* getLodGroups() const {
+            return mLodGroups.data();
+        }
+        /**
+         * @brief C̃}XN̔z擾
+         */
+        const UINT* getMasks() const {
+            return mMasks.data();
+        }
+        /**
+         * @brief CX^X̃tO̔z擾
+         */
+        const UINT* getFlags() const {
+            return mFlags.data();
+        }
+        /**
+         * @brief z̒gς
+         */
+        bool isDirty(UINT dense) const {
+            return (mDirtyBits[dense >> 6] & (1ull << (dense & 63))) != 0;
+        }
+        /**
+         * @brief z̒gςvf̃rbg擾
+         * @details 64vfƂ1[h
+         */
+        const std::vector<UINT64>& getDirtyBits() const {
+            return mDirtyBits;
+        }
+        /**
+         * @brief z̒gςL^
+         */
+        void clearDirty();
+
+    private:
+        /**
+         * @struct Slot
+         * @brief nhz̈ʒu߂̘g
+         */
+        struct Slot {
+            UINT dense = InstanceHandle::INVALID_INDEX; //!< z̈ʒu 󂫂ȂINVALID_INDEX
+            UINT generation = 0; //!< 
+        };
+
+    private:
+        /**
+         * @brief z̖ɗvfǉ
+         */
+        InstanceHandle pushBack(const InstanceCreateDesc& desc);
+        /**
+         * @brief z̗vf𖖔Ɠւč폜
+         */
+        void removeAt(UINT dense);
+        /**
+         * @brief vfɍ킹ă_[eB̃rbg̒ς
+         */
+        void resizeBits();
+        /**
+         * @brief ϊςƂL^
+         */
+        void markTransformDirty(UINT dense) {
+            mTransformDirtyBits[dense >> 6] |= 1ull << (dense & 63);
+        }
+        /**
+         * @brief z̒gςƂL^
+         */
+        void markDirty(UINT dense) {
+            mDirtyBits[dense >> 6] |= 1ull << (dense & 63);
+        }
+
+    private:
+        std::vector<Slot> mSlots; //!< nh̘g
+        std::vector<UINT> mFreeSlots; //!< ėpłg
+        std::vector<InstanceHandle> mHandles; //!< z̈ʒuƂ̃nh
+        std::vector<Math::Vector3> mPositions; //!< W
+        std::vector<Math::Quaternion> mRotations; //!< ]
+        std::vector<Math::Vector3> mScales; //!< g
+        std::vector<InstanceTransform> mTransforms; //!< [hϊs
+        std::vector<InstanceBounds> mLocalBounds; //!< [JԂł̃oEfBO{bNX
+        std::vector<InstanceBounds> mWorldBounds; //!< [hԂł̃oEfBO{bNX
+        std::vector<UINT> mGeometries; //!< WIg̔ԍ
+        std::vector<UINT> mHitGroupIndices; //!< qbgO[v̌vZɎgpCfbNX
+        std::vector<UINT> mLodGroups; //!< ڍדx̃O[v
+        std::vector<UINT> mMasks; //!< C̃}XN
+        std::vector<UINT> mFlags; //!< CX^X̃tO
+        std::vector<UINT64> mTransformDirtyBits; //!< ϊςvf
+        std::vector<UINT64> mDirtyBits; //!< z̒gςvf
+    };
+} // namespace Framework::Utility
@@ -0,0 +1,136 @@
+#include "LodSelector.h"
+#include <cfloat>
+#include <cmath>
+
+using namespace Framework::Math;
+
+namespace {
+    //s̊e̒̂ő̂̂߂
+    float maxAxisScale(const Framework::Utility::InstanceTransform& transform) {
+        float result = 0.0f;
+        for (int c = 0; c < 3; c++) {
+            const float lengthSq = transform.m[0][c] * transform.m[0][c]
+                + transform.m[1][c] * transform.m[1][c] + transform.m[2][c] * transform.m[2][c];
+            result = Framework::Math::MathUtil::mymax(result, lengthSq);
+        }
+        return std::sqrt(result);
+    }
+} // namespace
+
+namespace Framework::Utility {
+    //RXgN^
+    LodSelector::LodSelector() : mLevelCounts{} {}
+    //fXgN^
+    LodSelector::~LodSelector() {}
+    //ׂẴO[v폜
+    void LodSelector::clear() {
+        mLevels.clear();
+        mGroups.clear();
+        mSelected.clear();
+        mLevelCounts.fill(0);
+    }
+    //O[vǉ
+    UINT LodSelector::addGroup(const LodLevel* levels, UINT count) {
+        MY_ASSERTION(count > 0 && count <= MAX_LEVEL_COUNT, "iK͈͊Oł");
+        for (UINT i = 1; i < count; i++) {
+            MY_ASSERTION(levels[i - 1].geometricError <= levels[i].geometricError,
+                "덷ׂ͍ɏłKv܂");
+        }
+        mGroups.push_back({ static_cast<UINT>(mLevels.size()), count });
+        mLevels.insert(mLevels.end(), levels, levels + count);
+        return static_cast<UINT>(mGroups.size()) - 1;
+    }
+    //ˉe̊g嗦߂
+    float LodSelector::computeProjectionScale(float fovY, float screenHeight) {
+        return screenHeight / (2.0f * std::tan(fovY * 0.5f));
+    }
+    //ڍדxIсAςCX^X̃WIg؂ւ
+    UINT LodSelector::select(InstanceStore* instances, const LodParams& params,
+        const std::vector<UINT>* active, WorkerPool* workers) {
+        const UINT count = active ? static_cast<UINT>(active->size()) : instances->getCount();
+        mSelected.resize(count);
+        const UINT* groups = instances->getLodGroups();
+        const UINT* geometries = instances->getGeometries();
+        const InstanceTransform* transforms = instances->getTransforms();
+        const InstanceBounds* bounds = instances->getWorldBounds();
+
+        //IԊԂ̓CX^XȂ̂ŁAʒuƂɕĕɑIׂ
+        auto selectRange = [&](UINT begin, UINT end) {
+            for (UINT i = begin; i < end; i++) {
+                const UINT dense = active ? (*active)[i] : i;
+                if (groups[dense] == InstanceCreateDesc::NO_LOD_GROUP) {
+                    mSelected[i] = NOT_SELECTED;
+                    continue;
+                }
+                MY_ASSERTION(groups[dense] < mGroups.size(), "ȃO[vł");
+                const Group& group = mGroups[groups[dense]];
+                const LodLevel* levels = &mLevels[group.firstLevel];
+                //QƂĂWIg獡̒iKT ȂΕK؂ւ
+                UINT current = group.levelCount;
+                for (UINT level = 0; level < group.levelCount; level++) {
+                    if (levels[level].geometry == geometries[dense]) {
+                        current = level;
+                        break;
+                    }
+                }
+
+                //{bNX͂ދ̕\ʂ܂ł̋Ōς ɂȂłׂ
+                const InstanceBounds& b = bounds[dense];
+                const float dx = b.center.x - params.viewPosition.x;
+                const float dy = b.center.y - params.viewPosition.y;
+                const float dz = b.center.z - params.viewPosition.z;
+                const float distance = std::sqrt(dx * dx + dy * dy + dz * dz)
+                    - std::sqrt(b.extents.x * b.extents.x + b.extents.y * b.extents.y
+                        + b.extents.z * b.extents.z);
+                const float pixelsPerUnit = distance > 0.0f
+                    ? maxAxisScale(transforms[dense]) * params.projectionScale / distance
+                    : FLT_MAX;
+
+                const UINT selected = selectLevel(levels, group.levelCount,
+                    current < group.levelCount ? current : 0, pixelsPerUnit, params);
+                mSelected[i]
+                    = static_cast<UINT8>(selected | (selected != current ? CHANGED_BIT : 0));
+            }
+        };
+        if (workers) {
+            workers->parallelFor(count, GRAIN_SIZE, selectRange);
+        } else {
+            selectRange(0, count);
+        }
+
+        //_[eB̋L^̓[hPʂȂ̂ŁA͌Ăяoł܂Ƃ߂čs
+        mLevelCounts.fill(0);
+        UINT changed = 0;
+        for (UINT i = 0; i < count; i++) {
+            const UINT8 selected = mSelected[i];
+            if (selected == NOT_SELECTED) continue;
+            const UINT level = selected & ~CHANGED_BIT;
+            mLevelCounts[level]++;
+            if ((selected & CHANGED_BIT) == 0) continue;
+            const UINT dense = active ? (*active)[i] : i;
+            const LodLevel& target = mLevels[mGroups[groups[dense]].firstLevel + level];
+            instances->setGeometry(
+                instances->getHandle(dense), target.geometry, target.hitGroupIndex);
+            changed++;
+        }
+        return changed;
+    }
+    //1̃CX^X̒iKI
+    UINT LodSelector::selectLevel(const LodLevel* levels, UINT count, UINT current,
+        float pixelsPerUnit, const LodParams& params) {
+        auto fits = [&](UINT level, float maxPixelError) {
+            return levels[level].geometricError * pixelsPerUnit <= maxPixelError;
+        };
+        //eʂ𒴂ĂA܂Ƃ܂łɍׂ
+        if (!fits(current, params.maxPixelError)) {
+            UINT level = current;
+            while (level > 0 && !fits(level, params.maxPixelError)) level--;
+            return level;
+        }
+        //ê͗]TĎ܂Ƃɂ
+        const float coarseError = params.maxPixelError * (1.0f - params.hysteresis);
+        UINT level = current;
+        while (level + 1 < count && fits(level + 1, coarseError)) level++;
+        return level;
+    }
+} // namespace Framework::Utility
@@ -0,0 +1,127 @@
+/**
+ * @file LodSelector.h
+ * @brief ڍדx̑I
+ * @details ʏł̌덷e͈͂Ɏ܂łebVCX^XƂɑI
+ */
+
+#pragma once
+#include <array>
+#include <vector>
+#include "Math/Vector3.h"
+#include "Utility/Scene/InstanceStore.h"
+#include "Utility/Thread/WorkerPool.h"
+
+namespace Framework::Utility {
+    /**
+     * @struct LodLevel
+     * @brief 1iK̏ڍדx
+     */
+    struct LodLevel {
+        UINT geometry; //!< QƂWIg̔ԍ
+        UINT hitGroupIndex; //!< qbgO[v̌vZɎgpCfbNX
+        float geometricError; //!< łׂbV̍ő̂ [JԂł̋
+    };
+
+    /**
+     * @struct LodParams
+     * @brief ڍדxIԏ
+     */
+    struct LodParams {
+        Math::Vector3 viewPosition; //!< _̍W
+        float projectionScale = 1.0f; //!< 1ł1Pʂ̃sNZ
+        float maxPixelError = 1.0f; //!< eʏł̌덷̃sNZ
+        float hysteresis = 0.25f; //!< eƂɋeʂ獷 Eł̂h
+    };
+
+    /**
+     * @class LodSelector
+     * @brief ڍדx̑I
+     * @details ݂̒iK̓CX^XQƂĂWIg狁߂̂ŁA
+     * 폜Ŕz̏ԂςĂIђ̏ԂȂ
+     * ׂƂ͋eʂ𒴂炷؂ւAeƂ͋eʂ菭]Tł܂ő҂
+     */
+    class LodSelector {
+    public:
+        static constexpr UINT MAX_LEVEL_COUNT = 8; //!< O[vƂ̍őiK
+        static constexpr UINT GRAIN_SIZE = 4096; //!< ɑIԂƂ̑̕傫
+    public:
+        /**
+         * @brief RXgN^
+         */
+        LodSelector();
+        /**
+         * @brief fXgN^
+         */
+        ~LodSelector();
+        /**
+         * @brief ׂẴO[v폜
+         */
+        void clear();
+        /**
+         * @brief O[vǉ
+         * @param levels ׂɕׂiK 덷͏ł邱
+         * @param count iK
+         * @return O[v̔ԍ InstanceCreateDesc::lodGroupɎw肷
+         */
+        UINT addGroup(const LodLevel* levels, UINT count);
+        /**
+         * @brief ˉe̊g嗦߂
+         * @param fovY c̎p(WA)
+         * @param screenHeight ʂ̍̃sNZ
+         */
+        static float computeProjectionScale(float fovY, float screenHeight);
+        /**
+         * @brief ڍדxIсAςCX^X̃WIg؂ւ
+         * @param instances CX^X̔z updateTransformsς݂ł邱
+         * @param params Iԏ
+         * @param active IԃCX^X̔z̈ʒu nullptrȂ炷ׂ
+         * @param workers đIԃXbh nullptrȂĂяoőI
+         * @return ؂ւ
+         */
+        UINT select(InstanceStore* instances, const LodParams& params,
+            const std::vector<UINT>* active, WorkerPool* workers);
+        /**
+         * @brief O[v擾
+         */
+        UINT getGroupCount() const {
+            return static_cast<UINT>(mGroups.size());
+        }
+        /**
+         * @brief ŌɑI񂾂Ƃ̒iKƂ̃CX^X擾
+         */
+        const std::array<UINT, MAX_LEVEL_COUNT>& getLevelCounts() const {
+            return mLevelCounts;
+        }
+
+    public:
+        /**
+         * @brief 1̃CX^X̒iKI
+         * @param levels O[v̒iK
+         * @param count iK
+         * @param current ݂̒iK
+         * @param pixelsPerUnit [JԂ1PʂʏŉsNZɂȂ邩
+         * @param params Iԏ
+         * @details 덷͒iKiނقǑ傫̂ŁAeʂɎ܂Ō̒iKT
+         */
+        static UINT selectLevel(const LodLevel* levels, UINT count, UINT current,
+            float pixelsPerUnit, const LodParams& params);
+
+    private:
+        /**
+         * @struct Group
+         * @brief O[v̒iK͈̔
+         */
+        struct Group {
+            UINT firstLevel; //!< ŏ̒iK̈ʒu
+            UINT levelCount; //!< iK
+        };
+        static constexpr UINT8 NOT_SELECTED = 0x7f; //!< O[vȂ̂őIłȂ
+        static constexpr UINT8 CHANGED_BIT = 0x80; //!< iKς
+
+    private:
+        std::vector<LodLevel> mLevels; //!< ׂẴO[v̒iK
+        std::vector<Group> mGroups; //!< O[v
+        std::vector<UINT8> mSelected; //!< I񂾒iK ς̂CHANGED_BIT𗧂Ă
+        std::array<UINT, MAX_LEVEL_COUNT> mLevelCounts; //!< iKƂ̃CX^X
+    };
+} // namespace Framework::Utility
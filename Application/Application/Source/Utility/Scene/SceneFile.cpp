@@ -0,0 +1,431 @@
+#include "SceneFile.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <string_view>
+#include <unordered_map>
+
+using namespace Framework::Math;
+using namespace Framework::Utility;
+
+namespace {
+    static constexpr UINT32 MAGIC = 0x424E4353; //!< t@C̎ʎq("SCNB")
+    static constexpr UINT64 SECTION_ALIGNMENT = 8; //!< z̐擪̃ACg
+    static constexpr float SNORM16_SCALE = 32767.0f; //!< tK̍ől
+
+    /**
+     * @brief oCi`̃wb_[
+     * @details ez̓t@C擪̈ʒuŎwASECTION_ALIGNMENTɂ낦Ēu
+     */
+    struct FileHeader {
+        UINT32 magic;
+        UINT32 version;
+        UINT32 modelCount;
+        UINT32 groupCount;
+        UINT32 instanceCount;
+        UINT32 stringSize;
+        UINT64 modelOffset;
+        UINT64 groupOffset;
+        UINT64 instanceOffset;
+        UINT64 stringOffset;
+    };
+
+    //z̐擪̈ʒu낦
+    inline UINT64 alignSection(UINT64 offset) {
+        return (offset + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+    }
+    //z񂪃t@CɎ܂Ă邩
+    inline bool isValidSection(UINT64 fileSize, UINT64 offset, UINT64 count, UINT64 stride) {
+        return offset % SECTION_ALIGNMENT == 0 && offset <= fileSize
+            && count <= (fileSize - offset) / stride;
+    }
+
+    /**
+     * @brief eLXg`ǂݎe
+     */
+    struct TextScene {
+        std::vector<SceneModelRecord> models;
+        std::vector<SceneGroupRecord> groups;
+        std::vector<SceneInstanceRecord> instances;
+        std::string strings;
+        std::unordered_map<std::string_view, UINT> modelNames;
+        std::unordered_map<std::string_view, UINT> groupNames;
+
+        //e[uɒǉĈʒuԂ
+        UINT32 addString(std::string_view str) {
+            const UINT32 offset = static_cast<UINT32>(strings.size());
+            strings.append(str);
+            strings.push_back('\0');
+            return offset;
+        }
+    };
+
+    /**
+     * @class TextParser
+     * @brief eLXg`̓ǂݎ
+     * @details 1s󔒂ŋ؂A؂̓t@C̓ê܂܎w
+     */
+    class TextParser {
+    public:
+        TextParser(const std::string& text, const std::string& name)
+            : mText(text), mName(name), mPosition(0), mLine(0) {}
+        //ׂĂ̍sǂݎ
+        bool parse(TextScene* scene) {
+            while (nextLine()) {
+                if (mTokens.empty()) continue;
+                const std::string_view command = mTokens[0];
+                bool ok;
+                if (command == "model") {
+                    ok = parseModel(scene);
+                } else if (command == "group") {
+                    ok = parseGroup(scene);
+                } else if (command == "instance") {
+                    ok = parseInstance(scene);
+                } else {
+                    ok = error("unknown command");
+                }
+                if (!ok) return false;
+            }
+            return true;
+        }
+
+    private:
+        //̍s؂
+        bool nextLine() {
+            if (mPosition >= mText.size()) return false;
+            size_t end = mText.find('\n', mPosition);
+            if (end == std::string::npos) end = mText.size();
+            //#ȍ~̓RgƂĈ
+            const size_t contentEnd = static_cast<size_t>(
+                std::find(mText.begin() + mPosition, mText.begin() + end, '#') - mText.begin());
+
+            mTokens.clear();
+            size_t i = mPosition;
+            while (i < contentEnd) {
+                while (i < contentEnd && isSpace(mText[i])) i++;
+                const size_t begin = i;
+                while (i < contentEnd && !isSpace(mText[i])) i++;
+                if (i > begin) mTokens.emplace_back(mText.data() + begin, i - begin);
+            }
+            mPosition = end + 1;
+            mLine++;
+            return true;
+        }
+        //󔒂
+        static bool isSpace(char c) {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+        //L^
+        bool error(const char* message) const {
+            MY_DEBUG_LOG("scene %s(%u): %s\n", mName.c_str(), mLine, message);
+            return false;
+        }
+        //lǂݎ
+        bool readFloat(size_t index, float* value) const {
+            if (index >= mTokens.size()) return error("missing number");
+            //؂̌͋󔒂I[Ȃ̂ŁÂ܂ܕϊł
+            const char* begin = mTokens[index].data();
+            char* end;
+            *value = std::strtof(begin, &end);
+            if (end != begin + mTokens[index].size()) return error("invalid number");
+            return true;
+        }
+        //3̐lǂݎ
+        bool readVector(size_t index, Vector3* value) const {
+            return readFloat(index, &value->x) && readFloat(index + 1, &value->y)
+                && readFloat(index + 2, &value->z);
+        }
+        //WɑϊƐeǂݎ
+        bool parseTransform(size_t index, const TextScene& scene, SceneTransform* transform,
+            UINT* parent) const {
+            Vector3 position;
+            Vector3 rotation(0, 0, 0);
+            Vector3 scale(1, 1, 1);
+            if (!readVector(index, &position)) return false;
+            *parent = SceneFile::NO_PARENT;
+            for (index += 3; index < mTokens.size();) {
+                const std::string_view key = mTokens[index];
+                if (key == "rotation") {
+                    if (!readVector(index + 1, &rotation)) return false;
+                    index += 4;
+                } else if (key == "scale") {
+                    if (!readVector(index + 1, &scale)) return false;
+                    index += 4;
+                } else if (key == "parent") {
+                    if (index + 1 >= mTokens.size()) return error("missing group name");
+                    auto it = scene.groupNames.find(mTokens[index + 1]);
+                    if (it == scene.groupNames.end()) return error("unknown group");
+                    *parent = it->second;
+                    index += 2;
+                } else {
+                    return error("unknown keyword");
+                }
+            }
+            *transform
+                = SceneFile::encodeTransform(position, Quaternion::fromEular(rotation), scale);
+            return true;
+        }
+        //model <O> <t@C> <qbgO[v> [procedural_sphere]
+        bool parseModel(TextScene* scene) {
+            if (mTokens.size() < 4 || mTokens.size() > 5) return error("invalid model");
+            if (scene->models.size() >= SceneFile::MAX_MODEL_COUNT) return error("too many models");
+            SceneModelRecord model = {};
+            model.flags = SceneModelFlags::None;
+            if (mTokens.size() == 5) {
+                if (mTokens[4] != "procedural_sphere") return error("unknown model option");
+                model.flags |= SceneModelFlags::ProceduralSphere;
+            }
+            const UINT index = static_cast<UINT>(scene->models.size());
+            if (!scene->modelNames.emplace(mTokens[1], index).second) {
+                return error("duplicate model name");
+            }
+            model.name = scene->addString(mTokens[1]);
+            model.file = scene->addString(mTokens[2]);
+            model.hitGroup = scene->addString(mTokens[3]);
+            scene->models.emplace_back(model);
+            return true;
+        }
+        //group <O> <W> [ϊ] [e]
+        bool parseGroup(TextScene* scene) {
+            if (mTokens.size() < 2) return error("invalid group");
+            if (scene->groups.size() >= SceneFile::MAX_GROUP_COUNT) return error("too many groups");
+            SceneGroupRecord group = {};
+            //Oo^OɐeT̂ŁAeɂ͂łȂ
+            if (!parseTransform(2, *scene, &group.transform, &group.parent)) return false;
+            const UINT index = static_cast<UINT>(scene->groups.size());
+            if (!scene->groupNames.emplace(mTokens[1], index).second) {
+                return error("duplicate group name");
+            }
+            group.name = scene->addString(mTokens[1]);
+            scene->groups.emplace_back(group);
+            return true;
+        }
+        //instance <f> <W> [ϊ] [e]
+        bool parseInstance(TextScene* scene) {
+            if (mTokens.size() < 2) return error("invalid instance");
+            auto it = scene->modelNames.find(mTokens[1]);
+            if (it == scene->modelNames.end()) return error("unknown model");
+            SceneInstanceRecord instance = {};
+            UINT parent;
+            if (!parseTransform(2, *scene, &instance.transform, &parent)) return false;
+            instance.model = static_cast<UINT16>(it->second);
+            instance.parent = static_cast<UINT16>(parent);
+            scene->instances.emplace_back(instance);
+            return true;
+        }
+
+    private:
+        const std::string& mText; //!< t@C̓e
+        const std::string& mName; //!< ̕\Ɏgt@C
+        size_t mPosition; //!< ̍s̐擪
+        UINT mLine; //!< ̍sԍ
+        std::vector<std::string_view> mTokens; //!< ̍s؂
+    };
+} // namespace
+
+namespace Framework::Utility {
+    //RXgN^
+    SceneFile::SceneFile() {
+        reset();
+    }
+    //fXgN^
+    SceneFile::~SceneFile() {}
+    //V[ǂݍ
+    bool SceneFile::load(
+        const std::filesystem::path& textPath, const std::filesystem::path& binaryPath) {
+        reset();
+        std::error_code ec;
+        const bool hasText = std::filesystem::exists(textPath, ec);
+        bool upToDate = std::filesystem::exists(binaryPath, ec);
+        if (hasText && upToDate) {
+            upToDate = std::filesystem::last_write_time(binaryPath, ec)
+                >= std::filesystem::last_write_time(textPath, ec);
+        }
+        if (upToDate && loadBinary(binaryPath)) return true;
+        if (!hasText || !convert(textPath, binaryPath)) return false;
+        return loadBinary(binaryPath);
+    }
+    //oCi`̃t@Cǂݍ
+    bool SceneFile::loadBinary(const std::filesystem::path& path) {
+        reset();
+        const std::string name = path.filename().string();
+        if (!mFile.open(path)) return false;
+
+        const UINT64 fileSize = mFile.size();
+        const FileHeader* header = reinterpret_cast<const FileHeader*>(mFile.data());
+        if (fileSize < sizeof(FileHeader) || header->magic != MAGIC
+            || header->version != VERSION) {
+            MY_DEBUG_LOG("scene %s: stale\n", name.c_str());
+            reset();
+            return false;
+        }
+        if (!isValidSection(
+                fileSize, header->modelOffset, header->modelCount, sizeof(SceneModelRecord))
+            || !isValidSection(
+                fileSize, header->groupOffset, header->groupCount, sizeof(SceneGroupRecord))
+            || !isValidSection(fileSize, header->instanceOffset, header->instanceCount,
+                sizeof(SceneInstanceRecord))
+            || !isValidSection(fileSize, header->stringOffset, header->stringSize, 1)
+            || header->stringSize == 0) {
+            MY_DEBUG_LOG("scene %s: truncated\n", name.c_str());
+            reset();
+            return false;
+        }
+        const BYTE* data = mFile.data();
+        mModels = reinterpret_cast<const SceneModelRecord*>(data + header->modelOffset);
+        mGroups = reinterpret_cast<const SceneGroupRecord*>(data + header->groupOffset);
+        mInstances = reinterpret_cast<const SceneInstanceRecord*>(data + header->instanceOffset);
+        mStrings = reinterpret_cast<const char*>(data + header->stringOffset);
+        mModelCount = header->modelCount;
+        mGroupCount = header->groupCount;
+        mInstanceCount = header->instanceCount;
+
+        //ԍƕ̈ʒu͈͓ȂAgŊm߂ȂĂ悢
+        const UINT32 stringSize = header->stringSize;
+        bool valid = mStrings[stringSize - 1] == '\0';
+        for (UINT i = 0; valid && i < mModelCount; i++) {
+            const SceneModelRecord& model = mModels[i];
+            valid = model.name < stringSize && model.file < stringSize
+                && model.hitGroup < stringSize;
+        }
+        for (UINT i = 0; valid && i < mGroupCount; i++) {
+            valid = mGroups[i].name < stringSize
+                && (mGroups[i].parent == NO_PARENT || mGroups[i].parent < i);
+        }
+        for (UINT i = 0; valid && i < mInstanceCount; i++) {
+            valid = mInstances[i].model < mModelCount
+                && (mInstances[i].parent == NO_PARENT || mInstances[i].parent < mGroupCount);
+        }
+        if (!valid) {
+            MY_DEBUG_LOG("scene %s: corrupted\n", name.c_str());
+            reset();
+            return false;
+        }
+        return true;
+    }
+    //eLXg`̃t@CoCi`ɕϊ
+    bool SceneFile::convert(
+        const std::filesystem::path& textPath, const std::filesystem::path& binaryPath) {
+        const std::string name = textPath.filename().string();
+        std::string text;
+        {
+            std::ifstream ifs(textPath, std::ios::binary | std::ios::in);
+            if (!ifs) {
+                MY_DEBUG_LOG("scene %s: failed to read\n", name.c_str());
+                return false;
+            }
+            ifs.seekg(0, std::ios::end);
+            text.resize(static_cast<size_t>(ifs.tellg()));
+            ifs.seekg(0, std::ios::beg);
+            ifs.read(text.data(), text.size());
+        }
+        TextScene scene;
+        if (!TextParser(text, name).parse(&scene)) return false;
+        //̕e[u͉ꂽt@CƋʂłȂ̂ŁAK1͓
+        if (scene.strings.empty()) scene.strings.push_back('\0');
+
+        FileHeader header = {};
+        header.magic = MAGIC;
+        header.version = VERSION;
+        header.modelCount = static_cast<UINT32>(scene.models.size());
+        header.groupCount = static_cast<UINT32>(scene.groups.size());
+        header.instanceCount = static_cast<UINT32>(scene.instances.size());
+        header.stringSize = static_cast<UINT32>(scene.strings.size());
+        header.modelOffset = alignSection(sizeof(FileHeader));
+        header.groupOffset
+            = alignSection(header.modelOffset + scene.models.size() * sizeof(SceneModelRecord));
+        header.instanceOffset
+            = alignSection(header.groupOffset + scene.groups.size() * sizeof(SceneGroupRecord));
+        header.stringOffset = alignSection(
+            header.instanceOffset + scene.instances.size() * sizeof(SceneInstanceRecord));
+
+        //ݓr̃t@Cǂ܂Ȃ悤Ɉꎞt@CɏĂu
+        std::error_code ec;
+        std::filesystem::create_directories(binaryPath.parent_path(), ec);
+        std::filesystem::path temp = binaryPath;
+        temp += ".tmp";
+        {
+            std::ofstream ofs(temp, std::ios::binary | std::ios::out | std::ios::trunc);
+            if (!ofs) {
+                MY_DEBUG_LOG("scene %s: failed to write\n", name.c_str());
+                return false;
+            }
+            UINT64 written = 0;
+            auto writeSection = [&](UINT64 offset, const void* data, UINT64 size) {
+                static const char padding[SECTION_ALIGNMENT] = {};
+                ofs.write(padding, offset - written);
+                ofs.write(static_cast<const char*>(data), size);
+                written = offset + size;
+            };
+            writeSection(0, &header, sizeof(header));
+            writeSection(header.modelOffset, scene.models.data(),
+                scene.models.size() * sizeof(SceneModelRecord));
+            writeSection(header.groupOffset, scene.groups.data(),
+                scene.groups.size() * sizeof(SceneGroupRecord));
+            writeSection(header.instanceOffset, scene.instances.data(),
+                scene.instances.size() * sizeof(SceneInstanceRecord));
+            writeSection(header.stringOffset, scene.strings.data(), scene.strings.size());
+            if (!ofs) {
+                MY_DEBUG_LOG("scene %s: failed to write\n", name.c_str());
+                return false;
+            }
+        }
+        std::filesystem::rename(temp, binaryPath, ec);
+        if (ec) {
+            MY_DEBUG_LOG("scene %s: failed to write\n", name.c_str());
+            return false;
+        }
+        return true;
+    }
+    //ϊl߂
+    SceneTransform SceneFile::encodeTransform(
+        const Vector3& position, const Quaternion& rotation, const Vector3& scale) {
+        const Quaternion q = rotation.normalized();
+        auto toSnorm = [](float value) {
+            return static_cast<INT16>(std::lround(
+                MathUtil::clamp(value, -1.0f, 1.0f) * SNORM16_SCALE));
+        };
+        SceneTransform result;
+        result.position[0] = position.x;
+        result.position[1] = position.y;
+        result.position[2] = position.z;
+        result.rotation[0] = toSnorm(q.x);
+        result.rotation[1] = toSnorm(q.y);
+        result.rotation[2] = toSnorm(q.z);
+        result.rotation[3] = toSnorm(q.w);
+        result.scale[0] = scale.x;
+        result.scale[1] = scale.y;
+        result.scale[2] = scale.z;
+        return result;
+    }
+    //l߂ϊ߂
+    void SceneFile::decodeTransform(const SceneTransform& transform, Vector3* position,
+        Quaternion* rotation, Vector3* scale) {
+        *position = Vector3(transform.position[0], transform.position[1], transform.position[2]);
+        //ʎqŒ̂ŐK
+        *rotation = Quaternion(transform.rotation[0] / SNORM16_SCALE,
+            transform.rotation[1] / SNORM16_SCALE, transform.rotation[2] / SNORM16_SCALE,
+            transform.rotation[3] / SNORM16_SCALE)
+                        .normalized();
+        *scale = Vector3(transform.scale[0], transform.scale[1], transform.scale[2]);
+    }
+    //OO[v̔ԍT
+    UINT SceneFile::findGroup(const std::string& name) const {
+        for (UINT i = 0; i < mGroupCount; i++) {
+            if (name == getString(mGroups[i].name)) return i;
+        }
+        return NO_PARENT;
+    }
+    //ǂݍ񂾓ej
+    void SceneFile::reset() {
+        mFile.close();
+        mModels = nullptr;
+        mGroups = nullptr;
+        mInstances = nullptr;
+        mStrings = nullptr;
+        mModelCount = 0;
+        mGroupCount = 0;
+        mInstanceCount = 0;
+    }
+} // namespace Framework::Utility
@@ -0,0 +1,188 @@
+/**
+ * @file SceneFile.h
+ * @brief V[t@C
+ * @details ҏWp̃eLXg`ƁAǂݍݗp̃oCi`
+ */
+
+#pragma once
+#include "Math/Quaternion.h"
+#include "Math/Vector3.h"
+#include "Utility/IO/MappedFile.h"
+
+namespace Framework::Utility {
+    /**
+     * @struct SceneTransform
+     * @brief t@CɊi[ϊ
+     * @details ]͐Kl16bit̕tKŋl߂Ď
+     */
+    struct SceneTransform {
+        float position[3]; //!< e猩W
+        INT16 rotation[4]; //!< e猩] x,y,z,w̏
+        float scale[3]; //!< e猩g
+    };
+
+    /**
+     * @brief f̐ݒ
+     */
+    namespace SceneModelFlags {
+        enum Enum : UINT32 {
+            None = 0,
+            ProceduralSphere = 1 << 0, //!< `͓IȋɂAf̓}eAɂ̂ݎg
+        };
+    } // namespace SceneModelFlags
+
+    /**
+     * @struct SceneModelRecord
+     * @brief f̒`
+     * @details ͕e[üʒuŎ
+     */
+    struct SceneModelRecord {
+        UINT32 name; //!< V[ł̖O
+        UINT32 file; //!< f̃t@C
+        UINT32 hitGroup; //!< qbgO[v
+        UINT32 flags; //!< SceneModelFlags̑gݍ킹
+    };
+
+    /**
+     * @struct SceneGroupRecord
+     * @brief CX^X܂Ƃ߂ē߂̃O[v
+     * @details e͕KOɒ`ꂽO[vɂȂ
+     */
+    struct SceneGroupRecord {
+        UINT32 name; //!< V[ł̖O
+        UINT32 parent; //!< ẽO[v̔ԍ
+        SceneTransform transform; //!< ϊ
+    };
+
+    /**
+     * @struct SceneInstanceRecord
+     * @brief CX^X̔zu
+     */
+    struct SceneInstanceRecord {
+        UINT16 model; //!< f̔ԍ
+        UINT16 parent; //!< ẽO[v̔ԍ
+        SceneTransform transform; //!< ϊ
+    };
+
+    /**
+     * @class SceneFile
+     * @brief V[t@C̓ǂݍ
+     * @details oCi`̓}bvt@Ĉ܂ܔzƂĎQƂ̂ŁA
+     * CX^Xɂ炸ǂݍ݂ŃmۂȂ
+     * eLXg`1s1̒`A#ȍ~͖
+     * - model <O> <t@C> <qbgO[v> [procedural_sphere]
+     * - group <O> <x> <y> <z> [rotation <x> <y> <z>] [scale <x> <y> <z>] [parent <O[v>]
+     * - instance <f> <x> <y> <z> [rotation <x> <y> <z>] [scale <x> <y> <z>] [parent <O[v>]
+     * ]̓IC[p(x)ŏ
+     */
+    class SceneFile {
+    public:
+        static constexpr UINT32 VERSION = 1; //!< oCi`̃o[W
+        static constexpr UINT32 NO_PARENT = 0xffff; //!< ẽO[vȂ
+        static constexpr UINT32 MAX_MODEL_COUNT = 0xffff; //!< f̍ő吔
+        static constexpr UINT32 MAX_GROUP_COUNT = NO_PARENT; //!< O[v̍ő吔
+    public:
+        /**
+         * @brief RXgN^
+         */
+        SceneFile();
+        /**
+         * @brief fXgN^
+         */
+        ~SceneFile();
+        /**
+         * @brief V[ǂݍ
+         * @param textPath eLXg`̃t@CpX
+         * @param binaryPath oCi`̃t@CpX
+         * @return ǂݍ߂ȂfalseԂ
+         * @details oCi`ȂAeLXg`ÂΕϊĂǂݍ
+         */
+        bool load(const std::filesystem::path& textPath, const std::filesystem::path& binaryPath);
+        /**
+         * @brief oCi`̃t@Cǂݍ
+         * @return ݂ȂAo[WႤAĂfalseԂ
+         */
+        bool loadBinary(const std::filesystem::path& path);
+        /**
+         * @brief eLXg`̃t@CoCi`ɕϊ
+         * @param textPath eLXg`̃t@CpX
+         * @param binaryPath ݐ̃t@CpX
+         * @return ̌肪邩߂ȂfalseԂ
+         */
+        static bool convert(
+            const std::filesystem::path& textPath, const std::filesystem::path& binaryPath);
+        /**
+         * @brief ϊl߂
+         */
+        static SceneTransform encodeTransform(const Math::Vector3& position,
+            const Math::Quaternion& rotation, const Math::Vector3& scale);
+        /**
+         * @brief l߂ϊ߂
+         */
+        static void decodeTransform(const SceneTransform& transform, Math::Vector3* position,
+            Math::Quaternion* rotation, Math::Vector3* scale);
+        /**
+         * @brief f擾
+         */
+        UINT getModelCount() const {
+            return mModelCount;
+        }
+        /**
+         * @brief f̒`擾
+         */
+        const SceneModelRecord* getModels() const {
+            return mModels;
+        }
+        /**
+         * @brief O[v擾
+         */
+        UINT getGroupCount() const {
+            return mGroupCount;
+        }
+        /**
+         * @brief O[v擾
+         */
+        const SceneGroupRecord* getGroups() const {
+            return mGroups;
+        }
+        /**
+         * @brief CX^X擾
+         */
+        UINT getInstanceCount() const {
+            return mInstanceCount;
+        }
+        /**
+         * @brief CX^X̔zu擾
+         */
+        const SceneInstanceRecord* getInstances() const {
+            return mInstances;
+        }
+        /**
+         * @brief e[u當擾
+         */
+        const char* getString(UINT32 offset) const {
+            return mStrings + offset;
+        }
+        /**
+         * @brief OO[v̔ԍT
+         * @return ȂNO_PARENTԂ
+         */
+        UINT findGroup(const std::string& name) const;
+
+    private:
+        /**
+         * @brief ǂݍ񂾓ej
+         */
+        void reset();
+
+    private:
+        MappedFile mFile; //!< }bvoCi`̃t@C
+        const SceneModelRecord* mModels; //!< f̒`
+        const SceneGroupRecord* mGroups; //!< O[v
+        const SceneInstanceRecord* mInstances; //!< CX^X̔zu
+        const char* mStrings; //!< e[u
+        UINT mModelCount; //!< f
+        UINT mGroupCount; //!< O[v
+        UINT mInstanceCount; //!< CX^X
+    };
+} // namespace Framework::Utility
@@ -0,0 +1,299 @@
+#include "SceneGraph.h"
+#include "Utility/BitScan.h"
+
+using namespace Framework::Math;
+
+namespace {
+    //rbg̃[h߂
+    inline size_t wordCount(size_t count) {
+        return (count + 63) / 64;
+    }
+    //[begin,end)̃rbg𗧂Ă
+    void setBitRange(std::vector<UINT64>& bits, UINT begin, UINT end) {
+        while (begin < end) {
+            const UINT bit = begin & 63;
+            const UINT count = Framework::Math::MathUtil::mymin(64 - bit, end - begin);
+            const UINT64 mask = count == 64 ? ~0ull : ((1ull << count) - 1) << bit;
+            bits[begin >> 6] |= mask;
+            begin += count;
+        }
+    }
+    //ll
+    inline bool equals(const Quaternion& a, const Quaternion& b) {
+        return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+    }
+} // namespace
+
+namespace Framework::Utility {
+    //RXgN^
+    SceneGraph::SceneGraph() : mNodeCount(0), mLayoutDirty(false), mDirtyCount(0) {}
+    //fXgN^
+    SceneGraph::~SceneGraph() {}
+    //ׂẴm[h폜
+    void SceneGraph::clear() {
+        mNodes.clear();
+        mFreeNodes.clear();
+        mNodeCount = 0;
+        mLayoutDirty = false;
+        mDenseNodes.clear();
+        mParents.clear();
+        mChildBegins.clear();
+        mChildCounts.clear();
+        mPositions.clear();
+        mRotations.clear();
+        mScales.clear();
+        mWorldTransforms.clear();
+        mDirtyBits.clear();
+        mUpdated.clear();
+        mLevelBegins.clear();
+        mUpdatedNodes.clear();
+        mDirtyCount = 0;
+    }
+    //m[h쐬
+    UINT SceneGraph::createNode(UINT parent, const Vector3& position, const Quaternion& rotation,
+        const Vector3& scale, const InstanceHandle& instance) {
+        MY_ASSERTION(parent == INVALID_NODE || isValid(parent), "Ȑem[hł");
+        UINT node;
+        if (mFreeNodes.empty()) {
+            node = static_cast<UINT>(mNodes.size());
+            mNodes.emplace_back();
+        } else {
+            node = mFreeNodes.back();
+            mFreeNodes.pop_back();
+            mNodes[node] = Node();
+        }
+        Node& target = mNodes[node];
+        target.used = true;
+        target.instance = instance;
+        //ג܂ł͖ɒuĂ
+        target.dense = static_cast<UINT>(mDenseNodes.size());
+        mDenseNodes.emplace_back(node);
+        mParents.emplace_back(INVALID_NODE);
+        mChildBegins.emplace_back(0);
+        mChildCounts.emplace_back(0);
+        mPositions.emplace_back(position);
+        mRotations.emplace_back(rotation);
+        mScales.emplace_back(scale);
+        mWorldTransforms.emplace_back();
+        attach(node, parent);
+        mNodeCount++;
+        mLayoutDirty = true;
+        return node;
+    }
+    //m[hqƍ폜
+    void SceneGraph::destroyNode(UINT node) {
+        MY_ASSERTION(isValid(node), "ȃm[hł");
+        detach(node);
+        std::vector<UINT> stack = { node };
+        while (!stack.empty()) {
+            const UINT current = stack.back();
+            stack.pop_back();
+            for (UINT child = mNodes[current].firstChild; child != INVALID_NODE;
+                 child = mNodes[child].nextSibling) {
+                stack.emplace_back(child);
+            }
+            mNodes[current] = Node();
+            mFreeNodes.emplace_back(current);
+            mNodeCount--;
+        }
+        mLayoutDirty = true;
+    }
+    //eς
+    void SceneGraph::setParent(UINT node, UINT parent) {
+        MY_ASSERTION(isValid(node), "ȃm[hł");
+        MY_ASSERTION(parent == INVALID_NODE || isValid(parent), "Ȑem[hł");
+        //̎qeɂƗւł
+        for (UINT ancestor = parent; ancestor != INVALID_NODE; ancestor = mNodes[ancestor].parent) {
+            MY_ASSERTION(ancestor != node, "qeɂ͂ł܂");
+        }
+        detach(node);
+        attach(node, parent);
+        mLayoutDirty = true;
+    }
+    //e猩Wݒ肷
+    void SceneGraph::setLocalPosition(UINT node, const Vector3& position) {
+        MY_ASSERTION(isValid(node), "ȃm[hł");
+        Vector3& current = mPositions[mNodes[node].dense];
+        //lȂq܂ŌvZȂ
+        if (current == position) return;
+        current = position;
+        markDirty(node);
+    }
+    //e猩]ݒ肷
+    void SceneGraph::setLocalRotation(UINT node, const Quaternion& rotation) {
+        MY_ASSERTION(isValid(node), "ȃm[hł");
+        Quaternion& current = mRotations[mNodes[node].dense];
+        if (equals(current, rotation)) return;
+        current = rotation;
+        markDirty(node);
+    }
+    //e猩gݒ肷
+    void SceneGraph::setLocalScale(UINT node, const Vector3& scale) {
+        MY_ASSERTION(isValid(node), "ȃm[hł");
+        Vector3& current = mScales[mNodes[node].dense];
+        if (current == scale) return;
+        current = scale;
+        markDirty(node);
+    }
+    //[hϊsXV
+    UINT SceneGraph::update(InstanceStore* instances, WorkerPool* workers) {
+        if (mLayoutDirty) rebuildLayout();
+        if (mDirtyCount == 0) return 0;
+
+        const UINT updated = workers && mDirtyCount >= PARALLEL_THRESHOLD
+            ? updateParallel(workers)
+            : updateSerial();
+        mDirtyCount = 0;
+        if (instances) {
+            for (auto&& dense : mUpdatedNodes) {
+                const InstanceHandle& instance = mNodes[mDenseNodes[dense]].instance;
+                if (instances->isValid(instance)) {
+                    instances->setWorldTransform(instance, mWorldTransforms[dense]);
+                }
+            }
+        }
+        return updated;
+    }
+    //[hϊs擾
+    const InstanceTransform& SceneGraph::getWorldTransform(UINT node) const {
+        MY_ASSERTION(isValid(node), "ȃm[hł");
+        return mWorldTransforms[mNodes[node].dense];
+    }
+    //em[h擾
+    UINT SceneGraph::getParent(UINT node) const {
+        MY_ASSERTION(isValid(node), "ȃm[hł");
+        return mNodes[node].parent;
+    }
+    //e̎q̈ꗗO
+    void SceneGraph::detach(UINT node) {
+        Node& target = mNodes[node];
+        if (target.parent == INVALID_NODE) return;
+        //Z͑OɂȂłȂ̂ŁAǑZ͂ǂĒT
+        UINT* link = &mNodes[target.parent].firstChild;
+        while (*link != node) { link = &mNodes[*link].nextSibling; }
+        *link = target.nextSibling;
+        target.parent = INVALID_NODE;
+        target.nextSibling = INVALID_NODE;
+    }
+    //e̎q̈ꗗɉ
+    void SceneGraph::attach(UINT node, UINT parent) {
+        Node& target = mNodes[node];
+        target.parent = parent;
+        if (parent == INVALID_NODE) return;
+        target.nextSibling = mNodes[parent].firstChild;
+        mNodes[parent].firstChild = node;
+    }
+    //D̏ɕג
+    void SceneGraph::rebuildLayout() {
+        std::vector<UINT> order;
+        order.reserve(mNodeCount);
+        mLevelBegins.clear();
+        for (UINT node = 0; node < mNodes.size(); node++) {
+            if (mNodes[node].used && mNodes[node].parent == INVALID_NODE) order.emplace_back(node);
+        }
+        std::vector<UINT> parents(mNodeCount, INVALID_NODE);
+        std::vector<UINT> childBegins(mNodeCount, 0);
+        std::vector<UINT> childCounts(mNodeCount, 0);
+        //L[ɐς񂾏̂܂ܕD̏ɂȂAe̎q͘A
+        UINT levelEnd = 0;
+        for (UINT i = 0; i < order.size(); i++) {
+            if (i == levelEnd) {
+                mLevelBegins.emplace_back(i);
+                levelEnd = static_cast<UINT>(order.size());
+            }
+            childBegins[i] = static_cast<UINT>(order.size());
+            for (UINT child = mNodes[order[i]].firstChild; child != INVALID_NODE;
+                 child = mNodes[child].nextSibling) {
+                parents[order.size()] = i;
+                order.emplace_back(child);
+            }
+            childCounts[i] = static_cast<UINT>(order.size()) - childBegins[i];
+        }
+        MY_ASSERTION(order.size() == mNodeCount, "؂̍\Ă܂");
+        mLevelBegins.emplace_back(mNodeCount);
+
+        //O̕тڂւ
+        std::vector<Vector3> positions(mNodeCount);
+        std::vector<Quaternion> rotations(mNodeCount);
+        std::vector<Vector3> scales(mNodeCount);
+        for (UINT i = 0; i < mNodeCount; i++) {
+            Node& node = mNodes[order[i]];
+            positions[i] = mPositions[node.dense];
+            rotations[i] = mRotations[node.dense];
+            scales[i] = mScales[node.dense];
+            node.dense = i;
+        }
+        mDenseNodes.swap(order);
+        mParents.swap(parents);
+        mChildBegins.swap(childBegins);
+        mChildCounts.swap(childCounts);
+        mPositions.swap(positions);
+        mRotations.swap(rotations);
+        mScales.swap(scales);
+        mWorldTransforms.resize(mNodeCount);
+
+        //тς̂őŜvZ
+        mDirtyBits.assign(wordCount(mNodeCount), 0ull);
+        setBitRange(mDirtyBits, 0, mNodeCount);
+        mDirtyCount = mNodeCount;
+        mLayoutDirty = false;
+    }
+    //ύXƂL^
+    void SceneGraph::markDirty(UINT node) {
+        //גƂɂ͑ŜvẐŋL^ȂĂ悢
+        if (mLayoutDirty) return;
+        const UINT dense = mNodes[node].dense;
+        mDirtyBits[dense >> 6] |= 1ull << (dense & 63);
+        mDirtyCount++;
+    }
+    //1̃m[h̃[hϊs߂
+    void SceneGraph::updateNode(UINT dense) {
+        InstanceTransform& world = mWorldTransforms[dense];
+        composeTransform(mPositions[dense], mRotations[dense], mScales[dense], &world);
+        const UINT parent = mParents[dense];
+        if (parent != INVALID_NODE) multiplyTransform(mWorldTransforms[parent], world, &world);
+    }
+    //ύXm[h珇ɎqւǂčXV
+    UINT SceneGraph::updateSerial() {
+        mUpdatedNodes.clear();
+        for (size_t word = 0; word < mDirtyBits.size(); word++) {
+            //q͕Kɂ̂ŁA[hɐς܂ꂽqǂݒď
+            while (mDirtyBits[word] != 0) {
+                const UINT bit = findFirstSetBit(mDirtyBits[word]);
+                mDirtyBits[word] &= mDirtyBits[word] - 1;
+                const UINT dense = static_cast<UINT>(word * 64 + bit);
+                updateNode(dense);
+                setBitRange(mDirtyBits, mChildBegins[dense],
+                    mChildBegins[dense] + mChildCounts[dense]);
+                mUpdatedNodes.emplace_back(dense);
+            }
+        }
+        return static_cast<UINT>(mUpdatedNodes.size());
+    }
+    //[ƂɕĕɍXV
+    UINT SceneGraph::updateParallel(WorkerPool* workers) {
+        mUpdated.assign(mNodeCount, 0);
+        //[̃m[h݂͌ɈˑȂ̂ŁA󂢏ɐ[Ƃɕď
+        for (size_t level = 0; level + 1 < mLevelBegins.size(); level++) {
+            const UINT levelBegin = mLevelBegins[level];
+            workers->parallelFor(mLevelBegins[level + 1] - levelBegin, PARALLEL_GRAIN_SIZE,
+                [&](UINT begin, UINT end) {
+                    for (UINT dense = levelBegin + begin; dense < levelBegin + end; dense++) {
+                        //ςAevZȂvZ
+                        const UINT parent = mParents[dense];
+                        const bool dirty = (mDirtyBits[dense >> 6] & (1ull << (dense & 63))) != 0
+                            || (parent != INVALID_NODE && mUpdated[parent] != 0);
+                        if (!dirty) continue;
+                        updateNode(dense);
+                        mUpdated[dense] = 1;
+                    }
+                });
+        }
+        std::fill(mDirtyBits.begin(), mDirtyBits.end(), 0ull);
+        mUpdatedNodes.clear();
+        for (UINT dense = 0; dense < mNodeCount; dense++) {
+            if (mUpdated[dense] != 0) mUpdatedNodes.emplace_back(dense);
+        }
+        return static_cast<UINT>(mUpdatedNodes.size());
+    }
+} // namespace Framework::Utility
@@ -0,0 +1,173 @@
+/**
+ * @file SceneGraph.h
+ * @brief ϊ̊Kw\
+ * @details m[h𕝗D̏ɕׁAeqֈɑă[hϊs߂
+ */
+
+#pragma once
+#include <vector>
+#include "Utility/Scene/InstanceStore.h"
+#include "Utility/Thread/WorkerPool.h"
+
+namespace Framework::Utility {
+    /**
+     * @class SceneGraph
+     * @brief eq֌Wϊ̖
+     * @details D̏ł͐eKqOɗāAe̎q͘Aĕ
+     * ύXm[hƂ̎qvẐŁAXV̎Ԃ͕ςm[h̐ɔႷ
+     * eq֌WςƂג
+     */
+    class SceneGraph {
+    public:
+        static constexpr UINT INVALID_NODE = UINT_MAX; //!< ȃm[h
+        static constexpr UINT PARALLEL_THRESHOLD = 8192; //!< ɍXVύX̖ڈ
+        static constexpr UINT PARALLEL_GRAIN_SIZE = 1024; //!< ɍXVƂ̑̕傫
+    public:
+        /**
+         * @brief RXgN^
+         */
+        SceneGraph();
+        /**
+         * @brief fXgN^
+         */
+        ~SceneGraph();
+        /**
+         * @brief ׂẴm[h폜
+         */
+        void clear();
+        /**
+         * @brief m[h쐬
+         * @param parent em[h INVALID_NODEȂ獪ɂȂ
+         * @param position e猩W
+         * @param rotation e猩]
+         * @param scale e猩g
+         * @param instance [hϊsރCX^X ȃnhȂ珑܂Ȃ
+         * @return m[h̔ԍ
+         */
+        UINT createNode(UINT parent, const Math::Vector3& position,
+            const Math::Quaternion& rotation, const Math::Vector3& scale,
+            const InstanceHandle& instance = InstanceHandle());
+        /**
+         * @brief m[hqƍ폜
+         * @details тCX^X͍폜Ȃ
+         */
+        void destroyNode(UINT node);
+        /**
+         * @brief eς
+         * @param node Ώۂ̃m[h
+         * @param parent Ve INVALID_NODEȂ獪ɂȂ
+         */
+        void setParent(UINT node, UINT parent);
+        /**
+         * @brief e猩Wݒ肷
+         * @details lςȂΕύXƂċL^Ȃ ]Ɗg
+         */
+        void setLocalPosition(UINT node, const Math::Vector3& position);
+        /**
+         * @brief e猩]ݒ肷
+         */
+        void setLocalRotation(UINT node, const Math::Quaternion& rotation);
+        /**
+         * @brief e猩gݒ肷
+         */
+        void setLocalScale(UINT node, const Math::Vector3& scale);
+        /**
+         * @brief [hϊsXV
+         * @param instances тCX^X̏ݐ nullptrȂ珑܂Ȃ
+         * @param workers ύXƂɕďXbh nullptrȂĂяoŏ
+         * @return vZm[h
+         */
+        UINT update(InstanceStore* instances, WorkerPool* workers);
+        /**
+         * @brief Lȃm[h
+         */
+        bool isValid(UINT node) const {
+            return node < mNodes.size() && mNodes[node].used;
+        }
+        /**
+         * @brief [hϊs擾
+         * @details updateĂԂ܂ł͕ύXfȂ
+         */
+        const InstanceTransform& getWorldTransform(UINT node) const;
+        /**
+         * @brief em[h擾
+         */
+        UINT getParent(UINT node) const;
+        /**
+         * @brief m[h擾
+         */
+        UINT getNodeCount() const {
+            return mNodeCount;
+        }
+        /**
+         * @brief ؂̐[擾
+         */
+        UINT getDepth() const {
+            return mLevelBegins.empty() ? 0 : static_cast<UINT>(mLevelBegins.size()) - 1;
+        }
+
+    private:
+        /**
+         * @struct Node
+         * @brief m[ĥȂ
+         */
+        struct Node {
+            UINT parent = INVALID_NODE; //!< e
+            UINT firstChild = INVALID_NODE; //!< ŏ̎q
+            UINT nextSibling = INVALID_NODE; //!< ̌Z
+            UINT dense = INVALID_NODE; //!< D̏ł̈ʒu
+            InstanceHandle instance; //!< тCX^X
+            bool used = false; //!< gp
+        };
+
+    private:
+        /**
+         * @brief e̎q̈ꗗO
+         */
+        void detach(UINT node);
+        /**
+         * @brief e̎q̈ꗗɉ
+         */
+        void attach(UINT node, UINT parent);
+        /**
+         * @brief D̏ɕג
+         */
+        void rebuildLayout();
+        /**
+         * @brief ύXƂL^
+         */
+        void markDirty(UINT node);
+        /**
+         * @brief 1̃m[h̃[hϊs߂
+         */
+        void updateNode(UINT dense);
+        /**
+         * @brief ύXm[h珇ɎqւǂčXV
+         */
+        UINT updateSerial();
+        /**
+         * @brief [ƂɕĕɍXV
+         */
+        UINT updateParallel(WorkerPool* workers);
+
+    private:
+        std::vector<Node> mNodes; //!< m[ĥȂ
+        std::vector<UINT> mFreeNodes; //!< ėpłm[h̔ԍ
+        UINT mNodeCount; //!< Lȃm[h
+        bool mLayoutDirty; //!< גKv
+        //ȉ͕D̏ɕ
+        std::vector<UINT> mDenseNodes; //!< m[h̔ԍ
+        std::vector<UINT> mParents; //!< ëʒu
+        std::vector<UINT> mChildBegins; //!< ŏ̎q̈ʒu
+        std::vector<UINT> mChildCounts; //!< q̐
+        std::vector<Math::Vector3> mPositions; //!< e猩W
+        std::vector<Math::Quaternion> mRotations; //!< e猩]
+        std::vector<Math::Vector3> mScales; //!< e猩g
+        std::vector<InstanceTransform> mWorldTransforms; //!< [hϊs
+        std::vector<UINT64> mDirtyBits; //!< vZm[h
+        std::vector<UINT8> mUpdated; //!< ɍXVƂɌvZm[h
+        std::vector<UINT> mLevelBegins; //!< [Ƃ̐擪̈ʒu ̓m[h
+        std::vector<UINT> mUpdatedNodes; //!< Ō̍XVŌvZm[h
+        UINT mDirtyCount; //!< ڕύXm[h̖ڈ
+    };
+} // namespace Framework::Utility
@@ -0,0 +1,84 @@
+#include "WorkerPool.h"
+
+namespace Framework::Utility {
+    //RXgN^
+    WorkerPool::WorkerPool(UINT workerCount)
+        : mFunc(nullptr),
+          mCount(0),
+          mGrainSize(1),
+          mNextBegin(0),
+          mRunningWorkers(0),
+          mSerial(0),
+          mQuit(false) {
+        if (workerCount == 0) {
+            //ĂяõXbĥň炷
+            const UINT hardware = std::thread::hardware_concurrency();
+            workerCount = hardware > 1 ? hardware - 1 : 0;
+        }
+        mThreads.reserve(workerCount);
+        for (UINT i = 0; i < workerCount; i++) { mThreads.emplace_back([this]() { workerLoop(); }); }
+    }
+    //fXgN^
+    WorkerPool::~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mQuit = true;
+        }
+        mStartCondition.notify_all();
+        for (auto&& thread : mThreads) { thread.join(); }
+    }
+    //͈͂𕪊ĕɏ
+    void WorkerPool::parallelFor(UINT count, UINT grainSize, const RangeFunc& func) {
+        if (count == 0) return;
+        grainSize = Math::MathUtil::mymax(grainSize, 1u);
+        //قǂ̗ʂȂ΂̏ŏ
+        if (mThreads.empty() || count <= grainSize) {
+            func(0, count);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            MY_ASSERTION(!mFunc, "񃋁[v͓qɂł܂");
+            mFunc = &func;
+            mCount = count;
+            mGrainSize = grainSize;
+            mNextBegin.store(0, std::memory_order_relaxed);
+            mRunningWorkers = static_cast<UINT>(mThreads.size());
+            mSerial++;
+        }
+        mStartCondition.notify_all();
+        runChunks();
+
+        //[J[͈̔͂I܂ő҂
+        std::unique_lock<std::mutex> lock(mMutex);
+        mFinishCondition.wait(lock, [this]() { return mRunningWorkers == 0; });
+        mFunc = nullptr;
+    }
+    //[J[Xbh̏
+    void WorkerPool::workerLoop() {
+        UINT64 serial = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mStartCondition.wait(lock, [&]() { return mQuit || mSerial != serial; });
+                if (mQuit) return;
+                serial = mSerial;
+            }
+            runChunks();
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mRunningWorkers--;
+            }
+            mFinishCondition.notify_one();
+        }
+    }
+    //cĂ͈͂ȂȂ܂ŏ
+    void WorkerPool::runChunks() {
+        while (true) {
+            const UINT begin = mNextBegin.fetch_add(mGrainSize, std::memory_order_relaxed);
+            if (begin >= mCount) return;
+            const UINT end = Math::MathUtil::mymin(begin + mGrainSize, mCount);
+            (*mFunc)(begin, end);
+        }
+    }
+} // namespace Framework::Utility
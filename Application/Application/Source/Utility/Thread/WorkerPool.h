@@ -0,0 +1,74 @@
+/**
+ * @file WorkerPool.h
+ * @brief 풓郏[J[Xbh
+ * @details ͈͂ɂČĂяõXbhƈꏏɏ
+ */
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Framework::Utility {
+    /**
+     * @class WorkerPool
+     * @brief 񃋁[vp̃Xbhv[
+     * @details xɎsł郋[v͈ŁA[v̒qŌĂяoƂ͂łȂ
+     * ͗O𓊂Ȃ
+     */
+    class WorkerPool {
+    public:
+        using RangeFunc = std::function<void(UINT begin, UINT end)>; //!< ͈͂֐
+    public:
+        /**
+         * @brief RXgN^
+         * @param workerCount ĂяoȊOɋNXbh 0Ȃ_RA猈߂
+         */
+        explicit WorkerPool(UINT workerCount = 0);
+        /**
+         * @brief fXgN^
+         */
+        ~WorkerPool();
+        /**
+         * @brief ͈͂𕪊ĕɏ
+         * @param count vf
+         * @param grainSize xɏŏ̗vf
+         * @param func ͈͂֐ [begin,end)n
+         * @details ׂĂ͈̔͂̏I܂Ŗ߂Ȃ
+         */
+        void parallelFor(UINT count, UINT grainSize, const RangeFunc& func);
+        /**
+         * @brief ɎQXbh擾
+         * @details ĂяõXbh܂
+         */
+        UINT getThreadCount() const {
+            return static_cast<UINT>(mThreads.size()) + 1;
+        }
+
+    private:
+        /**
+         * @brief [J[Xbh̏
+         */
+        void workerLoop();
+        /**
+         * @brief cĂ͈͂ȂȂ܂ŏ
+         */
+        void runChunks();
+
+    private:
+        std::vector<std::thread> mThreads; //!< [J[Xbh
+        std::mutex mMutex; //!< ȉ̏Ԃ
+        std::condition_variable mStartCondition; //!< [v̊Jnm点
+        std::condition_variable mFinishCondition; //!< [J[̏Im点
+        const RangeFunc* mFunc; //!< s̏
+        UINT mCount; //!< s̃[v̗vf
+        UINT mGrainSize; //!< s̃[v̑̕傫
+        std::atomic<UINT> mNextBegin; //!< ɏ͈͂̐擪
+        UINT mRunningWorkers; //!< ̃[J[
+        UINT64 mSerial; //!< Jn[v̐
+        bool mQuit; //!< Iv
+    };
+} // namespace Framework::Utility
@@ -52,6 +52,8 @@ public:
      */
     void onDestroy() override {
         Game::onDestroy();
+        //GPŮ҂Aobt@r[o^Ԃ悤foCXɔj
+        mScene.reset();
     }
     /**
      * @brief
@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+#include "DX/Raytracing/AccelerationStructureCache.h"
+
+using namespace Framework::DX;
+
+namespace {
+    //x`}[Np̃LbVfBNg
+    std::filesystem::path getDirectory() {
+        return std::filesystem::temp_directory_path() / "AccelerationStructureCacheBenchmark";
+    }
+} // namespace
+
+//LbṼL[̌vZ _ƃCfbNXׂēǂ
+static void BM_AccelerationStructureCacheComputeKey(benchmark::State& state) {
+    const size_t bytes = static_cast<size_t>(state.range(0));
+    std::vector<BYTE> geometry(bytes, 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(AccelerationStructureCache::computeKey(
+            geometry.data(), bytes / 2, geometry.data() + bytes / 2, bytes / 2, 0));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+}
+BENCHMARK(BM_AccelerationStructureCacheComputeKey)->Arg(1 << 20)->Arg(16 << 20);
+
+//LbV̓ǂݍ }bvăf[^Ŝ̃nbVm߂
+static void BM_AccelerationStructureCacheLoad(benchmark::State& state) {
+    const size_t bytes = static_cast<size_t>(state.range(0));
+    AccelerationStructureCache cache(getDirectory());
+    cache.store("benchmark", 1, std::vector<BYTE>(bytes, 3), {});
+    for (auto _ : state) {
+        AccelerationStructureCache::Entry entry;
+        if (!cache.load("benchmark", 1, &entry)) state.SkipWithError("load failed");
+        benchmark::DoNotOptimize(entry.data);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+    std::filesystem::remove_all(getDirectory());
+}
+BENCHMARK(BM_AccelerationStructureCacheLoad)->Arg(1 << 20)->Arg(16 << 20)->Unit(benchmark::kMicrosecond);
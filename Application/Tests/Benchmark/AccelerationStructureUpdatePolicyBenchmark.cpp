@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "DX/Raytracing/AccelerationStructureUpdatePolicy.h"
+
+using namespace Framework::DX;
+using Framework::Utility::InstanceBounds;
+
+namespace {
+    /**
+     * @brief CX^Xꂼ̑xœV[
+     */
+    struct AnimatedScene {
+        std::vector<InstanceBounds> built; //!< Ōɍ\zƂ̃{bNX
+        std::vector<InstanceBounds> current; //!< ݂̃{bNX
+        std::vector<Vec3> velocities; //!< 1t[œ
+
+        AnimatedScene(size_t count, float speed) : built(count), current(count), velocities(count) {
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+            std::uniform_real_distribution<float> extent(0.5f, 5.0f);
+            std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+            for (size_t i = 0; i < count; i++) {
+                current[i].center = Vec3(position(rng), position(rng), position(rng));
+                current[i].extents = Vec3(extent(rng), extent(rng), extent(rng));
+                velocities[i] = Vec3(direction(rng), direction(rng), direction(rng)) * speed;
+            }
+            built = current;
+        }
+        void step() {
+            for (size_t i = 0; i < current.size(); i++) { current[i].center += velocities[i]; }
+        }
+    };
+} // namespace
+
+//t[򉻂ςč\z@߂
+//rebuildInterval͍č\z̊Ԃɉt[tBbgł
+static void BM_UpdatePolicyAnimatedScene(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const float speed = static_cast<float>(state.range(1)) * 0.01f;
+    AnimatedScene scene(count, speed);
+    AccelerationStructureUpdatePolicy policy;
+    UINT64 frames = 0, builds = 0;
+    for (auto _ : state) {
+        scene.step();
+        const float degradation = AccelerationStructureUpdatePolicy::estimateDegradation(
+            scene.built.data(), scene.current.data(), count);
+        if (policy.evaluate(true, degradation) == AccelerationStructureBuildMode::Build) {
+            scene.built = scene.current;
+            builds++;
+        }
+        frames++;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(frames * count));
+    state.counters["rebuildInterval"]
+        = static_cast<double>(frames) / static_cast<double>(builds > 0 ? builds : 1);
+}
+BENCHMARK(BM_UpdatePolicyAnimatedScene)
+    ->ArgNames({ "instances", "speed%" })
+    ->Args({ 10000, 5 })
+    ->Args({ 100000, 5 })
+    ->Args({ 1000000, 5 })
+    ->Args({ 100000, 50 })
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+#include <mutex>
+#include "DX/Descriptor/AtomicIndexAllocator.h"
+#include "DX/Descriptor/DescriptorRangeAllocator.h"
+#include "DX/Descriptor/DescriptorThreadCache.h"
+
+using namespace Framework::DX;
+
+namespace {
+    constexpr UINT CAPACITY = 1 << 16; //!< 64XbhɎĂ鐔
+    constexpr UINT HOLD = 16; //!< 1XbhɎ
+
+    //SXbhŋLAP[^
+    AtomicIndexAllocator gAtomicAllocator;
+    DescriptorRangeAllocator gRangeAllocator;
+    std::mutex gRangeMutex;
+} // namespace
+
+//bNgȂ1̊m LocalDescriptorHeap::allocate(cpu, gpu)̌oH
+static void BM_DescriptorAllocateLockFree(benchmark::State& state) {
+    if (state.thread_index() == 0) gAtomicAllocator.init(CAPACITY);
+    std::array<UINT, HOLD> held;
+    for (auto _ : state) {
+        for (UINT i = 0; i < HOLD; i++) { held[i] = gAtomicAllocator.allocate(); }
+        for (UINT i = 0; i < HOLD; i++) { gAtomicAllocator.free(held[i]); }
+    }
+    state.SetItemsProcessed(state.iterations() * HOLD);
+}
+BENCHMARK(BM_DescriptorAllocateLockFree)->ThreadRange(1, 64)->UseRealTime();
+
+//XbhƂ̃LbVʂm ThreadCacheScope[J[XbȟoH
+static void BM_DescriptorAllocateThreadCache(benchmark::State& state) {
+    if (state.thread_index() == 0) gAtomicAllocator.init(CAPACITY);
+    std::array<UINT, HOLD> held;
+    {
+        DescriptorThreadCache<AtomicIndexAllocator> cache(&gAtomicAllocator);
+        for (auto _ : state) {
+            for (UINT i = 0; i < HOLD; i++) { held[i] = cache.allocate(); }
+            for (UINT i = 0; i < HOLD; i++) { cache.deallocate(&held[i]); }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * HOLD);
+}
+BENCHMARK(BM_DescriptorAllocateThreadCache)->ThreadRange(1, 64)->UseRealTime();
+
+//bN󂫃Xg̊m LocalDescriptorHeap::allocate(cpu, gpu, count)̌oH
+static void BM_DescriptorAllocateLocked(benchmark::State& state) {
+    if (state.thread_index() == 0) gRangeAllocator.init(CAPACITY);
+    std::array<UINT, HOLD> held;
+    for (auto _ : state) {
+        for (UINT i = 0; i < HOLD; i++) {
+            std::lock_guard<std::mutex> lock(gRangeMutex);
+            held[i] = gRangeAllocator.allocate(1);
+        }
+        for (UINT i = 0; i < HOLD; i++) {
+            std::lock_guard<std::mutex> lock(gRangeMutex);
+            gRangeAllocator.free(held[i], 1);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * HOLD);
+}
+BENCHMARK(BM_DescriptorAllocateLocked)->ThreadRange(1, 64)->UseRealTime();
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "DX/Descriptor/DescriptorRangeAllocator.h"
+
+using namespace Framework::DX;
+
+//傫̈قȂ͈͂_ɊmہE
+//fragmentation͋󂫂̑ɑ΂xɊmۂłȂ̊
+static void BM_DescriptorRangeAllocatorChurn(benchmark::State& state) {
+    const UINT capacity = static_cast<UINT>(state.range(0));
+    const UINT maxCount = static_cast<UINT>(state.range(1));
+    DescriptorRangeAllocator allocator;
+    allocator.init(capacity);
+    std::vector<std::pair<UINT, UINT>> live;
+    live.reserve(capacity);
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<UINT> size(1, maxCount);
+
+    //炢܂Ԃn߂
+    while (allocator.getFreeCount() > capacity / 2) {
+        const UINT count = size(rng);
+        const UINT offset = allocator.allocate(count);
+        if (offset == DescriptorRangeAllocator::INVALID_OFFSET) break;
+        live.emplace_back(offset, count);
+    }
+
+    UINT64 failures = 0;
+    for (auto _ : state) {
+        //Ă瓯mۂāAgpʂۂ
+        const size_t index = rng() % live.size();
+        allocator.free(live[index].first, live[index].second);
+        const UINT count = size(rng);
+        const UINT offset = allocator.allocate(count);
+        if (offset == DescriptorRangeAllocator::INVALID_OFFSET) {
+            failures++;
+            live[index] = live.back();
+            live.pop_back();
+            continue;
+        }
+        live[index] = { offset, count };
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+    state.counters["failures"] = static_cast<double>(failures);
+    state.counters["fragmentation"] = 1.0
+        - static_cast<double>(allocator.getLargestFreeRange())
+            / static_cast<double>(allocator.getFreeCount());
+}
+BENCHMARK(BM_DescriptorRangeAllocatorChurn)
+    ->ArgNames({ "capacity", "maxCount" })
+    ->Args({ 4096, 1 })
+    ->Args({ 4096, 16 })
+    ->Args({ 1 << 20, 64 })
+    ->Iterations(4000000);
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "Utility/Scene/InstanceCuller.h"
+
+using namespace Framework::Utility;
+using namespace Framework::Math;
+
+namespace {
+    /**
+     * @brief ŃCX^XU΂点
+     */
+    void fillRandom(InstanceStore* store, UINT count) {
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+        std::uniform_real_distribution<float> size(0.1f, 20.0f);
+        std::vector<InstanceCreateDesc> descs(count);
+        for (auto&& desc : descs) {
+            desc.position = Vector3(position(rng), position(rng) * 0.1f, position(rng));
+            desc.localBounds.extents = Vector3(size(rng), size(rng), size(rng));
+            desc.mask = rng() % 4 == 0 ? 0x3 : 0x1;
+        }
+        store->reserve(count);
+        store->createBulk(descs.data(), count, nullptr);
+        store->updateTransforms();
+    }
+} // namespace
+
+//ƋŃJO J͖񏭂
+static void BM_InstanceCullerCull(benchmark::State& state) {
+    const UINT count = static_cast<UINT>(state.range(0));
+    InstanceStore store;
+    fillRandom(&store, count);
+    InstanceCuller culler;
+    const Matrix4x4 proj
+        = Matrix4x4::createProjection(Deg(60.0f).toRadians(), 16.0f / 9.0f, 0.1f, 1000.0f);
+    float angle = 0.0f;
+    for (auto _ : state) {
+        angle += 0.01f;
+        const Vector3 eye(0, 50, 0);
+        const Vector3 at(std::cos(angle), 50, std::sin(angle));
+        CullingParams params;
+        InstanceCuller::extractFrustumPlanes(
+            Matrix4x4::createView(eye, at, Vector3(0, 1, 0)) * proj, &params);
+        params.viewPosition = eye;
+        params.maxDistance = 800.0f;
+        params.relevanceDistance = 200.0f;
+        params.relevanceMask = 0x2;
+        culler.cull(store, params);
+        benchmark::DoNotOptimize(culler.getActiveCount());
+    }
+    state.counters["active"] = culler.getActiveCount();
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_InstanceCullerCull)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "Utility/Scene/InstanceDescWriter.h"
+#include "Utility/Scene/InstanceStore.h"
+#include "Utility/Thread/WorkerPool.h"
+
+using namespace Framework::Utility;
+using namespace Framework::Math;
+
+namespace {
+    /**
+     * @brief D3D12_RAYTRACING_INSTANCE_DESCƓт̏ݐ
+     */
+    struct RaytracingInstanceDesc {
+        float Transform[3][4];
+        UINT InstanceID : 24;
+        UINT InstanceMask : 8;
+        UINT InstanceContributionToHitGroupIndex : 24;
+        UINT Flags : 8;
+        UINT64 AccelerationStructure;
+    };
+    static_assert(sizeof(RaytracingInstanceDesc) == 64, "CX^XfBXN64oCg");
+
+    constexpr UINT GEOMETRY_NUM = 16;
+
+    /**
+     * @brief iqɃCX^Xׂ
+     */
+    void fillStore(InstanceStore* store, UINT count) {
+        std::vector<InstanceCreateDesc> descs(count);
+        std::mt19937 rng(1);
+        const UINT side = static_cast<UINT>(std::cbrt(static_cast<double>(count))) + 1;
+        for (UINT i = 0; i < count; i++) {
+            InstanceCreateDesc& desc = descs[i];
+            desc.position = Vector3(static_cast<float>(i % side),
+                static_cast<float>((i / side) % side), static_cast<float>(i / (side * side)));
+            desc.localBounds.extents = Vector3(0.5f);
+            desc.geometry = rng() % GEOMETRY_NUM;
+            desc.hitGroupIndex = desc.geometry;
+        }
+        store->reserve(count);
+        store->createBulk(descs.data(), count, nullptr);
+        store->updateTransforms();
+        store->clearDirty();
+    }
+} // namespace
+
+//SCX^X̃[hԂ̃oEfBO{bNXǂ
+static void BM_InstanceStoreIterate(benchmark::State& state) {
+    const UINT count = static_cast<UINT>(state.range(0));
+    InstanceStore store;
+    fillStore(&store, count);
+    for (auto _ : state) {
+        const InstanceBounds* bounds = store.getWorldBounds();
+        float sum = 0.0f;
+        for (UINT i = 0; i < count; i++) sum += bounds[i].center.x + bounds[i].extents.y;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_InstanceStoreIterate)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+//ꕔ̃CX^X𓮂Aς̂s蒼
+//͓(%)
+static void BM_InstanceStoreUpdate(benchmark::State& state) {
+    const UINT count = static_cast<UINT>(state.range(0));
+    const UINT percent = static_cast<UINT>(state.range(1));
+    InstanceStore store;
+    fillStore(&store, count);
+    const UINT step = percent == 0 ? count : 100 / percent;
+    float angle = 0.0f;
+    UINT updated = 0;
+    for (auto _ : state) {
+        angle += 1.0f;
+        const Quaternion rotation = Quaternion::fromEular(Vector3(0.0f, angle, 0.0f));
+        for (UINT i = 0; i < count; i += step) store.setRotation(store.getHandle(i), rotation);
+        updated = store.updateTransforms();
+        store.clearDirty();
+    }
+    state.counters["updated"] = updated;
+    state.SetItemsProcessed(state.iterations() * updated);
+}
+BENCHMARK(BM_InstanceStoreUpdate)
+    ->Args({ 1000000, 1 })
+    ->Args({ 1000000, 10 })
+    ->Args({ 1000000, 100 })
+    ->Unit(benchmark::kMillisecond);
+
+//SCX^X̃CX^XfBXN
+//̓CX^Xƃ[J[ 0ȂĂяoŏ
+static void BM_InstanceStoreWriteDescs(benchmark::State& state) {
+    const UINT count = static_cast<UINT>(state.range(0));
+    const UINT workerCount = static_cast<UINT>(state.range(1));
+    //TopLevelAccelerationStructureƓ̑傫
+    constexpr UINT GRAIN_SIZE = 4096;
+    InstanceStore store;
+    fillStore(&store, count);
+    std::vector<UINT64> blasAddresses(GEOMETRY_NUM);
+    for (UINT i = 0; i < GEOMETRY_NUM; i++) blasAddresses[i] = 0x10000ull * (i + 1);
+    std::vector<RaytracingInstanceDesc> descs(count);
+    std::vector<InstanceBounds> bounds(count);
+    std::unique_ptr<WorkerPool> workers;
+    if (workerCount > 0) workers = std::make_unique<WorkerPool>(workerCount);
+    auto write = [&](UINT begin, UINT end) {
+        writeInstanceDescs(
+            store, blasAddresses.data(), nullptr, begin, end, descs.data(), bounds.data());
+    };
+    for (auto _ : state) {
+        if (workers) {
+            workers->parallelFor(count, GRAIN_SIZE, write);
+        } else {
+            write(0, count);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.SetBytesProcessed(state.iterations() * count * sizeof(RaytracingInstanceDesc));
+}
+BENCHMARK(BM_InstanceStoreWriteDescs)
+    ->ArgsProduct({ { 10000, 100000, 1000000 }, { 0, 1, 3, 7 } })
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "Utility/Scene/LodSelector.h"
+
+using namespace Framework::Utility;
+using namespace Framework::Math;
+
+namespace {
+    const LodLevel LEVELS[] = {
+        { 0, 0, 0.0f },
+        { 1, 1, 0.01f },
+        { 2, 2, 0.05f },
+        { 3, 3, 0.2f },
+    };
+
+    /**
+     * @brief ŃCX^XU΂点
+     */
+    void fillRandom(InstanceStore* store, UINT count, UINT group) {
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+        std::vector<InstanceCreateDesc> descs(count);
+        for (auto&& desc : descs) {
+            desc.position = Vector3(position(rng), 0.0f, position(rng));
+            desc.localBounds.extents = Vector3(1.0f);
+            desc.lodGroup = group;
+        }
+        store->reserve(count);
+        store->createBulk(descs.data(), count, nullptr);
+        store->updateTransforms();
+    }
+} // namespace
+
+//_đIђ ̓CX^Xƃ[J[
+static void BM_LodSelectorSelect(benchmark::State& state) {
+    const UINT count = static_cast<UINT>(state.range(0));
+    const UINT workerCount = static_cast<UINT>(state.range(1));
+    LodSelector selector;
+    InstanceStore store;
+    fillRandom(&store, count, selector.addGroup(LEVELS, 4));
+    std::unique_ptr<WorkerPool> workers;
+    if (workerCount > 0) workers = std::make_unique<WorkerPool>(workerCount);
+    LodParams params;
+    params.projectionScale
+        = LodSelector::computeProjectionScale(Deg(60.0f).toRadians().getRad(), 1080.0f);
+    UINT changed = 0;
+    for (auto _ : state) {
+        params.viewPosition.x += 1.0f;
+        changed = selector.select(&store, params, nullptr, workers.get());
+        store.clearDirty();
+    }
+    state.counters["changed"] = changed;
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_LodSelectorSelect)
+    ->ArgsProduct({ { 10000, 1000000 }, { 0, 3 } })
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+//1̃CX^X̒iKI
+static void BM_LodSelectorSelectLevel(benchmark::State& state) {
+    LodParams params;
+    float pixelsPerUnit = 1.0f;
+    UINT current = 0;
+    for (auto _ : state) {
+        pixelsPerUnit = pixelsPerUnit > 200.0f ? 1.0f : pixelsPerUnit * 1.1f;
+        current = LodSelector::selectLevel(LEVELS, 4, current, pixelsPerUnit, params);
+        benchmark::DoNotOptimize(current);
+    }
+}
+BENCHMARK(BM_LodSelectorSelectLevel);
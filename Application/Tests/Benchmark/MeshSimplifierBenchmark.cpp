@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include "Utility/Mesh/MeshSimplifier.h"
+
+using namespace Framework::DX;
+using namespace Framework::Utility;
+
+namespace {
+    /**
+     * @brief oxƈܓxŕa1̋
+     */
+    void makeSphere(UINT slices, UINT stacks, std::vector<Vertex>* vertices,
+        std::vector<Index>* indices) {
+        constexpr float PI = 3.14159265f;
+        for (UINT j = 0; j <= stacks; j++) {
+            const float v = static_cast<float>(j) / stacks;
+            for (UINT i = 0; i <= slices; i++) {
+                const float u = static_cast<float>(i) / slices;
+                const Vec3 p(std::sin(v * PI) * std::cos(u * 2.0f * PI), std::cos(v * PI),
+                    std::sin(v * PI) * std::sin(u * 2.0f * PI));
+                vertices->push_back({ p, p, Vec2(u, v), Vec4(1, 0, 0, 1) });
+            }
+        }
+        for (UINT j = 0; j < stacks; j++) {
+            for (UINT i = 0; i < slices; i++) {
+                const Index i0 = static_cast<Index>(j * (slices + 1) + i);
+                const Index i2 = static_cast<Index>(i0 + slices + 1);
+                indices->insert(indices->end(),
+                    { i0, static_cast<Index>(i0 + 1), i2, static_cast<Index>(i0 + 1),
+                        static_cast<Index>(i2 + 1), i2 });
+            }
+        }
+    }
+} // namespace
+
+//Op`𔼕Ɍ炷 ͌ox̕ňܓx͂̔
+static void BM_MeshSimplifierSimplify(benchmark::State& state) {
+    const UINT slices = static_cast<UINT>(state.range(0));
+    std::vector<Vertex> vertices;
+    std::vector<Index> indices;
+    makeSphere(slices, slices / 2, &vertices, &indices);
+    SimplifyOptions options;
+    options.targetIndexCount = static_cast<UINT>(indices.size() / 6) * 3;
+    std::vector<Index> result;
+    for (auto _ : state) {
+        MeshSimplifier::simplify(vertices, indices, options, &result);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.counters["triangles"] = static_cast<double>(indices.size() / 3);
+    state.SetItemsProcessed(state.iterations() * (indices.size() / 3));
+}
+BENCHMARK(BM_MeshSimplifierSimplify)->Arg(64)->Arg(128)->Arg(256)->Unit(benchmark::kMillisecond);
+
+//̃bVƔɂbṼnEXht߂
+static void BM_MeshSimplifierHausdorff(benchmark::State& state) {
+    const UINT slices = static_cast<UINT>(state.range(0));
+    std::vector<Vertex> vertices;
+    std::vector<Index> indices;
+    makeSphere(slices, slices / 2, &vertices, &indices);
+    SimplifyOptions options;
+    options.targetIndexCount = static_cast<UINT>(indices.size() / 6) * 3;
+    std::vector<Index> simplified;
+    MeshSimplifier::simplify(vertices, indices, options, &simplified);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            MeshSimplifier::computeHausdorffDistance(vertices, indices, vertices, simplified));
+    }
+    state.SetItemsProcessed(state.iterations() * ((indices.size() + simplified.size()) / 3));
+}
+BENCHMARK(BM_MeshSimplifierHausdorff)->Arg(64)->Arg(256)->Unit(benchmark::kMillisecond);
+
+//ǂݍݎƓ4iK̏ڍדx
+static void BM_MeshSimplifierBuildLodChain(benchmark::State& state) {
+    const UINT slices = static_cast<UINT>(state.range(0));
+    std::vector<Vertex> vertices;
+    std::vector<Index> indices;
+    makeSphere(slices, slices / 2, &vertices, &indices);
+    LodChainOptions options;
+    options.maxLevelCount = 4;
+    std::vector<LodMesh> lods;
+    for (auto _ : state) {
+        MeshSimplifier::buildLodChain(vertices, indices, options, &lods);
+        benchmark::DoNotOptimize(lods.data());
+    }
+    state.counters["levels"] = static_cast<double>(lods.size());
+    state.SetItemsProcessed(state.iterations() * (indices.size() / 3));
+}
+BENCHMARK(BM_MeshSimplifierBuildLodChain)->Arg(64)->Arg(256)->Unit(benchmark::kMillisecond);
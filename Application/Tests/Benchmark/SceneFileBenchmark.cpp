@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <random>
+#include "Utility/Scene/SceneFile.h"
+
+using namespace Framework::Utility;
+using namespace Framework::Math;
+
+namespace {
+    constexpr UINT INSTANCE_COUNT = 1000000;
+
+    /**
+     * @brief 100̃CX^XuV[xo
+     */
+    class SceneFixture {
+    public:
+        SceneFixture() {
+            mDirectory = std::filesystem::temp_directory_path() / "SceneFileBenchmark";
+            std::filesystem::remove_all(mDirectory);
+            std::filesystem::create_directories(mDirectory);
+            mTextPath = mDirectory / "scene.txt";
+            mBinaryPath = mDirectory / "scene.bin";
+
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+            std::uniform_int_distribution<int> angle(0, 359);
+            std::ofstream ofs(mTextPath, std::ios::binary | std::ios::trunc);
+            ofs << "model house House/house.glb Normal\n";
+            ofs << "model ball Sphere/sphere.glb Sphere procedural_sphere\n";
+            ofs << "group root 0 0 0\n";
+            for (UINT i = 0; i < INSTANCE_COUNT; i++) {
+                ofs << (i % 2 ? "instance ball " : "instance house ") << position(rng) << ' '
+                    << position(rng) * 0.1f << ' ' << position(rng) << " rotation 0 "
+                    << angle(rng) << " 0";
+                if (i % 4 == 0) ofs << " parent root";
+                ofs << '\n';
+            }
+        }
+        ~SceneFixture() {
+            std::filesystem::remove_all(mDirectory);
+        }
+        const std::filesystem::path& getTextPath() const {
+            return mTextPath;
+        }
+        const std::filesystem::path& getBinaryPath() const {
+            return mBinaryPath;
+        }
+
+    private:
+        std::filesystem::path mDirectory;
+        std::filesystem::path mTextPath;
+        std::filesystem::path mBinaryPath;
+    };
+
+    const SceneFixture& getFixture() {
+        static const SceneFixture fixture;
+        return fixture;
+    }
+} // namespace
+
+//eLXg`ǂݎăoCi`ɏo
+static void BM_SceneFileConvert(benchmark::State& state) {
+    const SceneFixture& fixture = getFixture();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            SceneFile::convert(fixture.getTextPath(), fixture.getBinaryPath()));
+    }
+    state.SetItemsProcessed(state.iterations() * INSTANCE_COUNT);
+}
+BENCHMARK(BM_SceneFileConvert)->Unit(benchmark::kMillisecond);
+
+//oCi`}bvĔ͈͂m߂
+static void BM_SceneFileLoadBinary(benchmark::State& state) {
+    const SceneFixture& fixture = getFixture();
+    SceneFile::convert(fixture.getTextPath(), fixture.getBinaryPath());
+    SceneFile file;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(file.loadBinary(fixture.getBinaryPath()));
+    }
+    state.SetItemsProcessed(state.iterations() * INSTANCE_COUNT);
+}
+BENCHMARK(BM_SceneFileLoadBinary)->Unit(benchmark::kMillisecond);
+
+//ǂݍ񂾔zuϊ߂ V[̏ŃCX^X镪
+static void BM_SceneFileDecodeTransforms(benchmark::State& state) {
+    const SceneFixture& fixture = getFixture();
+    SceneFile::convert(fixture.getTextPath(), fixture.getBinaryPath());
+    SceneFile file;
+    file.loadBinary(fixture.getBinaryPath());
+    for (auto _ : state) {
+        const SceneInstanceRecord* instances = file.getInstances();
+        for (UINT i = 0; i < file.getInstanceCount(); i++) {
+            Vector3 position, scale;
+            Quaternion rotation;
+            SceneFile::decodeTransform(instances[i].transform, &position, &rotation, &scale);
+            benchmark::DoNotOptimize(rotation);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * INSTANCE_COUNT);
+}
+BENCHMARK(BM_SceneFileDecodeTransforms)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "Utility/Scene/SceneGraph.h"
+
+using namespace Framework::Utility;
+using namespace Framework::Math;
+
+namespace {
+    constexpr UINT NODE_COUNT = 1000000;
+    constexpr UINT BRANCH = 8;
+
+    /**
+     * @brief em[hqBRANCH؂
+     */
+    std::vector<UINT> buildTree(SceneGraph* graph) {
+        std::vector<UINT> nodes;
+        nodes.reserve(NODE_COUNT);
+        nodes.emplace_back(graph->createNode(
+            SceneGraph::INVALID_NODE, Vector3(0.0f), Quaternion::IDENTITY, Vector3(1.0f)));
+        for (UINT i = 1; i < NODE_COUNT; i++) {
+            nodes.emplace_back(graph->createNode(nodes[(i - 1) / BRANCH],
+                Vector3(static_cast<float>(i % 13), 1.0f, 0.0f), Quaternion::IDENTITY,
+                Vector3(1.0f)));
+        }
+        graph->update(nullptr, nullptr);
+        return nodes;
+    }
+} // namespace
+
+//tIŉ񂵁Aς̂vZ
+//͓t̐ƃ[J[
+static void BM_SceneGraphUpdateLeaves(benchmark::State& state) {
+    const UINT moved = static_cast<UINT>(state.range(0));
+    const UINT workerCount = static_cast<UINT>(state.range(1));
+    SceneGraph graph;
+    const std::vector<UINT> nodes = buildTree(&graph);
+    std::unique_ptr<WorkerPool> workers;
+    if (workerCount > 0) workers = std::make_unique<WorkerPool>(workerCount);
+    std::mt19937 rng(1);
+    //Ō̒i͑Ŝ87߂
+    const UINT firstLeaf = NODE_COUNT / BRANCH;
+    float angle = 0.0f;
+    UINT updated = 0;
+    for (auto _ : state) {
+        angle += 1.0f;
+        const Quaternion rotation = Quaternion::fromEular(Vector3(0.0f, angle, 0.0f));
+        for (UINT i = 0; i < moved; i++) {
+            graph.setLocalRotation(nodes[firstLeaf + rng() % (NODE_COUNT - firstLeaf)], rotation);
+        }
+        updated = graph.update(nullptr, workers.get());
+    }
+    state.counters["updated"] = updated;
+    state.SetItemsProcessed(state.iterations() * updated);
+}
+BENCHMARK(BM_SceneGraphUpdateLeaves)
+    ->ArgsProduct({ { 100, 10000, 100000 }, { 0, 3 } })
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+//񂵂ĖؑŜvZ
+static void BM_SceneGraphUpdateRoot(benchmark::State& state) {
+    const UINT workerCount = static_cast<UINT>(state.range(0));
+    SceneGraph graph;
+    const std::vector<UINT> nodes = buildTree(&graph);
+    std::unique_ptr<WorkerPool> workers;
+    if (workerCount > 0) workers = std::make_unique<WorkerPool>(workerCount);
+    float angle = 0.0f;
+    for (auto _ : state) {
+        angle += 1.0f;
+        graph.setLocalRotation(nodes[0], Quaternion::fromEular(Vector3(0.0f, angle, 0.0f)));
+        benchmark::DoNotOptimize(graph.update(nullptr, workers.get()));
+    }
+    state.SetItemsProcessed(state.iterations() * NODE_COUNT);
+}
+BENCHMARK(BM_SceneGraphUpdateRoot)->Arg(0)->Arg(3)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+//ςȂ]𖈃t[ݒ肵ĂvZȂ
+static void BM_SceneGraphUnchangedRotation(benchmark::State& state) {
+    SceneGraph graph;
+    const std::vector<UINT> nodes = buildTree(&graph);
+    const Quaternion rotation = Quaternion::fromEular(Vector3(0.0f, 180.0f, 0.0f));
+    graph.setLocalRotation(nodes[0], rotation);
+    graph.update(nullptr, nullptr);
+    for (auto _ : state) {
+        graph.setLocalRotation(nodes[0], rotation);
+        benchmark::DoNotOptimize(graph.update(nullptr, nullptr));
+    }
+}
+BENCHMARK(BM_SceneGraphUnchangedRotation)->Unit(benchmark::kNanosecond);
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "Assets/Shader/Raytracing/Util/SphereCompat.h"
+
+using namespace Framework::DX;
+
+namespace {
+    /**
+     * @brief ɎgC
+     */
+    struct Ray {
+        Vec3 origin; //!< n_
+        Vec3 direction; //!< 
+    };
+
+    constexpr UINT RAY_COUNT = 1 << 16;
+
+    /**
+     * @brief ̎肩甼قǓ郌C
+     */
+    std::vector<Ray> makeRays() {
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::vector<Ray> rays(RAY_COUNT);
+        for (Ray& ray : rays) {
+            ray.origin = Vec3(unit(rng), unit(rng), unit(rng)).normalized() * 10.0f;
+            const Vec3 target = Vec3(unit(rng), unit(rng), unit(rng)) * 1.3f;
+            ray.direction = target - ray.origin;
+        }
+        return rays;
+    }
+} // namespace
+
+//C^[ZNVVF[_[Ɠ肾s
+static void BM_IntersectUnitSphere(benchmark::State& state) {
+    const std::vector<Ray> rays = makeRays();
+    UINT64 hits = 0;
+    for (auto _ : state) {
+        for (const Ray& ray : rays) {
+            const SphereHit hit = IntersectUnitSphere(ray.origin, ray.direction, 0.0f, 1e30f);
+            hits += hit.hit ? 1 : 0;
+            benchmark::DoNotOptimize(hit);
+        }
+    }
+    const double rayCount = static_cast<double>(state.iterations()) * RAY_COUNT;
+    state.SetItemsProcessed(static_cast<int64_t>(rayCount));
+    state.counters["hitRate"] = static_cast<double>(hits) / rayCount;
+}
+BENCHMARK(BM_IntersectUnitSphere);
+
+//_̒_܂ŋ߂ N[[Xgqbgōs܂
+static void BM_IntersectUnitSphereWithSurface(benchmark::State& state) {
+    const std::vector<Ray> rays = makeRays();
+    for (auto _ : state) {
+        for (const Ray& ray : rays) {
+            const SphereHit hit = IntersectUnitSphere(ray.origin, ray.direction, 0.0f, 1e30f);
+            if (!hit.hit) continue;
+            const TriangleAttributes attr = GetSphereSurface(hit.normal);
+            benchmark::DoNotOptimize(attr);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * RAY_COUNT);
+}
+BENCHMARK(BM_IntersectUnitSphereWithSurface);
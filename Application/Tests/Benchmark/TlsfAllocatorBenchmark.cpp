@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "Utility/Memory/TlsfAllocator.h"
+
+using namespace Framework::Utility;
+
+namespace {
+    constexpr UINT64 KB = 1024;
+    constexpr UINT64 MB = 1024 * KB;
+
+    /**
+     * @brief mۂ͈͂̑傫ƃACg
+     * @details 萔obt@Aobt@AeNX`z
+     */
+    struct Request {
+        UINT64 size;
+        UINT64 alignment;
+    };
+    Request makeRequest(std::mt19937& rng) {
+        switch (rng() % 4) {
+        case 0: return { 256 * (1 + rng() % 16), 256 };
+        case 1: return { 64 * KB * (1 + rng() % 4), 64 * KB };
+        case 2: return { 256 * KB + rng() % (4 * MB), 64 * KB };
+        default: return { 4 * MB * (1 + rng() % 2), 4 * MB };
+        }
+    }
+} // namespace
+
+//q[v̎gpۂ܂܊mۂƉJԂ
+//fragmentation͍Ō̋󂫗̈̂ő̃ubNɓȂ
+static void BM_TlsfAllocatorChurn(benchmark::State& state) {
+    const UINT64 capacity = static_cast<UINT64>(state.range(0)) * MB;
+    const double occupancy = static_cast<double>(state.range(1)) / 100.0;
+    TlsfAllocator allocator;
+    allocator.init(capacity);
+    std::vector<TlsfAllocator::Allocation> live;
+    std::mt19937 rng(1);
+
+    UINT64 failures = 0;
+    double fragmentationSum = 0.0;
+    UINT64 samples = 0;
+    for (auto _ : state) {
+        if (allocator.getUsedSize() < capacity * occupancy || live.empty()) {
+            const Request request = makeRequest(rng);
+            const TlsfAllocator::Allocation allocation
+                = allocator.allocate(request.size, request.alignment);
+            if (allocation.isValid()) {
+                live.push_back(allocation);
+            } else {
+                failures++;
+            }
+        } else {
+            const size_t index = rng() % live.size();
+            allocator.free(live[index]);
+            live[index] = live.back();
+            live.pop_back();
+        }
+        if ((state.iterations() & 1023) == 0) {
+            fragmentationSum += allocator.getStats().getFragmentation();
+            samples++;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["failures"] = static_cast<double>(failures);
+    state.counters["fragmentation"] = samples > 0 ? fragmentationSum / samples : 0.0;
+    state.counters["freeBlocks"] = allocator.getStats().freeBlockCount;
+}
+BENCHMARK(BM_TlsfAllocatorChurn)
+    ->ArgNames({ "heapMB", "occupancy%" })
+    ->Args({ 256, 50 })
+    ->Args({ 256, 80 })
+    ->Args({ 256, 95 })
+    ->Iterations(2000000);
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "Assets/Shader/Raytracing/Util/TriangleCompat.h"
+
+using namespace Framework::DX;
+
+namespace {
+    /**
+     * @brief VF[_[̒_ECfbNXobt@^bV
+     */
+    struct Mesh {
+        std::vector<Vertex> vertices; //!< _
+        std::vector<Index> indices; //!< 16bitCfbNX
+        std::vector<UINT> hitTriangles; //!< Փ˂Op`̔ԍ
+        std::vector<Vec2> hitBarycentrics; //!< Փ˂dSW
+
+        Mesh(UINT vertexCount, UINT triangleCount, UINT hitCount)
+            : vertices(vertexCount), indices(triangleCount * 3) {
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+            std::uniform_int_distribution<UINT> vertex(0, vertexCount - 1);
+            std::uniform_int_distribution<UINT> triangle(0, triangleCount - 1);
+            for (Vertex& v : vertices) {
+                v.position = Vec3(value(rng), value(rng), value(rng));
+                v.normal = Vec3(value(rng), value(rng), value(rng));
+                v.uv = Vec2(value(rng), value(rng));
+                v.tangent = Vec4(value(rng), value(rng), value(rng), 1.0f);
+            }
+            for (Index& i : indices) { i = static_cast<Index>(vertex(rng)); }
+            for (UINT i = 0; i < hitCount; i++) {
+                const float bx = (value(rng) + 1.0f) * 0.5f;
+                const float by = (1.0f - bx) * (value(rng) + 1.0f) * 0.5f;
+                hitTriangles.push_back(triangle(rng));
+                hitBarycentrics.push_back(Vec2(bx, by));
+            }
+        }
+
+        //GetIndices CfbNXobt@3ǂݏo
+        std::array<Index, 3> getIndices(UINT triangle, UINT64& loads) const {
+            loads++;
+            const Index* base = &indices[triangle * 3];
+            return { base[0], base[1], base[2] };
+        }
+    };
+
+    constexpr UINT HIT_COUNT = 1 << 16;
+} // namespace
+
+//ȑOGetNormal/GetUV/GetTangent ƂɃCfbNXƒ_ǂݒ
+static void BM_TriangleAttributesPerAttribute(benchmark::State& state) {
+    const Mesh mesh(1 << 16, 1 << 17, HIT_COUNT);
+    UINT64 indexLoads = 0, vertexLoads = 0;
+    for (auto _ : state) {
+        for (UINT i = 0; i < HIT_COUNT; i++) {
+            const UINT triangle = mesh.hitTriangles[i];
+            const Vec2 b = mesh.hitBarycentrics[i];
+
+            auto n = mesh.getIndices(triangle, indexLoads);
+            const Vec3 n0 = mesh.vertices[n[0]].normal, n1 = mesh.vertices[n[1]].normal,
+                       n2 = mesh.vertices[n[2]].normal;
+            const Vec3 normal = n0 + (n1 - n0) * b.x + (n2 - n0) * b.y;
+
+            auto u = mesh.getIndices(triangle, indexLoads);
+            const Vec2 u0 = mesh.vertices[u[0]].uv, u1 = mesh.vertices[u[1]].uv,
+                       u2 = mesh.vertices[u[2]].uv;
+            const Vec2 uv = u0 + (u1 - u0) * b.x + (u2 - u0) * b.y;
+
+            auto t = mesh.getIndices(triangle, indexLoads);
+            const Vec4 t0 = mesh.vertices[t[0]].tangent, t1 = mesh.vertices[t[1]].tangent,
+                       t2 = mesh.vertices[t[2]].tangent;
+            const Vec4 tangent = t0 + (t1 - t0) * b.x + (t2 - t0) * b.y;
+
+            vertexLoads += 9;
+            benchmark::DoNotOptimize(normal);
+            benchmark::DoNotOptimize(uv);
+            benchmark::DoNotOptimize(tangent);
+        }
+    }
+    const double shades = static_cast<double>(state.iterations()) * HIT_COUNT;
+    state.SetItemsProcessed(static_cast<int64_t>(shades));
+    state.counters["indexLoads/shade"] = static_cast<double>(indexLoads) / shades;
+    state.counters["vertexLoads/shade"] = static_cast<double>(vertexLoads) / shades;
+}
+BENCHMARK(BM_TriangleAttributesPerAttribute);
+
+//GetTriangleAttributes CfbNXƒ_1񂾂ǂł܂Ƃ߂ĕԂ
+static void BM_TriangleAttributesFused(benchmark::State& state) {
+    const Mesh mesh(1 << 16, 1 << 17, HIT_COUNT);
+    UINT64 indexLoads = 0, vertexLoads = 0;
+    for (auto _ : state) {
+        for (UINT i = 0; i < HIT_COUNT; i++) {
+            auto idx = mesh.getIndices(mesh.hitTriangles[i], indexLoads);
+            const TriangleAttributes attr = InterpolateTriangle(mesh.vertices[idx[0]],
+                mesh.vertices[idx[1]], mesh.vertices[idx[2]], mesh.hitBarycentrics[i]);
+            vertexLoads += 3;
+            benchmark::DoNotOptimize(attr);
+        }
+    }
+    const double shades = static_cast<double>(state.iterations()) * HIT_COUNT;
+    state.SetItemsProcessed(static_cast<int64_t>(shades));
+    state.counters["indexLoads/shade"] = static_cast<double>(indexLoads) / shades;
+    state.counters["vertexLoads/shade"] = static_cast<double>(vertexLoads) / shades;
+}
+BENCHMARK(BM_TriangleAttributesFused);
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include "DX/Descriptor/DescriptorThreadCache.h"
+
+using namespace Framework::DX;
+
+namespace {
+    using IndexCache = DescriptorThreadCache<AtomicIndexAllocator>;
+} // namespace
+
+//eʂ܂ŊmۂłA𒴂Ǝs
+TEST(AtomicIndexAllocatorTest, AllocatesUpToCapacity) {
+    AtomicIndexAllocator allocator;
+    allocator.init(4);
+    std::vector<UINT> indices;
+    for (UINT i = 0; i < 4; i++) { indices.push_back(allocator.allocate()); }
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(indices, (std::vector<UINT>{ 0, 1, 2, 3 }));
+    EXPECT_EQ(allocator.allocate(), AtomicIndexAllocator::INVALID_INDEX);
+    EXPECT_EQ(allocator.getAllocatedCount(), 4u);
+}
+
+//CfbNXėp
+TEST(AtomicIndexAllocatorTest, ReusesFreedIndices) {
+    AtomicIndexAllocator allocator;
+    allocator.init(2);
+    const UINT a = allocator.allocate();
+    const UINT b = allocator.allocate();
+    allocator.free(a);
+    EXPECT_EQ(allocator.allocate(), a);
+    allocator.free(b);
+    allocator.free(a);
+    EXPECT_EQ(allocator.getAllocatedCount(), 0u);
+    //ɉ̂Ԃ
+    EXPECT_EQ(allocator.allocate(), a);
+    EXPECT_EQ(allocator.allocate(), b);
+}
+
+//XbhmۂƉJԂĂACfbNX𓯎ɓ񂩏֓nȂ
+TEST(AtomicIndexAllocatorTest, ConcurrentAllocateAndFreeNeverHandsOutAnIndexTwice) {
+    constexpr UINT CAPACITY = 256;
+    constexpr UINT HOLD = 8;
+    constexpr UINT ITERATIONS = 20000;
+    const UINT threadCount = std::max(4u, std::thread::hardware_concurrency());
+
+    AtomicIndexAllocator allocator;
+    allocator.init(CAPACITY);
+    //CfbNXƂ̎gp̃tO
+    std::unique_ptr<std::atomic<UINT>[]> owners = std::make_unique<std::atomic<UINT>[]>(CAPACITY);
+    std::atomic<UINT> duplicates(0), failures(0);
+
+    std::vector<std::thread> threads;
+    for (UINT t = 0; t < threadCount; t++) {
+        threads.emplace_back([&]() {
+            std::array<UINT, HOLD> held;
+            for (UINT i = 0; i < ITERATIONS; i++) {
+                UINT count = 0;
+                for (; count < HOLD; count++) {
+                    const UINT index = allocator.allocate();
+                    if (index == AtomicIndexAllocator::INVALID_INDEX) {
+                        failures++;
+                        break;
+                    }
+                    if (owners[index].exchange(1) != 0) duplicates++;
+                    held[count] = index;
+                }
+                for (UINT n = 0; n < count; n++) {
+                    if (owners[held[n]].exchange(0) != 1) duplicates++;
+                    allocator.free(held[n]);
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) { thread.join(); }
+
+    EXPECT_EQ(duplicates.load(), 0u);
+    EXPECT_EQ(allocator.getAllocatedCount(), 0u);
+    //Ɏ̍veʂ𒴂ȂΎsȂ
+    if (threadCount * HOLD <= CAPACITY) {
+        EXPECT_EQ(failures.load(), 0u);
+    }
+
+    //ׂĕԂĂΗeʂ傤ǂ܂Ŋmۂł
+    std::vector<bool> seen(CAPACITY, false);
+    for (UINT i = 0; i < CAPACITY; i++) {
+        const UINT index = allocator.allocate();
+        ASSERT_LT(index, CAPACITY);
+        EXPECT_FALSE(seen[index]);
+        seen[index] = true;
+    }
+    EXPECT_EQ(allocator.allocate(), AtomicIndexAllocator::INVALID_INDEX);
+}
+
+//̃LbVmۂƂ܂Ƃ߂ĕ[
+TEST(AtomicIndexAllocatorTest, ThreadCacheRefillsInBatches) {
+    AtomicIndexAllocator allocator;
+    allocator.init(64);
+    IndexCache cache(&allocator);
+    const UINT index = cache.allocate();
+    EXPECT_LT(index, 64u);
+    EXPECT_EQ(allocator.getAllocatedCount(), IndexCache::BATCH_SIZE);
+    EXPECT_EQ(cache.getCachedNum(), IndexCache::BATCH_SIZE - 1);
+    //LbVɎcĂԂ̓AP[^ɐGȂ
+    for (UINT i = 1; i < IndexCache::BATCH_SIZE; i++) { cache.allocate(); }
+    EXPECT_EQ(allocator.getAllocatedCount(), IndexCache::BATCH_SIZE);
+    EXPECT_EQ(cache.getCachedNum(), 0u);
+}
+
+//ςɂȂ甼ԂAjƂׂĕԂ
+TEST(AtomicIndexAllocatorTest, ThreadCacheReturnsHalfWhenFull) {
+    AtomicIndexAllocator allocator;
+    allocator.init(64);
+    std::vector<UINT> indices;
+    for (UINT i = 0; i <= IndexCache::CACHE_SIZE; i++) { indices.push_back(allocator.allocate()); }
+    {
+        IndexCache cache(&allocator);
+        for (UINT i = 0; i < IndexCache::CACHE_SIZE; i++) {
+            cache.deallocate(&indices[i]);
+            EXPECT_EQ(indices[i], AtomicIndexAllocator::INVALID_INDEX);
+        }
+        EXPECT_EQ(cache.getCachedNum(), IndexCache::CACHE_SIZE);
+        EXPECT_EQ(allocator.getAllocatedCount(), IndexCache::CACHE_SIZE + 1);
+
+        cache.deallocate(&indices[IndexCache::CACHE_SIZE]);
+        EXPECT_EQ(cache.getCachedNum(), IndexCache::CACHE_SIZE - IndexCache::BATCH_SIZE + 1);
+        EXPECT_EQ(allocator.getAllocatedCount(), IndexCache::CACHE_SIZE - IndexCache::BATCH_SIZE + 1);
+    }
+    EXPECT_EQ(allocator.getAllocatedCount(), 0u);
+}
+
+//AP[^Ɏc肪ȂΕ[łgAȂȂΎs
+TEST(AtomicIndexAllocatorTest, ThreadCacheUsesWhatIsLeft) {
+    AtomicIndexAllocator allocator;
+    allocator.init(3);
+    IndexCache cache(&allocator);
+    std::vector<UINT> indices;
+    for (UINT i = 0; i < 3; i++) { indices.push_back(cache.allocate()); }
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(indices, (std::vector<UINT>{ 0, 1, 2 }));
+    EXPECT_EQ(cache.allocate(), AtomicIndexAllocator::INVALID_INDEX);
+    //̂̓LbVėp
+    cache.deallocate(&indices[1]);
+    EXPECT_EQ(cache.allocate(), 1u);
+}
+
+//XbhƂ̃LbVʂĂACfbNX𓯎ɓ񂩏֓nȂ
+TEST(AtomicIndexAllocatorTest, ConcurrentThreadCachesNeverHandOutAnIndexTwice) {
+    constexpr UINT HOLD = 8;
+    constexpr UINT ITERATIONS = 20000;
+    const UINT threadCount = std::max(4u, std::thread::hardware_concurrency());
+    //eXbhƃLbVĂ鐔̍veʂɎ܂悤ɂ
+    const UINT capacity = threadCount * (HOLD + IndexCache::CACHE_SIZE);
+
+    AtomicIndexAllocator allocator;
+    allocator.init(capacity);
+    std::unique_ptr<std::atomic<UINT>[]> owners = std::make_unique<std::atomic<UINT>[]>(capacity);
+    std::atomic<UINT> duplicates(0), failures(0);
+
+    std::vector<std::thread> threads;
+    for (UINT t = 0; t < threadCount; t++) {
+        threads.emplace_back([&, t]() {
+            IndexCache cache(&allocator);
+            std::array<UINT, HOLD> held;
+            for (UINT i = 0; i < ITERATIONS; i++) {
+                //ςāA[ƕԋpN悤ɂ
+                const UINT count = 1 + (i + t) % HOLD;
+                for (UINT n = 0; n < count; n++) {
+                    held[n] = cache.allocate();
+                    if (held[n] == AtomicIndexAllocator::INVALID_INDEX) {
+                        failures++;
+                        continue;
+                    }
+                    if (owners[held[n]].exchange(1) != 0) duplicates++;
+                }
+                for (UINT n = 0; n < count; n++) {
+                    if (held[n] == AtomicIndexAllocator::INVALID_INDEX) continue;
+                    if (owners[held[n]].exchange(0) != 1) duplicates++;
+                    cache.deallocate(&held[n]);
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) { thread.join(); }
+
+    EXPECT_EQ(duplicates.load(), 0u);
+    EXPECT_EQ(failures.load(), 0u);
+    //Xbh̏IŃLbVĵŁAׂăAP[^ɕԂĂ
+    EXPECT_EQ(allocator.getAllocatedCount(), 0u);
+}
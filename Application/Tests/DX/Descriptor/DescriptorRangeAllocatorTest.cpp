@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "DX/Descriptor/DescriptorRangeAllocator.h"
+
+using namespace Framework::DX;
+
+//擪珇ɐ؂o
+TEST(DescriptorRangeAllocatorTest, AllocatesFromTheFront) {
+    DescriptorRangeAllocator allocator;
+    allocator.init(10);
+    EXPECT_EQ(allocator.allocate(3), 0u);
+    EXPECT_EQ(allocator.allocate(2), 3u);
+    EXPECT_EQ(allocator.getFreeCount(), 5u);
+    EXPECT_EQ(allocator.getLargestFreeRange(), 5u);
+    EXPECT_EQ(allocator.allocate(6), DescriptorRangeAllocator::INVALID_OFFSET);
+    EXPECT_EQ(allocator.allocate(5), 5u);
+    EXPECT_EQ(allocator.allocate(1), DescriptorRangeAllocator::INVALID_OFFSET);
+}
+
+//܂钆ōł󂫗̈悩mۂ
+TEST(DescriptorRangeAllocatorTest, PicksTheBestFit) {
+    DescriptorRangeAllocator allocator;
+    allocator.init(20);
+    const UINT a = allocator.allocate(5);
+    allocator.allocate(1);
+    const UINT b = allocator.allocate(2);
+    allocator.allocate(1);
+    //󂫗̈ 5A2A11
+    allocator.free(a, 5);
+    allocator.free(b, 2);
+    EXPECT_EQ(allocator.allocate(2), b);
+    EXPECT_EQ(allocator.allocate(4), a);
+}
+
+//ƑŐ󂫗̈ƌ
+TEST(DescriptorRangeAllocatorTest, FreeCoalescesNeighbours) {
+    DescriptorRangeAllocator allocator;
+    allocator.init(9);
+    const UINT a = allocator.allocate(3);
+    const UINT b = allocator.allocate(3);
+    const UINT c = allocator.allocate(3);
+    allocator.free(a, 3);
+    allocator.free(c, 3);
+    EXPECT_EQ(allocator.getLargestFreeRange(), 3u);
+    //^񒆂ԂƑŜɂȂ
+    allocator.free(b, 3);
+    EXPECT_EQ(allocator.getLargestFreeRange(), 9u);
+    EXPECT_EQ(allocator.allocate(9), 0u);
+}
+
+//resetłׂċ󂫂ɖ߂
+TEST(DescriptorRangeAllocatorTest, ResetFreesEverything) {
+    DescriptorRangeAllocator allocator;
+    allocator.init(8);
+    allocator.allocate(3);
+    allocator.allocate(4);
+    allocator.reset();
+    EXPECT_EQ(allocator.getFreeCount(), 8u);
+    EXPECT_EQ(allocator.getLargestFreeRange(), 8u);
+}
+
+//_ɊmۂƉJԂĂ͈͂dȂ炸AׂĕԂΌɖ߂
+TEST(DescriptorRangeAllocatorTest, RandomAllocateAndFreeKeepsRangesDisjoint) {
+    constexpr UINT CAPACITY = 1024;
+    DescriptorRangeAllocator allocator;
+    allocator.init(CAPACITY);
+    std::vector<bool> used(CAPACITY, false);
+    std::vector<std::pair<UINT, UINT>> live;
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<UINT> size(1, 16);
+
+    for (UINT i = 0; i < 20000; i++) {
+        if (live.empty() || rng() % 2 == 0) {
+            const UINT count = size(rng);
+            const UINT offset = allocator.allocate(count);
+            if (offset == DescriptorRangeAllocator::INVALID_OFFSET) {
+                EXPECT_LT(allocator.getLargestFreeRange(), count);
+                continue;
+            }
+            ASSERT_LE(offset + count, CAPACITY);
+            for (UINT n = offset; n < offset + count; n++) {
+                ASSERT_FALSE(used[n]);
+                used[n] = true;
+            }
+            live.emplace_back(offset, count);
+        } else {
+            const size_t index = rng() % live.size();
+            const auto [offset, count] = live[index];
+            for (UINT n = offset; n < offset + count; n++) { used[n] = false; }
+            allocator.free(offset, count);
+            live[index] = live.back();
+            live.pop_back();
+        }
+    }
+    for (auto&& [offset, count] : live) { allocator.free(offset, count); }
+    EXPECT_EQ(allocator.getFreeCount(), CAPACITY);
+    EXPECT_EQ(allocator.getLargestFreeRange(), CAPACITY);
+}
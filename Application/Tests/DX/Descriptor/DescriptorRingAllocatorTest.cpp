@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "DX/Descriptor/DescriptorRingAllocator.h"
+
+using namespace Framework::DX;
+
+namespace {
+    /**
+     * @brief GPŨtFX̑
+     * @details VOil͎w肵t[xĊ
+     */
+    struct FakeFence {
+        UINT64 signaled = 0; //!< ŌɃVOil
+        UINT latency = 0; //!< ܂ł̃t[
+
+        UINT64 signal() {
+            return ++signaled;
+        }
+        UINT64 completed() const {
+            return signaled > latency ? signaled - latency : 0;
+        }
+    };
+} // namespace
+
+//tFXʉ߂܂Ŕ͈͉͂Ȃ
+TEST(DescriptorRingAllocatorTest, RangesAreHeldUntilTheFencePasses) {
+    DescriptorRingAllocator ring;
+    ring.init(8);
+    EXPECT_EQ(ring.allocate(3), 0u);
+    EXPECT_EQ(ring.allocate(3), 3u);
+    ring.endFrame(1);
+    EXPECT_EQ(ring.getLastFrameCount(), 6u);
+    EXPECT_EQ(ring.allocate(3), DescriptorRingAllocator::INVALID_OFFSET);
+
+    ring.retire(0);
+    EXPECT_EQ(ring.getUsedCount(), 6u);
+    ring.retire(1);
+    EXPECT_EQ(ring.getUsedCount(), 0u);
+    EXPECT_EQ(ring.getPendingFrameCount(), 0u);
+}
+
+//Ɏ܂Ȃ͈͖͂̂ĂĐ擪mۂÂĂꏏɉ
+TEST(DescriptorRingAllocatorTest, WrapSkipsTheTailAndReleasesItWithTheFrame) {
+    DescriptorRingAllocator ring;
+    ring.init(8);
+    EXPECT_EQ(ring.allocate(5), 0u);
+    ring.endFrame(1);
+    EXPECT_EQ(ring.allocate(2), 5u);
+    ring.endFrame(2);
+    ring.retire(1);
+    //󂫂͖1Ɛ擪5 3͖Ɏ܂Ȃ̂Ő擪
+    EXPECT_EQ(ring.allocate(3), 0u);
+    ring.endFrame(3);
+    EXPECT_EQ(ring.getLastFrameCount(), 4u);
+    EXPECT_EQ(ring.getUsedCount(), 6u);
+    ring.retire(3);
+    EXPECT_EQ(ring.getUsedCount(), 0u);
+}
+
+//gI͈͂ƏdȂmۂ͂Ȃ
+TEST(DescriptorRingAllocatorTest, NeverOverlapsLiveRanges) {
+    DescriptorRingAllocator ring;
+    ring.init(8);
+    ring.allocate(4);
+    ring.endFrame(1);
+    EXPECT_EQ(ring.allocate(4), 4u);
+    ring.endFrame(2);
+    ring.retire(1);
+    //󂢂Ă̂͐擪4
+    EXPECT_EQ(ring.allocate(5), DescriptorRingAllocator::INVALID_OFFSET);
+    EXPECT_EQ(ring.allocate(4), 0u);
+}
+
+//GPUt[xĊĂAgp̐͒xĂt[̕œłɂȂ
+TEST(DescriptorRingAllocatorTest, SteadyStateWithFramesInFlight) {
+    constexpr UINT PER_FRAME = 100;
+    FakeFence fence;
+    fence.latency = 2;
+    DescriptorRingAllocator ring;
+    ring.init(PER_FRAME * 4);
+
+    for (UINT frame = 0; frame < 1000; frame++) {
+        ring.retire(fence.completed());
+        for (UINT n = 0; n < PER_FRAME / 10; n++) {
+            ASSERT_NE(ring.allocate(10), DescriptorRingAllocator::INVALID_OFFSET) << frame;
+        }
+        ring.endFrame(fence.signal());
+    }
+    EXPECT_EQ(ring.getLastFrameCount(), PER_FRAME);
+    //҂2t[ƋL^̃t[
+    EXPECT_LE(ring.getHighWaterMark(), PER_FRAME * 3);
+}
+
+//蒼Ăgp̐̍ől͈p
+TEST(DescriptorRingAllocatorTest, InitKeepsTheHighWaterMark) {
+    DescriptorRingAllocator ring;
+    ring.init(8);
+    ring.allocate(6);
+    ring.init(16);
+    EXPECT_EQ(ring.getUsedCount(), 0u);
+    EXPECT_EQ(ring.getHighWaterMark(), 6u);
+    EXPECT_EQ(ring.allocate(16), 0u);
+}
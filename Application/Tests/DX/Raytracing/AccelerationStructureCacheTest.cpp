@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include "DX/Raytracing/AccelerationStructureCache.h"
+
+using namespace Framework::DX;
+
+namespace {
+    /**
+     * @brief eXgƂɋ̃LbVfBNgpӂ
+     */
+    class AccelerationStructureCacheTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            mDirectory = std::filesystem::temp_directory_path()
+                / ("AccelerationStructureCacheTest_"
+                    + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+            std::filesystem::remove_all(mDirectory);
+            mData.resize(1000);
+            for (size_t i = 0; i < mData.size(); i++) { mData[i] = static_cast<BYTE>(i * 7); }
+            mMetadata = { 1, 2, 300, 4000 };
+        }
+        void TearDown() override {
+            std::filesystem::remove_all(mDirectory);
+        }
+        //t@C̈ꕔ
+        void overwrite(UINT64 offset, BYTE value) {
+            std::fstream file(mDirectory / "model.blas", std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(static_cast<std::streamoff>(offset));
+            file.put(static_cast<char>(value));
+        }
+
+        std::filesystem::path mDirectory;
+        std::vector<BYTE> mData;
+        AccelerationStructureCache::Metadata mMetadata;
+    };
+} // namespace
+
+//ۑf[^ƃV[̏񂪂̂܂ܓǂ߂
+TEST_F(AccelerationStructureCacheTest, RoundTrip) {
+    AccelerationStructureCache cache(mDirectory);
+    cache.store("model", 42, mData, mMetadata);
+
+    AccelerationStructureCache::Entry entry;
+    ASSERT_TRUE(cache.load("model", 42, &entry));
+    ASSERT_EQ(entry.size, mData.size());
+    EXPECT_EQ(std::memcmp(entry.data, mData.data(), mData.size()), 0);
+    EXPECT_EQ(std::memcmp(&entry.metadata, &mMetadata, sizeof(mMetadata)), 0);
+    //f[^ASƓACgŒu
+    EXPECT_EQ(static_cast<UINT64>(entry.data - entry.file.data()),
+        AccelerationStructureCache::DATA_ALIGNMENT);
+}
+
+TEST_F(AccelerationStructureCacheTest, MissingFileFails) {
+    AccelerationStructureCache cache(mDirectory);
+    AccelerationStructureCache::Entry entry;
+    EXPECT_FALSE(cache.load("model", 42, &entry));
+}
+
+//L[ႦΌÂLbVƂĎgȂ
+TEST_F(AccelerationStructureCacheTest, DifferentKeyIsStale) {
+    AccelerationStructureCache cache(mDirectory);
+    cache.store("model", 42, mData, mMetadata);
+    AccelerationStructureCache::Entry entry;
+    EXPECT_FALSE(cache.load("model", 43, &entry));
+    EXPECT_FALSE(entry.file.isOpen());
+}
+
+//f[^1oCgłĂΎgȂ
+TEST_F(AccelerationStructureCacheTest, CorruptedDataFails) {
+    AccelerationStructureCache cache(mDirectory);
+    cache.store("model", 42, mData, mMetadata);
+    overwrite(AccelerationStructureCache::DATA_ALIGNMENT + 500, 0xff);
+    AccelerationStructureCache::Entry entry;
+    EXPECT_FALSE(cache.load("model", 42, &entry));
+}
+
+//rŐ؂ꂽt@C͎gȂ
+TEST_F(AccelerationStructureCacheTest, TruncatedFileFails) {
+    AccelerationStructureCache cache(mDirectory);
+    cache.store("model", 42, mData, mMetadata);
+    const std::filesystem::path path = mDirectory / "model.blas";
+    AccelerationStructureCache::Entry entry;
+    std::filesystem::resize_file(path, AccelerationStructureCache::DATA_ALIGNMENT + 10);
+    EXPECT_FALSE(cache.load("model", 42, &entry));
+    std::filesystem::resize_file(path, 16);
+    EXPECT_FALSE(cache.load("model", 42, &entry));
+}
+
+//㏑ΐVf[^ǂ߂
+TEST_F(AccelerationStructureCacheTest, StoreReplacesExistingFile) {
+    AccelerationStructureCache cache(mDirectory);
+    cache.store("model", 42, mData, mMetadata);
+    mData.assign(10, 5);
+    cache.store("model", 43, mData, mMetadata);
+    AccelerationStructureCache::Entry entry;
+    EXPECT_FALSE(cache.load("model", 42, &entry));
+    ASSERT_TRUE(cache.load("model", 43, &entry));
+    EXPECT_EQ(entry.size, 10u);
+}
+
+//L[̓WIgƍ\ztÔǂ炪ςĂς
+TEST(AccelerationStructureCacheKeyTest, KeyDependsOnGeometryAndFlags) {
+    const float vertices[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+    const UINT16 indices[] = { 0, 1, 2 };
+    const UINT64 key = AccelerationStructureCache::computeKey(
+        vertices, sizeof(vertices), indices, sizeof(indices), 4);
+    EXPECT_EQ(key,
+        AccelerationStructureCache::computeKey(
+            vertices, sizeof(vertices), indices, sizeof(indices), 4));
+    EXPECT_NE(key,
+        AccelerationStructureCache::computeKey(
+            vertices, sizeof(vertices), indices, sizeof(indices), 2));
+
+    float moved[9];
+    std::memcpy(moved, vertices, sizeof(vertices));
+    moved[4] += 0.5f;
+    EXPECT_NE(key,
+        AccelerationStructureCache::computeKey(moved, sizeof(moved), indices, sizeof(indices), 4));
+    //E炵̃f[^ʂ
+    EXPECT_NE(key,
+        AccelerationStructureCache::computeKey(
+            vertices, sizeof(vertices) - 4, indices, sizeof(indices), 4));
+}
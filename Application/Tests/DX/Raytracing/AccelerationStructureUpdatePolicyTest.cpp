@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "DX/Raytracing/AccelerationStructureUpdatePolicy.h"
+
+using namespace Framework::DX;
+using Framework::Utility::InstanceBounds;
+
+namespace {
+    //SƔ̑傫{bNX
+    InstanceBounds makeBounds(const Vec3& center, const Vec3& extents) {
+        InstanceBounds result;
+        result.center = center;
+        result.extents = extents;
+        return result;
+    }
+} // namespace
+
+//ĂȂΗ򉻂Ȃ
+TEST(AccelerationStructureUpdatePolicyTest, UnchangedBoundsDoNotDegrade) {
+    const InstanceBounds bounds[2]
+        = { makeBounds(Vec3(0, 0, 0), Vec3(1, 1, 1)), makeBounds(Vec3(5, 0, 0), Vec3(1, 2, 3)) };
+    EXPECT_FLOAT_EQ(AccelerationStructureUpdatePolicy::estimateDegradation(bounds, bounds, 2), 1.0f);
+}
+
+//\zƌ݂͂ރ{bNXL
+TEST(AccelerationStructureUpdatePolicyTest, MovedBoundsGrowByTheUnion) {
+    const InstanceBounds built = makeBounds(Vec3(0, 0, 0), Vec3(1, 1, 1));
+    const InstanceBounds moved = makeBounds(Vec3(2, 0, 0), Vec3(1, 1, 1));
+    //a4x2x2̃{bNXɂȂ
+    const float expected = (4 * 2 + 2 * 2 + 2 * 4) * 2.0f / (2 * 2 * 6.0f);
+    EXPECT_FLOAT_EQ(
+        AccelerationStructureUpdatePolicy::estimateDegradation(&built, &moved, 1), expected);
+}
+
+//ɏk񂾂Ƃ͍\z̃{bNX̂܂ܘaɂȂ
+TEST(AccelerationStructureUpdatePolicyTest, ContainedBoundsKeepTheBuiltArea) {
+    const InstanceBounds built = makeBounds(Vec3(0, 0, 0), Vec3(2, 2, 2));
+    const InstanceBounds shrunk = makeBounds(Vec3(0.5f, 0, 0), Vec3(1, 1, 1));
+    EXPECT_FLOAT_EQ(
+        AccelerationStructureUpdatePolicy::estimateDegradation(&built, &shrunk, 1), 1.0f);
+}
+
+//\ʐς͑Svf̍vŔׂ
+TEST(AccelerationStructureUpdatePolicyTest, DegradationIsAreaWeighted) {
+    const InstanceBounds built[2]
+        = { makeBounds(Vec3(0, 0, 0), Vec3(1, 1, 1)), makeBounds(Vec3(0, 0, 0), Vec3(9, 9, 9)) };
+    const InstanceBounds current[2]
+        = { makeBounds(Vec3(2, 0, 0), Vec3(1, 1, 1)), built[1] };
+    //vf傫ĂAŜ̗򉻂͂킸ɂȂ
+    const float degradation
+        = AccelerationStructureUpdatePolicy::estimateDegradation(built, current, 2);
+    EXPECT_GT(degradation, 1.0f);
+    EXPECT_LT(degradation, 1.02f);
+}
+
+TEST(AccelerationStructureUpdatePolicyTest, SurfaceArea) {
+    EXPECT_FLOAT_EQ(
+        AccelerationStructureUpdatePolicy::surfaceArea(makeBounds(Vec3(0, 0, 0), Vec3(1, 2, 3))),
+        2.0f * (2 * 4 + 4 * 6 + 6 * 2));
+}
+
+//臒l𒴂܂ł̓tBbgAč\zĐ
+TEST(AccelerationStructureUpdatePolicyTest, RebuildsWhenDegradationExceedsThreshold) {
+    AccelerationStructureUpdatePolicy policy(1.5f, 100);
+    EXPECT_EQ(policy.evaluate(true, 1.1f), AccelerationStructureBuildMode::Refit);
+    EXPECT_EQ(policy.evaluate(true, 1.4f), AccelerationStructureBuildMode::Refit);
+    EXPECT_EQ(policy.getRefitCount(), 2u);
+    EXPECT_FLOAT_EQ(policy.getDegradation(), 1.4f);
+
+    EXPECT_EQ(policy.evaluate(true, 1.6f), AccelerationStructureBuildMode::Build);
+    EXPECT_EQ(policy.getLastMode(), AccelerationStructureBuildMode::Build);
+    EXPECT_EQ(policy.getRefitCount(), 0u);
+    EXPECT_FLOAT_EQ(policy.getDegradation(), 1.0f);
+}
+
+//򉻂ĂAAŃtBbgł񐔂𒴂č\z
+TEST(AccelerationStructureUpdatePolicyTest, RebuildsAfterMaxRefitCount) {
+    AccelerationStructureUpdatePolicy policy(1.5f, 3);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(policy.evaluate(true, 1.0f), AccelerationStructureBuildMode::Refit);
+    }
+    EXPECT_EQ(policy.evaluate(true, 1.0f), AccelerationStructureBuildMode::Build);
+    EXPECT_EQ(policy.evaluate(true, 1.0f), AccelerationStructureBuildMode::Refit);
+}
+
+//tBbgłȂԂł͗򉻂ɂ炸\z
+TEST(AccelerationStructureUpdatePolicyTest, BuildsWhenRefitIsNotPossible) {
+    AccelerationStructureUpdatePolicy policy;
+    EXPECT_EQ(policy.evaluate(false, 1.0f), AccelerationStructureBuildMode::Build);
+    EXPECT_EQ(policy.evaluate(true, 1.0f), AccelerationStructureBuildMode::Refit);
+    EXPECT_EQ(policy.evaluate(false, 1.0f), AccelerationStructureBuildMode::Build);
+    EXPECT_EQ(policy.getRefitCount(), 0u);
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include "Assets/Shader/Raytracing/Util/HitGroupCompat.h"
+
+namespace {
+    /**
+     * @brief eNX`ƂɈقȂCfbNX}eA
+     */
+    MaterialRecord makeRecord() {
+        MaterialRecord record;
+        record.albedoIndex = 3;
+        record.normalIndex = 17;
+        record.metallicRoughnessIndex = 42;
+        record.emissiveIndex = 1023;
+        record.occlusionIndex = UINT_MAX;
+        record.emissiveFactor = Vec3(0.25f, 0.5f, 4.0f);
+        return record;
+    }
+} // namespace
+
+//VF[_[StructuredBufferƓzuɂȂĂ
+TEST(HitGroupCompatTest, MaterialRecordLayout) {
+    EXPECT_EQ(32u, sizeof(MaterialRecord));
+    EXPECT_EQ(0u, offsetof(MaterialRecord, albedoIndex));
+    EXPECT_EQ(4u, offsetof(MaterialRecord, normalIndex));
+    EXPECT_EQ(8u, offsetof(MaterialRecord, metallicRoughnessIndex));
+    EXPECT_EQ(12u, offsetof(MaterialRecord, emissiveIndex));
+    EXPECT_EQ(16u, offsetof(MaterialRecord, occlusionIndex));
+    EXPECT_EQ(20u, offsetof(MaterialRecord, emissiveFactor));
+    EXPECT_EQ(12u, sizeof(HitGroupConstant));
+    EXPECT_EQ(8u, offsetof(HitGroupConstant, materialIndex));
+}
+
+//obt@ɏ񂾒lVF[_[Ɠʒuǂݏo
+TEST(HitGroupCompatTest, MaterialRecordHoldsBindlessIndices) {
+    const MaterialRecord records[2] = { makeRecord(), MaterialRecord{ 0, 1, 2, 3, 4, Vec3() } };
+    //VF[_[UINT̔zƂēǂނ̂ŁAXgChƊevf̈ʒum߂
+    const UINT* words = reinterpret_cast<const UINT*>(records);
+    const UINT stride = sizeof(MaterialRecord) / sizeof(UINT);
+    EXPECT_EQ(3u, words[0]);
+    EXPECT_EQ(17u, words[1]);
+    EXPECT_EQ(42u, words[2]);
+    EXPECT_EQ(1023u, words[3]);
+    EXPECT_EQ(UINT_MAX, words[4]);
+    const float* factor = reinterpret_cast<const float*>(words + 5);
+    EXPECT_EQ(0.25f, factor[0]);
+    EXPECT_EQ(0.5f, factor[1]);
+    EXPECT_EQ(4.0f, factor[2]);
+    for (UINT i = 0; i < 5; i++) { EXPECT_EQ(i, words[stride + i]); }
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "Assets/Shader/Raytracing/Util/SphereCompat.h"
+
+using namespace Framework::DX;
+
+namespace {
+    /**
+     * @brief oxƈܓxŕPʋ̃bV
+     * @details ȑOV[ŎgĂOp`̋Ɠ_͋ʏɂ
+     */
+    struct TessellatedSphere {
+        std::vector<Vec3> positions; //!< _
+        std::vector<UINT> indices; //!< CfbNX
+
+        TessellatedSphere(UINT slices, UINT stacks) {
+            constexpr float PI = 3.14159265f;
+            for (UINT j = 0; j <= stacks; j++) {
+                const float theta = PI * j / stacks;
+                for (UINT i = 0; i <= slices; i++) {
+                    const float phi = 2.0f * PI * i / slices;
+                    positions.emplace_back(std::sin(theta) * std::cos(phi), std::cos(theta),
+                        std::sin(theta) * std::sin(phi));
+                }
+            }
+            for (UINT j = 0; j < stacks; j++) {
+                for (UINT i = 0; i < slices; i++) {
+                    const UINT i0 = j * (slices + 1) + i;
+                    const UINT i2 = i0 + slices + 1;
+                    indices.insert(indices.end(), { i0, i0 + 1, i2, i0 + 1, i2 + 1, i2 });
+                }
+            }
+        }
+
+        /**
+         * @brief ׂĂ̎Op`ƌ肵čł߂p[^߂
+         * @return ȂΕ̒l
+         */
+        float intersect(const Vec3& origin, const Vec3& direction, float tMin) const {
+            float best = -1.0f;
+            for (size_t i = 0; i < indices.size(); i += 3) {
+                const Vec3& p0 = positions[indices[i]];
+                const Vec3 e1 = positions[indices[i + 1]] - p0;
+                const Vec3 e2 = positions[indices[i + 2]] - p0;
+                const Vec3 p = Vec3::cross(direction, e2);
+                const float det = Vec3::dot(e1, p);
+                if (std::fabs(det) < 1e-12f) continue;
+                const Vec3 s = origin - p0;
+                const float u = Vec3::dot(s, p) / det;
+                if (u < 0.0f || u > 1.0f) continue;
+                const Vec3 q = Vec3::cross(s, e1);
+                const float v = Vec3::dot(direction, q) / det;
+                if (v < 0.0f || u + v > 1.0f) continue;
+                const float t = Vec3::dot(e2, q) / det;
+                if (t >= tMin && (best < 0.0f || t < best)) best = t;
+            }
+            return best;
+        }
+    };
+
+    /**
+     * @brief {xŋ߂Ỏ
+     */
+    double referenceNear(const Vec3& origin, const Vec3& direction) {
+        const double a = static_cast<double>(direction.x) * direction.x
+            + static_cast<double>(direction.y) * direction.y
+            + static_cast<double>(direction.z) * direction.z;
+        const double b = static_cast<double>(origin.x) * direction.x
+            + static_cast<double>(origin.y) * direction.y
+            + static_cast<double>(origin.z) * direction.z;
+        const double c = static_cast<double>(origin.x) * origin.x
+            + static_cast<double>(origin.y) * origin.y + static_cast<double>(origin.z) * origin.z
+            - 1.0;
+        return (-b - std::sqrt(b * b - a * c)) / a;
+    }
+} // namespace
+
+//ׂOp`̋Ɠʒuœ
+TEST(SphereCompatTest, MatchesTessellatedSphere) {
+    const TessellatedSphere mesh(128, 64);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    UINT compared = 0;
+    for (int i = 0; i < 500; i++) {
+        const Vec3 origin = Vec3(unit(rng), unit(rng), unit(rng)).normalized() * 5.0f;
+        const Vec3 target = Vec3(unit(rng), unit(rng), unit(rng)) * 1.2f;
+        const Vec3 direction = (target - origin).normalized();
+        const SphereHit hit = IntersectUnitSphere(origin, direction, 0.0f, 100.0f);
+        const float meshT = mesh.intersect(origin, direction, 0.0f);
+
+        //ʂ̓ɓ荞ސ[͕Ō܂̂ŁAʂ痣ꂽ̕t߂͓肪HĂ悢
+        const float closest = (origin + direction * -Vec3::dot(origin, direction)).length();
+        if (closest > 1.0f) {
+            EXPECT_FALSE(hit.hit);
+            EXPECT_LT(meshT, 0.0f);
+            continue;
+        }
+        ASSERT_TRUE(hit.hit);
+        if (closest > 0.99f) continue;
+        ASSERT_GE(meshT, 0.0f);
+        //΂߂ɓقǖʂƋʂ̂ꂪp[^ɑ傫\
+        const float cosine = std::fabs(Vec3::dot(hit.normal, direction));
+        EXPECT_LE(hit.t, meshT + 1e-4f);
+        EXPECT_NEAR(hit.t, meshT, 1e-3f / cosine);
+        EXPECT_NEAR(hit.normal.length(), 1.0f, 1e-5f);
+        compared++;
+    }
+    EXPECT_GT(compared, 100u);
+}
+
+//猂ĂȂ
+TEST(SphereCompatTest, FarOriginIsAccurate) {
+    const Vec3 origins[] = { Vec3(0, 0, -1e4f), Vec3(3e3f, -2e3f, 5e3f) };
+    for (const Vec3& origin : origins) {
+        const Vec3 direction = (Vec3(0.3f, 0.2f, 0.1f) - origin).normalized();
+        const SphereHit hit = IntersectUnitSphere(origin, direction, 0.0f, 1e6f);
+        ASSERT_TRUE(hit.hit);
+        const double expected = referenceNear(origin, direction);
+        EXPECT_NEAR(hit.t, expected, expected * 1e-6);
+        EXPECT_NEAR(hit.normal.length(), 1.0f, 1e-2f);
+    }
+}
+
+//߂郌C͐ړ_œ
+TEST(SphereCompatTest, TangentRayHitsAtContactPoint) {
+    const SphereHit hit = IntersectUnitSphere(Vec3(-3, 1, 0), Vec3(1, 0, 0), 0.0f, 10.0f);
+    ASSERT_TRUE(hit.hit);
+    EXPECT_NEAR(hit.t, 3.0f, 1e-3f);
+    EXPECT_NEAR(hit.normal.y, 1.0f, 1e-5f);
+    EXPECT_FALSE(IntersectUnitSphere(Vec3(-3, 1.001f, 0), Vec3(1, 0, 0), 0.0f, 10.0f).hit);
+}
+
+//ʏォڂɌƏdɂȂA0/0ɂȂ炸Ɏn_œ
+TEST(SphereCompatTest, TangentFromSurfaceIsNotNaN) {
+    const SphereHit hit = IntersectUnitSphere(Vec3(0, 1, 0), Vec3(2, 0, 0), 0.0f, 10.0f);
+    ASSERT_TRUE(hit.hit);
+    EXPECT_EQ(hit.t, 0.0f);
+    EXPECT_EQ(hit.normal, Vec3(0, 1, 0));
+    //n_͈͂Ɋ܂߂ȂΓȂ
+    EXPECT_FALSE(IntersectUnitSphere(Vec3(0, 1, 0), Vec3(2, 0, 0), 1e-4f, 10.0f).hit);
+}
+
+//ʏォɌƔΑœAOȂ瓖Ȃ
+TEST(SphereCompatTest, StartOnSurface) {
+    const Vec3 origin = Vec3(1, 1, 0).normalized();
+    const SphereHit inward = IntersectUnitSphere(origin, -origin, 1e-4f, 10.0f);
+    ASSERT_TRUE(inward.hit);
+    EXPECT_NEAR(inward.t, 2.0f, 1e-5f);
+    EXPECT_NEAR(inward.normal.x, -origin.x, 1e-5f);
+    EXPECT_NEAR(inward.normal.y, -origin.y, 1e-5f);
+    EXPECT_FALSE(IntersectUnitSphere(origin, origin, 1e-4f, 10.0f).hit);
+
+    //΂߂ɓĂ̒i
+    const Vec3 slanted = Vec3(-1, -0.5f, 0).normalized();
+    const SphereHit chord = IntersectUnitSphere(Vec3(1, 0, 0), slanted, 1e-4f, 10.0f);
+    ASSERT_TRUE(chord.hit);
+    EXPECT_NEAR(chord.t, 2.0f * -Vec3::dot(Vec3(1, 0, 0), slanted), 1e-5f);
+}
+
+//猂Ɖ̖ʂœ
+TEST(SphereCompatTest, StartInside) {
+    const SphereHit hit = IntersectUnitSphere(Vec3(0.5f, 0, 0), Vec3(1, 0, 0), 0.0f, 10.0f);
+    ASSERT_TRUE(hit.hit);
+    EXPECT_NEAR(hit.t, 0.5f, 1e-6f);
+}
+
+//𐳋KĂȂ΃p[^ŏk
+TEST(SphereCompatTest, UnnormalizedDirection) {
+    const SphereHit unit = IntersectUnitSphere(Vec3(0, 0, -5), Vec3(0, 0, 1), 0.0f, 100.0f);
+    const SphereHit scaled = IntersectUnitSphere(Vec3(0, 0, -5), Vec3(0, 0, 4), 0.0f, 100.0f);
+    ASSERT_TRUE(unit.hit && scaled.hit);
+    EXPECT_NEAR(scaled.t * 4.0f, unit.t, 1e-5f);
+    EXPECT_NEAR(scaled.normal.z, -1.0f, 1e-6f);
+}
+
+//͈͊Ỏ͓ɂȂ
+TEST(SphereCompatTest, RespectsRange) {
+    EXPECT_FALSE(IntersectUnitSphere(Vec3(0, 0, -5), Vec3(0, 0, 1), 0.0f, 3.9f).hit);
+    //Ỏ͈͊OȂ牜̉g
+    const SphereHit far = IntersectUnitSphere(Vec3(0, 0, -5), Vec3(0, 0, 1), 4.5f, 10.0f);
+    ASSERT_TRUE(far.hit);
+    EXPECT_NEAR(far.t, 6.0f, 1e-5f);
+}
+
+//UV͌oxƈܓxŁAڐ͌ox̑
+TEST(SphereCompatTest, SurfaceAttributes) {
+    const TriangleAttributes equator = GetSphereSurface(Vec3(1, 0, 0));
+    EXPECT_NEAR(equator.uv.x, 0.5f, 1e-6f);
+    EXPECT_NEAR(equator.uv.y, 0.5f, 1e-6f);
+    EXPECT_NEAR(equator.tangent.z, 1.0f, 1e-6f);
+    const TriangleAttributes pole = GetSphereSurface(Vec3(0, 1, 0));
+    EXPECT_NEAR(pole.uv.y, 0.0f, 1e-6f);
+    EXPECT_EQ(pole.tangent, Vec4(1, 0, 0, 1));
+}
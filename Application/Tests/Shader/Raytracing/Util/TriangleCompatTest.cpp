@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include "Assets/Shader/Raytracing/Util/TriangleCompat.h"
+
+using namespace Framework::DX;
+
+namespace {
+    //ƂɈقȂl_
+    Vertex makeVertex(float seed) {
+        Vertex v;
+        v.position = Vec3(seed, seed * 2.0f, seed * 3.0f);
+        v.normal = Vec3(-seed, seed * 0.5f, 1.0f);
+        v.uv = Vec2(seed * 0.25f, 1.0f - seed * 0.25f);
+        v.tangent = Vec4(seed, -seed, seed * 4.0f, 1.0f);
+        return v;
+    }
+
+    void expectNear(const Vec2& a, const Vec2& b) {
+        EXPECT_NEAR(a.x, b.x, 1e-5f);
+        EXPECT_NEAR(a.y, b.y, 1e-5f);
+    }
+    void expectNear(const Vec3& a, const Vec3& b) {
+        EXPECT_NEAR(a.x, b.x, 1e-5f);
+        EXPECT_NEAR(a.y, b.y, 1e-5f);
+        EXPECT_NEAR(a.z, b.z, 1e-5f);
+    }
+    void expectNear(const Vec4& a, const Vec4& b) {
+        EXPECT_NEAR(a.x, b.x, 1e-5f);
+        EXPECT_NEAR(a.y, b.y, 1e-5f);
+        EXPECT_NEAR(a.z, b.z, 1e-5f);
+        EXPECT_NEAR(a.w, b.w, 1e-5f);
+    }
+    void expectVertex(const TriangleAttributes& attr, const Vertex& v) {
+        expectNear(attr.position, v.position);
+        expectNear(attr.normal, v.normal);
+        expectNear(attr.uv, v.uv);
+        expectNear(attr.tangent, v.tangent);
+    }
+} // namespace
+
+//dSW_ɂƂ͂̒_̑ɂȂ
+TEST(TriangleCompatTest, CornersReturnVertexAttributes) {
+    const Vertex v0 = makeVertex(1.0f), v1 = makeVertex(2.0f), v2 = makeVertex(3.0f);
+    expectVertex(InterpolateTriangle(v0, v1, v2, Vec2(0.0f, 0.0f)), v0);
+    expectVertex(InterpolateTriangle(v0, v1, v2, Vec2(1.0f, 0.0f)), v1);
+    expectVertex(InterpolateTriangle(v0, v1, v2, Vec2(0.0f, 1.0f)), v2);
+}
+
+//dSł3_̕ςɂȂ
+TEST(TriangleCompatTest, CentroidIsTheAverage) {
+    const Vertex v0 = makeVertex(0.0f), v1 = makeVertex(3.0f), v2 = makeVertex(6.0f);
+    const TriangleAttributes attr
+        = InterpolateTriangle(v0, v1, v2, Vec2(1.0f / 3.0f, 1.0f / 3.0f));
+    expectVertex(attr, makeVertex(3.0f));
+}
+
+//ȑȎƂ̕(v0 + b.x * (v1 - v0) + b.y * (v2 - v0))ƈv
+TEST(TriangleCompatTest, MatchesPerAttributeInterpolation) {
+    const Vertex v0 = makeVertex(0.3f), v1 = makeVertex(-1.7f), v2 = makeVertex(2.9f);
+    const Vec2 barycentrics[] = { Vec2(0.1f, 0.2f), Vec2(0.7f, 0.05f), Vec2(0.25f, 0.6f) };
+    for (const Vec2& b : barycentrics) {
+        const TriangleAttributes attr = InterpolateTriangle(v0, v1, v2, b);
+        expectNear(attr.normal, v0.normal + (v1.normal - v0.normal) * b.x + (v2.normal - v0.normal) * b.y);
+        expectNear(attr.uv, v0.uv + (v1.uv - v0.uv) * b.x + (v2.uv - v0.uv) * b.y);
+        expectNear(attr.tangent,
+            v0.tangent + (v1.tangent - v0.tangent) * b.x + (v2.tangent - v0.tangent) * b.y);
+    }
+}
@@ -0,0 +1,74 @@
+/**
+ * @file TestPrelude.h
+ * @brief eXgƃx`}[NŋCN[hwb_[
+ * @details Windows̃rhŋCN[hstdafx.h̑ɁA
+ * D3D12ɈˑȂR[hgWCuA^A}Npӂ
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Utility/Platform.h"
+
+/**
+ * @def MY_ASSERTION
+ * @brief AT[V
+ * @details eXgł̓rh\ɂ炸LɂAs炻̏Ŏ~߂
+ */
+#define MY_ASSERTION(expr, format, ...)                                                      \
+    do {                                                                                     \
+        if (!(expr)) {                                                                       \
+            std::fprintf(stderr, "error an occurred %s %d:\n" format "\n", __FUNCTION__,     \
+                __LINE__, ##__VA_ARGS__);                                                    \
+            std::abort();                                                                    \
+        }                                                                                    \
+    } while (0)
+/**
+ * @def MY_DEBUG_LOG
+ * @brief fobOO
+ */
+#define MY_DEBUG_LOG(format, ...) \
+    do { std::fprintf(stderr, format, ##__VA_ARGS__); } while (0)
+/**
+ * @def MY_THROW_IF_FALSE_LOG
+ * @brief sĂO𓊂
+ */
+#define MY_THROW_IF_FALSE_LOG(expr, format, ...)                             \
+    do {                                                                     \
+        if (!(expr)) {                                                       \
+            char message[512];                                               \
+            std::snprintf(message, sizeof(message), format, ##__VA_ARGS__); \
+            throw std::runtime_error(message);                               \
+        }                                                                    \
+    } while (0)
+/**
+ * @def MY_THROW_IF_FALSE
+ * @brief sĂO𓊂
+ */
+#define MY_THROW_IF_FALSE(expr) \
+    do { if (!(expr)) throw std::runtime_error(#expr); } while (0)
+
+#include "Math/MathUtility.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+#include "Math/VectorUtil.h"
+
+using Vec2 = Framework::Math::Vector2;
+using Vec3 = Framework::Math::Vector3;
+using Vec4 = Framework::Math::Vector4;
+using Mat4 = Framework::Math::Matrix4x4;
+using Deg = Framework::Math::Degrees;
+using Rad = Framework::Math::Radians;
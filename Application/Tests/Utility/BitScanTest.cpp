@@ -0,0 +1,22 @@
+#include <gtest/gtest.h>
+#include "Utility/BitScan.h"
+
+using namespace Framework::Utility;
+
+//1rbgĂ΂ǂ̈ʒuԂ
+TEST(BitScanTest, SingleBit) {
+    for (UINT bit = 0; bit < 64; bit++) {
+        EXPECT_EQ(findFirstSetBit(1ull << bit), bit);
+        EXPECT_EQ(findLastSetBit(1ull << bit), bit);
+    }
+}
+
+//̃rbgĂ΍ŉʂƍŏʂԂ
+TEST(BitScanTest, MultipleBits) {
+    EXPECT_EQ(findFirstSetBit(0b101100), 2u);
+    EXPECT_EQ(findLastSetBit(0b101100), 5u);
+    EXPECT_EQ(findFirstSetBit(UINT64_MAX), 0u);
+    EXPECT_EQ(findLastSetBit(UINT64_MAX), 63u);
+    EXPECT_EQ(findFirstSetBit(0x8000000000000001ull), 0u);
+    EXPECT_EQ(findLastSetBit(0x8000000000000001ull), 63u);
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "Utility/Graphics/ResourceStateTracker.h"
+
+using namespace Framework::Utility;
+
+namespace {
+    //D3D12_RESOURCE_STATESɎ
+    constexpr UINT COMMON = 0;
+    constexpr UINT VERTEX = 0x1;
+    constexpr UINT SRV = 0x40;
+    constexpr UINT UAV = 0x8;
+    constexpr UINT RENDER_TARGET = 0x4;
+    constexpr UINT COPY_DEST = 0x400;
+    constexpr UINT READ_ONLY = VERTEX | SRV;
+
+    /**
+     * @brief R}hXg̑ɐς܂ꂽoAL^
+     */
+    class RecordingCommandList : public IResourceBarrierSink {
+    public:
+        void submitBarriers(const ResourceBarrierDesc* barriers, UINT count) override {
+            calls.emplace_back(barriers, barriers + count);
+        }
+        std::vector<std::vector<ResourceBarrierDesc>> calls; //!< Ă΂邽т̃oA
+    };
+
+    //\[X̑ɎgAhX
+    int gResourceA, gResourceB;
+    const void* const A = &gResourceA;
+    const void* const B = &gResourceB;
+} // namespace
+
+//XgōŏɎg\[X̓oAς܂Aoɓo^ς݂̏Ԃ␳
+TEST(ResourceStateTrackerTest, FirstUseIsResolvedAtSubmit) {
+    ResourceStateRegistry registry;
+    registry.registerResource(A, COPY_DEST);
+    ResourceStateTracker tracker(READ_ONLY);
+    RecordingCommandList list;
+
+    tracker.transition(A, SRV);
+    tracker.flush(&list);
+    EXPECT_TRUE(list.calls.empty());
+
+    std::vector<ResourceBarrierDesc> fixups;
+    tracker.resolve(&registry, &fixups);
+    ASSERT_EQ(fixups.size(), 1u);
+    EXPECT_EQ(fixups[0].resource, A);
+    EXPECT_EQ(fixups[0].before, COPY_DEST);
+    EXPECT_EQ(fixups[0].after, SRV);
+    UINT state;
+    ASSERT_TRUE(registry.tryGetState(A, &state));
+    EXPECT_EQ(state, SRV);
+}
+
+//߂ڍs͈x̌Ăяoł܂Ƃ߂Đς
+TEST(ResourceStateTrackerTest, FlushBatchesBarriers) {
+    ResourceStateTracker tracker(READ_ONLY);
+    RecordingCommandList list;
+    tracker.transition(A, RENDER_TARGET);
+    tracker.transition(B, UAV);
+    tracker.transition(A, SRV);
+    tracker.transition(B, SRV);
+    tracker.flush(&list);
+
+    ASSERT_EQ(list.calls.size(), 1u);
+    ASSERT_EQ(list.calls[0].size(), 2u);
+    EXPECT_EQ(list.calls[0][0].resource, A);
+    EXPECT_EQ(list.calls[0][0].before, RENDER_TARGET);
+    EXPECT_EQ(list.calls[0][0].after, SRV);
+    EXPECT_EQ(list.calls[0][1].resource, B);
+    EXPECT_EQ(tracker.getStats().flushCount, 1u);
+    EXPECT_EQ(tracker.getStats().barrierCount, 2u);
+}
+
+//s̈ڍs͈ڍsĂ܂Ƃ߁Aɖ߂ΔsȂ
+TEST(ResourceStateTrackerTest, MergesPendingTransitions) {
+    ResourceStateTracker tracker(READ_ONLY);
+    RecordingCommandList list;
+    tracker.transition(A, RENDER_TARGET);
+    tracker.transition(A, UAV);
+    tracker.transition(A, COPY_DEST);
+    tracker.flush(&list);
+    ASSERT_EQ(list.calls.size(), 1u);
+    ASSERT_EQ(list.calls[0].size(), 1u);
+    EXPECT_EQ(list.calls[0][0].before, RENDER_TARGET);
+    EXPECT_EQ(list.calls[0][0].after, COPY_DEST);
+
+    tracker.transition(A, UAV);
+    tracker.transition(A, COPY_DEST);
+    tracker.flush(&list);
+    EXPECT_EQ(list.calls.size(), 1u);
+}
+
+//ɂ̏ԂȂ牽ς܂Ȃ ǂݎpm͍
+TEST(ResourceStateTrackerTest, SkipsRedundantAndCombinesReadStates) {
+    ResourceStateTracker tracker(READ_ONLY);
+    RecordingCommandList list;
+    tracker.transition(A, VERTEX);
+    tracker.transition(A, SRV);
+    tracker.transition(A, VERTEX);
+    tracker.flush(&list);
+    EXPECT_TRUE(list.calls.empty());
+    UINT state;
+    ASSERT_TRUE(tracker.tryGetState(A, &state));
+    EXPECT_EQ(state, VERTEX | SRV);
+    EXPECT_GE(tracker.getStats().redundantCount, 1u);
+}
+
+//oA͊JnƊ̓ς
+TEST(ResourceStateTrackerTest, SplitBarrierEmitsBeginAndEnd) {
+    ResourceStateTracker tracker(READ_ONLY);
+    RecordingCommandList list;
+    tracker.transition(A, RENDER_TARGET);
+    tracker.beginSplitTransition(A, SRV);
+    tracker.flush(&list);
+    tracker.endSplitTransition(A);
+    tracker.flush(&list);
+    ASSERT_EQ(list.calls.size(), 2u);
+    EXPECT_EQ(list.calls[0][0].split, ResourceBarrierDesc::Split::Begin);
+    EXPECT_EQ(list.calls[1][0].split, ResourceBarrierDesc::Split::End);
+    EXPECT_EQ(list.calls[1][0].after, SRV);
+}
+
+//\[XɑUAVoAς܂Ȃ
+TEST(ResourceStateTrackerTest, CollapsesRepeatedUavBarriers) {
+    ResourceStateTracker tracker(READ_ONLY);
+    RecordingCommandList list;
+    tracker.transition(A, UAV);
+    tracker.uavBarrier(A);
+    tracker.uavBarrier(A);
+    tracker.flush(&list);
+    ASSERT_EQ(list.calls.size(), 1u);
+    ASSERT_EQ(list.calls[0].size(), 1u);
+    EXPECT_EQ(list.calls[0][0].type, ResourceBarrierDesc::Type::UnorderedAccess);
+}
+
+//o^AhX́AėpĂÂԂ␳Ȃ
+TEST(ResourceStateTrackerTest, UnregisteredResourceIsNotResolved) {
+    ResourceStateRegistry registry;
+    registry.registerResource(A, RENDER_TARGET);
+    registry.registerResource(B, COMMON);
+    EXPECT_EQ(registry.getCount(), 2u);
+    registry.unregisterResource(A);
+    EXPECT_EQ(registry.getCount(), 1u);
+
+    ResourceStateTracker tracker(READ_ONLY);
+    tracker.transition(A, SRV);
+    std::vector<ResourceBarrierDesc> fixups;
+    tracker.resolve(&registry, &fixups);
+    EXPECT_TRUE(fixups.empty());
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "Utility/Memory/FrameDirtyRanges.h"
+
+using namespace Framework::Utility;
+
+namespace {
+    /**
+     * @brief t[̎ʂ̃obt@
+     * @details Abv[hobt@̑ɁAo͈͂ʂɃRs[
+     */
+    class FrameBufferedArray {
+    public:
+        FrameBufferedArray(UINT frameCount, UINT mergeGap) : mFrames(frameCount) {
+            mDirty.init(frameCount, mergeGap);
+        }
+        void resize(UINT count) {
+            source.resize(count, 0);
+            for (auto&& frame : mFrames) frame.resize(count, UINT_MAX);
+            mDirty.resize(count);
+        }
+        void set(UINT index, UINT value) {
+            source[index] = value;
+            mDirty.markDirty(index);
+        }
+        //ʂɏ݁ARs[vfԂ
+        UINT upload(UINT frame) {
+            const UINT copied = mDirty.collect(frame, &ranges);
+            for (auto&& range : ranges) {
+                std::copy(source.begin() + range.begin, source.begin() + range.end,
+                    mFrames[frame].begin() + range.begin);
+            }
+            return copied;
+        }
+        const std::vector<UINT>& getFrame(UINT frame) const {
+            return mFrames[frame];
+        }
+        FrameDirtyRanges& getDirty() {
+            return mDirty;
+        }
+
+    public:
+        std::vector<UINT> source; //!< CPU̔z
+        std::vector<DirtyRange> ranges; //!< ŌɎo͈
+    private:
+        FrameDirtyRanges mDirty;
+        std::vector<std::vector<UINT>> mFrames;
+    };
+} // namespace
+
+//vfׂ͂Ă̎ʂŏ܂
+TEST(FrameDirtyRangesTest, NewElementsAreDirtyInEveryFrame) {
+    FrameBufferedArray array(3, 0);
+    array.resize(100);
+    for (UINT frame = 0; frame < 3; frame++) {
+        EXPECT_EQ(array.upload(frame), 100u);
+        EXPECT_EQ(array.getFrame(frame), array.source);
+        EXPECT_EQ(array.upload(frame), 0u);
+    }
+}
+
+//Avf͈͈̔͂ɂȂA[h̋E܂łr؂Ȃ
+TEST(FrameDirtyRangesTest, CollectsContiguousRuns) {
+    FrameBufferedArray array(1, 0);
+    array.resize(256);
+    array.upload(0);
+    for (UINT i = 60; i < 130; i++) array.set(i, i);
+    array.set(200, 1);
+    array.set(255, 2);
+    EXPECT_EQ(array.upload(0), 72u);
+    ASSERT_EQ(array.ranges.size(), 3u);
+    EXPECT_EQ(array.ranges[0].begin, 60u);
+    EXPECT_EQ(array.ranges[0].end, 130u);
+    EXPECT_EQ(array.ranges[1].begin, 200u);
+    EXPECT_EQ(array.ranges[2].begin, 255u);
+    EXPECT_EQ(array.ranges[2].end, 256u);
+}
+
+//Ԃ͈͂͂܂Ƃ߁ÅԂ̗vfRs[
+TEST(FrameDirtyRangesTest, MergesNearbyRuns) {
+    FrameBufferedArray array(1, 4);
+    array.resize(64);
+    array.upload(0);
+    array.set(10, 1);
+    array.set(14, 1);
+    array.set(30, 1);
+    EXPECT_EQ(array.upload(0), 6u);
+    ASSERT_EQ(array.ranges.size(), 2u);
+    EXPECT_EQ(array.ranges[0].begin, 10u);
+    EXPECT_EQ(array.ranges[0].end, 15u);
+    EXPECT_EQ(array.ranges[1].begin, 30u);
+}
+
+//rbgł܂Ƃ߂ĈtĂ͈͊O̗vf͗Ȃ
+TEST(FrameDirtyRangesTest, MarkFromBitsIsClippedToCount) {
+    FrameBufferedArray array(2, 0);
+    array.resize(70);
+    array.upload(0);
+    array.upload(1);
+    array.getDirty().markDirty(std::vector<UINT64>{ 0ull, ~0ull });
+    EXPECT_EQ(array.upload(0), 6u);
+    EXPECT_EQ(array.upload(1), 6u);
+    EXPECT_EQ(array.ranges.back().end, 70u);
+}
+
+//ʂԂɏނƁAǂ̎ʂ񂾎_̓eƈv
+TEST(FrameDirtyRangesTest, EveryFrameCopyMatchesSource) {
+    constexpr UINT FRAME_COUNT = 3;
+    FrameBufferedArray array(FRAME_COUNT, 16);
+    std::mt19937 rng(3);
+    array.resize(1000);
+    for (UINT tick = 0; tick < 300; tick++) {
+        //Ƃǂvf𑝌
+        if (tick % 50 == 49) array.resize(500 + rng() % 1000);
+        const UINT count = static_cast<UINT>(array.source.size());
+        const UINT changes = rng() % 40;
+        for (UINT i = 0; i < changes; i++) {
+            //܂Ƃ܂ύXƂ΂΂̕ύX
+            const UINT begin = rng() % count;
+            const UINT length = rng() % 2 ? 1 : 1 + rng() % 100;
+            for (UINT j = begin; j < std::min(count, begin + length); j++) array.set(j, rng());
+        }
+        const UINT frame = tick % FRAME_COUNT;
+        const UINT copied = array.upload(frame);
+        EXPECT_LE(copied, count);
+        ASSERT_EQ(array.getFrame(frame), array.source) << "tick " << tick;
+    }
+}
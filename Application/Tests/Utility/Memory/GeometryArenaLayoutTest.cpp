@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "Utility/Memory/GeometryArenaLayout.h"
+
+using namespace Framework::Utility;
+
+namespace {
+    /**
+     * @brief ͈̔͂dȂ邩
+     */
+    bool overlaps(UINT offsetA, UINT countA, UINT offsetB, UINT countB) {
+        if (countA == 0 || countB == 0) return false;
+        return offsetA < offsetB + countB && offsetB < offsetA + countA;
+    }
+} // namespace
+
+//w肵̍v܂ł͕Kmۂł
+TEST(GeometryArenaLayoutTest, FitsRequestedCapacity) {
+    constexpr UINT MESH_NUM = 37;
+    constexpr UINT VERTEX_NUM = 1000;
+    constexpr UINT INDEX_NUM = 3000;
+    GeometryArenaLayout layout;
+    layout.init(MESH_NUM * VERTEX_NUM, MESH_NUM * INDEX_NUM, 4);
+    for (UINT i = 0; i < MESH_NUM; i++) {
+        const UINT mesh = layout.allocate(VERTEX_NUM, INDEX_NUM);
+        ASSERT_NE(mesh, GeometryArenaLayout::INVALID_MESH) << i;
+        EXPECT_EQ(mesh, i);
+    }
+    EXPECT_EQ(layout.getMeshCount(), MESH_NUM);
+    EXPECT_EQ(layout.getUsedVertexCount(), MESH_NUM * VERTEX_NUM);
+}
+
+//bVm͈̔͂͏dȂ炸ACfbNX̐擪͂낤
+TEST(GeometryArenaLayoutTest, RangesAreDisjointAndAligned) {
+    GeometryArenaLayout layout;
+    layout.init(10000, 30000, 8);
+    std::vector<UINT> meshes;
+    for (UINT i = 1; i <= 20; i++) meshes.emplace_back(layout.allocate(i * 17, i * 51));
+    for (size_t i = 0; i < meshes.size(); i++) {
+        const GeometryRange& a = layout.getRange(meshes[i]);
+        EXPECT_EQ(a.indexOffset % 8, 0u);
+        EXPECT_LE(a.vertexOffset + a.vertexCount, layout.getVertexCapacity());
+        EXPECT_LE(a.indexOffset + a.indexCount, layout.getIndexCapacity());
+        for (size_t j = i + 1; j < meshes.size(); j++) {
+            const GeometryRange& b = layout.getRange(meshes[j]);
+            EXPECT_FALSE(overlaps(a.vertexOffset, a.vertexCount, b.vertexOffset, b.vertexCount));
+            EXPECT_FALSE(overlaps(a.indexOffset, a.indexCount, b.indexOffset, b.indexCount));
+        }
+    }
+}
+
+//܂ȂΎsAmۂ_߂
+TEST(GeometryArenaLayoutTest, FailureRollsBackVertices) {
+    GeometryArenaLayout layout;
+    layout.init(1000, 100);
+    const UINT used = layout.getUsedVertexCount();
+    EXPECT_EQ(layout.allocate(100, 1000000), GeometryArenaLayout::INVALID_MESH);
+    EXPECT_EQ(layout.getUsedVertexCount(), used);
+    EXPECT_EQ(layout.getMeshCount(), 0u);
+}
+
+//CfbNXȂbVmۂł
+TEST(GeometryArenaLayoutTest, AllowsMeshWithoutIndices) {
+    GeometryArenaLayout layout;
+    layout.init(100, 0);
+    const UINT mesh = layout.allocate(50, 0);
+    ASSERT_TRUE(layout.isValid(mesh));
+    EXPECT_EQ(layout.getRange(mesh).indexCount, 0u);
+    EXPECT_EQ(layout.getUsedIndexCount(), 0u);
+}
+
+//ԍƗ͍̈ėp
+TEST(GeometryArenaLayoutTest, FreeReusesSlotAndSpace) {
+    GeometryArenaLayout layout;
+    layout.init(300, 900);
+    const UINT a = layout.allocate(100, 300);
+    const UINT b = layout.allocate(100, 300);
+    layout.allocate(100, 300);
+    layout.free(b);
+    EXPECT_FALSE(layout.isValid(b));
+    EXPECT_EQ(layout.getMeshCount(), 2u);
+
+    //TLSF͑傫̋敪؂グĒT̂ŁA󂢂菬̂
+    const UINT c = layout.allocate(60, 180);
+    EXPECT_EQ(c, b);
+    EXPECT_GE(layout.getRange(c).vertexOffset, 100u);
+    EXPECT_LT(layout.getRange(c).vertexOffset, 200u);
+    EXPECT_TRUE(layout.isValid(a));
+    EXPECT_EQ(layout.getMeshCount(), 3u);
+
+    layout.reset();
+    EXPECT_EQ(layout.getMeshCount(), 0u);
+    EXPECT_EQ(layout.getUsedVertexCount(), 0u);
+    EXPECT_EQ(layout.allocate(300, 900), 0u);
+}
+
+//mۂƉJԂĂS΋ɖ߂
+TEST(GeometryArenaLayoutTest, ChurnReturnsToEmpty) {
+    GeometryArenaLayout layout;
+    layout.init(100000, 300000, 4);
+    std::mt19937 rng(7);
+    std::vector<UINT> live;
+    for (int i = 0; i < 5000; i++) {
+        if (!live.empty() && (rng() % 2 == 0 || live.size() > 200)) {
+            const size_t pick = rng() % live.size();
+            layout.free(live[pick]);
+            live[pick] = live.back();
+            live.pop_back();
+        } else {
+            const UINT mesh = layout.allocate(1 + rng() % 500, 3 * (1 + rng() % 500));
+            if (mesh != GeometryArenaLayout::INVALID_MESH) live.emplace_back(mesh);
+        }
+    }
+    for (UINT mesh : live) layout.free(mesh);
+    EXPECT_EQ(layout.getMeshCount(), 0u);
+    EXPECT_EQ(layout.getUsedVertexCount(), 0u);
+    EXPECT_EQ(layout.getUsedIndexCount(), 0u);
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include "Utility/Memory/RingAllocator.h"
+
+using namespace Framework::Utility;
+
+//擪珇ɋl߁Aeʂ𒴂Ǝs
+TEST(RingAllocatorTest, AllocatesUntilFull) {
+    RingAllocator ring;
+    ring.init(1024);
+    EXPECT_EQ(ring.allocate(256, 256), 0u);
+    EXPECT_EQ(ring.allocate(256, 256), 256u);
+    EXPECT_EQ(ring.allocate(512, 256), 512u);
+    EXPECT_EQ(ring.allocate(1, 1), RingAllocator::INVALID_OFFSET);
+    EXPECT_EQ(ring.getUsedSize(), 1024u);
+    EXPECT_EQ(ring.getCurrentBatchSize(), 1024u);
+}
+
+//ACgŋ󂢂gpʂɊ܂߂
+TEST(RingAllocatorTest, AlignmentPaddingIsConsumed) {
+    RingAllocator ring;
+    ring.init(1024);
+    EXPECT_EQ(ring.allocate(16, 1), 0u);
+    EXPECT_EQ(ring.allocate(16, 256), 256u);
+    EXPECT_EQ(ring.getUsedSize(), 272u);
+}
+
+//tFXʉ߂ob`Âɉ
+TEST(RingAllocatorTest, RetiresBatchesInFenceOrder) {
+    RingAllocator ring;
+    ring.init(1024);
+    ring.allocate(256, 1);
+    ring.endBatch(1);
+    ring.allocate(256, 1);
+    ring.endBatch(2);
+    EXPECT_EQ(ring.getOldestFenceValue(), 1u);
+    EXPECT_EQ(ring.getCurrentBatchSize(), 0u);
+
+    ring.retire(0);
+    EXPECT_EQ(ring.getUsedSize(), 512u);
+    ring.retire(1);
+    EXPECT_EQ(ring.getUsedSize(), 256u);
+    EXPECT_EQ(ring.getOldestFenceValue(), 2u);
+    ring.retire(2);
+    EXPECT_EQ(ring.getUsedSize(), 0u);
+    EXPECT_EQ(ring.getOldestFenceValue(), 0u);
+}
+
+//̃ob`͋L^Ȃ
+TEST(RingAllocatorTest, EmptyBatchIsIgnored) {
+    RingAllocator ring;
+    ring.init(1024);
+    ring.endBatch(1);
+    EXPECT_EQ(ring.getOldestFenceValue(), 0u);
+}
+
+//Ɏ܂ȂΖ̂ĂĐ擪ɖ߂
+TEST(RingAllocatorTest, WrapsAroundAndWastesTail) {
+    RingAllocator ring;
+    ring.init(1024);
+    ring.allocate(512, 1);
+    ring.endBatch(1);
+    ring.allocate(384, 1);
+    ring.endBatch(2);
+    ring.retire(1);
+    //ɂ128oCgȂ̂Ő擪mۂ
+    EXPECT_EQ(ring.allocate(256, 1), 0u);
+    //̂Ă128oCggpƂĐ
+    EXPECT_EQ(ring.getUsedSize(), 384u + 128u + 256u);
+    //҂͈̔͂ɂ͏dȂȂ
+    EXPECT_EQ(ring.allocate(512, 1), RingAllocator::INVALID_OFFSET);
+    EXPECT_EQ(ring.allocate(256, 1), 256u);
+    ring.endBatch(3);
+    ring.retire(3);
+    EXPECT_EQ(ring.getUsedSize(), 0u);
+}
+
+//gp͈̔͂擪ɂƂ́A̎O܂łmۂȂ
+TEST(RingAllocatorTest, DoesNotOverrunTail) {
+    RingAllocator ring;
+    ring.init(1024);
+    ring.allocate(256, 1);
+    ring.endBatch(1);
+    ring.allocate(512, 1);
+    ring.endBatch(2);
+    ring.allocate(256, 1);
+    ring.endBatch(3);
+    ring.retire(1);
+    //󂢂Ă̂͐擪256oCg
+    EXPECT_EQ(ring.allocate(128, 1), 0u);
+    EXPECT_EQ(ring.allocate(256, 1), RingAllocator::INVALID_OFFSET);
+    EXPECT_EQ(ring.allocate(128, 1), 128u);
+    EXPECT_EQ(ring.getUsedSize(), 1024u);
+}
+
+//t[ƂɊmۂƉJԂĂgpʂɖ߂
+TEST(RingAllocatorTest, SteadyStateFramesDoNotLeak) {
+    RingAllocator ring;
+    ring.init(4096);
+    constexpr UINT64 LATENCY = 2;
+    for (UINT64 frame = 1; frame <= 1000; frame++) {
+        if (frame > LATENCY) ring.retire(frame - LATENCY);
+        for (UINT64 i = 0; i < 5; i++) {
+            const UINT64 size = 64 + (frame * 7 + i * 13) % 200;
+            const UINT64 offset = ring.allocate(size, 256);
+            ASSERT_NE(offset, RingAllocator::INVALID_OFFSET) << "frame " << frame;
+            EXPECT_EQ(offset % 256, 0u);
+            EXPECT_LE(offset + size, ring.getCapacity());
+        }
+        ring.endBatch(frame);
+    }
+    ring.retire(1000);
+    EXPECT_EQ(ring.getUsedSize(), 0u);
+}
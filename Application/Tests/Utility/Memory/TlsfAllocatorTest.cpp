@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "Utility/Memory/TlsfAllocator.h"
+
+using namespace Framework::Utility;
+
+namespace {
+    constexpr UINT64 KB = 1024;
+    constexpr UINT64 MB = 1024 * KB;
+} // namespace
+
+//擪珇ɊmۂAeʂ𒴂Ǝs
+TEST(TlsfAllocatorTest, AllocatesUntilFull) {
+    TlsfAllocator allocator;
+    allocator.init(4 * MB);
+    const TlsfAllocator::Allocation a = allocator.allocate(2 * MB, 64 * KB);
+    const TlsfAllocator::Allocation b = allocator.allocate(2 * MB, 64 * KB);
+    ASSERT_TRUE(a.isValid());
+    ASSERT_TRUE(b.isValid());
+    EXPECT_EQ(a.offset, 0u);
+    EXPECT_EQ(b.offset, 2 * MB);
+    EXPECT_FALSE(allocator.allocate(1, 1).isValid());
+    EXPECT_EQ(allocator.getUsedSize(), 4 * MB);
+}
+
+//ItZbg̓ACgɂ낤
+TEST(TlsfAllocatorTest, RespectsAlignment) {
+    TlsfAllocator allocator;
+    allocator.init(16 * MB);
+    allocator.allocate(256, 256);
+    const TlsfAllocator::Allocation texture = allocator.allocate(64 * KB, 64 * KB);
+    const TlsfAllocator::Allocation msaa = allocator.allocate(4 * MB, 4 * MB);
+    ASSERT_TRUE(texture.isValid());
+    ASSERT_TRUE(msaa.isValid());
+    EXPECT_EQ(texture.offset % (64 * KB), 0u);
+    EXPECT_EQ(msaa.offset % (4 * MB), 0u);
+    //擪̂͋󂫂ƂĎcAmۂɎg
+    const TlsfAllocator::Allocation cb = allocator.allocate(256, 256);
+    ASSERT_TRUE(cb.isValid());
+    EXPECT_LT(cb.offset, texture.offset);
+}
+
+//ƑŐ󂫃ubNƌAŜĂъmۂł
+TEST(TlsfAllocatorTest, FreeCoalescesNeighbours) {
+    TlsfAllocator allocator;
+    allocator.init(3 * MB);
+    const TlsfAllocator::Allocation a = allocator.allocate(MB, 256);
+    const TlsfAllocator::Allocation b = allocator.allocate(MB, 256);
+    const TlsfAllocator::Allocation c = allocator.allocate(MB, 256);
+    allocator.free(a);
+    allocator.free(c);
+    EXPECT_EQ(allocator.getStats().freeBlockCount, 2u);
+    EXPECT_EQ(allocator.getStats().largestFreeSize, MB);
+    allocator.free(b);
+    EXPECT_TRUE(allocator.isEmpty());
+    EXPECT_EQ(allocator.getStats().freeBlockCount, 1u);
+    EXPECT_EQ(allocator.getStats().getFragmentation(), 0.0f);
+    EXPECT_TRUE(allocator.allocate(3 * MB, 256).isValid());
+}
+
+//mے͈̔͂擪񋓂
+TEST(TlsfAllocatorTest, ForEachAllocationVisitsInOffsetOrder) {
+    TlsfAllocator allocator;
+    allocator.init(MB);
+    const TlsfAllocator::Allocation a = allocator.allocate(100, 1);
+    const TlsfAllocator::Allocation b = allocator.allocate(200, 1);
+    const TlsfAllocator::Allocation c = allocator.allocate(300, 1);
+    allocator.free(b);
+    std::vector<UINT64> offsets;
+    allocator.forEachAllocation(
+        [&](const TlsfAllocator::Allocation& allocation) { offsets.push_back(allocation.offset); });
+    EXPECT_EQ(offsets, (std::vector<UINT64>{ a.offset, c.offset }));
+}
+
+//_ɊmۂƉJԂĂ͈͂dȂ炸Avv
+TEST(TlsfAllocatorTest, RandomAllocateAndFreeKeepsRangesDisjoint) {
+    constexpr UINT64 CAPACITY = 64 * MB;
+    TlsfAllocator allocator;
+    allocator.init(CAPACITY);
+    std::vector<TlsfAllocator::Allocation> live;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<UINT64> size(1, 2 * MB);
+    const UINT64 alignments[] = { 256, 64 * KB, 4 * MB };
+
+    for (UINT i = 0; i < 20000; i++) {
+        if (live.empty() || rng() % 3 != 0) {
+            const UINT64 alignment = alignments[rng() % 3];
+            const TlsfAllocator::Allocation allocation = allocator.allocate(size(rng), alignment);
+            if (!allocation.isValid()) continue;
+            EXPECT_EQ(allocation.offset % alignment, 0u);
+            EXPECT_LE(allocation.offset + allocation.size, CAPACITY);
+            live.push_back(allocation);
+        } else {
+            const size_t index = rng() % live.size();
+            allocator.free(live[index]);
+            live[index] = live.back();
+            live.pop_back();
+        }
+        if (i % 1000 != 0) continue;
+        //mے͈̔͂͏dȂȂ
+        UINT64 end = 0, used = 0;
+        UINT count = 0;
+        allocator.forEachAllocation([&](const TlsfAllocator::Allocation& allocation) {
+            EXPECT_GE(allocation.offset, end);
+            end = allocation.offset + allocation.size;
+            used += allocation.size;
+            count++;
+        });
+        EXPECT_EQ(used, allocator.getUsedSize());
+        EXPECT_EQ(count, live.size());
+    }
+    for (auto&& allocation : live) { allocator.free(allocation); }
+    EXPECT_TRUE(allocator.isEmpty());
+    EXPECT_EQ(allocator.getStats().largestFreeSize, CAPACITY);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include "Utility/Memory/UploadRing.h"
+
+using namespace Framework::Utility;
+
+namespace {
+    /**
+     * @brief GPȖɃtFXi߂L[
+     */
+    class FakeUploadQueue : public IUploadQueue {
+    public:
+        explicit FakeUploadQueue(UploadRing* ring) : mRing(ring) {}
+        UINT64 getCompletedFenceValue() const override {
+            return completed;
+        }
+        void waitForFence(UINT64 fenceValue) override {
+            waits.push_back(fenceValue);
+            completed = std::max(completed, fenceValue);
+        }
+        UINT64 submit() override {
+            submitted++;
+            mRing->endBatch(submitted);
+            return submitted;
+        }
+
+    public:
+        UINT64 completed = 0; //!< GPUʉ߂tFX̒l
+        UINT64 submitted = 0; //!< ŌɎstFX̒l
+        std::vector<UINT64> waits; //!< ҂tFX̒l
+    private:
+        UploadRing* mRing;
+    };
+} // namespace
+
+//󂫂΃L[ɐGȂ
+TEST(UploadRingTest, FitsWithoutQueueCalls) {
+    UploadRing ring;
+    ring.init(1024);
+    FakeUploadQueue queue(&ring);
+    EXPECT_EQ(ring.allocate(256, 1, &queue), 0u);
+    EXPECT_EQ(ring.allocate(256, 256, &queue), 256u);
+    EXPECT_EQ(queue.submitted, 0u);
+    EXPECT_TRUE(queue.waits.empty());
+    EXPECT_EQ(ring.getStallCount(), 0u);
+}
+
+//sς݂̃ob`ΈԌÂ̂҂ė̈󂯂
+TEST(UploadRingTest, WaitsForOldestBatch) {
+    UploadRing ring;
+    ring.init(1024);
+    FakeUploadQueue queue(&ring);
+    ring.allocate(512, 1, &queue);
+    queue.submit();
+    ring.allocate(512, 1, &queue);
+    queue.submit();
+    //ǂ̃ob`Ȃ̂ŁAÂ̊҂
+    EXPECT_EQ(ring.allocate(256, 1, &queue), 0u);
+    ASSERT_EQ(queue.waits.size(), 1u);
+    EXPECT_EQ(queue.waits[0], 1u);
+    EXPECT_EQ(ring.getStallCount(), 1u);
+    EXPECT_EQ(queue.submitted, 2u);
+}
+
+//҂̂Ȃ΋L^̃ob`sĂ҂
+TEST(UploadRingTest, SubmitsCurrentBatchWhenNothingPending) {
+    UploadRing ring;
+    ring.init(1024);
+    FakeUploadQueue queue(&ring);
+    ring.allocate(512, 1, &queue);
+    ring.allocate(512, 1, &queue);
+    EXPECT_EQ(ring.allocate(512, 1, &queue), 0u);
+    EXPECT_EQ(queue.submitted, 1u);
+    ASSERT_EQ(queue.waits.size(), 1u);
+    EXPECT_EQ(queue.waits[0], 1u);
+}
+
+//GPUɐiłΑ҂ɂ܂Ƃ߂ĉ
+TEST(UploadRingTest, RetiresEverythingCompleted) {
+    UploadRing ring;
+    ring.init(1024);
+    FakeUploadQueue queue(&ring);
+    for (int i = 0; i < 4; i++) {
+        ring.allocate(256, 1, &queue);
+        queue.submit();
+    }
+    queue.completed = 3;
+    ring.allocate(256, 1, &queue);
+    EXPECT_EQ(ring.getUsedSize(), 512u);
+    EXPECT_TRUE(queue.waits.empty());
+}
+
+//ob`ȂL[͑҂ɗOŒm点
+TEST(UploadRingTest, ThrowsWhenSubmitLeavesBatchOpen) {
+    class OpenBatchQueue : public IUploadQueue {
+    public:
+        UINT64 getCompletedFenceValue() const override {
+            return 0;
+        }
+        void waitForFence(UINT64) override {}
+        UINT64 submit() override {
+            return 1;
+        }
+    };
+    UploadRing ring;
+    ring.init(1024);
+    OpenBatchQueue queue;
+    ring.allocate(512, 1, &queue);
+    ring.allocate(512, 1, &queue);
+    EXPECT_THROW(ring.allocate(256, 1, &queue), std::runtime_error);
+}
+
+//eʂ̔𒴂̂̓OɓȂ
+TEST(UploadRingTest, OversizedIsHalfCapacity) {
+    UploadRing ring;
+    ring.init(1024);
+    EXPECT_FALSE(ring.isOversized(512));
+    EXPECT_TRUE(ring.isOversized(513));
+}
@@ -0,0 +1,230 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "Utility/Mesh/MeshSimplifier.h"
+
+using namespace Framework::DX;
+using namespace Framework::Utility;
+
+namespace {
+    /**
+     * @brief cɕʂ
+     * @details XZʏ01͈̔͂YWheight
+     */
+    void makeGrid(UINT divisions, float height, std::vector<Vertex>* vertices,
+        std::vector<Index>* indices) {
+        vertices->clear();
+        indices->clear();
+        for (UINT z = 0; z <= divisions; z++) {
+            for (UINT x = 0; x <= divisions; x++) {
+                const float u = static_cast<float>(x) / divisions;
+                const float v = static_cast<float>(z) / divisions;
+                vertices->push_back({ Vec3(u, height, v), Vec3(0, 1, 0), Vec2(u, v), Vec4(1, 0, 0, 1) });
+            }
+        }
+        for (UINT z = 0; z < divisions; z++) {
+            for (UINT x = 0; x < divisions; x++) {
+                const Index i0 = static_cast<Index>(z * (divisions + 1) + x);
+                const Index i1 = static_cast<Index>(i0 + 1);
+                const Index i2 = static_cast<Index>(i0 + divisions + 1);
+                const Index i3 = static_cast<Index>(i2 + 1);
+                indices->insert(indices->end(), { i0, i2, i1, i1, i2, i3 });
+            }
+        }
+    }
+
+    /**
+     * @brief oxƈܓxŕa1̋
+     * @details ox0̌pڂUVႤ_d˂Ď
+     */
+    void makeSphere(UINT slices, UINT stacks, std::vector<Vertex>* vertices,
+        std::vector<Index>* indices) {
+        constexpr float PI = 3.14159265f;
+        vertices->clear();
+        indices->clear();
+        for (UINT j = 0; j <= stacks; j++) {
+            const float v = static_cast<float>(j) / stacks;
+            const float theta = v * PI;
+            for (UINT i = 0; i <= slices; i++) {
+                const float u = static_cast<float>(i) / slices;
+                const float phi = u * 2.0f * PI;
+                const Vec3 p(std::sin(theta) * std::cos(phi), std::cos(theta),
+                    std::sin(theta) * std::sin(phi));
+                vertices->push_back({ p, p, Vec2(u, v), Vec4(1, 0, 0, 1) });
+            }
+        }
+        for (UINT j = 0; j < stacks; j++) {
+            for (UINT i = 0; i < slices; i++) {
+                const Index i0 = static_cast<Index>(j * (slices + 1) + i);
+                const Index i1 = static_cast<Index>(i0 + 1);
+                const Index i2 = static_cast<Index>(i0 + slices + 1);
+                const Index i3 = static_cast<Index>(i2 + 1);
+                if (j != 0) indices->insert(indices->end(), { i0, i1, i2 });
+                if (j != stacks - 1) indices->insert(indices->end(), { i1, i3, i2 });
+            }
+        }
+    }
+
+    /**
+     * @brief _ƎOp`̍ŒZ ̈ꍇċ߂
+     */
+    double pointTriangleDistance(const Vec3& p, const Vec3& a, const Vec3& b, const Vec3& c) {
+        auto dot = [](const Vec3& l, const Vec3& r) {
+            return static_cast<double>(l.x) * r.x + static_cast<double>(l.y) * r.y
+                + static_cast<double>(l.z) * r.z;
+        };
+        auto distance = [](const Vec3& l, double x, double y, double z) {
+            return std::sqrt((l.x - x) * (l.x - x) + (l.y - y) * (l.y - y) + (l.z - z) * (l.z - z));
+        };
+        const Vec3 ab = b - a, ac = c - a, ap = p - a;
+        const double d1 = dot(ab, ap), d2 = dot(ac, ap);
+        if (d1 <= 0 && d2 <= 0) return distance(p, a.x, a.y, a.z);
+        const Vec3 bp = p - b;
+        const double d3 = dot(ab, bp), d4 = dot(ac, bp);
+        if (d3 >= 0 && d4 <= d3) return distance(p, b.x, b.y, b.z);
+        const double vc = d1 * d4 - d3 * d2;
+        if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+            const double t = d1 / (d1 - d3);
+            return distance(p, a.x + t * ab.x, a.y + t * ab.y, a.z + t * ab.z);
+        }
+        const Vec3 cp = p - c;
+        const double d5 = dot(ab, cp), d6 = dot(ac, cp);
+        if (d6 >= 0 && d5 <= d6) return distance(p, c.x, c.y, c.z);
+        const double vb = d5 * d2 - d1 * d6;
+        if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+            const double t = d2 / (d2 - d6);
+            return distance(p, a.x + t * ac.x, a.y + t * ac.y, a.z + t * ac.z);
+        }
+        const double va = d3 * d6 - d5 * d4;
+        if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+            const double t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            return distance(p, b.x + t * (c.x - b.x), b.y + t * (c.y - b.y), b.z + t * (c.z - b.z));
+        }
+        const double denom = 1.0 / (va + vb + vc);
+        const double v = vb * denom, w = vc * denom;
+        return distance(p, a.x + ab.x * v + ac.x * w, a.y + ab.y * v + ac.y * w,
+            a.z + ab.z * v + ac.z * w);
+    }
+
+    /**
+     * @brief _ƏdS̑SOp`܂ł̋𑍓ŋ߂
+     */
+    double bruteForceOneSided(const std::vector<Vertex>& verticesA,
+        const std::vector<Index>& indicesA, const std::vector<Vertex>& verticesB,
+        const std::vector<Index>& indicesB) {
+        double result = 0.0;
+        auto nearest = [&](const Vec3& p) {
+            double best = DBL_MAX;
+            for (size_t i = 0; i < indicesB.size(); i += 3) {
+                best = std::fmin(best, pointTriangleDistance(p, verticesB[indicesB[i]].position,
+                    verticesB[indicesB[i + 1]].position, verticesB[indicesB[i + 2]].position));
+            }
+            return best;
+        };
+        for (size_t i = 0; i < indicesA.size(); i += 3) {
+            Vec3 centroid(0.0f);
+            for (size_t k = 0; k < 3; k++) {
+                const Vec3& p = verticesA[indicesA[i + k]].position;
+                centroid += p;
+                result = std::fmax(result, nearest(p));
+            }
+            result = std::fmax(result, nearest(centroid / 3.0f));
+        }
+        return result;
+    }
+    double bruteForceHausdorff(const std::vector<Vertex>& verticesA,
+        const std::vector<Index>& indicesA, const std::vector<Vertex>& verticesB,
+        const std::vector<Index>& indicesB) {
+        return std::fmax(bruteForceOneSided(verticesA, indicesA, verticesB, indicesB),
+            bruteForceOneSided(verticesB, indicesB, verticesA, indicesA));
+    }
+} // namespace
+
+//bVȂ狗0
+TEST(MeshSimplifierTest, HausdorffOfSameMeshIsZero) {
+    std::vector<Vertex> vertices;
+    std::vector<Index> indices;
+    makeSphere(16, 8, &vertices, &indices);
+    EXPECT_NEAR(
+        MeshSimplifier::computeHausdorffDistance(vertices, indices, vertices, indices), 0.0f, 1e-5f);
+}
+
+//sɂ炵ʂ͂炵ɂȂ
+TEST(MeshSimplifierTest, HausdorffOfOffsetPlane) {
+    std::vector<Vertex> verticesA, verticesB;
+    std::vector<Index> indicesA, indicesB;
+    makeGrid(8, 0.0f, &verticesA, &indicesA);
+    makeGrid(3, 0.25f, &verticesB, &indicesB);
+    EXPECT_NEAR(MeshSimplifier::computeHausdorffDistance(verticesA, indicesA, verticesB, indicesB),
+        0.25f, 1e-5f);
+}
+
+//ObhŒT͑ƈv
+TEST(MeshSimplifierTest, HausdorffMatchesBruteForce) {
+    std::vector<Vertex> vertices, coarseVertices;
+    std::vector<Index> indices, coarseIndices;
+    makeSphere(48, 24, &vertices, &indices);
+    makeSphere(7, 5, &coarseVertices, &coarseIndices);
+    const double expected = bruteForceHausdorff(vertices, indices, coarseVertices, coarseIndices);
+    EXPECT_GT(expected, 0.05);
+    EXPECT_NEAR(
+        MeshSimplifier::computeHausdorffDistance(vertices, indices, coarseVertices, coarseIndices),
+        expected, 1e-4);
+}
+
+//ʂ͌`ςɖڕW܂Ō点
+TEST(MeshSimplifierTest, SimplifyFlatGrid) {
+    std::vector<Vertex> vertices;
+    std::vector<Index> indices;
+    makeGrid(16, 0.0f, &vertices, &indices);
+    SimplifyOptions options;
+    options.targetIndexCount = static_cast<UINT>(indices.size() / 8);
+    std::vector<Index> result;
+    const float error = MeshSimplifier::simplify(vertices, indices, options, &result);
+    EXPECT_LE(result.size(), options.targetIndexCount);
+    EXPECT_EQ(result.size() % 3, 0u);
+    EXPECT_NEAR(error, 0.0f, 1e-5f);
+    EXPECT_NEAR(MeshSimplifier::computeHausdorffDistance(vertices, indices, vertices, result), 0.0f,
+        1e-5f);
+}
+
+//gĂ钸_QƂ̏ɋl߂
+TEST(MeshSimplifierTest, CompactVertices) {
+    std::vector<Vertex> vertices;
+    std::vector<Index> indices;
+    makeGrid(2, 0.0f, &vertices, &indices);
+    const std::vector<Index> subset = { 8, 4, 0 };
+    std::vector<Vertex> compactedVertices;
+    std::vector<Index> compactedIndices;
+    MeshSimplifier::compactVertices(vertices, subset, &compactedVertices, &compactedIndices);
+    ASSERT_EQ(compactedVertices.size(), 3u);
+    EXPECT_EQ(compactedIndices, (std::vector<Index>{ 0, 1, 2 }));
+    for (UINT i = 0; i < 3; i++) {
+        EXPECT_EQ(compactedVertices[i].position, vertices[subset[i]].position);
+    }
+}
+
+//iǨ덷͏ŁAۂ̃nEXhtȂ
+TEST(MeshSimplifierTest, LodChainErrorBoundsHausdorff) {
+    std::vector<Vertex> vertices;
+    std::vector<Index> indices;
+    makeSphere(32, 16, &vertices, &indices);
+    LodChainOptions options;
+    options.maxLevelCount = 5;
+    options.maxError = 0.2f;
+    std::vector<LodMesh> lods;
+    MeshSimplifier::buildLodChain(vertices, indices, options, &lods);
+    ASSERT_GE(lods.size(), 2u);
+
+    size_t previousCount = indices.size();
+    float previousError = 0.0f;
+    for (auto&& lod : lods) {
+        EXPECT_LE(lod.indices.size(), previousCount * MeshSimplifier::MIN_LEVEL_REDUCTION);
+        EXPECT_GE(lod.geometricError, previousError);
+        EXPECT_LE(lod.geometricError, options.maxError);
+        const double actual = bruteForceHausdorff(vertices, indices, lod.vertices, lod.indices);
+        EXPECT_GE(lod.geometricError, actual - 1e-4);
+        for (const Index index : lod.indices) ASSERT_LT(index, lod.vertices.size());
+        previousCount = lod.indices.size();
+        previousError = lod.geometricError;
+    }
+}
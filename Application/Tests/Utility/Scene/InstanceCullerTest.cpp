@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <bitset>
+#include <random>
+#include "Utility/Scene/InstanceCuller.h"
+
+using namespace Framework::Utility;
+using namespace Framework::Math;
+
+namespace {
+    constexpr UINT SHADOW_MASK = 0x2;
+
+    /**
+     * @brief ŃCX^XU΂点
+     */
+    void fillRandom(InstanceStore* store, UINT count, UINT seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> size(0.1f, 20.0f);
+        std::vector<InstanceCreateDesc> descs(count);
+        for (auto&& desc : descs) {
+            desc.position = Vector3(position(rng), position(rng) * 0.2f, position(rng));
+            desc.localBounds.extents = Vector3(size(rng), size(rng), size(rng));
+            desc.mask = rng() % 3 == 0 ? (0x1 | SHADOW_MASK) : 0x1;
+        }
+        store->clear();
+        store->createBulk(descs.data(), count, nullptr);
+        store->updateTransforms();
+    }
+
+    /**
+     * @brief JJȌ
+     */
+    CullingParams makeParams(const Vector3& eye, const Vector3& at) {
+        const Matrix4x4 view = Matrix4x4::createView(eye, at, Vector3(0, 1, 0));
+        const Matrix4x4 proj
+            = Matrix4x4::createProjection(Deg(60.0f).toRadians(), 16.0f / 9.0f, 0.1f, 1000.0f);
+        CullingParams params;
+        InstanceCuller::extractFrustumPlanes(view * proj, &params);
+        params.viewPosition = eye;
+        params.maxDistance = 400.0f;
+        params.relevanceDistance = 150.0f;
+        params.relevanceMask = SHADOW_MASK;
+        return params;
+    }
+
+    /**
+     * @brief 1fɔ肷
+     * @param slack Eǂꂾɂ߂邩 Ȃ猵
+     */
+    bool referenceVisible(
+        const CullingParams& params, const InstanceBounds& bounds, UINT mask, float slack) {
+        const Vector3& c = bounds.center;
+        const Vector3& e = bounds.extents;
+        bool inside = true;
+        for (UINT p = 0; p < params.planeCount; p++) {
+            const Vector4& n = params.planes[p];
+            const float distance = n.x * c.x + n.y * c.y + n.z * c.z + n.w;
+            const float radius = std::abs(n.x) * e.x + std::abs(n.y) * e.y + std::abs(n.z) * e.z;
+            const float scale = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+            if (distance + radius + slack * scale < 0.0f) inside = false;
+        }
+        const Vector3 d = c - params.viewPosition;
+        const float distance = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z)
+            - std::sqrt(e.x * e.x + e.y * e.y + e.z * e.z) - slack;
+        if (inside && distance <= params.maxDistance) return true;
+        return (mask & params.relevanceMask) != 0 && distance <= params.relevanceDistance;
+    }
+
+    /**
+     * @brief ʂfȔƈv邩m߂
+     * @details Z̏Ⴄ̂ŁAE肬̂̂͂ǂł悢
+     */
+    void expectMatchesReference(
+        const InstanceStore& store, const CullingParams& params, const InstanceCuller& culler) {
+        constexpr float SLACK = 1e-2f;
+        const InstanceBounds* bounds = store.getWorldBounds();
+        const UINT* masks = store.getMasks();
+        std::vector<UINT> expected;
+        for (UINT i = 0; i < store.getCount(); i++) {
+            const bool strict = referenceVisible(params, bounds[i], masks[i], -SLACK);
+            const bool loose = referenceVisible(params, bounds[i], masks[i], SLACK);
+            const bool actual = culler.isVisible(i);
+            if (strict) {
+                EXPECT_TRUE(actual) << "instance " << i;
+            }
+            if (!loose) {
+                EXPECT_FALSE(actual) << "instance " << i;
+            }
+            if (actual) expected.emplace_back(i);
+        }
+        //ĉ̈ꗗ̓rbgƓŏ
+        EXPECT_EQ(culler.getActiveInstances(), expected);
+    }
+} // namespace
+
+//4̔ƒ[̔肪A1fɔ肵ʂƈv
+TEST(InstanceCullerTest, MatchesScalarReference) {
+    for (UINT count : { 1u, 3u, 4u, 63u, 64u, 65u, 1001u, 10000u }) {
+        InstanceStore store;
+        fillRandom(&store, count, count);
+        InstanceCuller culler;
+        const CullingParams params = makeParams(Vector3(0, 50, -300), Vector3(0, 0, 0));
+        culler.cull(store, params);
+        SCOPED_TRACE(count);
+        expectMatchesReference(store, params, culler);
+    }
+}
+
+//̊Oł߂̉e𗎂Ƃ͎̂cAłȂ̂͊O
+TEST(InstanceCullerTest, KeepsRelevantInstancesBehindCamera) {
+    InstanceStore store;
+    InstanceCreateDesc desc;
+    desc.localBounds.extents = Vector3(1.0f);
+    //J̐^ɓ
+    desc.position = Vector3(0, 0, -20);
+    desc.mask = 0x1;
+    store.create(desc);
+    desc.mask = 0x1 | SHADOW_MASK;
+    store.create(desc);
+    //ʂ̉
+    desc.position = Vector3(0, 0, 900);
+    store.create(desc);
+    store.updateTransforms();
+
+    InstanceCuller culler;
+    culler.cull(store, makeParams(Vector3(0, 0, 0), Vector3(0, 0, 1)));
+    EXPECT_FALSE(culler.isVisible(0));
+    EXPECT_TRUE(culler.isVisible(1));
+    EXPECT_FALSE(culler.isVisible(2));
+    EXPECT_EQ(culler.getActiveCount(), 1u);
+}
+
+//J𓮂ƌʂς̂L^
+TEST(InstanceCullerTest, ChangedBitsTrackVisibilityFlips) {
+    InstanceStore store;
+    fillRandom(&store, 5000, 9);
+    InstanceCuller culler;
+    culler.cull(store, makeParams(Vector3(0, 50, -300), Vector3(0, 0, 0)));
+    const std::vector<UINT64> before = culler.getVisibleBits();
+
+    const CullingParams turned = makeParams(Vector3(0, 50, -300), Vector3(300, 0, 0));
+    culler.cull(store, turned);
+    expectMatchesReference(store, turned, culler);
+    const std::vector<UINT64>& after = culler.getVisibleBits();
+    const std::vector<UINT64>& changed = culler.getChangedBits();
+    ASSERT_EQ(changed.size(), before.size());
+    UINT flips = 0;
+    for (size_t w = 0; w < changed.size(); w++) {
+        EXPECT_EQ(changed[w], before[w] ^ after[w]);
+        flips += static_cast<UINT>(std::bitset<64>(changed[w]).count());
+    }
+    EXPECT_GT(flips, 0u);
+
+    //łx肷ΉςȂ
+    culler.cull(store, turned);
+    for (UINT64 word : culler.getChangedBits()) EXPECT_EQ(word, 0u);
+}
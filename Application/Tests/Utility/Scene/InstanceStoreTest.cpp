@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+#include "Utility/Scene/InstanceStore.h"
+
+using namespace Framework::Utility;
+using namespace Framework::Math;
+
+namespace {
+    constexpr float EPS = 1e-5f;
+
+    /**
+     * @brief WIg̔ԍUCX^X܂Ƃ߂Đ
+     */
+    std::vector<InstanceHandle> createNumbered(InstanceStore* store, UINT count) {
+        std::vector<InstanceCreateDesc> descs(count);
+        for (UINT i = 0; i < count; i++) {
+            descs[i].position = Vector3(static_cast<float>(i), 0.0f, 0.0f);
+            descs[i].geometry = i;
+        }
+        std::vector<InstanceHandle> handles(count);
+        store->createBulk(descs.data(), count, handles.data());
+        return handles;
+    }
+
+    /**
+     * @brief _[eBɂȂĂvf̐𐔂
+     */
+    UINT countDirty(const InstanceStore& store) {
+        UINT count = 0;
+        for (UINT i = 0; i < store.getCount(); i++) {
+            if (store.isDirty(i)) count++;
+        }
+        return count;
+    }
+} // namespace
+
+//폜gėpƐオi݁AÂnh͖ɂȂ
+TEST(InstanceStoreTest, DestroyedHandleBecomesInvalid) {
+    InstanceStore store;
+    const std::vector<InstanceHandle> handles = createNumbered(&store, 2);
+    const InstanceHandle a = handles[0];
+    store.destroy(a);
+    EXPECT_FALSE(store.isValid(a));
+    EXPECT_TRUE(store.isValid(handles[1]));
+
+    InstanceCreateDesc desc;
+    desc.geometry = 10;
+    const InstanceHandle c = store.create(desc);
+    EXPECT_EQ(a.index, c.index);
+    EXPECT_EQ(a.generation + 1, c.generation);
+    EXPECT_FALSE(store.isValid(a));
+    EXPECT_TRUE(store.isValid(c));
+    EXPECT_EQ(10u, store.getGeometries()[store.getDenseIndex(c)]);
+}
+
+//ׂč폜ƌÂnhׂ͂ĖɂȂ
+TEST(InstanceStoreTest, ClearInvalidatesAllHandles) {
+    InstanceStore store;
+    const std::vector<InstanceHandle> handles = createNumbered(&store, 5);
+    store.clear();
+    EXPECT_EQ(0u, store.getCount());
+    for (auto&& handle : handles) { EXPECT_FALSE(store.isValid(handle)); }
+
+    //g͍ėp邪オႤ
+    const std::vector<InstanceHandle> renewed = createNumbered(&store, 5);
+    for (auto&& handle : renewed) {
+        EXPECT_TRUE(store.isValid(handle));
+        EXPECT_EQ(1u, handle.generation);
+    }
+    for (auto&& handle : handles) { EXPECT_FALSE(store.isValid(handle)); }
+}
+
+//܂Ƃ߂č폜ƂAdnh△ȃnh͖
+TEST(InstanceStoreTest, DestroyBulkSkipsDuplicateAndInvalidHandles) {
+    InstanceStore store;
+    const std::vector<InstanceHandle> handles = createNumbered(&store, 8);
+    store.destroy(handles[6]);
+
+    const std::vector<InstanceHandle> targets
+        = { handles[1], handles[6], handles[3], handles[1], handles[7], handles[3] };
+    store.destroyBulk(targets.data(), static_cast<UINT>(targets.size()));
+    EXPECT_EQ(4u, store.getCount());
+
+    //ĉ̓nhĝ܂
+    for (UINT i : { 0u, 2u, 4u, 5u }) {
+        ASSERT_TRUE(store.isValid(handles[i]));
+        const UINT dense = store.getDenseIndex(handles[i]);
+        EXPECT_EQ(i, store.getGeometries()[dense]);
+        EXPECT_EQ(handles[i].index, store.getHandle(dense).index);
+        EXPECT_EQ(handles[i].generation, store.getHandle(dense).generation);
+    }
+    for (UINT i : { 1u, 3u, 6u, 7u }) { EXPECT_FALSE(store.isValid(handles[i])); }
+}
+
+//̗vf󂢂ʒuɈڂƂAf̕ϊƃ_[eBp
+TEST(InstanceStoreTest, MovedElementKeepsPendingTransform) {
+    //rbg̃[h܂悤ɂ
+    constexpr UINT COUNT = 70;
+    InstanceStore store;
+    const std::vector<InstanceHandle> handles = createNumbered(&store, COUNT);
+    EXPECT_EQ(COUNT, store.updateTransforms());
+    store.clearDirty();
+
+    const InstanceHandle last = handles[COUNT - 1];
+    store.setPosition(last, Vector3(5.0f, 6.0f, 7.0f));
+    store.destroy(handles[0]);
+
+    ASSERT_EQ(0u, store.getDenseIndex(last));
+    EXPECT_TRUE(store.isDirty(0));
+    EXPECT_EQ(1u, countDirty(store));
+    //rbg͎cȂ
+    EXPECT_EQ(0ull, store.getDirtyBits()[1]);
+
+    EXPECT_EQ(1u, store.updateTransforms());
+    const InstanceTransform& transform = store.getTransforms()[0];
+    EXPECT_NEAR(5.0f, transform.m[0][3], EPS);
+    EXPECT_NEAR(6.0f, transform.m[1][3], EPS);
+    EXPECT_NEAR(7.0f, transform.m[2][3], EPS);
+}
+
+//ϊfς݂̗vfڂĂAvf̖f̕ϊ͎cȂ
+TEST(InstanceStoreTest, MovedElementDropsRemovedPendingTransform) {
+    constexpr UINT COUNT = 70;
+    InstanceStore store;
+    const std::vector<InstanceHandle> handles = createNumbered(&store, COUNT);
+    store.updateTransforms();
+    store.clearDirty();
+
+    store.setPosition(handles[0], Vector3(100.0f, 0.0f, 0.0f));
+    store.destroy(handles[0]);
+
+    const InstanceHandle last = handles[COUNT - 1];
+    ASSERT_EQ(0u, store.getDenseIndex(last));
+    EXPECT_TRUE(store.isDirty(0));
+    EXPECT_EQ(1u, countDirty(store));
+
+    EXPECT_EQ(0u, store.updateTransforms());
+    EXPECT_NEAR(static_cast<float>(COUNT - 1), store.getTransforms()[0].m[0][3], EPS);
+}
+
+//̗vfƂ̓rbg
+TEST(InstanceStoreTest, DestroyLastClearsItsBits) {
+    InstanceStore store;
+    const std::vector<InstanceHandle> handles = createNumbered(&store, 3);
+    store.updateTransforms();
+    store.clearDirty();
+
+    store.setPosition(handles[2], Vector3(1.0f, 1.0f, 1.0f));
+    store.destroy(handles[2]);
+    EXPECT_EQ(0u, countDirty(store));
+    EXPECT_EQ(0u, store.updateTransforms());
+
+    //ʒuɒǉvfɌÂrbgȂ
+    store.create(InstanceCreateDesc());
+    EXPECT_EQ(1u, countDirty(store));
+    EXPECT_EQ(1u, store.updateTransforms());
+}
+
+//WE]Eg傩烏[hϊsƃoEfBO{bNXvZ
+TEST(InstanceStoreTest, UpdateTransformsComposesWorldTransform) {
+    InstanceStore store;
+    InstanceCreateDesc desc;
+    desc.position = Vector3(1.0f, 2.0f, 3.0f);
+    desc.rotation = Quaternion::fromEular(Vector3(0.0f, 180.0f, 0.0f));
+    desc.scale = Vector3(2.0f, 2.0f, 2.0f);
+    desc.localBounds.extents = Vector3(1.0f, 2.0f, 3.0f);
+    const InstanceHandle handle = store.create(desc);
+    EXPECT_EQ(1u, store.updateTransforms());
+    //2ڂ͉ςĂȂ
+    EXPECT_EQ(0u, store.updateTransforms());
+
+    const float expected[3][4] = {
+        { -2.0f, 0.0f, 0.0f, 1.0f },
+        { 0.0f, 2.0f, 0.0f, 2.0f },
+        { 0.0f, 0.0f, -2.0f, 3.0f },
+    };
+    const InstanceTransform& transform = store.getTransforms()[0];
+    for (int row = 0; row < 3; row++) {
+        for (int col = 0; col < 4; col++) {
+            EXPECT_NEAR(expected[row][col], transform.m[row][col], EPS);
+        }
+    }
+    const InstanceBounds& bounds = store.getWorldBounds()[0];
+    EXPECT_NEAR(1.0f, bounds.center.x, EPS);
+    EXPECT_NEAR(2.0f, bounds.center.y, EPS);
+    EXPECT_NEAR(3.0f, bounds.center.z, EPS);
+    EXPECT_NEAR(2.0f, bounds.extents.x, EPS);
+    EXPECT_NEAR(4.0f, bounds.extents.y, EPS);
+    EXPECT_NEAR(6.0f, bounds.extents.z, EPS);
+
+    //Wςƕsړς
+    store.setPosition(handle, Vector3(-4.0f, 0.0f, 0.0f));
+    EXPECT_EQ(1u, store.updateTransforms());
+    EXPECT_NEAR(-4.0f, transform.m[0][3], EPS);
+    EXPECT_NEAR(-2.0f, transform.m[0][0], EPS);
+    EXPECT_NEAR(-4.0f, store.getWorldBounds()[0].center.x, EPS);
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "Utility/Scene/LodSelector.h"
+
+using namespace Framework::Utility;
+using namespace Framework::Math;
+
+namespace {
+    //WIg1013ׂɕׂiK 10,100,10001ieȂ
+    const LodLevel LEVELS[] = {
+        { 10, 0, 0.0f },
+        { 11, 1, 0.01f },
+        { 12, 2, 0.1f },
+        { 13, 3, 1.0f },
+    };
+    constexpr UINT LEVEL_COUNT = 4;
+
+    /**
+     * @brief 11Pʂ1000sNZɂȂ
+     */
+    LodParams makeParams(const Vector3& viewPosition) {
+        LodParams params;
+        params.viewPosition = viewPosition;
+        params.projectionScale = 1000.0f;
+        params.maxPixelError = 1.0f;
+        params.hysteresis = 0.25f;
+        return params;
+    }
+
+    /**
+     * @brief X̎w肵ɑ傫̂ȂCX^X
+     */
+    InstanceHandle createAt(InstanceStore* store, float x, UINT lodGroup) {
+        InstanceCreateDesc desc;
+        desc.position = Vector3(x, 0.0f, 0.0f);
+        desc.geometry = LEVELS[0].geometry;
+        desc.lodGroup = lodGroup;
+        return store->create(desc);
+    }
+} // namespace
+
+//c̎p90xȂʂ̍̔g嗦ɂȂ
+TEST(LodSelectorTest, ComputeProjectionScale) {
+    EXPECT_NEAR(LodSelector::computeProjectionScale(Deg(90.0f).toRadians().getRad(), 1080.0f), 540.0f,
+        1e-3f);
+}
+
+//덷eʂ𒴂炷ɍׂ
+TEST(LodSelectorTest, SelectLevelRefinesImmediately) {
+    const LodParams params = makeParams(Vector3(0.0f));
+    //1Pʂ5sNZȂiK1̌덷0.05sNZ܂ŋeł
+    EXPECT_EQ(LodSelector::selectLevel(LEVELS, LEVEL_COUNT, 3, 5.0f, params), 2u);
+    EXPECT_EQ(LodSelector::selectLevel(LEVELS, LEVEL_COUNT, 3, 50.0f, params), 1u);
+    EXPECT_EQ(LodSelector::selectLevel(LEVELS, LEVEL_COUNT, 3, 1e6f, params), 0u);
+}
+
+//ê͋eʂɗ]TłĂɂ
+TEST(LodSelectorTest, SelectLevelCoarsensWithHysteresis) {
+    const LodParams params = makeParams(Vector3(0.0f));
+    //iK2̌덷0.9sNZŎ܂邪]TȂ̂ŒiK1ɗ܂
+    EXPECT_EQ(LodSelector::selectLevel(LEVELS, LEVEL_COUNT, 1, 9.0f, params), 1u);
+    //0.7sNZȂ]T
+    EXPECT_EQ(LodSelector::selectLevel(LEVELS, LEVEL_COUNT, 1, 7.0f, params), 2u);
+    //xɕieł
+    EXPECT_EQ(LodSelector::selectLevel(LEVELS, LEVEL_COUNT, 0, 0.1f, params), 3u);
+}
+
+//ɉăWIg؂ւAςȂΉȂ
+TEST(LodSelectorTest, SelectSwitchesGeometry) {
+    LodSelector selector;
+    const UINT group = selector.addGroup(LEVELS, LEVEL_COUNT);
+    InstanceStore store;
+    const float distances[] = { 5.0f, 50.0f, 500.0f, 5000.0f };
+    InstanceHandle handles[4];
+    for (int i = 0; i < 4; i++) handles[i] = createAt(&store, distances[i], group);
+    const InstanceHandle fixed = createAt(&store, 5000.0f, InstanceCreateDesc::NO_LOD_GROUP);
+    store.updateTransforms();
+    store.clearDirty();
+
+    const LodParams params = makeParams(Vector3(0.0f));
+    EXPECT_EQ(selector.select(&store, params, nullptr, nullptr), 3u);
+    for (UINT i = 0; i < 4; i++) {
+        const UINT dense = store.getDenseIndex(handles[i]);
+        EXPECT_EQ(store.getGeometries()[dense], LEVELS[i].geometry);
+        EXPECT_EQ(store.getHitGroupIndices()[dense], LEVELS[i].hitGroupIndex);
+        EXPECT_EQ(store.isDirty(dense), i != 0);
+    }
+    //O[vȂ̂͐؂ւȂ
+    EXPECT_EQ(store.getGeometries()[store.getDenseIndex(fixed)], LEVELS[0].geometry);
+    const std::array<UINT, LodSelector::MAX_LEVEL_COUNT> expected = { 1, 1, 1, 1 };
+    EXPECT_EQ(selector.getLevelCounts(), expected);
+
+    store.clearDirty();
+    EXPECT_EQ(selector.select(&store, params, nullptr, nullptr), 0u);
+}
+
+//CX^X̊g͉ʏ̌덷傫
+TEST(LodSelectorTest, ScaleRefinesLevel) {
+    LodSelector selector;
+    const UINT group = selector.addGroup(LEVELS, LEVEL_COUNT);
+    InstanceStore store;
+    InstanceCreateDesc desc;
+    desc.position = Vector3(500.0f, 0.0f, 0.0f);
+    desc.scale = Vector3(1.0f, 20.0f, 1.0f);
+    desc.geometry = LEVELS[0].geometry;
+    desc.lodGroup = group;
+    store.create(desc);
+    store.updateTransforms();
+    selector.select(&store, makeParams(Vector3(0.0f)), nullptr, nullptr);
+    EXPECT_EQ(store.getGeometries()[0], LEVELS[1].geometry);
+}
+
+//{bNX̒Ɏ_΍łׂ
+TEST(LodSelectorTest, InsideBoundsSelectsFinest) {
+    LodSelector selector;
+    const UINT group = selector.addGroup(LEVELS, LEVEL_COUNT);
+    InstanceStore store;
+    InstanceCreateDesc desc;
+    desc.position = Vector3(5000.0f, 0.0f, 0.0f);
+    desc.localBounds.extents = Vector3(10.0f);
+    desc.geometry = LEVELS[3].geometry;
+    desc.lodGroup = group;
+    store.create(desc);
+    store.updateTransforms();
+    selector.select(&store, makeParams(Vector3(5005.0f, 0.0f, 0.0f)), nullptr, nullptr);
+    EXPECT_EQ(store.getGeometries()[0], LEVELS[0].geometry);
+}
+
+//w肵ʒuI
+TEST(LodSelectorTest, SelectActiveOnly) {
+    LodSelector selector;
+    const UINT group = selector.addGroup(LEVELS, LEVEL_COUNT);
+    InstanceStore store;
+    for (int i = 0; i < 4; i++) createAt(&store, 5000.0f, group);
+    store.updateTransforms();
+    const std::vector<UINT> active = { 1, 3 };
+    EXPECT_EQ(selector.select(&store, makeParams(Vector3(0.0f)), &active, nullptr), 2u);
+    EXPECT_EQ(store.getGeometries()[0], LEVELS[0].geometry);
+    EXPECT_EQ(store.getGeometries()[1], LEVELS[3].geometry);
+    EXPECT_EQ(store.getGeometries()[2], LEVELS[0].geometry);
+    EXPECT_EQ(store.getGeometries()[3], LEVELS[3].geometry);
+}
+
+//폜Ŕz̏ԂςĂA̒iK̓WIg狁߂̂őIђȂ
+TEST(LodSelectorTest, DestroyDoesNotResetLevels) {
+    LodSelector selector;
+    const UINT group = selector.addGroup(LEVELS, LEVEL_COUNT);
+    InstanceStore store;
+    const InstanceHandle near = createAt(&store, 5.0f, group);
+    createAt(&store, 50.0f, group);
+    createAt(&store, 5000.0f, group);
+    store.updateTransforms();
+    const LodParams params = makeParams(Vector3(0.0f));
+    selector.select(&store, params, nullptr, nullptr);
+    store.destroy(near);
+    store.clearDirty();
+    EXPECT_EQ(selector.select(&store, params, nullptr, nullptr), 0u);
+}
+
+//ɑIłƓʂɂȂ
+TEST(LodSelectorTest, ParallelMatchesSerial) {
+    constexpr UINT COUNT = LodSelector::GRAIN_SIZE * 5 + 17;
+    LodSelector serial;
+    LodSelector parallel;
+    serial.addGroup(LEVELS, LEVEL_COUNT);
+    parallel.addGroup(LEVELS, LEVEL_COUNT);
+    InstanceStore serialStore;
+    InstanceStore parallelStore;
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> distance(1.0f, 3000.0f);
+    for (UINT i = 0; i < COUNT; i++) {
+        const float x = distance(rng);
+        createAt(&serialStore, x, 0);
+        createAt(&parallelStore, x, 0);
+    }
+    serialStore.updateTransforms();
+    parallelStore.updateTransforms();
+    WorkerPool workers(3);
+    LodParams params = makeParams(Vector3(0.0f));
+    for (int frame = 0; frame < 3; frame++) {
+        params.viewPosition.x = static_cast<float>(frame) * 400.0f;
+        EXPECT_EQ(serial.select(&serialStore, params, nullptr, nullptr),
+            parallel.select(&parallelStore, params, nullptr, &workers));
+        EXPECT_EQ(serial.getLevelCounts(), parallel.getLevelCounts());
+        for (UINT i = 0; i < COUNT; i++) {
+            ASSERT_EQ(serialStore.getGeometries()[i], parallelStore.getGeometries()[i]);
+        }
+    }
+}
@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include "Utility/Scene/SceneFile.h"
+
+using namespace Framework::Utility;
+using namespace Framework::Math;
+
+namespace {
+    constexpr UINT64 INSTANCE_OFFSET_POSITION = 40; //!< wb_[̃CX^X̔z̈ʒu
+
+    const char* const SCENE_TEXT = R"(# eXgp̃V[
+model house House/house.glb Normal
+model ball Sphere/sphere.glb Sphere procedural_sphere
+
+group root 0 0 0
+group spin 10 0 0 rotation 0 90 0 scale 2 2 2 parent root   # O[v
+instance house 1 2 3
+instance ball 0 1 0 scale 0.5 0.5 0.5 parent spin
+instance house -4 0 4 rotation 0 180 0 parent root
+)";
+
+    /**
+     * @brief eXgƂɋ̃fBNgpӂ
+     */
+    class SceneFileTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            mDirectory = std::filesystem::temp_directory_path()
+                / ("SceneFileTest_"
+                    + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+            std::filesystem::remove_all(mDirectory);
+            std::filesystem::create_directories(mDirectory);
+            mTextPath = mDirectory / "scene.txt";
+            mBinaryPath = mDirectory / "Cache" / "scene.bin";
+        }
+        void TearDown() override {
+            std::filesystem::remove_all(mDirectory);
+        }
+        //eLXg`̃t@C
+        void writeText(const std::string& text) {
+            std::ofstream(mTextPath, std::ios::binary | std::ios::trunc) << text;
+        }
+        //oCi`̃t@C̈ꕔ
+        void overwrite(UINT64 offset, const void* data, size_t size) {
+            std::fstream file(mBinaryPath, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(static_cast<std::streamoff>(offset));
+            file.write(static_cast<const char*>(data), size);
+        }
+        //oCi`̃t@C̈ꕔǂ
+        template <class T>
+        T read(UINT64 offset) {
+            T value;
+            std::ifstream file(mBinaryPath, std::ios::binary);
+            file.seekg(static_cast<std::streamoff>(offset));
+            file.read(reinterpret_cast<char*>(&value), sizeof(T));
+            return value;
+        }
+
+        std::filesystem::path mDirectory;
+        std::filesystem::path mTextPath;
+        std::filesystem::path mBinaryPath;
+    };
+} // namespace
+
+//eLXg`ϊê܂ܓǂ߂
+TEST_F(SceneFileTest, ConvertAndLoad) {
+    writeText(SCENE_TEXT);
+    SceneFile file;
+    ASSERT_TRUE(file.load(mTextPath, mBinaryPath));
+    EXPECT_TRUE(std::filesystem::exists(mBinaryPath));
+
+    ASSERT_EQ(file.getModelCount(), 2u);
+    EXPECT_STREQ(file.getString(file.getModels()[0].name), "house");
+    EXPECT_STREQ(file.getString(file.getModels()[0].file), "House/house.glb");
+    EXPECT_STREQ(file.getString(file.getModels()[0].hitGroup), "Normal");
+    EXPECT_EQ(file.getModels()[0].flags, SceneModelFlags::None);
+    EXPECT_EQ(file.getModels()[1].flags, SceneModelFlags::ProceduralSphere);
+
+    ASSERT_EQ(file.getGroupCount(), 2u);
+    EXPECT_EQ(file.getGroups()[0].parent, SceneFile::NO_PARENT);
+    EXPECT_EQ(file.getGroups()[1].parent, 0u);
+    EXPECT_EQ(file.findGroup("spin"), 1u);
+    EXPECT_EQ(file.findGroup("missing"), SceneFile::NO_PARENT);
+
+    ASSERT_EQ(file.getInstanceCount(), 3u);
+    const SceneInstanceRecord* instances = file.getInstances();
+    EXPECT_EQ(instances[0].model, 0u);
+    EXPECT_EQ(instances[0].parent, SceneFile::NO_PARENT);
+    EXPECT_EQ(instances[1].model, 1u);
+    EXPECT_EQ(instances[1].parent, 1u);
+    EXPECT_EQ(instances[2].parent, 0u);
+    Vector3 position, scale;
+    Quaternion rotation;
+    SceneFile::decodeTransform(instances[1].transform, &position, &rotation, &scale);
+    EXPECT_EQ(position, Vector3(0, 1, 0));
+    EXPECT_EQ(scale, Vector3(0.5f));
+}
+
+//l߂]͌̉]Ƃقړɖ߂
+TEST_F(SceneFileTest, TransformRoundTrip) {
+    const Vector3 angles[] = { Vector3(0, 0, 0), Vector3(0, 180, 0), Vector3(30, -45, 120),
+        Vector3(89, 10, -170) };
+    for (const Vector3& angle : angles) {
+        const Quaternion expected = Quaternion::fromEular(angle);
+        const SceneTransform packed
+            = SceneFile::encodeTransform(Vector3(1, -2, 3), expected, Vector3(4, 5, 6));
+        Vector3 position, scale;
+        Quaternion rotation;
+        SceneFile::decodeTransform(packed, &position, &rotation, &scale);
+        EXPECT_EQ(position, Vector3(1, -2, 3));
+        EXPECT_EQ(scale, Vector3(4, 5, 6));
+        //q-q͓]Ȃ̂œς̐ΒlŔׂ
+        const float dot = std::fabs(rotation.x * expected.x + rotation.y * expected.y
+            + rotation.z * expected.z + rotation.w * expected.w);
+        EXPECT_NEAR(dot, 1.0f, 1e-6f);
+    }
+}
+
+//eLXg`VȂϊ
+TEST_F(SceneFileTest, ReconvertsWhenTextIsNewer) {
+    writeText(SCENE_TEXT);
+    {
+        SceneFile file;
+        ASSERT_TRUE(file.load(mTextPath, mBinaryPath));
+        EXPECT_EQ(file.getInstanceCount(), 3u);
+    }
+    writeText(std::string(SCENE_TEXT) + "instance ball 5 5 5\n");
+    std::filesystem::last_write_time(mBinaryPath,
+        std::filesystem::last_write_time(mTextPath) - std::chrono::seconds(10));
+    SceneFile file;
+    ASSERT_TRUE(file.load(mTextPath, mBinaryPath));
+    EXPECT_EQ(file.getInstanceCount(), 4u);
+}
+
+//oCi`Εϊɓǂ߂
+TEST_F(SceneFileTest, LoadsBinaryWithoutText) {
+    writeText(SCENE_TEXT);
+    ASSERT_TRUE(SceneFile::convert(mTextPath, mBinaryPath));
+    std::filesystem::remove(mTextPath);
+    SceneFile file;
+    ASSERT_TRUE(file.load(mTextPath, mBinaryPath));
+    EXPECT_EQ(file.getInstanceCount(), 3u);
+    EXPECT_FALSE(file.load(mDirectory / "missing.txt", mDirectory / "missing.bin"));
+}
+
+//͕̌ϊȂ
+TEST_F(SceneFileTest, RejectsInvalidText) {
+    const char* const invalidTexts[] = {
+        "unknown house\n",
+        "model house house.glb\n",
+        "model house house.glb Normal cube\n",
+        "model house a.glb Normal\nmodel house b.glb Normal\n",
+        "instance house 0 0 0\n",
+        "model house a.glb Normal\ninstance house 0 0\n",
+        "model house a.glb Normal\ninstance house 0 0 x\n",
+        "model house a.glb Normal\ninstance house 0 0 0 parent missing\n",
+        "model house a.glb Normal\ninstance house 0 0 0 size 1 1 1\n",
+        "group root 0 0 0 parent root\n",
+        "group root 0 0 0\ngroup root 1 1 1\n",
+    };
+    for (const char* text : invalidTexts) {
+        writeText(text);
+        EXPECT_FALSE(SceneFile::convert(mTextPath, mBinaryPath)) << text;
+    }
+}
+
+//ʎqႦΌÂt@CƂēǂ܂Ȃ
+TEST_F(SceneFileTest, RejectsStaleBinary) {
+    writeText(SCENE_TEXT);
+    ASSERT_TRUE(SceneFile::convert(mTextPath, mBinaryPath));
+    const UINT32 magic = 0;
+    overwrite(0, &magic, sizeof(magic));
+    SceneFile file;
+    EXPECT_FALSE(file.loadBinary(mBinaryPath));
+    EXPECT_EQ(file.getInstanceCount(), 0u);
+    //eLXg`蒼
+    EXPECT_TRUE(file.load(mTextPath, mBinaryPath));
+}
+
+//rŐ؂ꂽt@C͓ǂ܂Ȃ
+TEST_F(SceneFileTest, RejectsTruncatedBinary) {
+    writeText(SCENE_TEXT);
+    ASSERT_TRUE(SceneFile::convert(mTextPath, mBinaryPath));
+    std::filesystem::resize_file(mBinaryPath, std::filesystem::file_size(mBinaryPath) - 4);
+    SceneFile file;
+    EXPECT_FALSE(file.loadBinary(mBinaryPath));
+}
+
+//͈͊O̔ԍt@C͓ǂ܂Ȃ
+TEST_F(SceneFileTest, RejectsOutOfRangeIndices) {
+    writeText(SCENE_TEXT);
+    ASSERT_TRUE(SceneFile::convert(mTextPath, mBinaryPath));
+    const UINT64 instanceOffset = read<UINT64>(INSTANCE_OFFSET_POSITION);
+    const UINT16 model = 2;
+    overwrite(instanceOffset + offsetof(SceneInstanceRecord, model), &model, sizeof(model));
+    SceneFile file;
+    EXPECT_FALSE(file.loadBinary(mBinaryPath));
+
+    ASSERT_TRUE(SceneFile::convert(mTextPath, mBinaryPath));
+    const UINT16 parent = 2;
+    overwrite(instanceOffset + offsetof(SceneInstanceRecord, parent), &parent, sizeof(parent));
+    EXPECT_FALSE(file.loadBinary(mBinaryPath));
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include "Utility/Scene/SceneGraph.h"
+
+using namespace Framework::Utility;
+using namespace Framework::Math;
+
+namespace {
+    const Quaternion IDENTITY = Quaternion::IDENTITY;
+    const Vector3 ONE = Vector3(1.0f);
+
+    /**
+     * @brief [hϊs̕sړo
+     */
+    Vector3 translation(const InstanceTransform& transform) {
+        return Vector3(transform.m[0][3], transform.m[1][3], transform.m[2][3]);
+    }
+    void expectNear(const Vector3& actual, const Vector3& expected) {
+        EXPECT_NEAR(actual.x, expected.x, 1e-4f);
+        EXPECT_NEAR(actual.y, expected.y, 1e-4f);
+        EXPECT_NEAR(actual.z, expected.z, 1e-4f);
+    }
+
+    /**
+     * @brief em[hqbranch؂
+     * @return m[h D̏
+     */
+    std::vector<UINT> buildTree(SceneGraph* graph, UINT nodeCount, UINT branch) {
+        std::vector<UINT> nodes;
+        nodes.reserve(nodeCount);
+        nodes.emplace_back(graph->createNode(SceneGraph::INVALID_NODE, Vector3(0.0f), IDENTITY, ONE));
+        for (UINT i = 1; i < nodeCount; i++) {
+            const UINT parent = nodes[(i - 1) / branch];
+            nodes.emplace_back(graph->createNode(
+                parent, Vector3(static_cast<float>(i % 7), 1.0f, 0.0f), IDENTITY, ONE));
+        }
+        return nodes;
+    }
+} // namespace
+
+//q̃[hϊ͐e̊gE]Esړ󂯌p
+TEST(SceneGraphTest, ComposesParentTransforms) {
+    SceneGraph graph;
+    const UINT root = graph.createNode(SceneGraph::INVALID_NODE, Vector3(10, 0, 0),
+        Quaternion::fromEular(Vector3(0, 180, 0)), Vector3(2.0f));
+    const UINT child = graph.createNode(root, Vector3(1, 0, 0), IDENTITY, ONE);
+    const UINT grandChild = graph.createNode(child, Vector3(0, 3, 0), IDENTITY, ONE);
+    EXPECT_EQ(graph.update(nullptr, nullptr), 3u);
+    EXPECT_EQ(graph.getDepth(), 3u);
+    expectNear(translation(graph.getWorldTransform(root)), Vector3(10, 0, 0));
+    //180x2{Ȃ̂(1,0,0)(-2,0,0)
+    expectNear(translation(graph.getWorldTransform(child)), Vector3(8, 0, 0));
+    expectNear(translation(graph.getWorldTransform(grandChild)), Vector3(8, 6, 0));
+}
+
+//ςm[hƂ̎qvZ
+TEST(SceneGraphTest, UpdatesOnlyDirtySubtree) {
+    SceneGraph graph;
+    const std::vector<UINT> nodes = buildTree(&graph, 1 + 4 + 16, 4);
+    EXPECT_EQ(graph.update(nullptr, nullptr), 21u);
+    EXPECT_EQ(graph.update(nullptr, nullptr), 0u);
+
+    //2iڂ̃m[h4̎q
+    graph.setLocalPosition(nodes[1], Vector3(0, 0, 5));
+    EXPECT_EQ(graph.update(nullptr, nullptr), 5u);
+    //t͎
+    graph.setLocalScale(nodes[20], Vector3(3.0f));
+    EXPECT_EQ(graph.update(nullptr, nullptr), 1u);
+}
+
+//lݒ肵ĂύXƂĈȂ
+TEST(SceneGraphTest, UnchangedValuesAreNotDirty) {
+    SceneGraph graph;
+    const std::vector<UINT> nodes = buildTree(&graph, 21, 4);
+    graph.update(nullptr, nullptr);
+    const Quaternion rotation = Quaternion::fromEular(Vector3(0, 180, 0));
+    graph.setLocalRotation(nodes[0], rotation);
+    EXPECT_EQ(graph.update(nullptr, nullptr), 21u);
+    //t[]ݒ肵ĂvZȂ
+    for (int frame = 0; frame < 3; frame++) {
+        graph.setLocalRotation(nodes[0], rotation);
+        graph.setLocalPosition(nodes[1], Vector3(1, 1, 0));
+        graph.setLocalScale(nodes[2], ONE);
+        EXPECT_EQ(graph.update(nullptr, nullptr), 0u);
+    }
+}
+
+//̍XV͒̍XVƓsɂȂ
+TEST(SceneGraphTest, ParallelUpdateMatchesSerial) {
+    constexpr UINT NODE_COUNT = 20000;
+    SceneGraph serial;
+    SceneGraph parallel;
+    const std::vector<UINT> serialNodes = buildTree(&serial, NODE_COUNT, 3);
+    const std::vector<UINT> parallelNodes = buildTree(&parallel, NODE_COUNT, 3);
+    WorkerPool workers(3);
+    serial.update(nullptr, nullptr);
+    parallel.update(nullptr, &workers);
+
+    std::mt19937 rng(5);
+    for (int round = 0; round < 3; round++) {
+        for (UINT i = 0; i < SceneGraph::PARALLEL_THRESHOLD + 100; i++) {
+            const UINT index = rng() % NODE_COUNT;
+            const Quaternion rotation
+                = Quaternion::fromEular(Vector3(0, static_cast<float>(rng() % 360), 0));
+            serial.setLocalRotation(serialNodes[index], rotation);
+            parallel.setLocalRotation(parallelNodes[index], rotation);
+        }
+        EXPECT_EQ(serial.update(nullptr, nullptr), parallel.update(nullptr, &workers));
+        for (UINT i = 0; i < NODE_COUNT; i++) {
+            const InstanceTransform& a = serial.getWorldTransform(serialNodes[i]);
+            const InstanceTransform& b = parallel.getWorldTransform(parallelNodes[i]);
+            ASSERT_EQ(std::memcmp(&a, &b, sizeof(a)), 0) << "node " << i;
+        }
+    }
+}
+
+//etւƐVe̕ϊ󂯌p
+TEST(SceneGraphTest, ReparentAndDestroy) {
+    SceneGraph graph;
+    const UINT a = graph.createNode(SceneGraph::INVALID_NODE, Vector3(100, 0, 0), IDENTITY, ONE);
+    const UINT b = graph.createNode(SceneGraph::INVALID_NODE, Vector3(0, 100, 0), IDENTITY, ONE);
+    const UINT child = graph.createNode(a, Vector3(1, 0, 0), IDENTITY, ONE);
+    graph.createNode(child, Vector3(1, 0, 0), IDENTITY, ONE);
+    graph.update(nullptr, nullptr);
+    expectNear(translation(graph.getWorldTransform(child)), Vector3(101, 0, 0));
+
+    graph.setParent(child, b);
+    graph.update(nullptr, nullptr);
+    EXPECT_EQ(graph.getParent(child), b);
+    expectNear(translation(graph.getWorldTransform(child)), Vector3(1, 100, 0));
+
+    graph.destroyNode(child);
+    EXPECT_FALSE(graph.isValid(child));
+    EXPECT_EQ(graph.getNodeCount(), 2u);
+    graph.update(nullptr, nullptr);
+    EXPECT_EQ(graph.getDepth(), 1u);
+}
+
+//тCX^XɃ[hϊ
+TEST(SceneGraphTest, WritesLinkedInstances) {
+    InstanceStore instances;
+    const InstanceHandle handle = instances.create(InstanceCreateDesc());
+    instances.updateTransforms();
+    instances.clearDirty();
+
+    SceneGraph graph;
+    const UINT root = graph.createNode(SceneGraph::INVALID_NODE, Vector3(5, 0, 0), IDENTITY, ONE);
+    graph.createNode(root, Vector3(0, 2, 0), IDENTITY, ONE, handle);
+    graph.update(&instances, nullptr);
+    instances.updateTransforms();
+    expectNear(translation(instances.getTransforms()[0]), Vector3(5, 2, 0));
+    EXPECT_TRUE(instances.isDirty(0));
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include "Utility/Thread/WorkerPool.h"
+
+using namespace Framework::Utility;
+
+//ׂĂ̗vf傤ǈx
+TEST(WorkerPoolTest, VisitsEveryIndexOnce) {
+    WorkerPool pool(3);
+    constexpr UINT COUNT = 100003;
+    std::vector<std::atomic<UINT>> visits(COUNT);
+    for (auto&& v : visits) v.store(0);
+    pool.parallelFor(COUNT, 64, [&](UINT begin, UINT end) {
+        for (UINT i = begin; i < end; i++) visits[i].fetch_add(1);
+    });
+    for (UINT i = 0; i < COUNT; i++) ASSERT_EQ(visits[i].load(), 1u) << i;
+}
+
+//͈͕͂̑傫𒴂AŌゾZȂ
+TEST(WorkerPoolTest, RangesRespectGrainSize) {
+    WorkerPool pool(2);
+    std::mutex mutex;
+    std::vector<std::pair<UINT, UINT>> ranges;
+    pool.parallelFor(1000, 128, [&](UINT begin, UINT end) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ranges.emplace_back(begin, end);
+    });
+    std::sort(ranges.begin(), ranges.end());
+    ASSERT_EQ(ranges.size(), 8u);
+    for (size_t i = 0; i < ranges.size(); i++) {
+        EXPECT_EQ(ranges[i].first, i * 128);
+        EXPECT_EQ(ranges[i].second, std::min<UINT>(static_cast<UINT>(i + 1) * 128, 1000));
+    }
+}
+
+//قǂ̗ʂȂΌĂяõXbhňxɏ
+TEST(WorkerPoolTest, SmallLoopRunsInline) {
+    WorkerPool pool(2);
+    const std::thread::id caller = std::this_thread::get_id();
+    UINT calls = 0;
+    pool.parallelFor(10, 64, [&](UINT begin, UINT end) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 10u);
+        calls++;
+    });
+    EXPECT_EQ(calls, 1u);
+    pool.parallelFor(0, 1, [&](UINT, UINT) { calls++; });
+    EXPECT_EQ(calls, 1u);
+}
+
+//ĂяoɎQAʂ͒ƈv
+TEST(WorkerPoolTest, CallerParticipates) {
+    WorkerPool pool(1);
+    UINT64 sum = 0;
+    std::mutex mutex;
+    pool.parallelFor(1000, 10, [&](UINT begin, UINT end) {
+        UINT64 local = 0;
+        for (UINT i = begin; i < end; i++) local += i;
+        std::lock_guard<std::mutex> lock(mutex);
+        sum += local;
+    });
+    EXPECT_EQ(sum, 999u * 1000u / 2u);
+    EXPECT_EQ(pool.getThreadCount(), 2u);
+}
+
+//ĉx[v񂵂Ă肱ڂȂ
+TEST(WorkerPoolTest, RepeatedLoopsComplete) {
+    WorkerPool pool(3);
+    std::atomic<UINT64> total{ 0 };
+    for (UINT loop = 0; loop < 500; loop++) {
+        pool.parallelFor(257, 16, [&](UINT begin, UINT end) { total.fetch_add(end - begin); });
+    }
+    EXPECT_EQ(total.load(), 500u * 257u);
+}